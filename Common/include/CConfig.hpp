@@ -412,6 +412,10 @@ private:
   unsigned long TimeIter;           /*!< \brief Current time iterations for multizone problems. */
   long Unst_RestartIter;            /*!< \brief Iteration number to restart an unsteady simulation (Dual time Method). */
   long Unst_AdjointIter;            /*!< \brief Iteration number to begin the reverse time integration in the direct solver for the unsteady adjoint. */
+  bool Unst_Checkpointing;          /*!< \brief Recompute the primal states of the unsteady adjoint from checkpoints. */
+  unsigned long Unst_Checkpoints_Memory, /*!< \brief Number of primal snapshots kept in memory. */
+  Unst_Checkpoints_Disk;            /*!< \brief Number of primal snapshots written to disk. */
+  string Unst_Checkpoints_FileName; /*!< \brief Base name of the snapshot files. */
   long Iter_Avg_Objective;          /*!< \brief Iteration the number of time steps to be averaged, counting from the back */
   long Dyn_RestartIter;             /*!< \brief Iteration number to restart a dynamic structural analysis. */
   su2double PhysicalTime;           /*!< \brief Physical time at the current iteration in the solver for unsteady problems. */
@@ -584,7 +588,19 @@ private:
   unsigned long Deform_Linear_Solver_Iter;       /*!< \brief Max iterations of the linear solver for the implicit formulation. */
   unsigned long Linear_Solver_Restart_Frequency; /*!< \brief Restart frequency of the linear solver for the implicit formulation. */
   unsigned long Linear_Solver_Prec_Threads;      /*!< \brief Number of threads per rank for ILU and LU_SGS preconditioners. */
+  unsigned short Kind_Linear_Solver_Prec_Schedule; /*!< \brief Thread-parallel strategy of the ILU and LU_SGS preconditioners. */
+  bool Linear_Solver_Mixed_Precision;           /*!< \brief Use float inner solves with iterative refinement in double. */
   unsigned short Linear_Solver_ILU_n;            /*!< \brief ILU fill=in level. */
+  unsigned short Linear_Solver_AMG_Levels;       /*!< \brief Maximum number of levels of the AMG preconditioner. */
+  unsigned short Linear_Solver_AMG_Sweeps;       /*!< \brief Number of pre- and post-smoothing sweeps of the AMG preconditioner. */
+  su2double Linear_Solver_AMG_Strength;          /*!< \brief Strength of connection threshold for AMG aggregation. */
+  bool NewtonKrylov;                             /*!< \brief Use the Jacobian-free Newton-Krylov method for the flow equations. */
+  unsigned long NewtonKrylov_StartupIter;        /*!< \brief Number of standard iterations before the Newton-Krylov ones. */
+  unsigned long NewtonKrylov_Iter;               /*!< \brief Max Krylov iterations per Newton step. */
+  su2double NewtonKrylov_StartupResidual;        /*!< \brief Residual reduction required before the Newton-Krylov iterations. */
+  su2double NewtonKrylov_ForcingMax;             /*!< \brief Upper bound of the forcing term (relative linear tolerance). */
+  su2double NewtonKrylov_FDStep;                 /*!< \brief Relative step of the finite difference Jacobian-vector products. */
+  su2double NewtonKrylov_LineSearchMin;          /*!< \brief Minimum step length factor of the line search. */
   su2double SemiSpan;                   /*!< \brief Wing Semi span. */
   su2double Roe_Kappa;                  /*!< \brief Relaxation of the Roe scheme. */
   su2double Relaxation_Factor_Adjoint;  /*!< \brief Relaxation coefficient for variable updates of adjoint solvers. */
@@ -731,6 +747,7 @@ private:
   unsigned short Analytical_Surface;  /*!< \brief Information about the analytical definition of the surface for grid adaptation. */
   unsigned short Geo_Description;     /*!< \brief Description of the geometry. */
   unsigned short Mesh_FileFormat;     /*!< \brief Mesh input format. */
+  unsigned short Mesh_Out_FileFormat; /*!< \brief Mesh output format. */
   unsigned short Tab_FileFormat;      /*!< \brief Format of the output files. */
   unsigned short ActDisk_Jump;        /*!< \brief Format of the output files. */
   unsigned long StartWindowIteration; /*!< \brief Starting Iteration for long time Windowing apporach . */
@@ -980,10 +997,12 @@ private:
   unsigned short Kind_Interpolation;         /*!< \brief type of interpolation to use for FSI applications. */
   bool ConservativeInterpolation;            /*!< \brief Conservative approach for non matching mesh interpolation. */
   unsigned short NumNearestNeighbors;        /*!< \brief Number of neighbors used for Nearest Neighbor interpolation. */
+  bool DistributedDonorSearch;               /*!< \brief Exchange only nearby donors when setting up interpolators. */
   unsigned short Kind_RadialBasisFunction;   /*!< \brief type of radial basis function to use for radial basis FSI. */
   bool RadialBasisFunction_PolynomialOption; /*!< \brief Option of whether to include polynomial terms in Radial Basis Function Interpolation or not. */
   su2double RadialBasisFunction_Parameter;   /*!< \brief Radial basis function parameter (radius). */
   su2double RadialBasisFunction_PruneTol;    /*!< \brief Tolerance to prune the RBF interpolation matrix. */
+  bool RadialBasisFunction_Sparse;           /*!< \brief Use the sparse (iterative) method for compactly supported RBF. */
   bool Prestretch;                           /*!< \brief Read a reference geometry for optimization purposes. */
   string Prestretch_FEMFileName;             /*!< \brief File name for reference geometry. */
   string FEA_FileName;              /*!< \brief File name for element-based properties. */
@@ -1021,6 +1040,14 @@ private:
   array<su2double, N_POLY_COEFFS> default_cp_polycoeffs{{0.0}};  /*!< \brief Array for specific heat polynomial coefficients. */
   array<su2double, N_POLY_COEFFS> default_mu_polycoeffs{{0.0}};  /*!< \brief Array for viscosity polynomial coefficients. */
   array<su2double, N_POLY_COEFFS> default_kt_polycoeffs{{0.0}};  /*!< \brief Array for thermal conductivity polynomial coefficients. */
+  array<su2double,2> default_lut_range{{0.0}};  /*!< \brief Default (automatic) ranges of the fluid model look-up table. */
+  bool LUT_FluidModel;                  /*!< \brief Evaluate the fluid model by interpolation in a look-up table. */
+  unsigned long LUT_nNodes_Density,     /*!< \brief Number of look-up table nodes in the density direction. */
+  LUT_nNodes_Energy,                    /*!< \brief Number of look-up table nodes in the energy direction. */
+  LUT_Error_Sampling;                   /*!< \brief Frequency of the comparisons between table and exact model. */
+  su2double *LUT_Density_Range,         /*!< \brief Density range of the look-up table. */
+  *LUT_Temperature_Range;               /*!< \brief Temperature range of the look-up table. */
+  string LUT_FileName;                  /*!< \brief File where the look-up table is loaded from or saved to. */
   su2double *ExtraRelFacGiles;          /*!< \brief coefficient for extra relaxation factor for Giles BC*/
   bool Body_Force;                      /*!< \brief Flag to know if a body force is included in the formulation. */
   su2double *Body_Force_Vector;         /*!< \brief Values of the prescribed body force vector. */
@@ -1112,6 +1139,12 @@ private:
   unsigned long VolumeWrtFreq;        /*!< \brief Writing frequency for solution files. */
   unsigned short* VolumeOutputFiles;  /*!< \brief File formats to output */
   unsigned short nVolumeOutputFiles;  /*!< \brief Number of File formats to output */
+  bool Output_Async;                  /*!< \brief Write the volume output files on a background thread. */
+  bool Performance_Trace;             /*!< \brief Record a timeline of the main routines (Chrome trace format). */
+  string Performance_Trace_FileName;  /*!< \brief Name of the performance trace file. */
+  unsigned long Performance_Trace_Buffer; /*!< \brief Maximum number of trace events recorded by each thread. */
+  bool Load_Balance_Report;           /*!< \brief Write the per-rank partition and compute/wait time reports. */
+  string Load_Balance_FileName;       /*!< \brief Prefix of the load balance report files. */
 
   bool Multizone_Mesh;            /*!< \brief Determines if the mesh contains multiple zones. */
   bool SinglezoneDriver;          /*!< \brief Determines if the single-zone driver is used. (TEMPORARY) */
@@ -1152,6 +1185,7 @@ private:
   bool frozen,                              /*!< \brief Flag for determining if mixture is frozen. */
   ionization,                               /*!< \brief Flag for determining if free electron gas is in the mixture. */
   vt_transfer_res_limit,                    /*!< \brief Flag for determining if residual limiting for source term VT-transfer is used. */
+  point_implicit_source,                    /*!< \brief Flag for the point-implicit treatment of the chemistry and VT-transfer sources. */
   monoatomic;                               /*!< \brief Flag for monoatomic mixture. */
   string GasModel,                          /*!< \brief Gas Model. */
   *Wall_Catalytic;                          /*!< \brief Pointer to catalytic walls. */
@@ -2975,6 +3009,26 @@ public:
    */
   long GetUnst_AdjointIter(void) const { return Unst_AdjointIter; }
 
+  /*!
+   * \brief Check if the primal states of the unsteady adjoint are recomputed (checkpointing) instead of read.
+   */
+  bool GetUnst_Checkpointing(void) const { return Unst_Checkpointing; }
+
+  /*!
+   * \brief Get the number of primal snapshots kept in memory for checkpointing.
+   */
+  unsigned long GetnUnst_Checkpoints_Memory(void) const { return Unst_Checkpoints_Memory; }
+
+  /*!
+   * \brief Get the number of primal snapshots written to disk for checkpointing.
+   */
+  unsigned long GetnUnst_Checkpoints_Disk(void) const { return Unst_Checkpoints_Disk; }
+
+  /*!
+   * \brief Get the base name of the checkpointing snapshot files.
+   */
+  const string& GetUnst_Checkpoints_FileName(void) const { return Unst_Checkpoints_FileName; }
+
   /*!
    * \brief Number of iterations to average (reverse time integration).
    * \return Starting direct iteration number for the unsteady adjoint.
@@ -3713,6 +3767,44 @@ public:
    */
   su2double GetAcentric_Factor(void) const { return Acentric_Factor; }
 
+  /*!
+   * \brief Check if the fluid model is evaluated via a look-up table.
+   * \return <code>TRUE</code> if the thermodynamic states are interpolated from a table.
+   */
+  bool GetLUT_FluidModel(void) const { return LUT_FluidModel; }
+
+  /*!
+   * \brief Get the number of look-up table nodes in the density direction.
+   */
+  unsigned long GetLUT_nNodes_Density(void) const { return LUT_nNodes_Density; }
+
+  /*!
+   * \brief Get the number of look-up table nodes in the energy direction.
+   */
+  unsigned long GetLUT_nNodes_Energy(void) const { return LUT_nNodes_Energy; }
+
+  /*!
+   * \brief Get the density range of the look-up table (dimensional, zeros for automatic).
+   * \param[in] val_index - 0 for the minimum, 1 for the maximum.
+   */
+  su2double GetLUT_Density_Range(unsigned short val_index) const { return LUT_Density_Range[val_index]; }
+
+  /*!
+   * \brief Get the temperature range of the look-up table (dimensional, zeros for automatic).
+   * \param[in] val_index - 0 for the minimum, 1 for the maximum.
+   */
+  su2double GetLUT_Temperature_Range(unsigned short val_index) const { return LUT_Temperature_Range[val_index]; }
+
+  /*!
+   * \brief Get the name of the file where the look-up table is stored.
+   */
+  string GetLUT_FileName(void) const { return LUT_FileName; }
+
+  /*!
+   * \brief Get how often (in number of evaluations) the look-up table is compared with the exact model.
+   */
+  unsigned long GetLUT_Error_Sampling(void) const { return LUT_Error_Sampling; }
+
   /*!
    * \brief Get the value of the viscosity model.
    * \return Viscosity model.
@@ -3982,6 +4074,59 @@ public:
    */
   unsigned short GetLinear_Solver_ILU_n(void) const { return Linear_Solver_ILU_n; }
 
+  /*!
+   * \brief Get the maximum number of levels of the AMG preconditioner.
+   * \return Maximum number of levels (including the finest).
+   */
+  unsigned short GetLinear_Solver_AMG_Levels(void) const { return Linear_Solver_AMG_Levels; }
+
+  /*!
+   * \brief Get the number of pre- and post-smoothing sweeps of the AMG preconditioner.
+   * \return Number of smoothing sweeps per level.
+   */
+  unsigned short GetLinear_Solver_AMG_Sweeps(void) const { return Linear_Solver_AMG_Sweeps; }
+
+  /*!
+   * \brief Get the strength of connection threshold used to form the AMG aggregates.
+   * \return Strength threshold, relative to the diagonal blocks.
+   */
+  su2double GetLinear_Solver_AMG_Strength(void) const { return Linear_Solver_AMG_Strength; }
+
+  /*!
+   * \brief Check if the flow equations are solved with the Jacobian-free Newton-Krylov method.
+   */
+  bool GetNewtonKrylov(void) const { return NewtonKrylov; }
+
+  /*!
+   * \brief Get the number of standard (defect-correction) iterations before switching to Newton-Krylov.
+   */
+  unsigned long GetNewtonKrylov_StartupIter(void) const { return NewtonKrylov_StartupIter; }
+
+  /*!
+   * \brief Get the reduction of the residuals (orders of magnitude) required before switching to Newton-Krylov.
+   */
+  su2double GetNewtonKrylov_StartupResidual(void) const { return NewtonKrylov_StartupResidual; }
+
+  /*!
+   * \brief Get the maximum number of Krylov iterations per Newton step.
+   */
+  unsigned long GetNewtonKrylov_Iter(void) const { return NewtonKrylov_Iter; }
+
+  /*!
+   * \brief Get the upper bound of the (Eisenstat-Walker) forcing term of the Newton steps.
+   */
+  su2double GetNewtonKrylov_ForcingMax(void) const { return NewtonKrylov_ForcingMax; }
+
+  /*!
+   * \brief Get the relative step of the finite difference Jacobian-vector products.
+   */
+  su2double GetNewtonKrylov_FDStep(void) const { return NewtonKrylov_FDStep; }
+
+  /*!
+   * \brief Get the minimum step length factor of the backtracking line search (1 disables it).
+   */
+  su2double GetNewtonKrylov_LineSearchMin(void) const { return NewtonKrylov_LineSearchMin; }
+
   /*!
    * \brief Get restart frequency of the linear solver for the implicit formulation.
    * \return Restart frequency of the linear solver for the implicit formulation.
@@ -5145,6 +5290,11 @@ public:
    */
   bool GetVTTransferResidualLimiting(void) const { return vt_transfer_res_limit; }
 
+  /*!
+   * \brief Indicates whether the Jacobians of the chemistry and VT-transfer sources are added to the implicit system.
+   */
+  bool GetPointImplicitSource(void) const { return point_implicit_source; }
+
   /*!
    * \brief Indicates if mixture is monoatomic.
    */
@@ -5201,6 +5351,12 @@ public:
    */
   unsigned short GetMesh_FileFormat(void) const { return Mesh_FileFormat; }
 
+  /*!
+   * \brief Get the format of the output grid (SU2 or SU2_BINARY).
+   * \return Format of the output grid.
+   */
+  unsigned short GetMesh_Out_FileFormat(void) const { return Mesh_Out_FileFormat; }
+
   /*!
    * \brief Get the format of the output solution.
    * \return Format of the output solution.
@@ -8699,11 +8855,21 @@ public:
    */
   su2double GetRadialBasisFunctionPruneTol(void) const { return RadialBasisFunction_PruneTol; }
 
+  /*!
+   * \brief Check if the RBF interpolation coefficients are computed with the sparse method.
+   */
+  bool GetRadialBasisFunctionSparse(void) const { return RadialBasisFunction_Sparse; }
+
   /*!
    * \brief Get the number of donor points to use in Nearest Neighbor interpolation.
    */
   unsigned short GetNumNearestNeighbors(void) const { return NumNearestNeighbors; }
 
+  /*!
+   * \brief Check if the donor points of interface interpolators are distributed by proximity to the targets.
+   */
+  bool GetDistributedDonorSearch(void) const { return DistributedDonorSearch; }
+
   /*!
    * \brief Get the kind of inlet face interpolation function to use.
    */
@@ -9190,6 +9356,36 @@ public:
    */
   unsigned long GetVolume_Wrt_Freq() const { return VolumeWrtFreq; }
 
+  /*!
+   * \brief Get whether the volume output files are written asynchronously (on a background thread).
+   */
+  bool GetOutput_Async() const { return Output_Async; }
+
+  /*!
+   * \brief Get whether a performance trace (timeline of the main routines) is recorded.
+   */
+  bool GetPerformance_Trace() const { return Performance_Trace; }
+
+  /*!
+   * \brief Get the name of the performance trace file.
+   */
+  const string& GetPerformance_Trace_FileName() const { return Performance_Trace_FileName; }
+
+  /*!
+   * \brief Get the maximum number of trace events recorded by each thread.
+   */
+  unsigned long GetPerformance_Trace_Buffer() const { return Performance_Trace_Buffer; }
+
+  /*!
+   * \brief Get whether the per-rank load balance (partition and compute/wait time) reports are written.
+   */
+  bool GetLoad_Balance_Report() const { return Load_Balance_Report; }
+
+  /*!
+   * \brief Get the prefix of the load balance report files.
+   */
+  const string& GetLoad_Balance_FileName() const { return Load_Balance_FileName; }
+
   /*!
    * \brief GetVolumeOutputFiles
    */
@@ -9237,6 +9433,18 @@ public:
    */
   unsigned long GetLinear_Solver_Prec_Threads(void) const { return Linear_Solver_Prec_Threads; }
 
+  /*!
+   * \brief Get the thread-parallel strategy of the ILU and LU_SGS preconditioners.
+   * \return Partitions or level scheduling.
+   */
+  unsigned short GetKind_Linear_Solver_Prec_Schedule(void) const { return Kind_Linear_Solver_Prec_Schedule; }
+
+  /*!
+   * \brief Get whether the linear systems are solved in mixed precision (float inner solves, double refinement).
+   * \return <code>TRUE</code> if mixed precision is used.
+   */
+  bool GetLinear_Solver_Mixed_Precision(void) const { return Linear_Solver_Mixed_Precision; }
+
   /*!
    * \brief Get the size of the edge groups colored for OpenMP parallelization of edge loops.
    */
@@ -75,6 +75,21 @@ public:
                               coor, dist, pointID, rankID);
   }
 
+  /*!
+   * \brief Function, which determines the nodes in the ADT within a given distance of a coordinate.
+   * \note Only valid for local trees, as the ranks of the nodes are not returned.
+   * \param[in]  coor    Coordinate of the center of the search.
+   * \param[in]  radius  Search radius.
+   * \param[out] pointID Local point IDs of the nodes found, in no particular order.
+   */
+  inline void DetermineNodesWithinRadius(const su2double *coor,
+                                         su2double       radius,
+                                         vector<unsigned long> &pointID) {
+    const auto iThread = omp_get_thread_num();
+    DetermineNodesWithinRadius_impl(FrontLeaves[iThread], FrontLeavesNew[iThread],
+                                    coor, radius, pointID);
+  }
+
   /*!
    * \brief Default constructor of the class, disabled.
    */
@@ -91,4 +106,14 @@ private:
                                  su2double       &dist,
                                  unsigned long   &pointID,
                                  int             &rankID) const;
+
+  /*!
+   * \brief Implementation of DetermineNodesWithinRadius.
+   * \note Working variables (first two) passed explicitly for thread safety.
+   */
+  void DetermineNodesWithinRadius_impl(vector<unsigned long>& frontLeaves,
+                                       vector<unsigned long>& frontLeavesNew,
+                                       const su2double *coor,
+                                       su2double       radius,
+                                       vector<unsigned long> &pointID) const;
 };
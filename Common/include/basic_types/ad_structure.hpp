@@ -261,6 +261,28 @@ namespace AD{
    */
   inline void EndPassive(bool wasActive) {}
 
+  /*!
+   * \brief Initialize the AD tool (OpenMP support), call once after MPI and OpenMP are setup.
+   */
+  inline void Initialize() {}
+
+  /*!
+   * \brief Finalize the AD tool, call once before MPI is finalized.
+   */
+  inline void Finalize() {}
+
+  /*!
+   * \brief Declare that the adjoints being updated by each thread are not read by other threads
+   *        (e.g. in edge loops over a coloring) so that they can be updated without atomics.
+   * \note Must be called by all threads of the parallel region, outside worksharing constructs.
+   */
+  inline void StartNoSharedReading() {}
+
+  /*!
+   * \brief Return to the default (atomic) update of the adjoints, see StartNoSharedReading.
+   */
+  inline void EndNoSharedReading() {}
+
 #else
   using CheckpointHandler = codi::DataStore;
 
@@ -270,6 +292,11 @@ namespace AD{
 
   extern ExtFuncHelper* FuncHelper;
 
+#ifdef HAVE_OPDI
+  /*--- External functions are recorded by all threads (e.g. the linear solver), each on its own tape. ---*/
+  #pragma omp threadprivate(FuncHelper)
+#endif
+
   /*--- Stores the indices of the input variables (they might be overwritten) ---*/
 
   extern std::vector<su2double::GradientData> inputValues;
@@ -278,9 +305,9 @@ namespace AD{
 
   extern int adjointVectorPosition;
 
-  /*--- Reference to the tape ---*/
+  /*--- Access to the tape (of the calling thread when OpenMP is used) ---*/
 
-  extern su2double::TapeType& globalTape;
+  FORCEINLINE su2double::TapeType& getGlobalTape() { return su2double::getGlobalTape(); }
 
   extern bool Status;
 
@@ -298,44 +325,60 @@ namespace AD{
 
   extern codi::PreaccumulationHelper<su2double> PreaccHelper;
 
+#ifdef HAVE_OPDI
+  /*--- Preaccumulation happens inside parallel regions, each thread needs its own. The bookkeeping of
+   *    inputs and tape positions refers to the tape of the thread that recorded it, so it is private too. ---*/
+  #pragma omp threadprivate(PreaccActive, PreaccHelper, inputValues, adjointVectorPosition, \
+                            StartPosition, EndPosition, TapePositions, localInputValues, localOutputValues)
+#endif
+
   FORCEINLINE void RegisterInput(su2double &data, bool push_index = true) {
-    AD::globalTape.registerInput(data);
+    AD::getGlobalTape().registerInput(data);
     if (push_index) {
       inputValues.push_back(data.getGradientData());
     }
   }
 
-  FORCEINLINE void RegisterOutput(su2double& data) {AD::globalTape.registerOutput(data);}
+  FORCEINLINE void RegisterOutput(su2double& data) {AD::getGlobalTape().registerOutput(data);}
 
   FORCEINLINE void ResetInput(su2double &data) {data.getGradientData() = su2double::GradientData();}
 
-  FORCEINLINE void StartRecording() {AD::globalTape.setActive();}
+  FORCEINLINE void StartRecording() {AD::getGlobalTape().setActive();}
 
-  FORCEINLINE void StopRecording() {AD::globalTape.setPassive();}
+  FORCEINLINE void StopRecording() {AD::getGlobalTape().setPassive();}
 
-  FORCEINLINE bool TapeActive() { return AD::globalTape.isActive(); }
+  FORCEINLINE bool TapeActive() { return AD::getGlobalTape().isActive(); }
 
-  FORCEINLINE void PrintStatistics() {AD::globalTape.printStatistics();}
+  FORCEINLINE void PrintStatistics() {AD::getGlobalTape().printStatistics();}
 
-  FORCEINLINE void ClearAdjoints() {AD::globalTape.clearAdjoints(); }
+  FORCEINLINE void ClearAdjoints() {AD::getGlobalTape().clearAdjoints(); }
 
-  FORCEINLINE void ComputeAdjoint() {AD::globalTape.evaluate(); adjointVectorPosition = 0;}
+  FORCEINLINE void ComputeAdjoint() {AD::getGlobalTape().evaluate(); adjointVectorPosition = 0;}
 
   FORCEINLINE void ComputeAdjoint(unsigned short enter, unsigned short leave) {
-    AD::globalTape.evaluate(TapePositions[enter], TapePositions[leave]);
+    AD::getGlobalTape().evaluate(TapePositions[enter], TapePositions[leave]);
     if (leave == 0)
       adjointVectorPosition = 0;
   }
 
   FORCEINLINE void Reset() {
-    globalTape.reset();
-    if (inputValues.size() != 0) {
+    getGlobalTape().reset();
+    auto clearBookkeeping = []() {
       adjointVectorPosition = 0;
       inputValues.clear();
-    }
-    if (TapePositions.size() != 0) {
       TapePositions.clear();
+      localInputValues.clear();
+      localOutputValues.clear();
+    };
+#ifdef HAVE_OPDI
+    /*--- Clear the private copies of all threads (when called from a serial context). ---*/
+    if (!omp_in_parallel()) {
+      #pragma omp parallel
+      clearBookkeeping();
+      return;
     }
+#endif
+    clearBookkeeping();
   }
 
   FORCEINLINE void SetIndex(int &index, const su2double &data) {
@@ -343,11 +386,11 @@ namespace AD{
   }
 
   FORCEINLINE void SetDerivative(int index, const double val) {
-    AD::globalTape.setGradient(index, val);
+    AD::getGlobalTape().setGradient(index, val);
   }
 
   FORCEINLINE double GetDerivative(int index) {
-    return AD::globalTape.getGradient(index);
+    return AD::getGlobalTape().getGradient(index);
   }
 
   /*--- Base case for parameter pack expansion. ---*/
@@ -397,7 +440,7 @@ namespace AD{
   }
 
   FORCEINLINE void StartPreacc() {
-    if (globalTape.isActive() && PreaccEnabled) {
+    if (getGlobalTape().isActive() && PreaccEnabled) {
       PreaccHelper.start();
       PreaccActive = true;
     }
@@ -438,7 +481,7 @@ namespace AD{
   }
 
   FORCEINLINE void Push_TapePosition() {
-    TapePositions.push_back(AD::globalTape.getPosition());
+    TapePositions.push_back(AD::getGlobalTape().getPosition());
   }
 
   FORCEINLINE void EndPreacc(){
@@ -478,7 +521,7 @@ namespace AD{
   }
 
   FORCEINLINE void SetExtFuncOut(su2double& data) {
-    if (globalTape.isActive()) {
+    if (getGlobalTape().isActive()) {
       FuncHelper->addOutput(data);
     }
   }
@@ -486,7 +529,7 @@ namespace AD{
   template<class T>
   FORCEINLINE void SetExtFuncOut(T&& data, const int size) {
     for (int i = 0; i < size; i++) {
-      if (globalTape.isActive()) {
+      if (getGlobalTape().isActive()) {
         FuncHelper->addOutput(data[i]);
       }
     }
@@ -496,7 +539,7 @@ namespace AD{
   FORCEINLINE void SetExtFuncOut(T&& data, const int size_x, const int size_y) {
     for (int i = 0; i < size_x; i++) {
       for (int j = 0; j < size_y; j++) {
-        if (globalTape.isActive()) {
+        if (getGlobalTape().isActive()) {
           FuncHelper->addOutput(data[i][j]);
         }
       }
@@ -511,7 +554,7 @@ namespace AD{
   FORCEINLINE void EndExtFunc() { delete FuncHelper; }
 
   FORCEINLINE bool BeginPassive() {
-    if(AD::globalTape.isActive()) {
+    if(AD::getGlobalTape().isActive()) {
       StopRecording();
       return true;
     }
@@ -520,6 +563,24 @@ namespace AD{
 
   FORCEINLINE void EndPassive(bool wasActive) { if(wasActive) StartRecording(); }
 
+  void Initialize();
+
+  void Finalize();
+
+  FORCEINLINE void StartNoSharedReading() {
+#ifdef HAVE_OPDI
+    opdi::logic->setAdjointAccessMode(opdi::LogicInterface::AdjointAccessMode::Classical);
+    opdi::logic->addReverseBarrier();
+#endif
+  }
+
+  FORCEINLINE void EndNoSharedReading() {
+#ifdef HAVE_OPDI
+    opdi::logic->addReverseBarrier();
+    opdi::logic->setAdjointAccessMode(opdi::LogicInterface::AdjointAccessMode::Atomic);
+#endif
+  }
+
 #endif // CODI_REVERSE_TYPE
 
 } // namespace AD
@@ -80,7 +80,17 @@ using su2enable_if = typename std::enable_if<condition,bool>::type;
 #define CODI_PRIMAL_INDEX_TAPE 0
 #endif
 
-#if CODI_INDEX_TAPE
+#if defined(HAVE_OPDI)
+/*--- Thread-safe tape for OpenMP, the parallel constructs are recorded by OpDiLib. ---*/
+#if CODI_PRIMAL_TAPE || CODI_PRIMAL_INDEX_TAPE
+#error "Primal value tapes are not supported with OpenMP (HAVE_OPDI)."
+#endif
+#include <omp.h>
+#include "opdi.hpp"
+#include "codi/tools/parallel/openmp/codiOpenMP.hpp"
+#include "codi/tools/parallel/openmp/codiOpDiLibTool.hpp"
+using su2double = codi::RealReverseIndexOpenMP;
+#elif CODI_INDEX_TAPE
 using su2double = codi::RealReverseIndex;
 #elif CODI_PRIMAL_TAPE
 using su2double = codi::RealReversePrimal;
@@ -111,6 +121,12 @@ using su2mixedfloat = float;
 using su2mixedfloat = passivedouble;
 #endif
 
+/*--- When the linear algebra is in passive double, float versions of its classes
+ * are also built, to allow lower precision to be selected at runtime. ---*/
+#if !defined(USE_MIXED_PRECISION) && !defined(CODI_FORWARD_TYPE) && !defined(CODI_REVERSE_TYPE)
+#define USE_RUNTIME_MIXED_PRECISION
+#endif
+
 /*!
  * \namespace SU2_TYPE
  * \brief Namespace for defining the datatype wrapper routines, this acts as a base
@@ -174,11 +190,11 @@ namespace SU2_TYPE {
 
 #ifdef CODI_REVERSE_TYPE
   FORCEINLINE passivedouble GetSecondary(const su2double& data) {
-    return AD::globalTape.getGradient(AD::inputValues[AD::adjointVectorPosition++]);
+    return AD::getGlobalTape().getGradient(AD::inputValues[AD::adjointVectorPosition++]);
   }
 
   FORCEINLINE passivedouble GetDerivative(const su2double& data) {
-    return AD::globalTape.getGradient(AD::inputValues[AD::adjointVectorPosition++]);
+    return AD::getGlobalTape().getGradient(AD::inputValues[AD::adjointVectorPosition++]);
   }
 #else // forward
   FORCEINLINE passivedouble GetSecondary(const su2double& data) {return data.getGradient();}
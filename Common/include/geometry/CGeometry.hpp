@@ -282,6 +282,15 @@ public:
    */
   void PreprocessP2PComms(CGeometry *geometry, CConfig *config);
 
+  /*!
+   * \brief Gather the partition statistics of all ranks (owned and halo points, edges, elements, neighbors,
+   *        data sent per halo exchange), print a summary of their imbalance and optionally write them to file.
+   * \note Must be called by all ranks after PreprocessP2PComms.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] nVar - Number of variables exchanged per point (used to estimate the bytes per halo exchange).
+   */
+  void ComputePartitionStatistics(const CConfig *config, unsigned short nVar) const;
+
   /*!
    * \brief Routine to allocate buffers for point-to-point MPI communications. Also called to dynamically reallocate if not enough memory is found for comms during runtime.
    * \param[in] val_countPerPoint - Maximum count of the data type per vertex in point-to-point comms, e.g., nPrimvarGrad*nDim.
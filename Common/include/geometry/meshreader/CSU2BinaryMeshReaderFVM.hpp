@@ -0,0 +1,119 @@
+/*!
+ * \file CSU2BinaryMeshReaderFVM.hpp
+ * \brief Header file for the class CSU2BinaryMeshReaderFVM.
+ *        The implementations are in the <i>CSU2BinaryMeshReaderFVM.cpp</i> file.
+ * \author SU2 Developers
+ * \version 7.1.0 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+
+#include "CMeshReaderFVM.hpp"
+
+/*!
+ * \class CSU2BinaryMeshReaderFVM
+ * \brief Reads a native SU2 binary grid into linear partitions for the finite volume solver (FVM).
+ * \note The file contains a single zone, all integers are 64-bit and all data is stored in native byte order:
+ *       - Header (index) of SU2_BINARY_MESH_HEADER integers: magic number, version, dimension, number of points,
+ *         number of elements, number of markers, byte offsets of the point, element and marker sections, reserved.
+ *       - Points: coordinates as doubles, point by point in global index order.
+ *       - Elements: records of SU2_BINARY_ELEM_SIZE integers [vtkType n0 ... n7], the global ID is the record index.
+ *       - Markers: for each marker the name length and the number of elements, the name (not null-terminated), and
+ *         records of SU2_BINARY_BOUND_SIZE integers [vtkType n0 ... n3].
+ *       Each rank reads the points and elements of its linear partition with collective MPI I/O, the elements
+ *       are then sent to all ranks that own at least one of their points. Only the master reads the markers.
+ * \author SU2 Developers
+ */
+class CSU2BinaryMeshReaderFVM: public CMeshReaderFVM {
+
+private:
+
+  string meshFilename; /*!< \brief Name of the SU2 binary mesh file being read. */
+
+#ifdef HAVE_MPI
+  MPI_File mesh_file;  /*!< \brief File handle for the SU2 binary mesh file. */
+#else
+  FILE* mesh_file;     /*!< \brief File handle for the SU2 binary mesh file. */
+#endif
+
+  uint64_t pointOffset = 0;   /*!< \brief Byte offset of the point coordinates in the file. */
+  uint64_t elementOffset = 0; /*!< \brief Byte offset of the volume elements in the file. */
+  uint64_t markerOffset = 0;  /*!< \brief Byte offset of the markers in the file. */
+
+  /*!
+   * \brief Collectively read an array from the file, every rank reads its own chunk.
+   * \param[in] offset - Position of the chunk of this rank in the file (in bytes).
+   * \param[out] data - Where to store the data.
+   * \param[in] count - Number of entries to read on this rank.
+   */
+  template<class T>
+  void ReadBinaryDataAll(uint64_t offset, T* data, unsigned long count);
+
+  /*!
+   * \brief Read an array from the file on the calling rank only.
+   * \param[in] offset - Position of the data in the file (in bytes).
+   * \param[out] data - Where to store the data.
+   * \param[in] count - Number of entries to read.
+   */
+  template<class T>
+  void ReadBinaryData(uint64_t offset, T* data, unsigned long count);
+
+  /*!
+   * \brief Reads the header of the SU2 binary mesh and checks for errors.
+   */
+  void ReadMetadata();
+
+  /*!
+   * \brief Reads the grid points of this rank's linear partition.
+   */
+  void ReadPointCoordinates();
+
+  /*!
+   * \brief Reads a linear partition of the volume elements and distributes them to the ranks that own their points.
+   */
+  void ReadVolumeElementConnectivity();
+
+  /*!
+   * \brief Reads the surface (boundary) elements on the master rank.
+   */
+  void ReadSurfaceElementConnectivity();
+
+public:
+
+  /*!
+   * \brief Constructor of the CSU2BinaryMeshReaderFVM class.
+   */
+  CSU2BinaryMeshReaderFVM(CConfig        *val_config,
+                          unsigned short val_iZone,
+                          unsigned short val_nZone);
+
+  /*!
+   * \brief Destructor of the CSU2BinaryMeshReaderFVM class.
+   */
+  ~CSU2BinaryMeshReaderFVM(void);
+
+};
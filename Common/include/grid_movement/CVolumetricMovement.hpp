@@ -31,6 +31,7 @@
 #include "../linear_algebra/CSysMatrix.hpp"
 #include "../linear_algebra/CSysVector.hpp"
 #include "../linear_algebra/CSysSolve.hpp"
+#include "../toolboxes/graph_toolbox.hpp"
 
 /*!
  * \class CVolumetricMovement
@@ -58,6 +59,27 @@ protected:
   CSysVector<su2double> LinSysSol;
   CSysVector<su2double> LinSysRes;
 
+  enum : size_t {OMP_MIN_SIZE = 32};  /*!< \brief Min chunk size for element loops (max is color group size). */
+  enum : size_t {OMP_MAX_SIZE = 512}; /*!< \brief Max chunk size for light point loops. */
+
+  unsigned long omp_chunk_size = OMP_MAX_SIZE;  /*!< \brief Chunk size used in light point loops. */
+
+#ifdef HAVE_OMP
+  vector<GridColor<> > ElemColoring;   /*!< \brief Element colors. */
+  bool LockStrategy = false;           /*!< \brief Whether to use an OpenMP lock to guard updates of the stiffness matrix. */
+  vector<omp_lock_t> UpdateLocks;      /*!< \brief Locks that may be used to protect accesses to CSysMatrix in element loops. */
+#else
+  array<DummyGridColor<>,1> ElemColoring;      /*--- Behaves like a normal integer type. ---*/
+  static constexpr bool LockStrategy = false;  /*--- Lock strategy is never needed for MPI-only. ---*/
+  DummyVectorOfLocks UpdateLocks;
+#endif
+
+  /*!
+   * \brief Set up the element coloring (or locks) for the thread-parallel assembly of the stiffness matrix.
+   * \param[in] geometry - Geometrical definition of the problem.
+   */
+  void HybridParallelInitialization(CGeometry* geometry);
+
 public:
 
   /*!
@@ -147,6 +147,14 @@ protected:
    */
   void ReconstructBoundary(unsigned long val_zone, int val_marker);
 
+  /*!
+   * \brief Gather the coordinates of the boundary vertices of all ranks, in the order of ReconstructBoundary.
+   * \param[in] val_zone   - index of the zone
+   * \param[in] val_marker - index of the marker
+   * \param[out] coord     - coordinates of the vertices, sized by the caller
+   */
+  void ReconstructBoundaryCoord(unsigned long val_zone, int val_marker, su2double* coord) const;
+
   /*!
    * \brief Determine array sizes used to collect and send coordinate and global point information.
    * \param[in] markDonor - Index of the boundary on the donor domain.
@@ -179,4 +187,74 @@ protected:
   unsigned long Collect_ElementInfo(int markDonor, unsigned short nDim, bool compress,
                                     vector<unsigned long>& allNumElem, vector<unsigned short>& numNodes,
                                     su2matrix<long>& idxNodes) const;
+
+  /*!
+   * \brief Collect the donor vertices of all ranks in compact form.
+   * \note Uses Determine_ArraySize and Collect_VertexInfo, Buffer_Receive_nVertex_Donor must be allocated.
+   * \param[in] markDonor - Index of the boundary on the donor domain.
+   * \param[in] markTarget - Index of the boundary on the target domain.
+   * \param[in] nVertexDonor - Number of vertices on the donor boundary.
+   * \param[in] nDim - number of physical dimensions.
+   * \param[out] coord - Coordinates of the donor vertices.
+   * \param[out] globalPoint - Global index of the donor vertices.
+   * \param[out] processor - Rank that owns each donor vertex.
+   * \return Number of donor vertices.
+   */
+  unsigned long Collect_VertexInfo(int markDonor, int markTarget, unsigned long nVertexDonor, unsigned short nDim,
+                                   su2activematrix& coord, vector<long>& globalPoint, vector<int>& processor);
+
+  /*!
+   * \brief Gather the bounding boxes of the vertices (owned by each rank) of a marker.
+   * \param[in] geometry - Donor or target geometry.
+   * \param[in] marker - Index of the boundary.
+   * \param[in] nDim - number of physical dimensions.
+   * \param[out] numVertex - Optionally, the number of owned vertices of each rank.
+   * \return One row per rank with the min then the max coordinates, empty boxes have min > max.
+   */
+  su2passivematrix Gather_BoundingBoxes(const CGeometry* geometry, int marker, unsigned short nDim,
+                                        vector<unsigned long>* numVertex = nullptr) const;
+
+  /*!
+   * \brief For each target rank, compute a distance from its bounding box that is guaranteed to contain
+   *        the "nDonor" closest donor vertices of any target point in the box.
+   * \note The distance is negative for ranks without target vertices.
+   * \param[in] targetBox - Bounding boxes of the target vertices, see Gather_BoundingBoxes.
+   * \param[in] donorBox - Bounding boxes of the donor vertices.
+   * \param[in] numDonor - Number of donor vertices of each rank.
+   * \param[in] nDonor - Number of closest donors needed.
+   */
+  static vector<passivedouble> DonorSearchRadius(const su2passivematrix& targetBox, const su2passivematrix& donorBox,
+                                                 const vector<unsigned long>& numDonor, unsigned long nDonor);
+
+  /*!
+   * \brief Send to each rank the donor vertices (owned by this rank) that are near its targets.
+   * \note This replaces the global gather of Collect_VertexInfo when only nearby donors are needed.
+   * \param[in] markDonor - Index of the boundary on the donor domain.
+   * \param[in] nDim - number of physical dimensions.
+   * \param[in] targetBox - Bounding boxes of the target vertices, see Gather_BoundingBoxes.
+   * \param[in] radius - Vertices within this distance from the box of a rank are sent to it, all are
+   *            sent if the radius is infinite, and none if it is negative.
+   * \param[out] coord - Coordinates of the received donor vertices.
+   * \param[out] globalPoint - Global index of the received donor vertices.
+   * \param[out] processor - Rank that owns each received donor vertex.
+   * \return Number of received donor vertices.
+   */
+  unsigned long Distribute_VertexInfo(int markDonor, unsigned short nDim, const su2passivematrix& targetBox,
+                                      const vector<passivedouble>& radius, su2activematrix& coord,
+                                      vector<long>& globalPoint, vector<int>& processor) const;
+
+  /*!
+   * \brief Send to each rank the donor elements with at least one node near its targets.
+   * \note Same criteria as Distribute_VertexInfo, elements on partition boundaries may be received more than once.
+   * \param[in] markDonor - Index of the boundary on the donor domain.
+   * \param[in] nDim - number of physical dimensions.
+   * \param[in] targetBox - Bounding boxes of the target vertices.
+   * \param[in] radius - Search distance for each rank.
+   * \param[out] numNodes - Number of nodes for each received element.
+   * \param[out] idxNodes - Index (global) of those nodes.
+   * \return Number of received donor elements.
+   */
+  unsigned long Distribute_ElementInfo(int markDonor, unsigned short nDim, const su2passivematrix& targetBox,
+                                       const vector<passivedouble>& radius, vector<unsigned short>& numNodes,
+                                       su2matrix<long>& idxNodes) const;
 };
@@ -32,7 +32,8 @@
  * \brief Nearest Neighbor(s) interpolation.
  * \note The closest k neighbors are used for IDW interpolation, the computational
  * cost of setting up the interpolation is O(N^2 log(k)), this can be improved
- * by using a kd-tree.
+ * by using a kd-tree. With DISTRIBUTED_DONOR_SEARCH each rank only receives the
+ * donors that can be among the closest to its targets.
  */
 class CNearestNeighbor final : public CInterpolator {
 private:
@@ -38,6 +38,9 @@ class CRadialBasisFunction final : public CInterpolator {
 private:
   unsigned long MinDonors = 0, AvgDonors = 0, MaxDonors = 0;
   passivedouble Density = 0.0, AvgCorrection = 0.0, MaxCorrection = 0.0;
+  bool Sparse = false;
+  passivedouble AvgIterations = 0.0;  /*!< \brief Avg. Krylov iterations per target point (sparse method). */
+  unsigned long NotConverged = 0;     /*!< \brief Krylov solves that did not converge (sparse method). */
 
 public:
   /*!
@@ -93,12 +96,35 @@ public:
    * removing a row from P (the polynomial part of the interpolation matrix).
    * \param[in] max_diff_tol - Tolerance to detect whether points are on a plane.
    * \param[out] keep_row - Marks the dimensions of P kept.
-   * \param[in,out] P - Polynomial part of the interpolation matrix, one row may be eliminated.
+   * \param[in,out] P - Polynomial part of the interpolation matrix, one row may be eliminated (P is resized).
    * \return n_polynomial - Size of the polynomial part on exit (in practice nDim or nDim-1).
    */
   static int CheckPolynomialTerms(su2double max_diff_tol, vector<int>& keep_row, su2passivematrix &P);
 
 private:
+  /*!
+   * \brief Compute the interpolation coefficients of the target points of a marker with the sparse method.
+   * \note For compactly supported functions. The global kernel matrix of the donors is sparse (SPD), it is
+   *       assembled with radius searches, and solved with CG (with a sparse approximate inverse preconditioner
+   *       built once) for the function values at each target. The polynomial term is handled by a Schur
+   *       complement. This gives the coefficients of the dense method (to the solver tolerance) for the donors
+   *       available to the rank, which are then pruned in the same way.
+   * \param[in] type - Type of radial basis function.
+   * \param[in] usePolynomial - Whether to use polynomial terms.
+   * \param[in] radius - Support radius.
+   * \param[in] pruneTol - Relative pruning tolerance.
+   * \param[in] markTarget - Index of the target marker.
+   * \param[in] donorCoord - Coordinates of the donor points.
+   * \param[in] donorPoint - Global index of the donor points.
+   * \param[in] donorProc - Rank that owns each donor point.
+   * \param[out] nTarget - Number of target points processed (owned by this rank).
+   * \return Total number of donors of the target points (after pruning).
+   */
+  unsigned long ComputeSparseCoefficients(ENUM_RADIALBASIS type, bool usePolynomial, passivedouble radius,
+                                          passivedouble pruneTol, int markTarget, const su2activematrix& donorCoord,
+                                          const vector<long>& donorPoint, const vector<int>& donorProc,
+                                          unsigned long& nTarget);
+
   /*!
    * \brief Helper function, prunes (by setting to zero) small interpolation coefficients,
    * i.e. <= tolerance*max(abs(coeffs)). The vector is re-scaled such that sum(coeffs)==1.
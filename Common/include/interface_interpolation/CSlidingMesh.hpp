@@ -27,6 +27,7 @@
 #pragma once
 
 #include "CInterpolator.hpp"
+#include <unordered_map>
 
 /*!
  * \brief Sliding mesh approach.
@@ -52,6 +53,49 @@ public:
   void SetTransferCoeff(const CConfig* const* config) override;
 
 private:
+  vector<vector<long> > donorSeed; /*!< \brief Global index of the donor vertex from which the supermesh of each
+                                        target vertex was built, it is the starting point of the next search. */
+
+  /*!
+   * \brief Interface boundary gathered from all ranks. The connectivity does not change between calls
+   *        of SetTransferCoeff, only the coordinates are gathered again.
+   */
+  struct GatheredBoundary {
+    bool gathered = false;
+    unsigned long nVertex = 0;
+    vector<su2double> coord;
+    vector<long> globalPoint;
+    vector<unsigned long> proc, nLinkedNodes, startLinkedNodes, linkedNodes;
+    unordered_map<long, unsigned long> index;   /*!< \brief Position of each global point in the arrays. */
+  };
+  vector<GatheredBoundary> targetBoundary, donorBoundary; /*!< \brief For each interface marker. */
+
+  /*!
+   * \brief Gather the boundary of a zone, the first time with its connectivity, afterwards only the coordinates.
+   * \param[in] zone - Index of the zone.
+   * \param[in] marker - Index of the interface marker in the zone (-1 if not present in this rank).
+   * \param[in,out] boundary - The gathered boundary.
+   */
+  void GatherBoundary(unsigned long zone, int marker, GatheredBoundary& boundary);
+
+  /*!
+   * \brief Walk the donor boundary from a seed vertex towards the vertex closest to a point.
+   * \note The walk stops at the first vertex that is closer to the point than all its neighbours,
+   *       between time steps of a sliding interface this is only a few vertices away from the seed.
+   * \param[in] nDim       - Number of dimensions
+   * \param[in] point      - Coordinates of the point
+   * \param[in] map        - array containing the index of the boundary points connected to the node
+   * \param[in] startIndex - for each vertex specifies the corresponding index in the global
+   *                         array containing the indexes of all its neighbouring vertexes
+   * \param[in] nNeighbor  - for each vertex specifies the number of its neighbouring vertexes (on the boundary)
+   * \param[in] coord      - array containing the coordinates of all the boundary vertexes
+   * \param[in] seed       - label of the vertex where the walk starts
+   * \return Label of the closest vertex found.
+   */
+  static unsigned long WalkToClosestVertex(unsigned short nDim, const su2double *point, const unsigned long *map,
+                                           const unsigned long *startIndex, const unsigned long* nNeighbor,
+                                           const su2double *coord, unsigned long seed);
+
   /*!
    * \brief For 3-Dimensional grids, build the dual surface element
    * \param[in] map         - array containing the index of the boundary points connected to the node
@@ -59,6 +59,17 @@ public:
    * \brief Generic "preprocessing" hook derived classes may implement to build the preconditioner.
    */
   virtual void Build() {}
+
+  /*!
+   * \brief Factory method.
+   * \param[in] kind - Type of preconditioner (see ENUM_LINEAR_SOLVER_PREC), Jacobi is used for unknown types.
+   * \param[in] jacobian - Matrix reference that will be used to define the preconditioner.
+   * \param[in] geometry - Associated geometry.
+   * \param[in] config - Problem configuration.
+   * \return Allocated preconditioner object (owned by the caller), Build() still needs to be called.
+   */
+  static CPreconditioner* Create(unsigned short kind, CSysMatrix<ScalarType>& jacobian,
+                                 CGeometry* geometry, const CConfig* config);
 };
 template<class ScalarType>
 CPreconditioner<ScalarType>::~CPreconditioner() {}
@@ -268,6 +279,57 @@ public:
 };
 
 
+/*!
+ * \class CAMGPreconditioner
+ * \brief Specialization of preconditioner that uses the algebraic multigrid of CSysMatrix.
+ */
+template<class ScalarType>
+class CAMGPreconditioner final : public CPreconditioner<ScalarType> {
+private:
+  CSysMatrix<ScalarType>& sparse_matrix; /*!< \brief Pointer to matrix that defines the preconditioner. */
+  CGeometry* geometry;                   /*!< \brief Pointer to geometry associated with the matrix. */
+  const CConfig *config;                 /*!< \brief Pointer to problem configuration. */
+
+public:
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] matrix_ref - Matrix reference that will be used to define the preconditioner.
+   * \param[in] geometry_ref - Geometry associated with the problem.
+   * \param[in] config_ref - Config of the problem.
+   */
+  inline CAMGPreconditioner(CSysMatrix<ScalarType> & matrix_ref,
+                            CGeometry *geometry_ref, const CConfig *config_ref) :
+    sparse_matrix(matrix_ref)
+  {
+    if((geometry_ref == nullptr) || (config_ref == nullptr))
+      SU2_MPI::Error("Preconditioner needs to be built with valid references.", CURRENT_FUNCTION);
+    geometry = geometry_ref;
+    config = config_ref;
+  }
+
+  /*!
+   * \note This class cannot be default constructed as that would leave us with invalid Pointers.
+   */
+  CAMGPreconditioner() = delete;
+
+  /*!
+   * \brief Operator that defines the preconditioner operation.
+   * \param[in] u - CSysVector that is being preconditioned.
+   * \param[out] v - CSysVector that is the result of the preconditioning.
+   */
+  inline void operator()(const CSysVector<ScalarType> & u, CSysVector<ScalarType> & v) const override {
+    sparse_matrix.ComputeAMGPreconditioner(u, v, geometry, config);
+  }
+
+  /*!
+   * \note Request the associated matrix to build (or update) the multigrid hierarchy.
+   */
+  inline void Build() override {
+    sparse_matrix.BuildAMGPreconditioner(config);
+  }
+};
+
+
 /*!
  * \class CPastixPreconditioner
  * \brief Specialization of preconditioner that uses PaStiX to factorize a CSysMatrix.
@@ -323,3 +385,37 @@ public:
     sparse_matrix.BuildPastixPreconditioner(geometry, config, kind_fact, transp);
   }
 };
+
+template<class ScalarType>
+CPreconditioner<ScalarType>* CPreconditioner<ScalarType>::Create(unsigned short kind,
+                                                                 CSysMatrix<ScalarType>& jacobian,
+                                                                 CGeometry* geometry,
+                                                                 const CConfig* config) {
+  CPreconditioner<ScalarType>* prec = nullptr;
+
+  switch (kind) {
+    case JACOBI:
+      prec = new CJacobiPreconditioner<ScalarType>(jacobian, geometry, config, false);
+      break;
+    case ILU:
+      prec = new CILUPreconditioner<ScalarType>(jacobian, geometry, config, false);
+      break;
+    case LU_SGS:
+      prec = new CLU_SGSPreconditioner<ScalarType>(jacobian, geometry, config);
+      break;
+    case LINELET:
+      prec = new CLineletPreconditioner<ScalarType>(jacobian, geometry, config);
+      break;
+    case AMG:
+      prec = new CAMGPreconditioner<ScalarType>(jacobian, geometry, config);
+      break;
+    case PASTIX_ILU: case PASTIX_LU_P: case PASTIX_LDLT_P:
+      prec = new CPastixPreconditioner<ScalarType>(jacobian, geometry, config, kind, false);
+      break;
+    default:
+      prec = new CJacobiPreconditioner<ScalarType>(jacobian, geometry, config, false);
+      break;
+  }
+
+  return prec;
+}
@@ -31,6 +31,7 @@
 #include "../../include/parallelization/mpi_structure.hpp"
 #include "../../include/parallelization/omp_structure.hpp"
 #include "../../include/parallelization/vectorization.hpp"
+#include "../../include/toolboxes/graph_toolbox.hpp"
 #include "CSysVector.hpp"
 #include "CPastixWrapper.hpp"
 
@@ -85,10 +86,12 @@ class CGeometry;
 template<class ScalarType>
 class CSysMatrix {
 private:
+  template<class> friend class CSysMatrix;
+
   const int rank;     /*!< \brief MPI Rank. */
   const int size;     /*!< \brief MPI Size. */
 
-  enum : size_t { MAXNVAR = 8 };    /*!< \brief Maximum number of variables the matrix can handle. The static
+  enum : size_t { MAXNVAR = 12 };   /*!< \brief Maximum number of variables the matrix can handle. The static
                                                 size is needed for fast, per-thread, static memory allocation. */
 
   enum { OMP_MAX_SIZE_L = 8192 };   /*!< \brief Max. chunk size used in light parallel for loops. */
@@ -98,14 +101,19 @@ private:
   unsigned long omp_heavy_size;     /*!< \brief Actual chunk size used in heavy loops (e.g. over rows). */
   unsigned long omp_num_parts;      /*!< \brief Number of threads used in thread-parallel LU_SGS and ILU. */
   unsigned long *omp_partitions;    /*!< \brief Point indexes of LU_SGS and ILU thread-parallel sub partitioning. */
+  bool omp_levels;                  /*!< \brief Use level scheduling, instead of the partitions, in LU_SGS and ILU. */
+  CCompressedSparsePatternUL levels_lower, levels_upper;         /*!< \brief Level schedules of the LU_SGS sweeps. */
+  CCompressedSparsePatternUL levels_lower_ilu, levels_upper_ilu; /*!< \brief Level schedules of the ILU factorization and sweeps. */
 
   unsigned long nPoint;             /*!< \brief Number of points in the grid. */
   unsigned long nPointDomain;       /*!< \brief Number of points in the grid (excluding halos). */
   unsigned long nVar;               /*!< \brief Number of variables (and rows of the blocks). */
   unsigned long nEqn;               /*!< \brief Number of equations (and columns of the blocks). */
+  unsigned long kernel_size;        /*!< \brief Block size of the specialized kernels, 0 if the generic ones are used. */
 
   ScalarType *matrix;               /*!< \brief Entries of the sparse matrix. */
   unsigned long nnz;                /*!< \brief Number of possible nonzero entries in the matrix. */
+  unsigned long valuesVersion = 0;  /*!< \brief Incremented when the entries are reset, see GetValuesVersion. */
   const unsigned long *row_ptr;     /*!< \brief Pointers to the first element in each row. */
   const unsigned long *dia_ptr;     /*!< \brief Pointers to the diagonal element in each row. */
   const unsigned long *col_ind;     /*!< \brief Column index for each of the elements in val(). */
@@ -129,6 +137,39 @@ private:
   mutable vector<vector<ScalarType> > LineletInvDiag;      /*!< \brief Inverse of the diagonal blocks of the tri-diag system (working memory). */
   mutable vector<vector<ScalarType> > LineletVector;       /*!< \brief Solution and RHS of the tri-diag system (working memory). */
 
+  enum { AMG_COARSE_SIZE = 512 };   /*!< \brief Target number of unknowns (nPoint*nVar) of the coarsest AMG level. */
+
+  /*!
+   * \brief One level of the algebraic multigrid hierarchy, stored in the same block-CSR format as the matrix.
+   * \note All levels own their data, the finest is a copy of the matrix (domain rows only). Each level
+   *       also stores its aggregation, i.e. the restriction/prolongation to the next (coarser) level.
+   */
+  struct AMGLevel {
+    unsigned long nPoint = 0;                /*!< \brief Number of block rows, columns >= nPoint are ignored (halos). */
+    const unsigned long *row_ptr = nullptr;  /*!< \brief Pointers to the first element in each row. */
+    const unsigned long *dia_ptr = nullptr;  /*!< \brief Pointers to the diagonal element in each row. */
+    const unsigned long *col_ind = nullptr;  /*!< \brief Column index for each of the blocks. */
+    const ScalarType *matrix = nullptr;      /*!< \brief Entries of the operator of this level. */
+
+    vector<unsigned long> row_ptr_data, dia_ptr_data, col_ind_data; /*!< \brief Sparse pattern of coarse levels. */
+    vector<ScalarType> matrix_data;          /*!< \brief Galerkin operator of coarse levels. */
+    vector<ScalarType> invD;                 /*!< \brief Inverse of the diagonal blocks, used by the smoother. */
+    vector<unsigned long> partitions;        /*!< \brief Row ranges smoothed by each thread. */
+
+    vector<unsigned long> aggregate;         /*!< \brief Aggregate (point of the next level) of each point. */
+    vector<unsigned long> agg_ptr, agg_pts;  /*!< \brief Points of each aggregate (CSR format). */
+    vector<unsigned long> coarse_nnz;        /*!< \brief Block of the next level to which each block contributes. */
+
+    vector<ScalarType> sol, rhs, old;        /*!< \brief Working vectors of the cycle. */
+  };
+  mutable vector<AMGLevel> AMGLevels;        /*!< \brief The AMG hierarchy, built once and re-valued by each build. */
+  vector<ScalarType> AMGCoarseLU;            /*!< \brief Dense LU factorization of the coarsest level. */
+  vector<unsigned long> AMGCoarsePivot;      /*!< \brief Row permutation of the coarsest level factorization. */
+  unsigned short amg_sweeps = 1;             /*!< \brief Number of pre and post smoothing sweeps. */
+  unsigned long AMGRegularizedPivots = 0;    /*!< \brief Number of pivots of the coarsest level that were regularized. */
+  const unsigned long *AMGSourceRowPtr = nullptr; /*!< \brief Sparse pattern from which the hierarchy was created. */
+  const unsigned long *AMGSourceColInd = nullptr; /*!< \brief Sparse pattern from which the hierarchy was created. */
+
 #ifdef USE_MKL
   using gemm_t = typename mkl_jit_wrapper<ScalarType>::gemm_t;
   void * MatrixMatrixProductJitter;              /*!< \brief Jitter handle for MKL JIT based GEMM. */
@@ -244,6 +285,14 @@ private:
     }
   }
 
+  /*!
+   * \brief Block sizes for which the dense kernels are specialized at compile time (see CSysMatrix.inl).
+   * \param[in] n - Size of the square blocks.
+   */
+  static constexpr bool IsSpecializedBlockSize(unsigned long n) {
+    return (n >= 1 && n <= 7) || n == 9 || n == 10;
+  }
+
   /*!
    * \brief Solve a small (nVar x nVar) linear system using Gaussian elimination.
    * \param[in,out] matrix - On entry the system matrix, on exit the factorized matrix.
@@ -340,6 +389,95 @@ private:
    */
   void RowProduct(const CSysVector<ScalarType> & vec, unsigned long row_i, ScalarType *prod) const;
 
+  /*!
+   * \brief Incomplete factorization of one row of the ILU matrix, and inversion of its diagonal block.
+   * \note Only the submatrix from row/col "begin" to row/col "end-1" is considered.
+   * \param[in] iPoint - Row to factorize, the previous rows of the submatrix must be factorized.
+   * \param[in] begin - First row/col of the submatrix.
+   * \param[in] end - Last row/col of the submatrix plus one.
+   */
+  inline void ILUFactorizeRow(unsigned long iPoint, unsigned long begin, unsigned long end);
+
+  /*!
+   * \brief Forward solve (lower triangle of the ILU factorization) of one row, in place.
+   * \param[in,out] prod - Vector being solved for.
+   * \param[in] iPoint - Row index.
+   * \param[in] begin - Inclusive lower bound of the columns considered.
+   */
+  inline void ILUForwardRow(CSysVector<ScalarType> & prod, unsigned long iPoint, unsigned long begin) const;
+
+  /*!
+   * \brief Backward solve (upper triangle of the ILU factorization) of one row, in place.
+   * \param[in,out] prod - Vector being solved for.
+   * \param[in] iPoint - Row index.
+   * \param[in] end - Exclusive upper bound of the columns considered.
+   */
+  inline void ILUBackwardRow(CSysVector<ScalarType> & prod, unsigned long iPoint, unsigned long end) const;
+
+  /*!
+   * \brief First part of the symmetric iteration, (D+L).x* = b, for one row.
+   * \param[in] vec - Right hand side (b).
+   * \param[in,out] prod - Vector being solved for.
+   * \param[in] iPoint - Row index.
+   * \param[in] begin - Inclusive lower bound of the columns considered.
+   */
+  inline void LU_SGSForwardRow(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
+                               unsigned long iPoint, unsigned long begin) const;
+
+  /*!
+   * \brief Second part of the symmetric iteration, (D+U).x_(1) = D.x*, for one row.
+   * \param[in,out] prod - Vector being solved for.
+   * \param[in] iPoint - Row index.
+   * \param[in] end - Exclusive upper bound of the columns considered.
+   */
+  inline void LU_SGSBackwardRow(CSysVector<ScalarType> & prod, unsigned long iPoint, unsigned long end) const;
+
+  /*!
+   * \brief Apply a row kernel to all rows, level by level (thread-parallel within each level).
+   * \note Consecutive small levels are processed by a single thread to avoid one barrier per level.
+   * \param[in] levels - Level schedule, see levelSchedule in graph_toolbox.
+   * \param[in] kernel - Function of the row index.
+   */
+  template<class F>
+  inline void LevelScheduledLoop(const CCompressedSparsePatternUL& levels, const F& kernel) const;
+
+  /*!
+   * \brief Compute the level schedules of LU_SGS and ILU, and report their statistics.
+   * \param[in] ilu_needed - Whether the ILU schedules are needed.
+   * \param[in] report - Which of the schedules to report, LU_SGS or ILU.
+   */
+  void SetupLevelScheduling(bool ilu_needed, unsigned short report);
+
+  /*!
+   * \brief Create the AMG levels, aggregating the points of each level by strength of connection.
+   * \note Done by the master thread, the operator of each level is formed before aggregating it, since
+   *       the strength of connection depends on it. Subsequent builds only update the values.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetupAMGHierarchy(const CConfig *config);
+
+  /*!
+   * \brief Galerkin product (RAP) for one row of an AMG level, with piecewise constant interpolation
+   *        this amounts to summing the blocks of the points of the aggregate.
+   * \param[in] iLevel - Coarse level (> 0) of the hierarchy.
+   * \param[in] iRow - Row (aggregate of the finer level) of that level.
+   */
+  void ComputeAMGCoarseRow(unsigned long iLevel, unsigned long iRow);
+
+  /*!
+   * \brief Block Gauss-Seidel sweeps on one AMG level (thread-parallel in the same way as LU_SGS).
+   * \param[in] iLevel - Level of the hierarchy.
+   * \param[in] nSweeps - Number of sweeps.
+   * \param[in] forward - Direction of the sweeps.
+   */
+  void AMGSmooth(unsigned long iLevel, unsigned long nSweeps, bool forward) const;
+
+  /*!
+   * \brief Recursive V-cycle starting at iLevel, for the rhs and initial solution in the working vectors.
+   * \param[in] iLevel - Level of the hierarchy.
+   */
+  void AMGCycle(unsigned long iLevel) const;
+
 public:
 
   /*!
@@ -368,6 +506,31 @@ public:
                   bool EdgeConnect, CGeometry *geometry,
                   const CConfig *config, bool needTranspPtr = false);
 
+  /*!
+   * \brief Copy the entries of another matrix, possibly of different precision, the first call
+   *        initializes this matrix with the same structure (and the sparse pattern is shared).
+   * \note Must be called by all threads.
+   * \param[in] other - Matrix being copied.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  template<class OtherType>
+  void CopyFrom(const CSysMatrix<OtherType>& other, CGeometry *geometry, const CConfig *config) {
+    const bool init = (matrix == nullptr);
+    SU2_OMP_BARRIER
+    if (init) {
+      SU2_OMP_MASTER
+      Initialize(other.nPoint, other.nPointDomain, other.nVar, other.nEqn, other.edge_ptr.ptr != nullptr,
+                 geometry, config, other.col_ptr != nullptr);
+      SU2_OMP_BARRIER
+    }
+    SU2_OMP_MASTER
+    ++valuesVersion;
+    SU2_OMP_FOR_STAT(omp_light_size)
+    for (auto i = 0ul; i < nnz*nVar*nEqn; ++i)
+      matrix[i] = PassiveAssign(other.matrix[i]);
+  }
+
   /*!
    * \brief Sets to zero all the entries of the sparse matrix.
    */
@@ -378,6 +541,13 @@ public:
    */
   void SetValDiagonalZero(void);
 
+  /*!
+   * \brief Get the number of times the entries were reset (by SetValZero, SetValDiagonalZero,
+   *        SetDiagonalAsColumnSum, or CopyFrom), each assembly of the matrix starts with one of these.
+   * \note Allows copies of the matrix (or of data derived from it) to know if they are outdated.
+   */
+  inline unsigned long GetValuesVersion() const { return valuesVersion; }
+
   /*!
    * \brief Routine to load a vector quantity into the data structures for MPI point-to-point
    *        communication and to launch non-blocking sends and recvs.
@@ -877,6 +1047,34 @@ public:
   void ComputeLineletPreconditioner(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
                                     CGeometry *geometry, const CConfig *config) const;
 
+  /*!
+   * \brief Build the algebraic multigrid preconditioner.
+   * \note The aggregation is done on the first call (or if the sparse pattern changes), subsequent calls
+   *       only update the copy of the matrix and the coarse operators.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void BuildAMGPreconditioner(const CConfig *config);
+
+  /*!
+   * \brief Get the number of levels of the AMG hierarchy (0 before the first build).
+   */
+  inline unsigned long GetnAMGLevels() const { return AMGLevels.size(); }
+
+  /*!
+   * \brief Get the number of (near) zero pivots of the coarsest AMG level that were regularized by the last build.
+   */
+  inline unsigned long GetnAMGRegularizedPivots() const { return AMGRegularizedPivots; }
+
+  /*!
+   * \brief Multiply CSysVector by the preconditioner (one V-cycle).
+   * \param[in] vec - CSysVector to be multiplied by the preconditioner.
+   * \param[out] prod - Result of the product M*vec.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ComputeAMGPreconditioner(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
+                                CGeometry *geometry, const CConfig *config) const;
+
   /*!
    * \brief Compute the linear residual.
    * \param[in] sol - Solution (x).
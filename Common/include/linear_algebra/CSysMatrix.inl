@@ -63,35 +63,144 @@ FORCEINLINE void gemv_impl(unsigned long n, unsigned long m, const T *a, const T
   /*---
    This is a templated version of GEMV with the constants as boolean
    template parameters so that they can be optimized away at compilation.
-   This is still the traditional "row dot vector" method.
+   This is still the traditional "row dot vector" method, the transposed
+   product is computed by columns to keep the inner loop contiguous.
+   When n and m are compile-time constants (see BLOCK_KERNEL_DISPATCH)
+   the loops are fully unrolled and vectorized.
   ---*/
   if (!transp) {
     for (auto i = 0ul; i < n; i++) {
-      if (!beta) c[i] = 0.0;
+      T sum = beta? c[i] : T(0.0);
       for (auto j = 0ul; j < m; j++)
-        c[i] += (alpha? 1 : -1) * a[i*m+j] * b[j];
+        sum += (alpha? 1 : -1) * a[i*m+j] * b[j];
+      c[i] = sum;
     }
   } else {
     if (!beta) for (auto j = 0ul; j < m; j++) c[j] = 0.0;
-    for (auto i = 0ul; i < n; i++)
+    for (auto i = 0ul; i < n; i++) {
+      const T bi = (alpha? 1 : -1) * b[i];
+      SU2_OMP_SIMD
       for (auto j = 0ul; j < m; j++)
-        c[j] += (alpha? 1 : -1) * a[i*n+j] * b[i];
+        c[j] += a[i*m+j] * bi;
+    }
   }
 }
 
 template<class T>
 FORCEINLINE void gemm_impl(unsigned long n, const T *a, const T *b, T *c) {
-  /*--- Same deal as for GEMV but here only the type is templated. ---*/
-  unsigned long i, j, k;
-  for (i = 0; i < n; i++) {
-    for (j = 0; j < n; j++) {
+  /*--- Same deal as for GEMV but here only the type is templated,
+   *    the i-k-j order makes the inner loop a contiguous axpy. ---*/
+  for (auto i = 0ul; i < n; i++) {
+    SU2_OMP_SIMD
+    for (auto j = 0ul; j < n; j++)
       c[i*n+j] = 0.0;
-      for (k = 0; k < n; k++)
-        c[i*n+j] += a[i*n+k] * b[k*n+j];
+    for (auto k = 0ul; k < n; k++) {
+      const T aik = a[i*n+k];
+      SU2_OMP_SIMD
+      for (auto j = 0ul; j < n; j++)
+        c[i*n+j] += aik * b[k*n+j];
+    }
+  }
+}
+
+template<class T>
+FORCEINLINE void gauss_elimination_impl(unsigned long n, T *matrix, T *vec) {
+#define A(I,J) matrix[(I)*n+(J)]
+
+  /*--- Transform system in Upper Matrix ---*/
+  for (auto iVar = 1ul; iVar < n; iVar++) {
+    for (auto jVar = 0ul; jVar < iVar; jVar++) {
+      T weight = A(iVar,jVar) / A(jVar,jVar);
+      for (auto kVar = jVar; kVar < n; kVar++)
+        A(iVar,kVar) -= weight * A(jVar,kVar);
+      vec[iVar] -= weight * vec[jVar];
     }
   }
+
+  /*--- Backwards substitution ---*/
+  for (auto iVar = n; iVar > 0ul;) {
+    iVar--; // unsigned type
+    for (auto jVar = iVar+1; jVar < n; jVar++)
+      vec[iVar] -= A(iVar,jVar) * vec[jVar];
+    vec[iVar] /= A(iVar,iVar);
+  }
+#undef A
 }
 
+template<class T>
+FORCEINLINE void matrix_inverse_impl(unsigned long n, T *matrix, T *inverse) {
+
+  /*--- This is a generalization of Gaussian elimination for multiple rhs' (the basis vectors).
+   We could call "Gauss_Elimination" multiple times or fully generalize it for multiple rhs,
+   the performance of both routines would suffer in both cases without the use of exotic templating.
+   And so it feels reasonable to have some duplication here. ---*/
+
+#define A(I,J) matrix[(I)*n+(J)]
+#define M(I,J) inverse[(I)*n+(J)]
+
+  /*--- Initialize the inverse with the identity. ---*/
+  for (auto iVar = 0ul; iVar < n; iVar++)
+    for (auto jVar = 0ul; jVar < n; jVar++)
+      M(iVar,jVar) = T(iVar==jVar);
+
+  /*--- Transform system in Upper Matrix ---*/
+  for (auto iVar = 1ul; iVar < n; iVar++) {
+    for (auto jVar = 0ul; jVar < iVar; jVar++)
+    {
+      T weight = A(iVar,jVar) / A(jVar,jVar);
+
+      for (auto kVar = jVar; kVar < n; kVar++)
+        A(iVar,kVar) -= weight * A(jVar,kVar);
+
+      /*--- at this stage M is lower triangular so not all cols need updating ---*/
+      for (auto kVar = 0ul; kVar <= jVar; kVar++)
+        M(iVar,kVar) -= weight * M(jVar,kVar);
+    }
+  }
+
+  /*--- Backwards substitution ---*/
+  for (auto iVar = n; iVar > 0ul;) {
+    iVar--; // unsigned type
+    for (auto jVar = iVar+1; jVar < n; jVar++) {
+      const T aij = A(iVar,jVar);
+      SU2_OMP_SIMD
+      for (auto kVar = 0ul; kVar < n; kVar++)
+        M(iVar,kVar) -= aij * M(jVar,kVar);
+    }
+
+    const T aii = A(iVar,iVar);
+    SU2_OMP_SIMD
+    for (auto kVar = 0ul; kVar < n; kVar++)
+      M(iVar,kVar) /= aii;
+  }
+#undef A
+#undef M
+}
+
+/*---
+ Calls a force-inlined block kernel with compile-time sizes "N" (rows) and "M" (columns)
+ for the block sizes selected by Initialize (kernel_size), and with the runtime sizes
+ otherwise. Inlining turns the size arguments into constants, which allows the compiler
+ to unroll and vectorize the small loops. The list of sizes covers the FVM, FEM, and NEMO
+ (N2 and AIR-5 mixtures) solvers, it must be consistent with IsSpecializedBlockSize.
+---*/
+#define BLOCK_KERNEL_CASE(SIZE, ...) \
+  case SIZE: { constexpr unsigned long N = SIZE, M = SIZE; (void)M; __VA_ARGS__; break; }
+
+#define BLOCK_KERNEL_DISPATCH(...) \
+  switch (kernel_size) { \
+    BLOCK_KERNEL_CASE(1, __VA_ARGS__) \
+    BLOCK_KERNEL_CASE(2, __VA_ARGS__) \
+    BLOCK_KERNEL_CASE(3, __VA_ARGS__) \
+    BLOCK_KERNEL_CASE(4, __VA_ARGS__) \
+    BLOCK_KERNEL_CASE(5, __VA_ARGS__) \
+    BLOCK_KERNEL_CASE(6, __VA_ARGS__) \
+    BLOCK_KERNEL_CASE(7, __VA_ARGS__) \
+    BLOCK_KERNEL_CASE(9, __VA_ARGS__) \
+    BLOCK_KERNEL_CASE(10, __VA_ARGS__) \
+    default: { const unsigned long N = nVar, M = nEqn; (void)M; __VA_ARGS__; break; } \
+  }
+
 #define __MATVECPROD_SIGNATURE__(TYPE,NAME) \
 FORCEINLINE void CSysMatrix<TYPE>::NAME(const TYPE *matrix, const TYPE *vector, TYPE *product) const
 
@@ -101,27 +210,27 @@ FORCEINLINE void CSysMatrix<TYPE>::NAME(const TYPE *matrix, const TYPE *vector,
 MATVECPROD_SIGNATURE( MatrixVectorProduct ) {
   /*---
    Without MKL (default) picture copying the body of gemv_impl
-   here and resolving the conditionals at compilation.
+   here and resolving the conditionals and sizes at compilation.
   ---*/
-  gemv_impl<ScalarType,true,false,false>(nVar, nEqn, matrix, vector, product);
+  BLOCK_KERNEL_DISPATCH(gemv_impl<ScalarType,true,false,false>(N, M, matrix, vector, product))
 }
 
 MATVECPROD_SIGNATURE( MatrixVectorProductAdd ) {
-  gemv_impl<ScalarType,true,true,false>(nVar, nEqn, matrix, vector, product);
+  BLOCK_KERNEL_DISPATCH(gemv_impl<ScalarType,true,true,false>(N, M, matrix, vector, product))
 }
 
 MATVECPROD_SIGNATURE( MatrixVectorProductSub ) {
-  gemv_impl<ScalarType,false,true,false>(nVar, nEqn, matrix, vector, product);
+  BLOCK_KERNEL_DISPATCH(gemv_impl<ScalarType,false,true,false>(N, M, matrix, vector, product))
 }
 
 MATVECPROD_SIGNATURE( MatrixVectorProductTransp ) {
-  gemv_impl<ScalarType,true,true,true>(nVar, nEqn, matrix, vector, product);
+  BLOCK_KERNEL_DISPATCH(gemv_impl<ScalarType,true,true,true>(N, M, matrix, vector, product))
 }
 
 template<class ScalarType>
 FORCEINLINE void CSysMatrix<ScalarType>::MatrixMatrixProduct(const ScalarType *matrix_a,
                                                              const ScalarType *matrix_b, ScalarType *product) const {
-  gemm_impl<ScalarType>(nVar, matrix_a, matrix_b, product);
+  BLOCK_KERNEL_DISPATCH(gemm_impl<ScalarType>(N, matrix_a, matrix_b, product))
 }
 #else
 MATVECPROD_SIGNATURE( MatrixVectorProduct ) {
@@ -230,3 +339,143 @@ FORCEINLINE void CSysMatrix<ScalarType>::DiagonalProduct(const CSysVector<Scalar
 
   MatrixVectorProduct(&matrix[dia_ptr[row_i]*nVar*nEqn], &vec[row_i*nEqn], prod);
 }
+
+template<class ScalarType>
+FORCEINLINE void CSysMatrix<ScalarType>::ILUFactorizeRow(unsigned long iPoint, unsigned long begin, unsigned long end) {
+
+  ScalarType weight[MAXNVAR*MAXNVAR], aux_block[MAXNVAR*MAXNVAR];
+
+  /*--- For this row (unknown), loop over its lower diagonal entries. ---*/
+
+  for (auto index = row_ptr_ilu[iPoint]; index < dia_ptr_ilu[iPoint]; index++) {
+
+    /*--- jPoint is the column index (jPoint < iPoint). ---*/
+
+    auto jPoint = col_ind_ilu[index];
+
+    /*--- We only care about the sub matrix within "begin" and "end-1". ---*/
+
+    if (jPoint < begin) continue;
+
+    /*--- Multiply the block by the inverse of the corresponding diagonal block. ---*/
+
+    auto Block_ij = &ILU_matrix[index*nVar*nVar];
+    MatrixMatrixProduct(Block_ij, &invM[jPoint*nVar*nVar], weight);
+
+    /*--- "weight" holds Aij*inv(Ajj). Jump to the upper part of the jPoint row. ---*/
+
+    for (auto index_ = dia_ptr_ilu[jPoint]+1; index_ < row_ptr_ilu[jPoint+1]; index_++) {
+
+      /*--- Get the column index (kPoint > jPoint). ---*/
+
+      auto kPoint = col_ind_ilu[index_];
+
+      if (kPoint >= end) break;
+
+      /*--- If Aik exists, update it: Aik -= Aij*inv(Ajj)*Ajk ---*/
+
+      auto Block_ik = GetBlock_ILUMatrix(iPoint, kPoint);
+
+      if (Block_ik != nullptr) {
+        auto Block_jk = &ILU_matrix[index_*nVar*nVar];
+        MatrixMatrixProduct(weight, Block_jk, aux_block);
+        MatrixSubtraction(Block_ik, aux_block, Block_ik);
+      }
+    }
+
+    /*--- Lastly, store "weight" in the lower triangular part, which
+     will be reused during the forward solve in the precon/smoother. ---*/
+
+    for (auto iVar = 0ul; iVar < nVar*nVar; ++iVar)
+      Block_ij[iVar] = weight[iVar];
+  }
+
+  /*--- The row is complete, invert and store its diagonal block to later compute the weights. ---*/
+
+  InverseDiagonalBlock_ILUMatrix(iPoint, &invM[iPoint*nVar*nVar]);
+}
+
+template<class ScalarType>
+FORCEINLINE void CSysMatrix<ScalarType>::ILUForwardRow(CSysVector<ScalarType> & prod,
+                                                       unsigned long iPoint, unsigned long begin) const {
+  for (auto index = row_ptr_ilu[iPoint]; index < dia_ptr_ilu[iPoint]; index++) {
+    auto jPoint = col_ind_ilu[index];
+    if (jPoint < begin) continue;
+    auto Block_ij = &ILU_matrix[index*nVar*nVar];
+    MatrixVectorProductSub(Block_ij, &prod[jPoint*nVar], &prod[iPoint*nVar]);
+  }
+}
+
+template<class ScalarType>
+FORCEINLINE void CSysMatrix<ScalarType>::ILUBackwardRow(CSysVector<ScalarType> & prod,
+                                                        unsigned long iPoint, unsigned long end) const {
+  ScalarType aux_vec[MAXNVAR];
+
+  for (auto iVar = 0ul; iVar < nVar; iVar++)
+    aux_vec[iVar] = prod[iPoint*nVar+iVar];
+
+  for (auto index = dia_ptr_ilu[iPoint]+1; index < row_ptr_ilu[iPoint+1]; index++) {
+    auto jPoint = col_ind_ilu[index];
+    if (jPoint >= end) break;
+    auto Block_ij = &ILU_matrix[index*nVar*nVar];
+    MatrixVectorProductSub(Block_ij, &prod[jPoint*nVar], aux_vec);
+  }
+
+  MatrixVectorProduct(&invM[iPoint*nVar*nVar], aux_vec, &prod[iPoint*nVar]);
+}
+
+template<class ScalarType>
+FORCEINLINE void CSysMatrix<ScalarType>::LU_SGSForwardRow(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
+                                                          unsigned long iPoint, unsigned long begin) const {
+  ScalarType low_prod[MAXNVAR];
+
+  auto idx = iPoint*nVar;
+  LowerProduct(prod, iPoint, begin, low_prod);        // Compute L.x*
+  VectorSubtraction(&vec[idx], low_prod, &prod[idx]); // Compute y = b - L.x*
+  Gauss_Elimination(iPoint, &prod[idx]);              // Solve D.x* = y
+}
+
+template<class ScalarType>
+FORCEINLINE void CSysMatrix<ScalarType>::LU_SGSBackwardRow(CSysVector<ScalarType> & prod,
+                                                           unsigned long iPoint, unsigned long end) const {
+  ScalarType up_prod[MAXNVAR], dia_prod[MAXNVAR];
+
+  auto idx = iPoint*nVar;
+  DiagonalProduct(prod, iPoint, dia_prod);          // Compute D.x*
+  UpperProduct(prod, iPoint, end, up_prod);         // Compute U.x_(n+1)
+  VectorSubtraction(dia_prod, up_prod, &prod[idx]); // Compute y = D.x*-U.x_(n+1)
+  Gauss_Elimination(iPoint, &prod[idx]);            // Solve D.x* = y
+}
+
+template<class ScalarType>
+template<class F>
+FORCEINLINE void CSysMatrix<ScalarType>::LevelScheduledLoop(const CCompressedSparsePatternUL& levels,
+                                                            const F& kernel) const {
+  const auto nLevel = levels.getOuterSize();
+  const auto levelPtr = levels.outerPtr();
+  const auto rows = levels.innerIdx();
+
+  for (auto iLevel = 0ul; iLevel < nLevel;) {
+    const auto size = levels.getNumNonZeros(iLevel);
+
+    if (size >= OMP_MIN_SIZE) {
+      /*--- The rows of a level are independent, the end of the loop synchronizes the threads. ---*/
+      SU2_OMP_FOR_STAT(computeStaticChunkSize(size, omp_get_num_threads(), OMP_MAX_SIZE_H))
+      for (auto k = levelPtr[iLevel]; k < levelPtr[iLevel+1]; ++k)
+        kernel(rows[k]);
+      ++iLevel;
+    }
+    else {
+      /*--- Process the next small levels sequentially, in order, with a single barrier. ---*/
+      auto last = iLevel+1;
+      while (last < nLevel && levels.getNumNonZeros(last) < OMP_MIN_SIZE) ++last;
+
+      SU2_OMP_MASTER
+      for (auto k = levelPtr[iLevel]; k < levelPtr[last]; ++k)
+        kernel(rows[k]);
+      SU2_OMP_BARRIER
+
+      iLevel = last;
+    }
+  }
+}
@@ -36,6 +36,7 @@
 #include <cstdlib>
 #include <iomanip>
 #include <string>
+#include <memory>
 
 #include "CSysVector.hpp"
 
@@ -83,6 +84,8 @@ private:
   mutable bool bcg_ready;    /*!< \brief Indicate if memory used by BCGSTAB is allocated. */
   mutable bool gmres_ready;  /*!< \brief Indicate if memory used by FGMRES is allocated. */
   mutable bool smooth_ready; /*!< \brief Indicate if memory used by SMOOTHER is allocated. */
+  mutable bool pgmres_ready; /*!< \brief Indicate if memory used by pipelined GMRES is allocated. */
+  mutable bool pbcg_ready;   /*!< \brief Indicate if memory used by pipelined BCGSTAB is allocated. */
 
   mutable VectorType r;      /*!< \brief Residual in CG and BCGSTAB. */
   mutable VectorType A_x;    /*!< \brief Result of matrix-vector product in CG and BCGSTAB. */
@@ -95,6 +98,17 @@ private:
   mutable std::vector<VectorType> W;  /*!< \brief Large matrix used by FGMRES, w^i+1 = A * z^i. */
   mutable std::vector<VectorType> Z;  /*!< \brief Large matrix used by FGMRES, preconditioned W. */
 
+  mutable std::vector<VectorType> PV;   /*!< \brief Krylov basis of pipelined GMRES. */
+  mutable std::vector<VectorType> PZ;   /*!< \brief Auxiliary basis of pipelined GMRES, z^i+1 = A * M^-1 * v^i. */
+  mutable std::vector<VectorType> PW;   /*!< \brief Work vectors of the pipelined solvers. */
+
+  mutable std::vector<ScalarType> redSum;    /*!< \brief Accumulator of the partial sums of a non-blocking reduction. */
+  mutable std::vector<ScalarType> redResult; /*!< \brief Result of a non-blocking reduction. */
+  mutable CBaseMPIWrapper::Request redRequest; /*!< \brief Request of the non-blocking reduction in progress. */
+  mutable passivedouble redStart = 0.0;       /*!< \brief Time at which the reduction in progress was started. */
+  mutable passivedouble redOverlapTime = 0.0; /*!< \brief Time spent doing useful work while reductions were in progress. */
+  mutable passivedouble redWaitTime = 0.0;    /*!< \brief Time spent waiting for reductions to complete. */
+
   VectorType  LinSysSol_tmp;        /*!< \brief Temporary used when it is necessary to interface between active and passive types. */
   VectorType  LinSysRes_tmp;        /*!< \brief Temporary used when it is necessary to interface between active and passive types. */
   VectorType* LinSysSol_ptr;        /*!< \brief Pointer to appropriate LinSysSol (set to original or temporary in call to Solve). */
@@ -102,6 +116,18 @@ private:
 
   LinearToleranceType tol_type = LinearToleranceType::RELATIVE; /*!< \brief How the linear solvers interpret the tolerance. */
 
+  bool mixed_stalled = false;  /*!< \brief The mixed precision mode stalled, only full precision is used from then on. */
+  bool reuse_precond = false;  /*!< \brief Skip the build of the preconditioner in Solve, the previous one is used. */
+#ifdef USE_RUNTIME_MIXED_PRECISION
+  std::unique_ptr<CSysMatrix<float> > JacobianFloat; /*!< \brief Float copy of the matrix, for the mixed precision mode. */
+  std::unique_ptr<CPreconditioner<float> > PrecondFloat; /*!< \brief Preconditioner built for the float matrix. */
+  const void* JacobianFloatSource = nullptr; /*!< \brief Matrix of which JacobianFloat is a copy. */
+  unsigned long JacobianFloatVersion = 0;    /*!< \brief Version of the values of that matrix when it was copied. */
+  std::unique_ptr<CSysSolve<float> > SolverFloat;    /*!< \brief Inner solver of the mixed precision mode. */
+  CSysVector<float> ResFloat, SolFloat;   /*!< \brief Residual and correction of the inner solves. */
+  VectorType ResRefine;                   /*!< \brief Residual (or correction) of the iterative refinement. */
+#endif
+
   /*!
    * \brief sign transfer function
    * \param[in] x - value having sign prescribed
@@ -170,6 +196,29 @@ private:
    */
   void ModGramSchmidt(int i, su2matrix<ScalarType>& Hsbg, std::vector<VectorType> & w) const;
 
+  /*!
+   * \brief Start the reduction, over threads and ranks, of partial sums (e.g. from CSysVector::localDot).
+   * \note Must be called by all threads, the reduction is non-blocking (except for AD types), the result
+   *       is obtained with FinishReduction which must be called before starting another reduction.
+   *       The buffers (redSum and redResult) must have been sized for n values before the parallel use.
+   * \param[in] partial - Partial sums of the calling thread.
+   * \param[in] n - Number of values.
+   */
+  void StartReduction(const ScalarType* partial, unsigned long n) const;
+
+  /*!
+   * \brief Wait for the reduction started by StartReduction, and get its result.
+   * \note Must be called by all threads, the times spent overlapping and waiting are accumulated.
+   * \param[out] result - Reduced values, the same for all threads.
+   * \param[in] n - Number of values.
+   */
+  void FinishReduction(ScalarType* result, unsigned long n) const;
+
+  /*!
+   * \brief writes the times accumulated by the non-blocking reductions
+   */
+  void WriteReductionTimes() const;
+
   /*!
    * \brief writes header information for a CSysSolve residual history
    * \param[in] solver - string describing the solver
@@ -278,6 +327,22 @@ private:
     SU2_OMP_BARRIER
   }
 
+  /*!
+   * \brief Solve the system by iterative refinement, the corrections are computed by inner solves in float
+   *        (with a float copy of the matrix and of the preconditioner), and the residuals in full precision.
+   * \note Operates on LinSysRes_ptr and LinSysSol_ptr, see Solve for the other parameters.
+   * \param[in,out] SolverTol - Tolerance, if the iterations stalled it is converted to the equivalent
+   *                absolute tolerance (relative to the norm of the rhs) for the full precision solve.
+   * \param[in,out] iters - Iterations of the inner solves (added to the input).
+   * \param[out] residual - Final normalized residual.
+   * \return False if the iterations stalled, in which case full precision should be used.
+   * \note The float copies of the matrix and of the preconditioner are kept between calls.
+   */
+  bool MixedPrecisionSolve(const MatrixType& Jacobian, CGeometry *geometry, const CConfig *config,
+                           unsigned short KindSolver, unsigned short KindPrecond, unsigned long MaxIter,
+                           unsigned long RestartIter, ScalarType& SolverTol, unsigned long& iters,
+                           ScalarType& residual);
+
 public:
 
   /*!
@@ -286,6 +351,11 @@ public:
    */
   CSysSolve(const bool mesh_deform_mode = false);
 
+  /*!
+   * \brief Destructor of the class.
+   */
+  ~CSysSolve();
+
   /*! \brief Conjugate Gradient method
    * \param[in] b - the right hand size vector
    * \param[in,out] x - on entry the intial guess, on exit the solution
@@ -333,6 +403,41 @@ public:
                                   const PrecondType & precond, ScalarType tol, unsigned long m,
                                   ScalarType & residual, bool monitoring, const CConfig *config) const;
 
+  /*!
+   * \brief Pipelined GMRES, the global reductions of each iteration are overlapped with the application
+   *        of the preconditioner and of the matrix (one reduction per iteration).
+   * \note Right preconditioning is used, the preconditioner must be fixed (not flexible).
+   * \param[in] b - the right hand size vector
+   * \param[in,out] x - on entry the intial guess, on exit the solution
+   * \param[in] mat_vec - object that defines matrix-vector product
+   * \param[in] precond - object that defines preconditioner
+   * \param[in] tol - tolerance with which to solve the system
+   * \param[in] m - maximum size of the search subspace
+   * \param[out] residual - final normalized residual
+   * \param[in] monitoring - turn on priting residuals from solver to screen.
+   * \param[in] config - Definition of the particular problem.
+   */
+  unsigned long PipelinedGMRES_LinSolver(const VectorType & b, VectorType & x, const ProductType & mat_vec,
+                                         const PrecondType & precond, ScalarType tol, unsigned long m,
+                                         ScalarType & residual, bool monitoring, const CConfig *config) const;
+
+  /*!
+   * \brief Pipelined BCGSTAB, the two global reductions of each iteration are overlapped with the
+   *        application of the preconditioner and of the matrix.
+   * \param[in] b - the right hand size vector
+   * \param[in,out] x - on entry the intial guess, on exit the solution
+   * \param[in] mat_vec - object that defines matrix-vector product
+   * \param[in] precond - object that defines preconditioner
+   * \param[in] tol - tolerance with which to solve the system
+   * \param[in] m - maximum number of iterations
+   * \param[out] residual - final normalized residual
+   * \param[in] monitoring - turn on priting residuals from solver to screen.
+   * \param[in] config - Definition of the particular problem.
+   */
+  unsigned long PipelinedBCGSTAB_LinSolver(const VectorType & b, VectorType & x, const ProductType & mat_vec,
+                                           const PrecondType & precond, ScalarType tol, unsigned long m,
+                                           ScalarType & residual, bool monitoring, const CConfig *config) const;
+
   /*!
    * \brief Generic smoother (modified Richardson iteration with preconditioner)
    * \param[in] b - the right hand size vector
@@ -383,6 +488,26 @@ public:
    */
   inline ScalarType GetResidual(void) const { return Residual; }
 
+  /*!
+   * \brief Get the time spent doing useful work while global reductions were in progress (pipelined solvers).
+   * \return Time hidden by the last call to a pipelined solver (this rank).
+   */
+  inline passivedouble GetReductionOverlapTime(void) const { return redOverlapTime; }
+
+  /*!
+   * \brief Get the time spent waiting for global reductions to complete (pipelined solvers).
+   * \return Time exposed by the last call to a pipelined solver (this rank).
+   */
+  inline passivedouble GetReductionWaitTime(void) const { return redWaitTime; }
+
+  /*!
+   * \brief Reuse the preconditioner built by the previous call to Solve (for the same matrix structure).
+   * \note The preconditioner data is stored by the matrix, it remains valid when only the values change,
+   *       but it becomes less effective as they drift from those it was built with.
+   * \param[in] reuse - True to skip the build of the preconditioner.
+   */
+  inline void SetReusePreconditioner(bool reuse) { reuse_precond = reuse; }
+
   /*!
    * \brief Set the type of the tolerance for stoping the linear solvers (RELATIVE or ABSOLUTE).
    */
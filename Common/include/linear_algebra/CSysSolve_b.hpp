@@ -32,8 +32,8 @@
 #ifdef CODI_REVERSE_TYPE
 template<class ScalarType>
 struct CSysSolve_b {
-  static void Solve_b(const codi::RealReverse::Real* x, codi::RealReverse::Real* x_b, size_t m,
-                      const codi::RealReverse::Real* y, const codi::RealReverse::Real* y_b, size_t n,
+  static void Solve_b(const su2double::Real* x, su2double::Real* x_b, size_t m,
+                      const su2double::Real* y, const su2double::Real* y_b, size_t n,
                       codi::DataStore* d);
 };
 #endif
@@ -325,6 +325,24 @@ class CSysVector : public VecExpr::CVecExpr<CSysVector<ScalarType>, ScalarType>
     return dotRes;
   }
 
+  /*!
+   * \brief Partial dot product between "this" and an expression, over the entries assigned to the calling thread.
+   * \note The reduction over threads and ranks is left to the caller (e.g. to make it non-blocking). There is
+   *       no synchronization, the work is distributed as in the other vector operations.
+   * \param[in] expr - Expression.
+   * \return Partial result of the dot product.
+   */
+  template <class T>
+  ScalarType localDot(const VecExpr::CVecExpr<T, ScalarType>& expr) const {
+    ScalarType sum = 0.0;
+
+    CSYSVEC_PARFOR
+    for (auto i = 0ul; i < nElmDomain; ++i) {
+      sum += vec_val[i] * expr.derived()[i];
+    }
+    return sum;
+  }
+
   /*!
    * \brief Squared L2 norm of the vector (via dot with self).
    * \return Squared L2 norm.
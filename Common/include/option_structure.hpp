@@ -136,6 +136,12 @@ const int SU2_CONN_SIZE   = 10;  /*!< \brief Size of the connectivity array that
                                              that we read from a mesh file in the format [[globalID vtkType n0 n1 n2 n3 n4 n5 n6 n7 n8]. */
 const int SU2_CONN_SKIP   = 2;   /*!< \brief Offset to skip the globalID and VTK type at the start of the element connectivity list for each CGNS element. */
 
+const int SU2_BINARY_MESH_MAGIC   = 0x5355324D; /*!< \brief Magic number (hex representation of "SU2M") at the start of native binary SU2 meshes. */
+const int SU2_BINARY_MESH_VERSION = 1;          /*!< \brief Version of the native binary SU2 mesh format. */
+const int SU2_BINARY_MESH_HEADER  = 10;         /*!< \brief Number of 64-bit integers in the header (index) of a native binary SU2 mesh. */
+const int SU2_BINARY_ELEM_SIZE    = 9;          /*!< \brief Size of the volume element records of a native binary SU2 mesh [vtkType n0 n1 n2 n3 n4 n5 n6 n7]. */
+const int SU2_BINARY_BOUND_SIZE   = 5;          /*!< \brief Size of the surface element records of a native binary SU2 mesh [vtkType n0 n1 n2 n3]. */
+
 const su2double COLORING_EFF_THRESH = 0.875;  /*!< \brief Below this value fallback strategies are used instead. */
 
 /*--- All temperature polynomial fits for the fluid models currently
@@ -1658,10 +1664,12 @@ enum ENUM_INPUT {
   SU2       = 1,  /*!< \brief SU2 input format. */
   CGNS_GRID = 2,  /*!< \brief CGNS input format for the computational grid. */
   RECTANGLE = 3,  /*!< \brief 2D rectangular mesh with N x M points of size Lx x Ly. */
-  BOX       = 4   /*!< \brief 3D box mesh with N x M x L points of size Lx x Ly x Lz. */
+  BOX       = 4,  /*!< \brief 3D box mesh with N x M x L points of size Lx x Ly x Lz. */
+  SU2_BINARY = 5  /*!< \brief Native SU2 binary input format (read in parallel with MPI I/O). */
 };
 static const MapType<string, ENUM_INPUT> Input_Map = {
   MakePair("SU2", SU2)
+  MakePair("SU2_BINARY", SU2_BINARY)
   MakePair("CGNS", CGNS_GRID)
   MakePair("RECTANGLE", RECTANGLE)
   MakePair("BOX", BOX)
@@ -1689,7 +1697,8 @@ enum ENUM_OUTPUT {
   STL_BINARY              = 16, /*!< \brief STL binary format for surface solution output. Not implemented yet. */
   PARAVIEW_XML            = 17, /*!< \brief Paraview XML with binary data format */
   SURFACE_PARAVIEW_XML    = 18, /*!< \brief Surface Paraview XML with binary data format */
-  PARAVIEW_MULTIBLOCK     = 19  /*!< \brief Paraview XML Multiblock */
+  PARAVIEW_MULTIBLOCK     = 19, /*!< \brief Paraview XML Multiblock */
+  SURFACE_CGNS            = 20  /*!< \brief CGNS format for the surface solution output. */
 };
 static const MapType<string, ENUM_OUTPUT> Output_Map = {
   MakePair("TECPLOT_ASCII", TECPLOT)
@@ -1708,6 +1717,7 @@ static const MapType<string, ENUM_OUTPUT> Output_Map = {
   MakePair("RESTART_ASCII", RESTART_ASCII)
   MakePair("RESTART", RESTART_BINARY)
   MakePair("CGNS", CGNS)
+  MakePair("SURFACE_CGNS", SURFACE_CGNS)
   MakePair("STL", STL)
   MakePair("STL_BINARY", STL_BINARY)
 };
@@ -1923,6 +1933,8 @@ enum ENUM_LINEAR_SOLVER {
   SMOOTHER = 8,             /*!< \brief Iterative smoother. */
   PASTIX_LDLT = 9,          /*!< \brief PaStiX LDLT (complete) factorization. */
   PASTIX_LU = 10,           /*!< \brief PaStiX LU (complete) factorization. */
+  PIPELINED_GMRES = 11,     /*!< \brief GMRES with the global reductions overlapped with the matrix-vector product. */
+  PIPELINED_BCGSTAB = 12,   /*!< \brief BCGSTAB with the global reductions overlapped with the matrix-vector product. */
 };
 static const MapType<string, ENUM_LINEAR_SOLVER> Linear_Solver_Map = {
   MakePair("STEEPEST_DESCENT", STEEPEST_DESCENT)
@@ -1932,6 +1944,8 @@ static const MapType<string, ENUM_LINEAR_SOLVER> Linear_Solver_Map = {
   MakePair("BCGSTAB", BCGSTAB)
   MakePair("FGMRES", FGMRES)
   MakePair("RESTARTED_FGMRES", RESTARTED_FGMRES)
+  MakePair("PIPELINED_GMRES", PIPELINED_GMRES)
+  MakePair("PIPELINED_BCGSTAB", PIPELINED_BCGSTAB)
   MakePair("SMOOTHER", SMOOTHER)
   MakePair("PASTIX_LDLT", PASTIX_LDLT)
   MakePair("PASTIX_LU", PASTIX_LU)
@@ -1994,6 +2008,7 @@ enum ENUM_LINEAR_SOLVER_PREC {
   PASTIX_ILU= 5,     /*!< \brief PaStiX ILU(k) preconditioner. */
   PASTIX_LU_P= 6,    /*!< \brief PaStiX LU as preconditioner. */
   PASTIX_LDLT_P= 7,  /*!< \brief PaStiX LDLT as preconditioner. */
+  AMG = 8,           /*!< \brief Aggregation-based algebraic multigrid preconditioner. */
 };
 static const MapType<string, ENUM_LINEAR_SOLVER_PREC> Linear_Solver_Prec_Map = {
   MakePair("JACOBI", JACOBI)
@@ -2003,6 +2018,19 @@ static const MapType<string, ENUM_LINEAR_SOLVER_PREC> Linear_Solver_Prec_Map = {
   MakePair("PASTIX_ILU", PASTIX_ILU)
   MakePair("PASTIX_LU", PASTIX_LU_P)
   MakePair("PASTIX_LDLT", PASTIX_LDLT_P)
+  MakePair("AMG", AMG)
+};
+
+/*!
+ * \brief Thread-parallel strategy of the ILU and LU_SGS preconditioners.
+ */
+enum ENUM_LINEAR_SOLVER_PREC_SCHEDULE {
+  PREC_SCHEDULE_PARTITIONS = 0,  /*!< \brief Independent sweeps on contiguous row partitions (block-Jacobi between threads). */
+  PREC_SCHEDULE_LEVELS = 1,      /*!< \brief Level scheduling, same result as the sequential sweeps. */
+};
+static const MapType<string, ENUM_LINEAR_SOLVER_PREC_SCHEDULE> Linear_Solver_Prec_Schedule_Map = {
+  MakePair("PARTITIONS", PREC_SCHEDULE_PARTITIONS)
+  MakePair("LEVEL_SCHEDULING", PREC_SCHEDULE_LEVELS)
 };
 
 /*!
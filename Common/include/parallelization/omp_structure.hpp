@@ -47,8 +47,9 @@
 #endif
 
 /*--- Detect compilation with OpenMP support, protect agaisnt
- *    using OpenMP with Reverse AD (not supported yet). ---*/
-#if defined(_OPENMP) && !defined(CODI_REVERSE_TYPE)
+ *    using OpenMP with Reverse AD unless OpDiLib is available
+ *    to record the parallel regions (see ad_structure.hpp). ---*/
+#if defined(_OPENMP) && (!defined(CODI_REVERSE_TYPE) || defined(HAVE_OPDI))
 #define HAVE_OMP
 #include <omp.h>
 
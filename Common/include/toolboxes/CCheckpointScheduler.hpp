@@ -0,0 +1,163 @@
+/*!
+ * \file CCheckpointScheduler.hpp
+ * \brief Binomial checkpointing schedule to reverse a sequence of time steps.
+ * \author SU2 Developers
+ * \version 7.1.0 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <string>
+#include <vector>
+#include "../basic_types/datatype_structure.hpp"
+
+/*!
+ * \class CCheckpointScheduler
+ * \brief Provides the states of a time-stepping process in reverse order (as needed by unsteady adjoints)
+ *        using a bounded number of snapshots, the missing states are recomputed from the nearest snapshot.
+ * \note The snapshot positions follow the binomial (revolve) strategy of Griewank and Walther, which minimizes
+ *       the number of recomputed steps for a given number of snapshots. States are numbered from -1 (the initial
+ *       condition, which can always be restored) and must be requested in decreasing order.
+ *       The snapshots form a stack, the bottom "nDisk" slots are files (they are overwritten less often),
+ *       the top "nMemory" slots are kept in memory. The class stores flat buffers of passive values, the
+ *       packing of the actual state is the responsibility of the caller.
+ * \author SU2 Developers
+ */
+class CCheckpointScheduler {
+public:
+  /*!
+   * \brief Type of operation in a schedule.
+   */
+  enum class Action : unsigned char {
+    RESTORE_INITIAL,  /*!< \brief Set the initial condition (state -1). */
+    RESTORE,          /*!< \brief Load the snapshot in "slot" (state "step"). */
+    ADVANCE,          /*!< \brief Advance from the current state to state "step". */
+    STORE             /*!< \brief Save the current state (state "step") to "slot". */
+  };
+
+  /*!
+   * \brief Operation of a schedule.
+   */
+  struct Operation {
+    Action action;
+    long step;
+    unsigned long slot;
+  };
+
+  /*!
+   * \brief Cost counters.
+   */
+  struct Statistics {
+    unsigned long requests = 0;       /*!< \brief Number of requested states. */
+    unsigned long advances = 0;       /*!< \brief Number of recomputed steps. */
+    unsigned long storesMemory = 0, storesDisk = 0;
+    unsigned long restoresMemory = 0, restoresDisk = 0;
+    unsigned long maxSlotsUsed = 0;
+    passivedouble bytesMemory = 0.0;  /*!< \brief Peak memory of the in-memory snapshots. */
+    passivedouble bytesDisk = 0.0;    /*!< \brief Total volume written to disk. */
+    passivedouble timeDisk = 0.0;     /*!< \brief Time spent in file I/O. */
+    passivedouble timeAdvance = 0.0;  /*!< \brief Time spent recomputing (set by the caller). */
+  };
+
+private:
+  const unsigned long nMemory, nDisk; /*!< \brief Number of slots of each kind. */
+  const std::string fileName;         /*!< \brief Base name of the disk slots. */
+
+  std::vector<long> stack;            /*!< \brief Steps stored in the slots (slot = position in the stack). */
+  long lastRequest;                   /*!< \brief To check the order of the requests. */
+
+  std::vector<std::vector<passivedouble> > memorySlots;
+  Statistics stats;
+
+  /*!
+   * \brief Name of the file of a disk slot (one per rank).
+   */
+  std::string SlotFileName(unsigned long slot) const;
+
+public:
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] nMemorySlots - Number of snapshots kept in memory.
+   * \param[in] nDiskSlots - Number of snapshots written to files.
+   * \param[in] diskFileName - Base name of the snapshot files.
+   */
+  CCheckpointScheduler(unsigned long nMemorySlots, unsigned long nDiskSlots, std::string diskFileName);
+
+  /*!
+   * \brief Destructor, removes the snapshot files.
+   */
+  ~CCheckpointScheduler();
+
+  CCheckpointScheduler(const CCheckpointScheduler&) = delete;
+  CCheckpointScheduler& operator= (const CCheckpointScheduler&) = delete;
+
+  /*!
+   * \brief Binomial coefficient C(n+k, n), saturated at the max of unsigned long (0 if k < 0).
+   */
+  static unsigned long Beta(unsigned long n, long k);
+
+  /*!
+   * \brief Optimal number of steps to advance before taking the first snapshot.
+   * \param[in] nSteps - Number of steps to reverse (at least 2), the initial state is available.
+   * \param[in] nSnapshots - Number of free snapshots (at least 1).
+   * \return Number of steps, between 1 and nSteps-1.
+   */
+  static unsigned long OptimalSplit(unsigned long nSteps, unsigned long nSnapshots);
+
+  /*!
+   * \brief Minimum number of recomputed steps to reverse nSteps with nSnapshots (initial state available).
+   */
+  static unsigned long MinimumAdvances(unsigned long nSteps, unsigned long nSnapshots);
+
+  /*!
+   * \brief Get the schedule to obtain a given state, the slots no longer needed are released.
+   * \param[in] step - The state (>= 0), must be smaller than in the previous request.
+   * \return Sequence of operations, always starts with a restore, and ends in the requested state.
+   */
+  std::vector<Operation> Request(long step);
+
+  /*!
+   * \brief Check if a slot is a file.
+   */
+  inline bool IsOnDisk(unsigned long slot) const { return slot < nDisk; }
+
+  /*!
+   * \brief Total number of slots.
+   */
+  inline unsigned long GetnSlots() const { return nMemory + nDisk; }
+
+  /*!
+   * \brief Save data to a slot.
+   */
+  void Save(unsigned long slot, const std::vector<passivedouble>& data);
+
+  /*!
+   * \brief Load data from a slot.
+   */
+  void Load(unsigned long slot, std::vector<passivedouble>& data);
+
+  /*!
+   * \brief Access the cost counters.
+   */
+  inline Statistics& GetStatistics() { return stats; }
+  inline const Statistics& GetStatistics() const { return stats; }
+};
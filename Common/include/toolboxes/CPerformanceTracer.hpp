@@ -0,0 +1,190 @@
+/*!
+ * \file CPerformanceTracer.hpp
+ * \brief Lightweight scoped timers recorded per thread and exported as a Chrome trace.
+ * \author SU2 Developers
+ * \version 7.1.0 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <string>
+#include <vector>
+#include "../parallelization/mpi_structure.hpp"
+#include "../parallelization/omp_structure.hpp"
+
+/*!
+ * \class CPerformanceTracer
+ * \brief Records timed events (name, category, start, end) in per-thread buffers, without locks, and writes
+ *        them in the Chrome trace event format (JSON), which can be opened in chrome://tracing or Perfetto.
+ * \note Each MPI rank is shown as a process and each OpenMP thread as a thread of that process. Events are
+ *       nested by time, i.e. a scope opened inside another is shown below it. When tracing is disabled the
+ *       cost of a scope is one branch, when the buffer of a thread is full further events are dropped.
+ *       The names and categories must be string literals (or otherwise outlive the tracer).
+ * \author SU2 Developers
+ */
+class CPerformanceTracer {
+public:
+  /*!
+   * \brief A timed event, times are relative to the origin of the tracer.
+   */
+  struct Event {
+    const char* name;
+    const char* category;
+    passivedouble start, end;
+  };
+
+private:
+  /*!
+   * \brief Events of one thread, padded to avoid false sharing between threads.
+   */
+  struct ThreadBuffer {
+    std::vector<Event> events;
+    unsigned long nDropped = 0;
+    char padding[64];
+  };
+
+  static bool enabled;                        /*!< \brief Whether events are being recorded. */
+  static bool waitTimer;                      /*!< \brief Whether the MPI wait time is accumulated. */
+  static passivedouble waitTime;              /*!< \brief Accumulated MPI wait time (master thread). */
+  static passivedouble origin;                /*!< \brief Time at which tracing started (synchronized). */
+  static unsigned long maxEvents;             /*!< \brief Capacity of the buffer of each thread. */
+  static std::vector<ThreadBuffer> buffers;   /*!< \brief One buffer per thread. */
+
+public:
+  /*!
+   * \brief Start recording, must be called by all ranks outside parallel regions.
+   * \param[in] maxEventsPerThread - Capacity of the buffer of each thread.
+   */
+  static void Initialize(unsigned long maxEventsPerThread);
+
+  /*!
+   * \brief Whether the tracer is recording events.
+   */
+  static inline bool IsEnabled() { return enabled; }
+
+  /*!
+   * \brief Current time relative to the origin of the tracer.
+   */
+  static inline passivedouble Now() { return SU2_MPI::Wtime() - origin; }
+
+  /*!
+   * \brief Record an event for the calling thread.
+   * \param[in] name - Name of the event.
+   * \param[in] category - Category of the event.
+   * \param[in] start - Start time (from Now()).
+   * \param[in] end - End time (from Now()).
+   */
+  static void AddEvent(const char* name, const char* category, passivedouble start, passivedouble end);
+
+  /*!
+   * \brief Start accumulating the time spent waiting for MPI messages (independently of the trace).
+   */
+  static inline void EnableWaitTimer() { waitTimer = true; }
+
+  /*!
+   * \brief Whether MPI waits need to be timed, either for the trace or for the wait timer.
+   */
+  static inline bool IsWaitTimed() { return enabled || waitTimer; }
+
+  /*!
+   * \brief Get the MPI wait time accumulated on this rank since the last reset.
+   */
+  static inline passivedouble GetWaitTime() { return waitTime; }
+
+  /*!
+   * \brief Reset the accumulated MPI wait time.
+   */
+  static inline void ResetWaitTime() { waitTime = 0.0; }
+
+  /*!
+   * \brief Record an MPI wait, it is added to the wait time and to the trace (category "mpi wait").
+   * \note Waits are always done by the master thread, this is not thread-safe.
+   * \param[in] name - Name of the event.
+   * \param[in] start - Start time (from Now()).
+   * \param[in] end - End time (from Now()).
+   */
+  static inline void AddWait(const char* name, passivedouble start, passivedouble end) {
+    if (waitTimer) waitTime += end - start;
+    if (enabled) AddEvent(name, "mpi wait", start, end);
+  }
+
+  /*!
+   * \brief Write the events of all ranks and threads to a Chrome trace file and stop recording.
+   * \note Collective call, must be made outside parallel regions.
+   * \param[in] fileName - Name of the trace file.
+   */
+  static void WriteTrace(const std::string& fileName);
+};
+
+/*!
+ * \class CTraceScope
+ * \brief Times the scope in which it is declared and records it in the CPerformanceTracer.
+ */
+class CTraceScope {
+private:
+  const char* name;
+  const char* category;
+  passivedouble start;
+
+public:
+  /*!
+   * \brief Start timing the current scope.
+   * \param[in] name_ - Name of the event, must be a string literal.
+   * \param[in] category_ - Category of the event, must be a string literal.
+   */
+  inline CTraceScope(const char* name_, const char* category_) :
+    name(CPerformanceTracer::IsEnabled()? name_ : nullptr), category(category_),
+    start(name? CPerformanceTracer::Now() : 0.0) {}
+
+  inline ~CTraceScope() {
+    if (name) CPerformanceTracer::AddEvent(name, category, start, CPerformanceTracer::Now());
+  }
+
+  CTraceScope(const CTraceScope&) = delete;
+  CTraceScope& operator=(const CTraceScope&) = delete;
+};
+
+/*!
+ * \class CTraceWaitScope
+ * \brief Times an MPI wait, for the trace and for the accumulated wait time of the rank.
+ */
+class CTraceWaitScope {
+private:
+  const char* name;
+  passivedouble start;
+
+public:
+  /*!
+   * \brief Start timing the wait.
+   * \param[in] name_ - Name of the event, must be a string literal.
+   */
+  inline explicit CTraceWaitScope(const char* name_) :
+    name(CPerformanceTracer::IsWaitTimed()? name_ : nullptr),
+    start(name? CPerformanceTracer::Now() : 0.0) {}
+
+  inline ~CTraceWaitScope() {
+    if (name) CPerformanceTracer::AddWait(name, start, CPerformanceTracer::Now());
+  }
+
+  CTraceWaitScope(const CTraceWaitScope&) = delete;
+  CTraceWaitScope& operator=(const CTraceWaitScope&) = delete;
+};
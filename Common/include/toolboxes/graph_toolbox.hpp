@@ -645,6 +645,66 @@ T colorSparsePattern(const T& pattern, size_t groupSize = 1, bool balanceColors
 }
 
 
+/*!
+ * \brief Level scheduling of a triangular (forward or backward) sweep over the rows of a sparse pattern.
+ * \note Rows of the same level only depend on rows of previous levels, they can thus be processed
+ *       in parallel while the result of the sweep is the same as in sequential execution.
+ *       The column indices of each row must be sorted, columns >= numRows (e.g. halos) are ignored.
+ * \param[in] numRows - Number of rows to schedule.
+ * \param[in] outerPtr - Pointers to the first entry of each row.
+ * \param[in] innerIdx - Column indices.
+ * \param[in] diagPtr - Pointers to the diagonal entry of each row.
+ * \param[in] upper - Schedule the backward sweep (dependencies in the upper triangle).
+ * \return Pattern with the rows of each level (outer index), levels are in order of execution.
+ */
+template<class T = CCompressedSparsePatternUL, typename Index_t>
+T levelSchedule(Index_t numRows, const Index_t* outerPtr, const Index_t* innerIdx,
+                const Index_t* diagPtr, bool upper)
+{
+  /*--- The level of a row is one more than the maximum level of its dependencies. ---*/
+  std::vector<Index_t> rowLevel(numRows, 0);
+  Index_t nLevel = (numRows > 0);
+
+  for(Index_t k = 0; k < numRows; ++k)
+  {
+    const Index_t iRow = upper? numRows-1-k : k;
+    Index_t level = 0;
+
+    if (upper) {
+      for(Index_t iNZ = diagPtr[iRow]+1; iNZ < outerPtr[iRow+1]; ++iNZ) {
+        if (innerIdx[iNZ] >= numRows) break;
+        level = std::max(level, rowLevel[innerIdx[iNZ]]+1);
+      }
+    }
+    else {
+      for(Index_t iNZ = outerPtr[iRow]; iNZ < diagPtr[iRow]; ++iNZ)
+        level = std::max(level, rowLevel[innerIdx[iNZ]]+1);
+    }
+    rowLevel[iRow] = level;
+    nLevel = std::max(nLevel, level+1);
+  }
+
+  /*--- Sort the rows by level (counting sort), keeping the sweep order within each level. ---*/
+
+  su2vector<Index_t> levelPtr(nLevel+1);
+  levelPtr = 0;
+  for(Index_t iRow = 0; iRow < numRows; ++iRow)
+    levelPtr(rowLevel[iRow]+1) += 1;
+  for(Index_t iLevel = 0; iLevel < nLevel; ++iLevel)
+    levelPtr(iLevel+1) += levelPtr(iLevel);
+
+  std::vector<Index_t> next(levelPtr.data(), levelPtr.data()+nLevel);
+  su2vector<Index_t> rows(numRows);
+
+  for(Index_t k = 0; k < numRows; ++k)
+  {
+    const Index_t iRow = upper? numRows-1-k : k;
+    rows(next[rowLevel[iRow]]++) = iRow;
+  }
+
+  return T(std::move(levelPtr), std::move(rows));
+}
+
 /*!
  * \brief A way to represent one grid color that allows range-for syntax.
  */
@@ -648,6 +648,12 @@ unsigned short CConfig::GetnZone(string val_mesh_filename, unsigned short val_fo
 
       break;
     }
+    case SU2_BINARY: {
+
+      /*--- Native SU2 binary meshes contain a single zone. ---*/
+      nZone = 1;
+      break;
+    }
     case RECTANGLE: {
       nZone = 1;
       break;
@@ -758,6 +764,25 @@ unsigned short CConfig::GetnDim(string val_mesh_filename, unsigned short val_for
 
       break;
     }
+    case SU2_BINARY: {
+
+      /*--- Read the header of the file, the dimension is its third entry. ---*/
+      uint64_t header[SU2_BINARY_MESH_HEADER] = {0};
+      ifstream mesh_file(val_mesh_filename, ios::in | ios::binary);
+      if (mesh_file.fail()) {
+        SU2_MPI::Error(string("The SU2 binary mesh file named ") + val_mesh_filename + string(" was not found."), CURRENT_FUNCTION);
+      }
+      mesh_file.read(reinterpret_cast<char*>(header), sizeof(header));
+      mesh_file.close();
+
+      if (header[0] != uint64_t(SU2_BINARY_MESH_MAGIC)) {
+        SU2_MPI::Error(val_mesh_filename + string(" is not a native SU2 binary mesh file. Please check."),
+                       CURRENT_FUNCTION);
+      }
+      nDim = short(header[2]);
+
+      break;
+    }
     case RECTANGLE: {
       nDim = 2;
       break;
@@ -913,6 +938,8 @@ void CConfig::SetPointersNull(void) {
   CFL_AdaptParam      = nullptr;
   CFL                 = nullptr;
   HTP_Axis = nullptr;
+
+  LUT_Density_Range = nullptr;    LUT_Temperature_Range = nullptr;
   PlaneTag            = nullptr;
   Kappa_Flow          = nullptr;
   Kappa_AdjFlow       = nullptr;
@@ -1162,6 +1189,8 @@ void CConfig::SetConfig_Options() {
   addBoolOption("IONIZATION", ionization, false);
   /* DESCRIPTION: Specify if there is VT transfer residual limiting */
   addBoolOption("VT_RESIDUAL_LIMITING", vt_transfer_res_limit, false);
+  /* DESCRIPTION: Specify if the chemistry and VT transfer sources are treated point-implicitly */
+  addBoolOption("POINT_IMPLICIT_SOURCE", point_implicit_source, false);
   /* DESCRIPTION: List of catalytic walls */
   addStringListOption("CATALYTIC_WALL", nWall_Catalytic, Wall_Catalytic);
   /*!\brief MARKER_MONITORING\n DESCRIPTION: Marker(s) of the surface where evaluate the non-dimensional coefficients \ingroup Config*/
@@ -1180,6 +1209,21 @@ void CConfig::SetConfig_Options() {
   /* DESCRIPTION: Critical Density, default value for MDM */
    addDoubleOption("ACENTRIC_FACTOR", Acentric_Factor, 0.035);
 
+  /*--- Options related to the tabulated (look-up table) evaluation of the fluid model ---*/
+  /* DESCRIPTION: Replace the thermodynamic evaluations of the fluid model by interpolation in a (rho,e) table */
+  addBoolOption("LUT_FLUID_MODEL", LUT_FluidModel, false);
+  /* DESCRIPTION: Number of table nodes in the density and in the energy directions */
+  addUnsignedLongOption("LUT_DENSITY_NODES", LUT_nNodes_Density, 256);
+  addUnsignedLongOption("LUT_ENERGY_NODES", LUT_nNodes_Energy, 256);
+  /* DESCRIPTION: Density range of the table (kg/m^3), (0,0) for an automatic range around the free-stream */
+  addDoubleArrayOption("LUT_DENSITY_RANGE", 2, LUT_Density_Range, default_lut_range.data());
+  /* DESCRIPTION: Temperature range of the table (K), (0,0) for an automatic range around the free-stream */
+  addDoubleArrayOption("LUT_TEMPERATURE_RANGE", 2, LUT_Temperature_Range, default_lut_range.data());
+  /* DESCRIPTION: Binary file the table is loaded from (if compatible) or saved to, empty to keep it in memory only */
+  addStringOption("LUT_FILENAME", LUT_FileName, string(""));
+  /* DESCRIPTION: Compare every N-th table evaluation against the exact model to monitor the error (0 disables) */
+  addUnsignedLongOption("LUT_ERROR_SAMPLING", LUT_Error_Sampling, 0);
+
    /*--- Options related to Viscosity Model ---*/
   /*!\brief VISCOSITY_MODEL \n DESCRIPTION: model of the viscosity \n OPTIONS: See \link ViscosityModel_Map \endlink \n DEFAULT: SUTHERLAND \ingroup Config*/
   addEnumOption("VISCOSITY_MODEL", Kind_ViscosityModel, ViscosityModel_Map, SUTHERLAND);
@@ -1649,6 +1693,14 @@ void CConfig::SetConfig_Options() {
   addLongOption("UNST_RESTART_ITER", Unst_RestartIter, 0);
   /* DESCRIPTION: Starting direct solver iteration for the unsteady adjoint */
   addLongOption("UNST_ADJOINT_ITER", Unst_AdjointIter, 0);
+  /* DESCRIPTION: Recompute the primal time steps for the unsteady adjoint from checkpoints instead of reading restart files */
+  addBoolOption("UNST_ADJOINT_CHECKPOINTING", Unst_Checkpointing, false);
+  /* DESCRIPTION: Number of primal snapshots kept in memory (unsteady adjoint checkpointing) */
+  addUnsignedLongOption("UNST_CHECKPOINTS_MEMORY", Unst_Checkpoints_Memory, 10);
+  /* DESCRIPTION: Number of primal snapshots written to disk (unsteady adjoint checkpointing) */
+  addUnsignedLongOption("UNST_CHECKPOINTS_DISK", Unst_Checkpoints_Disk, 0);
+  /* DESCRIPTION: Base name of the snapshot files (unsteady adjoint checkpointing) */
+  addStringOption("UNST_CHECKPOINTS_FILENAME", Unst_Checkpoints_FileName, string("checkpoint"));
   /* DESCRIPTION: Number of iterations to average the objective */
   addLongOption("ITER_AVERAGE_OBJ", Iter_Avg_Objective , 0);
   /* DESCRIPTION: Iteration number to begin unsteady restarts (structural analysis) */
@@ -1689,12 +1741,36 @@ void CConfig::SetConfig_Options() {
   addUnsignedLongOption("LINEAR_SOLVER_ITER", Linear_Solver_Iter, 10);
   /* DESCRIPTION: Fill in level for the ILU preconditioner */
   addUnsignedShortOption("LINEAR_SOLVER_ILU_FILL_IN", Linear_Solver_ILU_n, 0);
+  /* DESCRIPTION: Maximum number of levels (including the finest) of the AMG preconditioner */
+  addUnsignedShortOption("LINEAR_SOLVER_AMG_LEVELS", Linear_Solver_AMG_Levels, 10);
+  /* DESCRIPTION: Number of pre- and post-smoothing sweeps of the AMG preconditioner */
+  addUnsignedShortOption("LINEAR_SOLVER_AMG_SWEEPS", Linear_Solver_AMG_Sweeps, 1);
+  /* DESCRIPTION: Strength of connection threshold for the aggregation of the AMG preconditioner */
+  addDoubleOption("LINEAR_SOLVER_AMG_STRENGTH", Linear_Solver_AMG_Strength, 0.08);
+  /* DESCRIPTION: Solve the flow equations with the Jacobian-free Newton-Krylov method, the assembled Jacobian is the preconditioner */
+  addBoolOption("NEWTON_KRYLOV", NewtonKrylov, false);
+  /* DESCRIPTION: Number of standard iterations (per time step) before switching to Newton-Krylov */
+  addUnsignedLongOption("NEWTON_KRYLOV_STARTUP_ITER", NewtonKrylov_StartupIter, 10);
+  /* DESCRIPTION: Reduction of the residuals (orders of magnitude) required before switching to Newton-Krylov (0 disables the check) */
+  addDoubleOption("NEWTON_KRYLOV_STARTUP_RESIDUAL", NewtonKrylov_StartupResidual, 0.0);
+  /* DESCRIPTION: Maximum number of Krylov (FGMRES) iterations per Newton step */
+  addUnsignedLongOption("NEWTON_KRYLOV_ITER", NewtonKrylov_Iter, 50);
+  /* DESCRIPTION: Upper bound of the Eisenstat-Walker forcing term (relative tolerance of the Newton steps) */
+  addDoubleOption("NEWTON_KRYLOV_FORCING_MAX", NewtonKrylov_ForcingMax, 0.1);
+  /* DESCRIPTION: Relative step of the finite difference Jacobian-vector products */
+  addDoubleOption("NEWTON_KRYLOV_FD_STEP", NewtonKrylov_FDStep, 1e-7);
+  /* DESCRIPTION: Minimum step length factor of the backtracking line search (1 disables the line search) */
+  addDoubleOption("NEWTON_KRYLOV_LINESEARCH_MIN", NewtonKrylov_LineSearchMin, 0.1);
   /* DESCRIPTION: Maximum number of iterations of the linear solver for the implicit formulation */
   addUnsignedLongOption("LINEAR_SOLVER_RESTART_FREQUENCY", Linear_Solver_Restart_Frequency, 10);
   /* DESCRIPTION: Relaxation factor for iterative linear smoothers (SMOOTHER_ILU/JACOBI/LU-SGS/LINELET) */
   addDoubleOption("LINEAR_SOLVER_SMOOTHER_RELAXATION", Linear_Solver_Smoother_Relaxation, 1.0);
   /* DESCRIPTION: Custom number of threads used for additive domain decomposition for ILU and LU_SGS (0 is "auto"). */
   addUnsignedLongOption("LINEAR_SOLVER_PREC_THREADS", Linear_Solver_Prec_Threads, 0);
+  /* DESCRIPTION: Thread-parallel strategy of the ILU and LU_SGS preconditioners (PARTITIONS or LEVEL_SCHEDULING). */
+  addEnumOption("LINEAR_SOLVER_PREC_SCHEDULE", Kind_Linear_Solver_Prec_Schedule, Linear_Solver_Prec_Schedule_Map, PREC_SCHEDULE_PARTITIONS);
+  /* DESCRIPTION: Solve the linear systems by iterative refinement with inner solves in float. */
+  addBoolOption("LINEAR_SOLVER_MIXED_PRECISION", Linear_Solver_Mixed_Precision, false);
   /* DESCRIPTION: Relaxation factor for updates of adjoint variables. */
   addDoubleOption("RELAXATION_FACTOR_ADJOINT", Relaxation_Factor_Adjoint, 1.0);
   /* DESCRIPTION: Relaxation of the CHT coupling */
@@ -1946,6 +2022,8 @@ void CConfig::SetConfig_Options() {
   addStringOption("MESH_FILENAME", Mesh_FileName, string("mesh.su2"));
   /*!\brief MESH_OUT_FILENAME \n DESCRIPTION: Mesh output file name. Used when converting, scaling, or deforming a mesh. \n DEFAULT: mesh_out.su2 \ingroup Config*/
   addStringOption("MESH_OUT_FILENAME", Mesh_Out_FileName, string("mesh_out.su2"));
+  /*!\brief MESH_OUT_FORMAT \n DESCRIPTION: Mesh output file format (SU2 or SU2_BINARY) \n OPTIONS: see \link Input_Map \endlink \n DEFAULT: SU2 \ingroup Config*/
+  addEnumOption("MESH_OUT_FORMAT", Mesh_Out_FileFormat, Input_Map, SU2);
 
   /* DESCRIPTION: List of the number of grid points in the RECTANGLE or BOX grid in the x,y,z directions. (default: (33,33,33) ). */
   addShortListOption("MESH_BOX_SIZE", nMesh_Box_Size, Mesh_Box_Size);
@@ -2419,6 +2497,10 @@ void CConfig::SetConfig_Options() {
 
   addUnsignedShortOption("NUM_NEAREST_NEIGHBORS", NumNearestNeighbors, 1);
 
+  /*  DESCRIPTION: Exchange only the donor points near the targets of each rank, instead of gathering all donors on all ranks.
+   *  Options: NO, YES \ingroup Config */
+  addBoolOption("DISTRIBUTED_DONOR_SEARCH", DistributedDonorSearch, false);
+
   /*!\par KIND_INTERPOLATION \n
    * DESCRIPTION: Type of radial basis function to use for radial basis function interpolation. \n OPTIONS: see \link RadialBasis_Map \endlink
    * Sets Kind_RadialBasis \ingroup Config
@@ -2435,6 +2517,9 @@ void CConfig::SetConfig_Options() {
   /* DESCRIPTION: Tolerance to prune small coefficients from the RBF interpolation matrix. */
   addDoubleOption("RADIAL_BASIS_FUNCTION_PRUNE_TOLERANCE", RadialBasisFunction_PruneTol, 1e-6);
 
+  /* DESCRIPTION: Compute the RBF interpolation with an iterative sparse solver (compactly supported functions only). */
+  addBoolOption("RADIAL_BASIS_FUNCTION_SPARSE", RadialBasisFunction_Sparse, false);
+
    /*!\par INLETINTERPOLATION \n
    * DESCRIPTION: Type of spanwise interpolation to use for the inlet face. \n OPTIONS: see \link Inlet_SpanwiseInterpolation_Map \endlink
    * Sets Kind_InletInterpolation \ingroup Config
@@ -2755,6 +2840,18 @@ void CConfig::SetConfig_Options() {
   addUnsignedLongOption("OUTPUT_WRT_FREQ", VolumeWrtFreq, 250);
   /* DESCRIPTION: Volume solution files */
   addEnumListOption("OUTPUT_FILES", nVolumeOutputFiles, VolumeOutputFiles, Output_Map);
+  /* DESCRIPTION: Sort and write the volume output files on a background thread */
+  addBoolOption("OUTPUT_ASYNC", Output_Async, false);
+  /* DESCRIPTION: Record a timeline of the main routines in the Chrome trace format */
+  addBoolOption("PERFORMANCE_TRACE", Performance_Trace, false);
+  /* DESCRIPTION: Name of the performance trace file */
+  addStringOption("PERFORMANCE_TRACE_FILENAME", Performance_Trace_FileName, string("trace.json"));
+  /* DESCRIPTION: Maximum number of trace events recorded by each thread */
+  addUnsignedLongOption("PERFORMANCE_TRACE_BUFFER", Performance_Trace_Buffer, 100000);
+  /* DESCRIPTION: Write the per-rank partition statistics and compute/wait times, add the load balance history fields */
+  addBoolOption("LOAD_BALANCE_REPORT", Load_Balance_Report, false);
+  /* DESCRIPTION: Prefix of the load balance report files */
+  addStringOption("LOAD_BALANCE_FILENAME", Load_Balance_FileName, string("load_balance"));
 
   /* DESCRIPTION: Using Uncertainty Quantification with SST Turbulence Model */
   addBoolOption("USING_UQ", using_uq, false);
@@ -3541,6 +3638,13 @@ void CConfig::SetPostprocessing(unsigned short val_software, unsigned short val_
     }
   }
 
+  if (UseVectorization && Use_Accurate_Jacobians && (Kind_ConvNumScheme_Flow == SPACE_UPWIND) &&
+      ((Kind_Upwind_Flow == AUSMPLUSUP) || (Kind_Upwind_Flow == AUSMPLUSUP2) ||
+       (Kind_Upwind_Flow == SLAU) || (Kind_Upwind_Flow == SLAU2))) {
+    SU2_MPI::Error("USE_ACCURATE_FLUX_JACOBIANS is not available with USE_VECTORIZATION, the vectorized\n"
+                   "AUSM+up(2) and SLAU(2) schemes only have the approximate (Roe) Jacobians.", CURRENT_FUNCTION);
+  }
+
   if (nemo){
     if (Kind_Upwind_Flow == AUSMPWPLUS)
       SU2_MPI::Error("AUSMPW+ is extremely unstable. Feel free to fix me!", CURRENT_FUNCTION);
@@ -3554,6 +3658,20 @@ void CConfig::SetPostprocessing(unsigned short val_software, unsigned short val_
       SU2_MPI::Error("The option of FROZEN_MIXTURE is not yet working with Mutation++ support.", CURRENT_FUNCTION);
   }
 
+  if (nemo && point_implicit_source && Kind_TimeIntScheme_Flow != EULER_IMPLICIT){
+      SU2_MPI::Error("POINT_IMPLICIT_SOURCE requires TIME_DISCRE_FLOW= EULER_IMPLICIT.", CURRENT_FUNCTION);
+  }
+
+  if (LUT_FluidModel) {
+    if ((Kind_FluidModel != STANDARD_AIR) && (Kind_FluidModel != IDEAL_GAS) &&
+        (Kind_FluidModel != VW_GAS) && (Kind_FluidModel != PR_GAS))
+      SU2_MPI::Error("LUT_FLUID_MODEL is only available for STANDARD_AIR, IDEAL_GAS, VW_GAS, and PR_GAS.", CURRENT_FUNCTION);
+    if ((LUT_nNodes_Density < 2) || (LUT_nNodes_Energy < 2))
+      SU2_MPI::Error("The look-up table needs at least 2 nodes in each direction.", CURRENT_FUNCTION);
+    if ((LUT_Density_Range[0] > LUT_Density_Range[1]) || (LUT_Temperature_Range[0] > LUT_Temperature_Range[1]))
+      SU2_MPI::Error("LUT_DENSITY_RANGE and LUT_TEMPERATURE_RANGE must be given as (min, max).", CURRENT_FUNCTION);
+  }
+
   if(GetBoolTurbomachinery()){
     nBlades = new su2double[nZone];
     FreeStreamTurboNormal= new su2double[3];
@@ -4811,6 +4929,23 @@ void CConfig::SetPostprocessing(unsigned short val_software, unsigned short val_
                    CURRENT_FUNCTION);
   }
 
+  if ((Mesh_Out_FileFormat != SU2) && (Mesh_Out_FileFormat != SU2_BINARY)) {
+    SU2_MPI::Error("MESH_OUT_FORMAT must be SU2 or SU2_BINARY.", CURRENT_FUNCTION);
+  }
+
+#if defined CODI_REVERSE_TYPE || defined CODI_FORWARD_TYPE
+  if (Output_Async) {
+    SU2_MPI::Error("OUTPUT_ASYNC is not available in AD builds of SU2.", CURRENT_FUNCTION);
+  }
+#endif
+
+#ifndef USE_RUNTIME_MIXED_PRECISION
+  if (Linear_Solver_Mixed_Precision) {
+    SU2_MPI::Error("LINEAR_SOLVER_MIXED_PRECISION is not available with AD, or if SU2 was built with mixed precision\n"
+                   "(in which case the linear solvers already use float).", CURRENT_FUNCTION);
+  }
+#endif
+
   if (DiscreteAdjoint) {
 #if !defined CODI_REVERSE_TYPE
     if (Kind_SU2 == SU2_CFD) {
@@ -4840,6 +4975,24 @@ void CConfig::SetPostprocessing(unsigned short val_software, unsigned short val_
                        CURRENT_FUNCTION);
       }
 
+      if (Unst_Checkpointing) {
+        if ((TimeMarching != DT_STEPPING_1ST) && (TimeMarching != DT_STEPPING_2ND)) {
+          SU2_MPI::Error("UNST_ADJOINT_CHECKPOINTING requires dual time stepping.", CURRENT_FUNCTION);
+        }
+        if ((GetKind_GridMovement() != NO_MOVEMENT) || Deform_Mesh || Multizone_Problem) {
+          SU2_MPI::Error("UNST_ADJOINT_CHECKPOINTING is only available for single-zone problems on static grids.",
+                         CURRENT_FUNCTION);
+        }
+        switch (Kind_Solver) {
+          case EULER: case NAVIER_STOKES: case RANS:
+          case INC_EULER: case INC_NAVIER_STOKES: case INC_RANS:
+            break;
+          default:
+            SU2_MPI::Error("UNST_ADJOINT_CHECKPOINTING is only available for the finite volume flow solvers.",
+                           CURRENT_FUNCTION);
+        }
+      }
+
       /*--- If the averaging interval is not set, we average over all time-steps ---*/
 
       if (Iter_Avg_Objective == 0.0) {
@@ -4981,13 +5134,34 @@ void CConfig::SetPostprocessing(unsigned short val_software, unsigned short val_
     SU2_MPI::Error(string("CFL adaption minimum CFL is larger than the maximum CFL."), CURRENT_FUNCTION);
   }
 
+  if (NewtonKrylov) {
+    switch (Kind_Solver) {
+      case EULER: case NAVIER_STOKES: case RANS:
+      case INC_EULER: case INC_NAVIER_STOKES: case INC_RANS:
+        break;
+      default:
+        SU2_MPI::Error("NEWTON_KRYLOV is only available for the (primal) FVM compressible and incompressible solvers.",
+                       CURRENT_FUNCTION);
+    }
+    if (Kind_TimeIntScheme_Flow != EULER_IMPLICIT)
+      SU2_MPI::Error("NEWTON_KRYLOV requires TIME_DISCRE_FLOW= EULER_IMPLICIT.", CURRENT_FUNCTION);
+    if (nMGLevels != 0)
+      SU2_MPI::Error("NEWTON_KRYLOV does not support multigrid (MGLEVEL must be 0).", CURRENT_FUNCTION);
+    if (Low_Mach_Precon || (Kind_Upwind_Flow == TURKEL))
+      SU2_MPI::Error("NEWTON_KRYLOV does not support low Mach preconditioning.", CURRENT_FUNCTION);
+    if ((NewtonKrylov_ForcingMax <= 0.0) || (NewtonKrylov_ForcingMax >= 1.0))
+      SU2_MPI::Error("NEWTON_KRYLOV_FORCING_MAX must be in (0,1).", CURRENT_FUNCTION);
+    if (NewtonKrylov_Iter == 0)
+      SU2_MPI::Error("NEWTON_KRYLOV_ITER must be positive.", CURRENT_FUNCTION);
+  }
+
   /*--- 0 in the config file means "disable" which can be done using a very large group. ---*/
   if (edgeColorGroupSize==0) edgeColorGroupSize = 1<<30;
 
   /*--- Specifying a deforming surface requires a mesh deformation solver. ---*/
   if (GetSurface_Movement(DEFORMING)) Deform_Mesh = true;
 
-  if (GetGasModel() == "ARGON") monoatomic = true;
+  monoatomic = (GetGasModel() == "ARGON");
 }
 
 void CConfig::SetMarkers(unsigned short val_software) {
@@ -6397,15 +6571,22 @@ void CConfig::SetOutput(unsigned short val_software, unsigned short val_izone) {
             case BCGSTAB:
             case FGMRES:
             case RESTARTED_FGMRES:
-              if (Kind_Linear_Solver == BCGSTAB)
-                cout << "BCGSTAB is used for solving the linear system." << endl;
-              else
-                cout << "FGMRES is used for solving the linear system." << endl;
+            case PIPELINED_GMRES:
+            case PIPELINED_BCGSTAB:
+              switch (Kind_Linear_Solver) {
+                case BCGSTAB: cout << "BCGSTAB"; break;
+                case PIPELINED_GMRES: cout << "Pipelined GMRES"; break;
+                case PIPELINED_BCGSTAB: cout << "Pipelined BCGSTAB"; break;
+                default: cout << "FGMRES"; break;
+              }
+              cout << " is used for solving the linear system." << endl;
               switch (Kind_Linear_Solver_Prec) {
                 case ILU: cout << "Using a ILU("<< Linear_Solver_ILU_n <<") preconditioning."<< endl; break;
                 case LINELET: cout << "Using a linelet preconditioning."<< endl; break;
                 case LU_SGS:  cout << "Using a LU-SGS preconditioning."<< endl; break;
                 case JACOBI:  cout << "Using a Jacobi preconditioning."<< endl; break;
+                case AMG:     cout << "Using an algebraic multigrid preconditioning ("
+                                   << Linear_Solver_AMG_Levels << " levels max)." << endl; break;
               }
               break;
             case SMOOTHER:
@@ -6414,6 +6595,7 @@ void CConfig::SetOutput(unsigned short val_software, unsigned short val_izone) {
                 case LINELET: cout << "A Linelet"; break;
                 case LU_SGS:  cout << "A LU-SGS"; break;
                 case JACOBI:  cout << "A Jacobi"; break;
+                case AMG:     cout << "An algebraic multigrid"; break;
               }
               cout << " method is used for smoothing the linear system." << endl;
               break;
@@ -6451,6 +6633,12 @@ void CConfig::SetOutput(unsigned short val_software, unsigned short val_izone) {
               cout << "Convergence criteria of the linear solver: "<< Linear_Solver_Error <<"."<< endl;
               cout << "Max number of iterations: "<< Linear_Solver_Iter <<"."<< endl;
               break;
+            case PIPELINED_GMRES: case PIPELINED_BCGSTAB:
+              cout << "Pipelined " << (Kind_Linear_Solver == PIPELINED_GMRES? "GMRES" : "BCGSTAB")
+                   << " is used for solving the linear system." << endl;
+              cout << "Convergence criteria of the linear solver: "<< Linear_Solver_Error <<"."<< endl;
+              cout << "Max number of iterations: "<< Linear_Solver_Iter <<"."<< endl;
+              break;
             case CONJUGATE_GRADIENT:
               cout << "A Conjugate Gradient method is used for solving the linear system." << endl;
               cout << "Convergence criteria of the linear solver: "<< Linear_Solver_Error <<"."<< endl;
@@ -253,3 +253,59 @@ void CADTPointsOnlyClass::DetermineNearestNode_impl(vector<unsigned long>& front
   dist = sqrt(dist);
 
 }
+
+void CADTPointsOnlyClass::DetermineNodesWithinRadius_impl(vector<unsigned long>& frontLeaves,
+                                                          vector<unsigned long>& frontLeavesNew,
+                                                          const su2double *coor,
+                                                          su2double       radius,
+                                                          vector<unsigned long> &pointID) const {
+  pointID.clear();
+  if( isEmpty ) return;
+
+  const bool wasActive = AD::BeginPassive();
+
+  const su2double radius2 = radius*radius;
+
+  /*--- Traverse the tree, keeping the leaves whose bounding box intersects
+        the sphere, and the terminal children (nodes) that are inside it. ---*/
+  frontLeaves.clear();
+  frontLeaves.push_back(0);
+
+  while( !frontLeaves.empty() ) {
+
+    frontLeavesNew.clear();
+
+    for(const auto ll : frontLeaves) {
+      for(unsigned short mm=0; mm<2; ++mm) {
+
+        const unsigned long kk = leaves[ll].children[mm];
+        su2double dist = 0.0;
+
+        if( leaves[ll].childrenAreTerminal[mm] ) {
+          const su2double *coorTarget = coorPoints.data() + nDimADT*kk;
+          for(unsigned short l=0; l<nDimADT; ++l) {
+            const su2double ds = coor[l] - coorTarget[l];
+            dist += ds*ds;
+          }
+          if(dist <= radius2) pointID.push_back(localPointIDs[kk]);
+        }
+        else {
+          for(unsigned short l=0; l<nDimADT; ++l) {
+            su2double ds = 0.0;
+            if(     coor[l] < leaves[kk].xMin[l]) ds = coor[l] - leaves[kk].xMin[l];
+            else if(coor[l] > leaves[kk].xMax[l]) ds = coor[l] - leaves[kk].xMax[l];
+            dist += ds*ds;
+          }
+          if(dist <= radius2) frontLeavesNew.push_back(kk);
+        }
+      }
+    }
+    swap(frontLeaves, frontLeavesNew);
+  }
+
+  /*--- A tree with a single point has it in both children of the root. ---*/
+  sort(pointID.begin(), pointID.end());
+  pointID.erase(unique(pointID.begin(), pointID.end()), pointID.end());
+
+  AD::EndPassive(wasActive);
+}
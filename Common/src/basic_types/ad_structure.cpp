@@ -27,6 +27,11 @@
 
 #include "../../include/basic_types/datatype_structure.hpp"
 
+#ifdef HAVE_OPDI
+/*--- The backend (registered with the OpenMP runtime) is defined in this translation unit only. ---*/
+#include "opdi/backend/ompt/omptBackend.hpp"
+#endif
+
 namespace AD {
 #ifdef CODI_REVERSE_TYPE
   /*--- Initialization of the global variables ---*/
@@ -37,7 +42,6 @@ namespace AD {
   std::vector<su2double::GradientData> localInputValues;
   std::vector<su2double*> localOutputValues;
 
-  su2double::TapeType& globalTape = su2double::getGlobalTape();
   su2double::TapeType::Position StartPosition, EndPosition;
   std::vector<su2double::TapeType::Position> TapePositions;
 
@@ -48,5 +52,25 @@ namespace AD {
 
   ExtFuncHelper* FuncHelper;
 
+  void Initialize() {
+#ifdef HAVE_OPDI
+    /*--- The OMPT backend is registered by the OpenMP runtime, logic and tool need to be created. ---*/
+    opdi::logic = new opdi::OmpLogic;
+    opdi::logic->init();
+    opdi::tool = new CoDiOpDiLibTool<su2double>;
+    opdi::tool->init();
+#endif
+  }
+
+  void Finalize() {
+#ifdef HAVE_OPDI
+    opdi::backend->finalize();
+    opdi::logic->finalize();
+    opdi::tool->finalize();
+    delete opdi::logic;
+    delete opdi::tool;
+#endif
+  }
+
 #endif
 }
@@ -28,6 +28,8 @@
 #include "../../include/geometry/CGeometry.hpp"
 #include "../../include/geometry/elements/CElement.hpp"
 #include "../../include/parallelization/omp_structure.hpp"
+#include "../../include/toolboxes/CPerformanceTracer.hpp"
+#include "../../include/toolboxes/printing_toolbox.hpp"
 
 /*--- Cross product ---*/
 
@@ -368,6 +370,79 @@ void CGeometry::PreprocessP2PComms(CGeometry *geometry,
 
 }
 
+void CGeometry::ComputePartitionStatistics(const CConfig *config, unsigned short nVar) const {
+
+  /*--- Metrics of this rank, the sends are the halo points of the neighbors. ---*/
+
+  enum : int {N_POINT_DOMAIN, N_HALO, N_EDGE, N_ELEM, N_NEIGHBOR, N_POINT_SEND, N_BYTES_SEND, N_METRICS};
+
+  const char* names[N_METRICS] = {"Owned points", "Halo points", "Edges", "Elements",
+                                  "Neighbor ranks", "Points sent per exchange", "Bytes sent per exchange"};
+
+  const unsigned long nPointSend = (nPoint_P2PSend != nullptr)? nPoint_P2PSend[nP2PSend] : 0;
+
+  const unsigned long local[N_METRICS] = {nPointDomain, nPoint-nPointDomain, nEdge, nElem,
+                                          static_cast<unsigned long>(nP2PSend), nPointSend,
+                                          nPointSend*nVar*sizeof(su2double)};
+
+  vector<unsigned long> all(size*N_METRICS);
+  SU2_MPI::Allgather(local, N_METRICS, MPI_UNSIGNED_LONG, all.data(), N_METRICS, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+
+  if (rank != MASTER_NODE) return;
+
+  /*--- Print the spread of each metric, the imbalance is the ratio of the maximum to the average. ---*/
+
+  PrintingToolbox::CTablePrinter PartitionTable(&std::cout);
+  PartitionTable.AddColumn("Partition Metric", 26);
+  PartitionTable.AddColumn("Minimum", 13);
+  PartitionTable.AddColumn("Average", 13);
+  PartitionTable.AddColumn("Maximum", 13);
+  PartitionTable.AddColumn("Max/Avg", 10);
+  PartitionTable.SetAlign(PrintingToolbox::CTablePrinter::RIGHT);
+  PartitionTable.PrintHeader();
+
+  for (int iMetric = 0; iMetric < N_METRICS; iMetric++) {
+    unsigned long minVal = all[iMetric], maxVal = all[iMetric];
+    passivedouble avgVal = 0.0;
+    for (int iRank = 0; iRank < size; iRank++) {
+      const auto val = all[iRank*N_METRICS+iMetric];
+      minVal = min(minVal, val);
+      maxVal = max(maxVal, val);
+      avgVal += val;
+    }
+    avgVal /= size;
+    const passivedouble ratio = (avgVal > 0.0)? maxVal/avgVal : 1.0;
+    PartitionTable << names[iMetric] << minVal << avgVal << maxVal << ratio;
+  }
+  PartitionTable.PrintFooter();
+
+  if (!config->GetLoad_Balance_Report()) return;
+
+  /*--- Write the metrics of every rank. ---*/
+
+  string fileName = config->GetLoad_Balance_FileName() + "_partition";
+  if (config->GetnZone() > 1) fileName += "_" + PrintingToolbox::to_string(config->GetiZone());
+  fileName += ".csv";
+
+  ofstream file(fileName);
+  if (!file.is_open()) {
+    SU2_MPI::Error(string("Unable to open the load balance report ") + fileName, CURRENT_FUNCTION);
+  }
+
+  file << "\"Rank\"";
+  for (int iMetric = 0; iMetric < N_METRICS; iMetric++) file << ",\"" << names[iMetric] << "\"";
+  file << "\n";
+
+  for (int iRank = 0; iRank < size; iRank++) {
+    file << iRank;
+    for (int iMetric = 0; iMetric < N_METRICS; iMetric++) file << "," << all[iRank*N_METRICS+iMetric];
+    file << "\n";
+  }
+
+  cout << "Partition statistics of each rank written to " << fileName << "." << endl;
+
+}
+
 void CGeometry::AllocateP2PComms(unsigned short countPerPoint) {
 
   /*--- This routine is activated whenever we attempt to perform
@@ -645,6 +720,8 @@ void CGeometry::InitiateComms(CGeometry *geometry,
 
   if (nP2PSend == 0) return;
 
+  CTraceScope trace("CGeometry::InitiateComms", "mpi");
+
   /*--- Local variables ---*/
 
   unsigned short iDim;
@@ -751,6 +828,8 @@ void CGeometry::CompleteComms(CGeometry *geometry,
 
   if (nP2PRecv == 0) return;
 
+  CTraceScope trace("CGeometry::CompleteComms", "mpi");
+
   /*--- Local variables ---*/
 
   unsigned short iDim, COUNT_PER_POINT = 0, MPI_TYPE = 0;
@@ -781,7 +860,10 @@ void CGeometry::CompleteComms(CGeometry *geometry,
      the order they arrive. ---*/
 
     SU2_OMP_MASTER
-    SU2_MPI::Waitany(nP2PRecv, req_P2PRecv, &ind, &status);
+    {
+      CTraceWaitScope traceWait("MPI_Waitany");
+      SU2_MPI::Waitany(nP2PRecv, req_P2PRecv, &ind, &status);
+    }
     SU2_OMP_BARRIER
 
     /*--- Once we have recv'd a message, get the source rank. ---*/
@@ -847,7 +929,10 @@ void CGeometry::CompleteComms(CGeometry *geometry,
 
 #ifdef HAVE_MPI
   SU2_OMP_MASTER
-  SU2_MPI::Waitall(nP2PSend, req_P2PSend, MPI_STATUS_IGNORE);
+  {
+    CTraceWaitScope traceWait("MPI_Waitall");
+    SU2_MPI::Waitall(nP2PSend, req_P2PSend, MPI_STATUS_IGNORE);
+  }
 #endif
   SU2_OMP_BARRIER
 
@@ -0,0 +1,383 @@
+/*!
+ * \file CSU2BinaryMeshReaderFVM.cpp
+ * \brief Reads a native SU2 binary grid into linear partitions for the
+ *        finite volume solver (FVM).
+ * \author SU2 Developers
+ * \version 7.1.0 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../../include/toolboxes/CLinearPartitioner.hpp"
+#include "../../../include/geometry/meshreader/CSU2BinaryMeshReaderFVM.hpp"
+
+CSU2BinaryMeshReaderFVM::CSU2BinaryMeshReaderFVM(CConfig        *val_config,
+                                                 unsigned short val_iZone,
+                                                 unsigned short val_nZone)
+: CMeshReaderFVM(val_config, val_iZone, val_nZone) {
+
+  /* The binary format holds a single zone, multizone problems need one file per zone. */
+  if ((val_nZone > 1) && config->GetMultizone_Mesh() &&
+      (config->GetTime_Marching() != HARMONIC_BALANCE)) {
+    SU2_MPI::Error(string("Native SU2 binary meshes contain a single zone.\n") +
+                   string("Set MULTIZONE_MESH= NO and provide one mesh per zone in the CONFIG_LIST."),
+                   CURRENT_FUNCTION);
+  }
+
+  /* Splitting an actuator disk surface requires the whole mesh on all ranks. */
+  const bool actuator_disk = (((config->GetnMarker_ActDiskInlet() != 0) ||
+                               (config->GetnMarker_ActDiskOutlet() != 0)) &&
+                              ((config->GetKind_SU2() == SU2_CFD) ||
+                               ((config->GetKind_SU2() == SU2_DEF) &&
+                                (config->GetActDisk_SU2_DEF()))));
+  if (actuator_disk && !config->GetActDisk_DoubleSurface()) {
+    SU2_MPI::Error(string("Single surface actuator disks cannot be split from a native SU2 binary mesh.\n") +
+                   string("Use the SU2 ASCII mesh or a mesh with a double surface actuator disk."),
+                   CURRENT_FUNCTION);
+  }
+
+  if ((config->GetTime_Marching() == HARMONIC_BALANCE) && (rank == MASTER_NODE))
+    cout << "Reading time instance " << config->GetiInst()+1 << "." << endl;
+
+  /* Open the file on all ranks, it remains open while the sections are read. */
+  meshFilename = config->GetMesh_FileName();
+
+#ifdef HAVE_MPI
+  const bool opened = (MPI_File_open(MPI_COMM_WORLD, meshFilename.c_str(), MPI_MODE_RDONLY,
+                                     MPI_INFO_NULL, &mesh_file) == MPI_SUCCESS);
+#else
+  mesh_file = fopen(meshFilename.c_str(), "rb");
+  const bool opened = (mesh_file != nullptr);
+#endif
+  if (!opened) {
+    SU2_MPI::Error(string("Error opening SU2 binary grid ") + meshFilename +
+                   string(" \n Check that the file exists."), CURRENT_FUNCTION);
+  }
+
+  /* Read the header, then the points and interior elements of our rank's
+   linear partition. The master stores the entire set of surface connectivity. */
+  ReadMetadata();
+  ReadPointCoordinates();
+  ReadVolumeElementConnectivity();
+  ReadSurfaceElementConnectivity();
+
+#ifdef HAVE_MPI
+  MPI_File_close(&mesh_file);
+#else
+  fclose(mesh_file);
+#endif
+
+}
+
+CSU2BinaryMeshReaderFVM::~CSU2BinaryMeshReaderFVM(void) { }
+
+template<class T>
+void CSU2BinaryMeshReaderFVM::ReadBinaryDataAll(uint64_t offset, T* data, unsigned long count) {
+
+#ifdef HAVE_MPI
+
+  /*--- The entries are read as opaque blocks of bytes of the size of T,
+   this keeps the (int) count small for large partitions. ---*/
+
+  if (count > static_cast<unsigned long>(numeric_limits<int>::max())) {
+    SU2_MPI::Error("The linear partition of the SU2 binary grid is too large, use more ranks.",
+                   CURRENT_FUNCTION);
+  }
+
+  MPI_Datatype entryType;
+  MPI_Type_contiguous(int(sizeof(T)), MPI_BYTE, &entryType);
+  MPI_Type_commit(&entryType);
+
+  MPI_Status status;
+  int nRead = 0;
+  int ierr = MPI_File_read_at_all(mesh_file, MPI_Offset(offset), data, int(count), entryType, &status);
+  MPI_Get_count(&status, entryType, &nRead);
+
+  MPI_Type_free(&entryType);
+
+  if ((ierr != MPI_SUCCESS) || (nRead != int(count))) {
+    SU2_MPI::Error(string("Error reading SU2 binary grid ") + meshFilename +
+                   string(" \n The file is truncated or corrupted."), CURRENT_FUNCTION);
+  }
+
+#else
+  ReadBinaryData(offset, data, count);
+#endif
+
+}
+
+template<class T>
+void CSU2BinaryMeshReaderFVM::ReadBinaryData(uint64_t offset, T* data, unsigned long count) {
+
+  bool success = true;
+
+#ifdef HAVE_MPI
+  MPI_Status status;
+  int nRead = 0;
+  int ierr = MPI_File_read_at(mesh_file, MPI_Offset(offset), data, int(count*sizeof(T)), MPI_BYTE, &status);
+  MPI_Get_count(&status, MPI_BYTE, &nRead);
+  success = (ierr == MPI_SUCCESS) && (nRead == int(count*sizeof(T)));
+#else
+  /*--- 64-bit seek, the offsets of large grids do not fit in a long on all platforms. ---*/
+#if defined(_WIN32)
+  success = (_fseeki64(mesh_file, static_cast<__int64>(offset), SEEK_SET) == 0);
+#else
+  success = (fseeko(mesh_file, static_cast<off_t>(offset), SEEK_SET) == 0);
+#endif
+  success = success && (fread(data, sizeof(T), count, mesh_file) == count);
+#endif
+
+  if (!success) {
+    SU2_MPI::Error(string("Error reading SU2 binary grid ") + meshFilename +
+                   string(" \n The file is truncated or corrupted."), CURRENT_FUNCTION);
+  }
+
+}
+
+void CSU2BinaryMeshReaderFVM::ReadMetadata() {
+
+  /*--- All ranks read the header (the index of the file). ---*/
+
+  uint64_t header[SU2_BINARY_MESH_HEADER] = {0};
+  ReadBinaryDataAll(0, header, SU2_BINARY_MESH_HEADER);
+
+  if (header[0] != uint64_t(SU2_BINARY_MESH_MAGIC)) {
+    SU2_MPI::Error(meshFilename + string(" is not a native SU2 binary grid, or it was written\n") +
+                   string("on a machine with different byte order. Check MESH_FORMAT."),
+                   CURRENT_FUNCTION);
+  }
+  if (header[1] > uint64_t(SU2_BINARY_MESH_VERSION)) {
+    SU2_MPI::Error(string("The SU2 binary grid ") + meshFilename +
+                   string(" was written by a newer version of SU2."), CURRENT_FUNCTION);
+  }
+
+  dimension              = header[2];
+  numberOfGlobalPoints   = header[3];
+  numberOfGlobalElements = header[4];
+  numberOfMarkers        = header[5];
+  pointOffset            = header[6];
+  elementOffset          = header[7];
+  markerOffset           = header[8];
+
+  if ((dimension != 2) && (dimension != 3)) {
+    SU2_MPI::Error(string("Invalid dimension in the SU2 binary grid ") + meshFilename,
+                   CURRENT_FUNCTION);
+  }
+
+}
+
+void CSU2BinaryMeshReaderFVM::ReadPointCoordinates() {
+
+  /* Get a partitioner to help with linear partitioning. */
+  CLinearPartitioner pointPartitioner(numberOfGlobalPoints,0);
+
+  const unsigned long firstPoint = pointPartitioner.GetFirstIndexOnRank(rank);
+  numberOfLocalPoints = pointPartitioner.GetSizeOnRank(rank);
+
+  /*--- Read the contiguous block of coordinates of our partition. ---*/
+
+  vector<passivedouble> coords(numberOfLocalPoints*dimension);
+
+  ReadBinaryDataAll(pointOffset + firstPoint*dimension*sizeof(passivedouble),
+                    coords.data(), coords.size());
+
+  /*--- Store them in our data structure. ---*/
+
+  localPointCoordinates.resize(dimension);
+  for (int k = 0; k < dimension; k++) {
+    localPointCoordinates[k].resize(numberOfLocalPoints);
+    for (unsigned long iPoint = 0; iPoint < numberOfLocalPoints; iPoint++)
+      localPointCoordinates[k][iPoint] = coords[iPoint*dimension+k];
+  }
+
+}
+
+void CSU2BinaryMeshReaderFVM::ReadVolumeElementConnectivity() {
+
+  /* Get partitioners to help with linear partitioning. */
+  CLinearPartitioner pointPartitioner(numberOfGlobalPoints,0);
+  CLinearPartitioner elementPartitioner(numberOfGlobalElements,0);
+
+  /*--- Read a linear partition of the element records. ---*/
+
+  const unsigned long firstElement = elementPartitioner.GetFirstIndexOnRank(rank);
+  const unsigned long nElemLinear  = elementPartitioner.GetSizeOnRank(rank);
+
+  vector<uint64_t> records(nElemLinear*SU2_BINARY_ELEM_SIZE);
+
+  ReadBinaryDataAll(elementOffset + firstElement*SU2_BINARY_ELEM_SIZE*sizeof(uint64_t),
+                    records.data(), records.size());
+
+  /*--- Each element goes to every rank that owns at least one of its points
+   in the linear partitioning. We use a flag to send an element only once to
+   a given rank, and store the destinations to avoid repeating the search. ---*/
+
+  vector<int> nElem_Send(size,0), nElem_Recv(size,0), nElem_Flag(size,-1);
+  vector<int> destRanks;
+  vector<unsigned short> nDestRanks(nElemLinear,0);
+  destRanks.reserve(nElemLinear);
+
+  for (unsigned long iElem = 0; iElem < nElemLinear; iElem++) {
+
+    const uint64_t* record = &records[iElem*SU2_BINARY_ELEM_SIZE];
+
+    unsigned short nNodes = 0;
+    switch (record[0]) {
+      case TRIANGLE:      nNodes = N_POINTS_TRIANGLE;      break;
+      case QUADRILATERAL: nNodes = N_POINTS_QUADRILATERAL; break;
+      case TETRAHEDRON:   nNodes = N_POINTS_TETRAHEDRON;   break;
+      case HEXAHEDRON:    nNodes = N_POINTS_HEXAHEDRON;    break;
+      case PRISM:         nNodes = N_POINTS_PRISM;         break;
+      case PYRAMID:       nNodes = N_POINTS_PYRAMID;       break;
+      default:
+        SU2_MPI::Error(string("Unknown volume element type in the SU2 binary grid ") + meshFilename,
+                       CURRENT_FUNCTION);
+    }
+
+    for (unsigned short iNode = 0; iNode < nNodes; iNode++) {
+      if (record[1+iNode] >= numberOfGlobalPoints) {
+        SU2_MPI::Error(string("Invalid point index in the SU2 binary grid ") + meshFilename,
+                       CURRENT_FUNCTION);
+      }
+      const int iProcessor = pointPartitioner.GetRankContainingIndex(record[1+iNode]);
+      if (nElem_Flag[iProcessor] != (int)iElem) {
+        nElem_Flag[iProcessor] = iElem;
+        nElem_Send[iProcessor]++;
+        destRanks.push_back(iProcessor);
+        nDestRanks[iElem]++;
+      }
+    }
+  }
+
+  /*--- Communicate the number of elements to be received from each rank. ---*/
+
+  SU2_MPI::Alltoall(nElem_Send.data(), 1, MPI_INT,
+                    nElem_Recv.data(), 1, MPI_INT, MPI_COMM_WORLD);
+
+  /*--- Prepare the counts and displacements in terms of connectivity entries. ---*/
+
+  vector<int> nConn_Send(size), nConn_Recv(size), sendDispl(size+1,0), recvDispl(size+1,0);
+  for (int iProcessor = 0; iProcessor < size; iProcessor++) {
+    nConn_Send[iProcessor] = nElem_Send[iProcessor]*SU2_CONN_SIZE;
+    nConn_Recv[iProcessor] = nElem_Recv[iProcessor]*SU2_CONN_SIZE;
+    sendDispl[iProcessor+1] = sendDispl[iProcessor] + nConn_Send[iProcessor];
+    recvDispl[iProcessor+1] = recvDispl[iProcessor] + nConn_Recv[iProcessor];
+  }
+
+  /*--- Load the send buffer in the format [globalID vtkType n0 ... n7],
+   elements that go to the same rank remain in ascending global order. ---*/
+
+  vector<unsigned long> connSend(sendDispl[size]);
+  vector<int> index(sendDispl.begin(), sendDispl.end()-1);
+
+  unsigned long iDest = 0;
+  for (unsigned long iElem = 0; iElem < nElemLinear; iElem++) {
+    const uint64_t* record = &records[iElem*SU2_BINARY_ELEM_SIZE];
+    for (unsigned short iRank = 0; iRank < nDestRanks[iElem]; iRank++, iDest++) {
+      auto* conn = &connSend[index[destRanks[iDest]]];
+      conn[0] = firstElement + iElem;
+      for (int i = 0; i < SU2_BINARY_ELEM_SIZE; i++)
+        conn[SU2_CONN_SKIP-1+i] = record[i];
+      index[destRanks[iDest]] += SU2_CONN_SIZE;
+    }
+  }
+
+  /*--- Free the file data before receiving, then exchange the connectivity. ---*/
+
+  vector<uint64_t>().swap(records);
+
+  localVolumeElementConnectivity.resize(recvDispl[size]);
+
+  SU2_MPI::Alltoallv(connSend.data(), nConn_Send.data(), sendDispl.data(), MPI_UNSIGNED_LONG,
+                     localVolumeElementConnectivity.data(), nConn_Recv.data(), recvDispl.data(),
+                     MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+
+  numberOfLocalElements = localVolumeElementConnectivity.size()/SU2_CONN_SIZE;
+
+}
+
+void CSU2BinaryMeshReaderFVM::ReadSurfaceElementConnectivity() {
+
+  /* We already read in the number of markers with the metadata. */
+  surfaceElementConnectivity.resize(numberOfMarkers);
+  markerNames.resize(numberOfMarkers);
+
+  /*--- The surface connectivity is read and stored by the master node only
+   (and eventually distributed by the master as well). ---*/
+
+  if (rank != MASTER_NODE) return;
+
+  uint64_t offset = markerOffset;
+
+  for (unsigned long iMarker = 0; iMarker < numberOfMarkers; iMarker++) {
+
+    /*--- Length of the name and number of elements, then the name. ---*/
+
+    uint64_t markerInfo[2] = {0};
+    ReadBinaryData(offset, markerInfo, 2);
+    offset += 2*sizeof(uint64_t);
+
+    vector<char> name(markerInfo[0]);
+    ReadBinaryData(offset, name.data(), name.size());
+    offset += name.size();
+
+    markerNames[iMarker] = string(name.begin(), name.end());
+
+    if (markerNames[iMarker] == "SEND_RECEIVE") {
+      SU2_MPI::Error(string("Mesh file contains deprecated SEND_RECEIVE marker!\n\n") +
+                     string("Please remove any SEND_RECEIVE markers from the SU2 mesh."),
+                     CURRENT_FUNCTION);
+    }
+
+    /*--- The element records of this marker. ---*/
+
+    const uint64_t nElem_Bound = markerInfo[1];
+    vector<uint64_t> records(nElem_Bound*SU2_BINARY_BOUND_SIZE);
+    ReadBinaryData(offset, records.data(), records.size());
+    offset += records.size()*sizeof(uint64_t);
+
+    auto& connectivity = surfaceElementConnectivity[iMarker];
+    connectivity.resize(nElem_Bound*SU2_CONN_SIZE, 0);
+
+    unsigned long nElemStored = 0;
+    for (unsigned long iElem = 0; iElem < nElem_Bound; iElem++) {
+      const uint64_t* record = &records[iElem*SU2_BINARY_BOUND_SIZE];
+
+      /*--- Vertex elements are skipped, as by the ASCII reader. ---*/
+      if (record[0] == VERTEX) continue;
+
+      if ((record[0] != LINE) && (record[0] != TRIANGLE) && (record[0] != QUADRILATERAL)) {
+        SU2_MPI::Error(string("Unknown surface element type in the SU2 binary grid ") + meshFilename,
+                       CURRENT_FUNCTION);
+      }
+      if ((record[0] == LINE) && (dimension == 3)) {
+        SU2_MPI::Error(string("Line boundary conditions are not possible for 3D calculations.") +
+                       string("Please check the SU2 binary mesh file."), CURRENT_FUNCTION);
+      }
+
+      for (int i = 0; i < SU2_BINARY_BOUND_SIZE; i++)
+        connectivity[nElemStored*SU2_CONN_SIZE+SU2_CONN_SKIP-1+i] = record[i];
+      nElemStored++;
+    }
+    connectivity.resize(nElemStored*SU2_CONN_SIZE);
+  }
+
+}
@@ -30,6 +30,37 @@
 #include "../../include/adt/CADTPointsOnlyClass.hpp"
 #include "../../include/toolboxes/geometry_toolbox.hpp"
 
+namespace {
+/*!
+ * \brief Add the contribution of a Gauss point to the element stiffness matrix of isotropic linear elasticity.
+ * \note Equivalent to B^T.D.B but without the (mostly zero) B and D matrices, for node pair (a,b):
+ *       K_ab(i,j) = lambda * dNa_i * dNb_j + mu * (dNa_j * dNb_i + delta_ij * dNa . dNb).
+ */
+template<unsigned short nDim>
+void AddIsotropicStiffness(unsigned short nNodes, const su2double DShapeFunction[8][4], su2double weight,
+                           su2double lambda, su2double mu, su2double **StiffMatrix_Elem) {
+  const su2double wLambda = weight * lambda, wMu = weight * mu;
+
+  for (unsigned short iNode = 0; iNode < nNodes; iNode++) {
+    const su2double* dNa = DShapeFunction[iNode];
+
+    for (unsigned short jNode = 0; jNode < nNodes; jNode++) {
+      const su2double* dNb = DShapeFunction[jNode];
+
+      su2double dot = 0.0;
+      for (unsigned short iDim = 0; iDim < nDim; iDim++) dot += dNa[iDim] * dNb[iDim];
+
+      for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+        su2double* row = &StiffMatrix_Elem[iNode*nDim+iDim][jNode*nDim];
+        for (unsigned short jDim = 0; jDim < nDim; jDim++)
+          row[jDim] += wLambda * dNa[iDim] * dNb[jDim] + wMu * dNa[jDim] * dNb[iDim];
+        row[iDim] += wMu * dot;
+      }
+    }
+  }
+}
+} // namespace
+
 CVolumetricMovement::CVolumetricMovement(void) : CGridMovement(), System(true) {
 
 }
@@ -54,24 +85,66 @@ CVolumetricMovement::CVolumetricMovement(CGeometry *geometry, CConfig *config) :
     LinSysSol.Initialize(nPoint, nPointDomain, nVar, 0.0);
     LinSysRes.Initialize(nPoint, nPointDomain, nVar, 0.0);
     StiffMatrix.Initialize(nPoint, nPointDomain, nVar, nVar, false, geometry, config);
+
+    HybridParallelInitialization(geometry);
   }
 }
 
-CVolumetricMovement::~CVolumetricMovement(void) { }
+CVolumetricMovement::~CVolumetricMovement(void) {
 
-void CVolumetricMovement::UpdateGridCoord(CGeometry *geometry, CConfig *config) {
+  if (LockStrategy) {
+    for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++)
+      omp_destroy_lock(&UpdateLocks[iPoint]);
+  }
+}
 
-  unsigned short iDim;
-  unsigned long iPoint, total_index;
-  su2double new_coord;
+void CVolumetricMovement::HybridParallelInitialization(CGeometry* geometry) {
+#ifdef HAVE_OMP
+  /*--- Get the element coloring. ---*/
+
+  su2double parallelEff = 1.0;
+  const auto& coloring = geometry->GetElementColoring(&parallelEff);
+
+  /*--- If the coloring is too bad use lock-guarded accesses
+   *    to CSysMatrix in element loops instead. ---*/
+  LockStrategy = parallelEff < COLORING_EFF_THRESH;
+
+  /*--- When using locks force a single color to reduce the color loop overhead. ---*/
+  if (LockStrategy && (coloring.getOuterSize()>1))
+    geometry->SetNaturalElementColoring();
+
+  if (!coloring.empty()) {
+    /*--- We are not constrained by the color group size when using locks. ---*/
+    auto groupSize = LockStrategy? 1ul : geometry->GetElementColorGroupSize();
+    auto nColor = coloring.getOuterSize();
+    ElemColoring.reserve(nColor);
+
+    for(auto iColor = 0ul; iColor < nColor; ++iColor)
+      ElemColoring.emplace_back(coloring.innerIdx(iColor), coloring.getNumNonZeros(iColor), groupSize);
+  }
+
+  if (LockStrategy) {
+    UpdateLocks.resize(nPoint);
+    for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++)
+      omp_init_lock(&UpdateLocks[iPoint]);
+  }
+
+  omp_chunk_size = computeStaticChunkSize(nPoint, omp_get_max_threads(), OMP_MAX_SIZE);
+#else
+  ElemColoring[0] = DummyGridColor<>(geometry->GetnElem());
+#endif
+}
+
+void CVolumetricMovement::UpdateGridCoord(CGeometry *geometry, CConfig *config) {
 
   /*--- Update the grid coordinates using the solution of the linear system
    after grid deformation (LinSysSol contains the x, y, z displacements). ---*/
 
-  for (iPoint = 0; iPoint < nPoint; iPoint++)
-    for (iDim = 0; iDim < nDim; iDim++) {
-      total_index = iPoint*nDim + iDim;
-      new_coord = geometry->nodes->GetCoord(iPoint, iDim)+LinSysSol[total_index];
+  SU2_OMP_PARALLEL_(for schedule(static,omp_chunk_size))
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++)
+    for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+      const auto total_index = iPoint*nDim + iDim;
+      su2double new_coord = geometry->nodes->GetCoord(iPoint, iDim)+LinSysSol[total_index];
       if (fabs(new_coord) < EPS*EPS) new_coord = 0.0;
       geometry->nodes->SetCoord(iPoint, iDim, new_coord);
     }
@@ -116,7 +189,7 @@ void CVolumetricMovement::UpdateMultiGrid(CGeometry **geometry, CConfig *config)
 
 void CVolumetricMovement::SetVolume_Deformation(CGeometry *geometry, CConfig *config, bool UpdateGeo, bool Derivative) {
 
-  unsigned long Tot_Iter = 0;
+  unsigned long Tot_Iter = 0, Precond_Iter = 0;
   su2double MinVolume, MaxVolume;
 
   /*--- Retrieve number or iterations, tol, output, etc. from config ---*/
@@ -132,17 +205,26 @@ void CVolumetricMovement::SetVolume_Deformation(CGeometry *geometry, CConfig *co
 
   if (Derivative) Nonlinear_Iter = 1;
 
+  /*--- The direct solvers use the factorization as the solution, it cannot be lagged. ---*/
+
+  const bool Lag_Precond = (config->GetKind_Deform_Linear_Solver() != PASTIX_LDLT) &&
+                           (config->GetKind_Deform_Linear_Solver() != PASTIX_LU);
+
   /*--- Loop over the total number of grid deformation iterations. The surface
    deformation can be divided into increments to help with stability. In
    particular, the linear elasticity equations hold only for small deformations. ---*/
 
   for (auto iNonlinear_Iter = 0ul; iNonlinear_Iter < Nonlinear_Iter; iNonlinear_Iter++) {
 
-    /*--- Initialize vector and sparse matrix ---*/
+    /*--- Initialize vector and sparse matrix. The increments of the boundary displacements are
+     equal, the solution of the previous increment is therefore kept as the initial guess. ---*/
 
-    LinSysSol.SetValZero();
-    LinSysRes.SetValZero();
-    StiffMatrix.SetValZero();
+    SU2_OMP_PARALLEL
+    {
+      if (iNonlinear_Iter == 0) LinSysSol.SetValZero();
+      LinSysRes.SetValZero();
+      StiffMatrix.SetValZero();
+    }
 
     /*--- Compute the stiffness matrix entries for all nodes/elements in the
      mesh. FEA uses a finite element method discretization of the linear
@@ -174,21 +256,36 @@ void CVolumetricMovement::SetVolume_Deformation(CGeometry *geometry, CConfig *co
     StiffMatrix.InitiateComms(LinSysRes, geometry, config, SOLUTION_MATRIX);
     StiffMatrix.CompleteComms(LinSysRes, geometry, config, SOLUTION_MATRIX);
 
+    /*--- The stiffness changes little between increments, the preconditioner of the first one
+     is reused until the linear iterations double w.r.t. the solve right after the last build. ---*/
+
+    const bool Reuse_Precond = Lag_Precond && (iNonlinear_Iter > 0) && (Tot_Iter <= 2*Precond_Iter);
+    System.SetReusePreconditioner(Reuse_Precond);
+
     /*--- Definition of the preconditioner matrix vector multiplication, and linear solver ---*/
 
     /*--- If we want no derivatives or the direct derivatives, we solve the system using the
      * normal matrix vector product and preconditioner. For the mesh sensitivities using
      * the discrete adjoint method we solve the system using the transposed matrix. ---*/
-    if (!Derivative || ((config->GetKind_SU2() == SU2_CFD) && Derivative)) {
+    SU2_OMP_PARALLEL
+    {
+      unsigned long iter = 0;
+
+      if (!Derivative || ((config->GetKind_SU2() == SU2_CFD) && Derivative)) {
 
-      Tot_Iter = System.Solve(StiffMatrix, LinSysRes, LinSysSol, geometry, config);
+        iter = System.Solve(StiffMatrix, LinSysRes, LinSysSol, geometry, config);
 
-    } else if (Derivative && (config->GetKind_SU2() == SU2_DOT)) {
+      } else if (Derivative && (config->GetKind_SU2() == SU2_DOT)) {
 
-      Tot_Iter = System.Solve_b(StiffMatrix, LinSysRes, LinSysSol, geometry, config);
+        iter = System.Solve_b(StiffMatrix, LinSysRes, LinSysSol, geometry, config);
+      }
+      SU2_OMP_MASTER
+      Tot_Iter = iter;
     }
     su2double Residual = System.GetResidual();
 
+    if (!Reuse_Precond) Precond_Iter = Tot_Iter;
+
     /*--- Update the grid coordinates and cell volumes using the solution
      of the linear system (usol contains the x, y, z displacements). ---*/
 
@@ -218,23 +315,32 @@ void CVolumetricMovement::SetVolume_Deformation(CGeometry *geometry, CConfig *co
 
   }
 
+  /*--- The next deformation starts with a fresh preconditioner. ---*/
+
+  System.SetReusePreconditioner(false);
+
 }
 
 void CVolumetricMovement::ComputeDeforming_Element_Volume(CGeometry *geometry, su2double &MinVolume, su2double &MaxVolume, bool Screen_Output) {
 
-  unsigned long iElem, ElemCounter = 0, PointCorners[8];
-  su2double Volume = 0.0, CoordCorners[8][3];
-  unsigned short nNodes = 0, iNodes, iDim;
-  bool RightVol = true;
+  unsigned long ElemCounter = 0;
 
   if (rank == MASTER_NODE && Screen_Output)
     cout << "Computing volumes of the grid elements." << endl;
 
   MaxVolume = -1E22; MinVolume = 1E22;
 
+  SU2_OMP_PARALLEL
+  {
+  unsigned long PointCorners[8], elemCounter = 0;
+  su2double Volume = 0.0, CoordCorners[8][3], maxVolume = -1E22, minVolume = 1E22;
+  unsigned short nNodes = 0, iNodes, iDim;
+  bool RightVol = true;
+
   /*--- Load up each triangle and tetrahedron to check for negative volumes. ---*/
 
-  for (iElem = 0; iElem < geometry->GetnElem(); iElem++) {
+  SU2_OMP_FOR_DYN(OMP_MAX_SIZE)
+  for (auto iElem = 0ul; iElem < geometry->GetnElem(); iElem++) {
 
     if (geometry->elem[iElem]->GetVTK_Type() == TRIANGLE)     nNodes = 3;
     if (geometry->elem[iElem]->GetVTK_Type() == QUADRILATERAL)    nNodes = 4;
@@ -269,13 +375,20 @@ void CVolumetricMovement::ComputeDeforming_Element_Volume(CGeometry *geometry, s
     RightVol = true;
     if (Volume < 0.0) RightVol = false;
 
-    MaxVolume = max(MaxVolume, Volume);
-    MinVolume = min(MinVolume, Volume);
+    maxVolume = max(maxVolume, Volume);
+    minVolume = min(minVolume, Volume);
     geometry->elem[iElem]->SetVolume(Volume);
 
-    if (!RightVol) ElemCounter++;
+    if (!RightVol) elemCounter++;
 
   }
+  SU2_OMP_CRITICAL
+  {
+    MaxVolume = max(MaxVolume, maxVolume);
+    MinVolume = min(MinVolume, minVolume);
+    ElemCounter += elemCounter;
+  }
+  } // end SU2_OMP_PARALLEL
 
 #ifdef HAVE_MPI
   unsigned long ElemCounter_Local = ElemCounter; ElemCounter = 0;
@@ -288,8 +401,9 @@ void CVolumetricMovement::ComputeDeforming_Element_Volume(CGeometry *geometry, s
 
   /*--- Volume from  0 to 1 ---*/
 
-  for (iElem = 0; iElem < geometry->GetnElem(); iElem++) {
-    Volume = geometry->elem[iElem]->GetVolume()/MaxVolume;
+  SU2_OMP_PARALLEL_(for schedule(static,OMP_MAX_SIZE))
+  for (auto iElem = 0ul; iElem < geometry->GetnElem(); iElem++) {
+    su2double Volume = geometry->elem[iElem]->GetVolume()/MaxVolume;
     geometry->elem[iElem]->SetVolume(Volume);
   }
 
@@ -526,22 +640,10 @@ void CVolumetricMovement::ComputeSolid_Wall_Distance(CGeometry *geometry, CConfi
 
 su2double CVolumetricMovement::SetFEAMethodContributions_Elem(CGeometry *geometry, CConfig *config) {
 
-  unsigned short iVar, iDim, nNodes = 0, iNodes, StiffMatrix_nElem = 0;
-  unsigned long iElem, PointCorners[8];
-  su2double **StiffMatrix_Elem = nullptr, CoordCorners[8][3];
-  su2double MinVolume = 0.0, MaxVolume = 0.0, MinDistance = 0.0, MaxDistance = 0.0, ElemVolume = 0.0, ElemDistance = 0.0;
+  su2double MinVolume = 0.0, MaxVolume = 0.0, MinDistance = 0.0, MaxDistance = 0.0;
 
   bool Screen_Output  = config->GetDeform_Output();
 
-  /*--- Allocate maximum size (quadrilateral and hexahedron) ---*/
-
-  if (nDim == 2) StiffMatrix_nElem = 8;
-  else StiffMatrix_nElem = 24;
-
-  StiffMatrix_Elem = new su2double* [StiffMatrix_nElem];
-  for (iVar = 0; iVar < StiffMatrix_nElem; iVar++)
-    StiffMatrix_Elem[iVar] = new su2double [StiffMatrix_nElem];
-
   /*--- Compute min volume in the entire mesh. ---*/
 
   ComputeDeforming_Element_Volume(geometry, MinVolume, MaxVolume, Screen_Output);
@@ -556,9 +658,29 @@ su2double CVolumetricMovement::SetFEAMethodContributions_Elem(CGeometry *geometr
     if (rank == MASTER_NODE && Screen_Output) cout <<"Min. distance: "<< MinDistance <<", max. distance: "<< MaxDistance <<"." << endl;
   }
 
-  /*--- Compute contributions from each element by forming the stiffness matrix (FEA) ---*/
+  /*--- Compute contributions from each element by forming the stiffness matrix (FEA).
+   Elements of the same color do not share nodes and are processed concurrently. ---*/
+
+  SU2_OMP_PARALLEL
+  {
+  /*--- Thread-local element matrix, maximum size (hexahedron). ---*/
+
+  constexpr unsigned short StiffMatrix_nElem = 24;
+  su2double StiffMatrix_Data[StiffMatrix_nElem*StiffMatrix_nElem], *StiffMatrix_Elem[StiffMatrix_nElem];
+  for (unsigned short iVar = 0; iVar < StiffMatrix_nElem; iVar++)
+    StiffMatrix_Elem[iVar] = &StiffMatrix_Data[iVar*StiffMatrix_nElem];
+
+  for (auto color : ElemColoring) {
 
-  for (iElem = 0; iElem < geometry->GetnElem(); iElem++) {
+  /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
+  SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
+  for (auto k = 0ul; k < color.size; k++) {
+
+    const auto iElem = color.indices[k];
+
+    unsigned short iDim, nNodes = 0, iNodes;
+    unsigned long PointCorners[8];
+    su2double CoordCorners[8][3], ElemVolume = 0.0, ElemDistance = 0.0;
 
     if (geometry->elem[iElem]->GetVTK_Type() == TRIANGLE)      nNodes = 3;
     if (geometry->elem[iElem]->GetVTK_Type() == QUADRILATERAL) nNodes = 4;
@@ -591,12 +713,8 @@ su2double CVolumetricMovement::SetFEAMethodContributions_Elem(CGeometry *geometr
     AddFEA_StiffMatrix(geometry, StiffMatrix_Elem, PointCorners, nNodes);
 
   }
-
-  /*--- Deallocate memory and exit ---*/
-
-  for (iVar = 0; iVar < StiffMatrix_nElem; iVar++)
-    delete [] StiffMatrix_Elem[iVar];
-  delete [] StiffMatrix_Elem;
+  } // end color loop
+  } // end SU2_OMP_PARALLEL
 
   return MinVolume;
 
@@ -1341,9 +1459,8 @@ su2double CVolumetricMovement::GetHexa_Volume(su2double CoordCorners[8][3]) cons
 void CVolumetricMovement::SetFEA_StiffMatrix2D(CGeometry *geometry, CConfig *config, su2double **StiffMatrix_Elem, unsigned long PointCorners[8], su2double CoordCorners[8][3],
                                                unsigned short nNodes, su2double ElemVolume, su2double ElemDistance) {
 
-  su2double B_Matrix[3][8], D_Matrix[3][3], Aux_Matrix[8][3];
   su2double Xi = 0.0, Eta = 0.0, Det = 0.0, E = 1/EPS, Lambda = 0.0, Mu = 0.0, Nu = 0.0;
-  unsigned short iNode, iVar, jVar, kVar, iGauss, nGauss = 0;
+  unsigned short iVar, jVar, iGauss, nGauss = 0;
   su2double DShapeFunction[8][4] = {{0.0, 0.0, 0.0, 0.0}, {0.0, 0.0, 0.0, 0.0}, {0.0, 0.0, 0.0, 0.0}, {0.0, 0.0, 0.0, 0.0},
     {0.0, 0.0, 0.0, 0.0}, {0.0, 0.0, 0.0, 0.0}, {0.0, 0.0, 0.0, 0.0}, {0.0, 0.0, 0.0, 0.0}};
   su2double Location[4][3], Weight[4];
@@ -1375,6 +1492,18 @@ void CVolumetricMovement::SetFEA_StiffMatrix2D(CGeometry *geometry, CConfig *con
     Location[3][0] = -0.577350269189626;  Location[3][1] = 0.577350269189626;   Weight[3] = 1.0;
   }
 
+  /*--- Impose a type of stiffness for each element ---*/
+
+  switch (config->GetDeform_Stiffness_Type()) {
+    case INVERSE_VOLUME: E = 1.0 / ElemVolume; break;
+    case SOLID_WALL_DISTANCE: E = 1.0 / ElemDistance; break;
+    case CONSTANT_STIFFNESS: E = 1.0 / EPS; break;
+  }
+
+  Nu = config->GetDeform_Coeff();
+  Mu = E / (2.0*(1.0 + Nu));
+  Lambda = Nu*E/((1.0+Nu)*(1.0-2.0*Nu));
+
   for (iGauss = 0; iGauss < nGauss; iGauss++) {
 
     Xi = Location[iGauss][0]; Eta = Location[iGauss][1];
@@ -1382,59 +1511,10 @@ void CVolumetricMovement::SetFEA_StiffMatrix2D(CGeometry *geometry, CConfig *con
     if (nNodes == 3) Det = ShapeFunc_Triangle(Xi, Eta, CoordCorners, DShapeFunction);
     if (nNodes == 4) Det = ShapeFunc_Quadrilateral(Xi, Eta, CoordCorners, DShapeFunction);
 
-    /*--- Compute the B Matrix ---*/
-
-    for (iVar = 0; iVar < 3; iVar++)
-      for (jVar = 0; jVar < nNodes*nVar; jVar++)
-        B_Matrix[iVar][jVar] = 0.0;
-
-    for (iNode = 0; iNode < nNodes; iNode++) {
-      B_Matrix[0][0+iNode*nVar] = DShapeFunction[iNode][0];
-      B_Matrix[1][1+iNode*nVar] = DShapeFunction[iNode][1];
-
-      B_Matrix[2][0+iNode*nVar] = DShapeFunction[iNode][1];
-      B_Matrix[2][1+iNode*nVar] = DShapeFunction[iNode][0];
-    }
-
-    /*--- Impose a type of stiffness for each element ---*/
-
-    switch (config->GetDeform_Stiffness_Type()) {
-      case INVERSE_VOLUME: E = 1.0 / ElemVolume; break;
-      case SOLID_WALL_DISTANCE: E = 1.0 / ElemDistance; break;
-      case CONSTANT_STIFFNESS: E = 1.0 / EPS; break;
-    }
-
-    Nu = config->GetDeform_Coeff();
-    Mu = E / (2.0*(1.0 + Nu));
-    Lambda = Nu*E/((1.0+Nu)*(1.0-2.0*Nu));
-
-    /*--- Compute the D Matrix (for plane strain and 3-D)---*/
-
-    D_Matrix[0][0] = Lambda + 2.0*Mu;    D_Matrix[0][1] = Lambda;            D_Matrix[0][2] = 0.0;
-    D_Matrix[1][0] = Lambda;            D_Matrix[1][1] = Lambda + 2.0*Mu;   D_Matrix[1][2] = 0.0;
-    D_Matrix[2][0] = 0.0;               D_Matrix[2][1] = 0.0;               D_Matrix[2][2] = Mu;
+    /*--- Compute the BT.D.B Matrix (stiffness matrix, plane strain), and add
+     to the original matrix using Gauss integration ---*/
 
-
-    /*--- Compute the BT.D Matrix ---*/
-
-    for (iVar = 0; iVar < nNodes*nVar; iVar++) {
-      for (jVar = 0; jVar < 3; jVar++) {
-        Aux_Matrix[iVar][jVar] = 0.0;
-        for (kVar = 0; kVar < 3; kVar++)
-          Aux_Matrix[iVar][jVar] += B_Matrix[kVar][iVar]*D_Matrix[kVar][jVar];
-      }
-    }
-
-    /*--- Compute the BT.D.B Matrix (stiffness matrix), and add to the original
-     matrix using Gauss integration ---*/
-
-    for (iVar = 0; iVar < nNodes*nVar; iVar++) {
-      for (jVar = 0; jVar < nNodes*nVar; jVar++) {
-        for (kVar = 0; kVar < 3; kVar++) {
-          StiffMatrix_Elem[iVar][jVar] += Weight[iGauss] * Aux_Matrix[iVar][kVar]*B_Matrix[kVar][jVar] * fabs(Det);
-        }
-      }
-    }
+    AddIsotropicStiffness<2>(nNodes, DShapeFunction, Weight[iGauss]*fabs(Det), Lambda, Mu, StiffMatrix_Elem);
 
   }
 
@@ -1443,10 +1523,8 @@ void CVolumetricMovement::SetFEA_StiffMatrix2D(CGeometry *geometry, CConfig *con
 void CVolumetricMovement::SetFEA_StiffMatrix3D(CGeometry *geometry, CConfig *config, su2double **StiffMatrix_Elem, unsigned long PointCorners[8], su2double CoordCorners[8][3],
                                                unsigned short nNodes, su2double ElemVolume, su2double ElemDistance) {
 
-  su2double B_Matrix[6][24], D_Matrix[6][6] = {{0.0, 0.0, 0.0, 0.0, 0.0, 0.0}, {0.0, 0.0, 0.0, 0.0, 0.0, 0.0}, {0.0, 0.0, 0.0, 0.0, 0.0, 0.0}, {0.0, 0.0, 0.0, 0.0, 0.0, 0.0},
-    {0.0, 0.0, 0.0, 0.0, 0.0, 0.0}, {0.0, 0.0, 0.0, 0.0, 0.0, 0.0}}, Aux_Matrix[24][6];
   su2double Xi = 0.0, Eta = 0.0, Zeta = 0.0, Det = 0.0, Mu = 0.0, E = 0.0, Lambda = 0.0, Nu = 0.0;
-  unsigned short iNode, iVar, jVar, kVar, iGauss, nGauss = 0;
+  unsigned short iVar, jVar, iGauss, nGauss = 0;
   su2double DShapeFunction[8][4] = {{0.0, 0.0, 0.0, 0.0}, {0.0, 0.0, 0.0, 0.0}, {0.0, 0.0, 0.0, 0.0}, {0.0, 0.0, 0.0, 0.0},
     {0.0, 0.0, 0.0, 0.0}, {0.0, 0.0, 0.0, 0.0}, {0.0, 0.0, 0.0, 0.0}, {0.0, 0.0, 0.0, 0.0}};
   su2double Location[8][3], Weight[8];
@@ -1505,6 +1583,18 @@ void CVolumetricMovement::SetFEA_StiffMatrix3D(CGeometry *geometry, CConfig *con
     Location[7][0] = 0.577350269189626;   Location[7][1] = 0.577350269189626;   Location[7][2] = 0.577350269189626;   Weight[7] = 1.0;
   }
 
+  /*--- Impose a type of stiffness for each element ---*/
+
+  switch (config->GetDeform_Stiffness_Type()) {
+    case INVERSE_VOLUME: E = 1.0 / ElemVolume; break;
+    case SOLID_WALL_DISTANCE: E = 1.0 / ElemDistance; break;
+    case CONSTANT_STIFFNESS: E = 1.0 / EPS; break;
+  }
+
+  Nu = config->GetDeform_Coeff();
+  Mu = E / (2.0*(1.0 + Nu));
+  Lambda = Nu*E/((1.0+Nu)*(1.0-2.0*Nu));
+
   for (iGauss = 0; iGauss < nGauss; iGauss++) {
 
     Xi = Location[iGauss][0]; Eta = Location[iGauss][1];  Zeta = Location[iGauss][2];
@@ -1514,69 +1604,10 @@ void CVolumetricMovement::SetFEA_StiffMatrix3D(CGeometry *geometry, CConfig *con
     if (nNodes == 6) Det = ShapeFunc_Prism(Xi, Eta, Zeta, CoordCorners, DShapeFunction);
     if (nNodes == 8) Det = ShapeFunc_Hexa(Xi, Eta, Zeta, CoordCorners, DShapeFunction);
 
-    /*--- Compute the B Matrix ---*/
-
-    for (iVar = 0; iVar < 6; iVar++)
-      for (jVar = 0; jVar < nNodes*nVar; jVar++)
-        B_Matrix[iVar][jVar] = 0.0;
-
-    for (iNode = 0; iNode < nNodes; iNode++) {
-      B_Matrix[0][0+iNode*nVar] = DShapeFunction[iNode][0];
-      B_Matrix[1][1+iNode*nVar] = DShapeFunction[iNode][1];
-      B_Matrix[2][2+iNode*nVar] = DShapeFunction[iNode][2];
-
-      B_Matrix[3][0+iNode*nVar] = DShapeFunction[iNode][1];
-      B_Matrix[3][1+iNode*nVar] = DShapeFunction[iNode][0];
-
-      B_Matrix[4][1+iNode*nVar] = DShapeFunction[iNode][2];
-      B_Matrix[4][2+iNode*nVar] = DShapeFunction[iNode][1];
-
-      B_Matrix[5][0+iNode*nVar] = DShapeFunction[iNode][2];
-      B_Matrix[5][2+iNode*nVar] = DShapeFunction[iNode][0];
-    }
-
-    /*--- Impose a type of stiffness for each element ---*/
-
-    switch (config->GetDeform_Stiffness_Type()) {
-      case INVERSE_VOLUME: E = 1.0 / ElemVolume; break;
-      case SOLID_WALL_DISTANCE: E = 1.0 / ElemDistance; break;
-      case CONSTANT_STIFFNESS: E = 1.0 / EPS; break;
-    }
-
-    Nu = config->GetDeform_Coeff();
-    Mu = E / (2.0*(1.0 + Nu));
-    Lambda = Nu*E/((1.0+Nu)*(1.0-2.0*Nu));
-
-    /*--- Compute the D Matrix (for plane strain and 3-D)---*/
-
-    D_Matrix[0][0] = Lambda + 2.0*Mu;  D_Matrix[0][1] = Lambda;          D_Matrix[0][2] = Lambda;
-    D_Matrix[1][0] = Lambda;          D_Matrix[1][1] = Lambda + 2.0*Mu;  D_Matrix[1][2] = Lambda;
-    D_Matrix[2][0] = Lambda;          D_Matrix[2][1] = Lambda;          D_Matrix[2][2] = Lambda + 2.0*Mu;
-    D_Matrix[3][3] = Mu;
-    D_Matrix[4][4] = Mu;
-    D_Matrix[5][5] = Mu;
-
-
-    /*--- Compute the BT.D Matrix ---*/
-
-    for (iVar = 0; iVar < nNodes*nVar; iVar++) {
-      for (jVar = 0; jVar < 6; jVar++) {
-        Aux_Matrix[iVar][jVar] = 0.0;
-        for (kVar = 0; kVar < 6; kVar++)
-          Aux_Matrix[iVar][jVar] += B_Matrix[kVar][iVar]*D_Matrix[kVar][jVar];
-      }
-    }
-
     /*--- Compute the BT.D.B Matrix (stiffness matrix), and add to the original
      matrix using Gauss integration ---*/
 
-    for (iVar = 0; iVar < nNodes*nVar; iVar++) {
-      for (jVar = 0; jVar < nNodes*nVar; jVar++) {
-        for (kVar = 0; kVar < 6; kVar++) {
-          StiffMatrix_Elem[iVar][jVar] += Weight[iGauss] * Aux_Matrix[iVar][kVar]*B_Matrix[kVar][jVar] * fabs(Det);
-        }
-      }
-    }
+    AddIsotropicStiffness<3>(nNodes, DShapeFunction, Weight[iGauss]*fabs(Det), Lambda, Mu, StiffMatrix_Elem);
 
   }
 
@@ -1588,19 +1619,17 @@ void CVolumetricMovement::AddFEA_StiffMatrix(CGeometry *geometry, su2double **St
 
   unsigned short nVar = geometry->GetnDim();
 
-  su2double **StiffMatrix_Node;
-  StiffMatrix_Node = new su2double* [nVar];
-  for (iVar = 0; iVar < nVar; iVar++)
-    StiffMatrix_Node[iVar] = new su2double [nVar];
-
-  for (iVar = 0; iVar < nVar; iVar++)
-    for (jVar = 0; jVar < nVar; jVar++)
-      StiffMatrix_Node[iVar][jVar] = 0.0;
+  su2double StiffMatrix_Data[3][3] = {{0.0}};
+  su2double *StiffMatrix_Node[3] = {StiffMatrix_Data[0], StiffMatrix_Data[1], StiffMatrix_Data[2]};
 
   /*--- Transform the stiffness matrix for the hexahedral element into the
-   contributions for the individual nodes relative to each other. ---*/
+   contributions for the individual nodes relative to each other. Only the
+   rows of the element nodes are modified, those are locked if needed. ---*/
 
   for (iVar = 0; iVar < nNodes; iVar++) {
+
+    if (LockStrategy) omp_set_lock(&UpdateLocks[PointCorners[iVar]]);
+
     for (jVar = 0; jVar < nNodes; jVar++) {
 
       for (iDim = 0; iDim < nVar; iDim++) {
@@ -1612,13 +1641,9 @@ void CVolumetricMovement::AddFEA_StiffMatrix(CGeometry *geometry, su2double **St
       StiffMatrix.AddBlock(PointCorners[iVar], PointCorners[jVar], StiffMatrix_Node);
 
     }
-  }
-
-  /*--- Deallocate memory and exit ---*/
 
-  for (iVar = 0; iVar < nVar; iVar++)
-    delete [] StiffMatrix_Node[iVar];
-  delete [] StiffMatrix_Node;
+    if (LockStrategy) omp_unset_lock(&UpdateLocks[PointCorners[iVar]]);
+  }
 
 }
 
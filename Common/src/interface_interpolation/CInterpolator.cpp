@@ -29,6 +29,51 @@
 #include "../../include/CConfig.hpp"
 #include "../../include/geometry/CGeometry.hpp"
 
+#include <unordered_map>
+
+namespace {
+
+/*--- Squared distance from a point to a box (min coordinates followed by max). ---*/
+passivedouble SquaredDistanceToBox(unsigned short nDim, const passivedouble* x, const passivedouble* box) {
+  passivedouble d2 = 0.0;
+  for (auto iDim = 0u; iDim < nDim; ++iDim) {
+    const auto d = max(max(box[iDim]-x[iDim], x[iDim]-box[nDim+iDim]), passivedouble(0.0));
+    d2 += d*d;
+  }
+  return d2;
+}
+
+/*--- Largest distance between a point in box "a" and a point in box "b". ---*/
+passivedouble MaxDistanceBetweenBoxes(unsigned short nDim, const passivedouble* a, const passivedouble* b) {
+  passivedouble d2 = 0.0;
+  for (auto iDim = 0u; iDim < nDim; ++iDim) {
+    const auto d = max(fabs(a[nDim+iDim]-b[iDim]), fabs(b[nDim+iDim]-a[iDim]));
+    d2 += d*d;
+  }
+  return sqrt(d2);
+}
+
+/*--- Smallest distance between two boxes. ---*/
+passivedouble MinDistanceBetweenBoxes(unsigned short nDim, const passivedouble* a, const passivedouble* b) {
+  passivedouble d2 = 0.0;
+  for (auto iDim = 0u; iDim < nDim; ++iDim) {
+    const auto d = max(max(a[iDim]-b[nDim+iDim], b[iDim]-a[nDim+iDim]), passivedouble(0.0));
+    d2 += d*d;
+  }
+  return sqrt(d2);
+}
+
+bool IsEmptyBox(unsigned short nDim, const passivedouble* box) { return box[0] > box[nDim]; }
+
+/*--- Decide if a point (or the bounding box of a set) is close to the target box of a rank. ---*/
+bool IsNearBox(unsigned short nDim, const passivedouble* x, const passivedouble* box, passivedouble radius) {
+  if (radius < 0.0) return false;
+  if (std::isinf(radius)) return true;
+  return SquaredDistanceToBox(nDim, x, box) <= radius*radius;
+}
+
+}
+
 
 CInterpolator::CInterpolator(CGeometry ****geometry_container, const CConfig* const* config,
                              unsigned int iZone, unsigned int jZone) :
@@ -167,6 +212,325 @@ unsigned long CInterpolator::Collect_ElementInfo(int markDonor, unsigned short n
   return dstIdx;
 }
 
+unsigned long CInterpolator::Collect_VertexInfo(int markDonor, int markTarget, unsigned long nVertexDonor,
+                                               unsigned short nDim, su2activematrix& coord,
+                                               vector<long>& globalPoint, vector<int>& processor) {
+
+  /*--- Sets MaxLocalVertex_Donor, Buffer_Receive_nVertex_Donor. ---*/
+  Determine_ArraySize(markDonor, markTarget, nVertexDonor, nDim);
+
+  const auto nGlobalVertexDonor = accumulate(Buffer_Receive_nVertex_Donor,
+                                  Buffer_Receive_nVertex_Donor+size, 0ul);
+
+  Buffer_Send_Coord = new su2double [ MaxLocalVertex_Donor * nDim ];
+  Buffer_Send_GlobalPoint = new long [ MaxLocalVertex_Donor ];
+  Buffer_Receive_Coord = new su2double [ size * MaxLocalVertex_Donor * nDim ];
+  Buffer_Receive_GlobalPoint = new long [ size * MaxLocalVertex_Donor ];
+
+  Collect_VertexInfo(markDonor, markTarget, nVertexDonor, nDim);
+
+  /*--- Compress the gathered information. ---*/
+  coord.resize(nGlobalVertexDonor, nDim);
+  globalPoint.resize(nGlobalVertexDonor);
+  processor.resize(nGlobalVertexDonor);
+
+  auto iCount = 0ul;
+  for (int iProcessor = 0; iProcessor < size; ++iProcessor) {
+    auto offset = iProcessor * MaxLocalVertex_Donor;
+    for (auto iVertex = 0ul; iVertex < Buffer_Receive_nVertex_Donor[iProcessor]; ++iVertex) {
+      for (auto iDim = 0u; iDim < nDim; ++iDim)
+        coord(iCount,iDim) = Buffer_Receive_Coord[(offset+iVertex)*nDim + iDim];
+      globalPoint[iCount] = Buffer_Receive_GlobalPoint[offset+iVertex];
+      processor[iCount] = iProcessor;
+      ++iCount;
+    }
+  }
+  assert((iCount == nGlobalVertexDonor) && "Global donor point count mismatch.");
+
+  delete[] Buffer_Send_Coord;
+  delete[] Buffer_Send_GlobalPoint;
+  delete[] Buffer_Receive_Coord;
+  delete[] Buffer_Receive_GlobalPoint;
+
+  return nGlobalVertexDonor;
+}
+
+su2passivematrix CInterpolator::Gather_BoundingBoxes(const CGeometry* geometry, int marker, unsigned short nDim,
+                                                     vector<unsigned long>* numVertex) const {
+
+  vector<passivedouble> box(2*nDim);
+  for (auto iDim = 0u; iDim < nDim; ++iDim) {
+    box[iDim] = numeric_limits<passivedouble>::max();
+    box[nDim+iDim] = numeric_limits<passivedouble>::lowest();
+  }
+
+  unsigned long nOwned = 0;
+  const auto nVertex = (marker != -1)? geometry->GetnVertex(marker) : 0ul;
+
+  for (auto iVertex = 0ul; iVertex < nVertex; ++iVertex) {
+    const auto iPoint = geometry->vertex[marker][iVertex]->GetNode();
+    if (!geometry->nodes->GetDomain(iPoint)) continue;
+    ++nOwned;
+    for (auto iDim = 0u; iDim < nDim; ++iDim) {
+      const auto x = SU2_TYPE::GetValue(geometry->nodes->GetCoord(iPoint, iDim));
+      box[iDim] = min(box[iDim], x);
+      box[nDim+iDim] = max(box[nDim+iDim], x);
+    }
+  }
+
+  su2passivematrix allBoxes(size, 2*nDim);
+  SelectMPIWrapper<passivedouble>::W::Allgather(box.data(), 2*nDim, MPI_DOUBLE,
+                                                allBoxes.data(), 2*nDim, MPI_DOUBLE, MPI_COMM_WORLD);
+  if (numVertex) {
+    numVertex->resize(size);
+    SU2_MPI::Allgather(&nOwned, 1, MPI_UNSIGNED_LONG, numVertex->data(), 1, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+  }
+  return allBoxes;
+}
+
+vector<passivedouble> CInterpolator::DonorSearchRadius(const su2passivematrix& targetBox,
+                                                       const su2passivematrix& donorBox,
+                                                       const vector<unsigned long>& numDonor,
+                                                       unsigned long nDonor) {
+  const auto nRank = targetBox.rows();
+  const unsigned short nDim = targetBox.cols()/2;
+
+  vector<passivedouble> radius(nRank, -1.0);
+  vector<pair<passivedouble, unsigned long> > candidates;
+
+  for (auto iRank = 0ul; iRank < nRank; ++iRank) {
+    if (IsEmptyBox(nDim, targetBox[iRank])) continue;
+
+    /*--- Any point in the target box is at most at "max distance" from all the donors of a rank,
+     *    accumulate ranks in order of that distance until enough donors are guaranteed. ---*/
+    candidates.clear();
+    for (auto jRank = 0ul; jRank < nRank; ++jRank) {
+      if (numDonor[jRank] == 0) continue;
+      candidates.emplace_back(MaxDistanceBetweenBoxes(nDim, targetBox[iRank], donorBox[jRank]), numDonor[jRank]);
+    }
+    sort(candidates.begin(), candidates.end());
+
+    unsigned long count = 0;
+    for (const auto& candidate : candidates) {
+      radius[iRank] = candidate.first;
+      count += candidate.second;
+      if (count >= nDonor) break;
+    }
+    /*--- Small margin for round-off in the distance computations (more donors are harmless). ---*/
+    radius[iRank] *= 1.0 + 1e-6;
+  }
+  return radius;
+}
+
+unsigned long CInterpolator::Distribute_VertexInfo(int markDonor, unsigned short nDim,
+                                                   const su2passivematrix& targetBox,
+                                                   const vector<passivedouble>& radius, su2activematrix& coord,
+                                                   vector<long>& globalPoint, vector<int>& processor) const {
+
+  const auto nVertex = (markDonor != -1)? donor_geometry->GetnVertex(markDonor) : 0ul;
+
+  /*--- Bounding box of the local donors, to quickly discard ranks that are far away. ---*/
+  vector<passivedouble> localBox(2*nDim);
+  for (auto iDim = 0u; iDim < nDim; ++iDim) {
+    localBox[iDim] = numeric_limits<passivedouble>::max();
+    localBox[nDim+iDim] = numeric_limits<passivedouble>::lowest();
+  }
+  vector<unsigned long> ownedPoints;
+  for (auto iVertex = 0ul; iVertex < nVertex; ++iVertex) {
+    const auto iPoint = donor_geometry->vertex[markDonor][iVertex]->GetNode();
+    if (!donor_geometry->nodes->GetDomain(iPoint)) continue;
+    ownedPoints.push_back(iPoint);
+    for (auto iDim = 0u; iDim < nDim; ++iDim) {
+      const auto x = SU2_TYPE::GetValue(donor_geometry->nodes->GetCoord(iPoint, iDim));
+      localBox[iDim] = min(localBox[iDim], x);
+      localBox[nDim+iDim] = max(localBox[nDim+iDim], x);
+    }
+  }
+
+  /*--- Select the vertices for each rank. ---*/
+  vector<vector<unsigned long> > sendPoints(size);
+
+  if (!ownedPoints.empty()) {
+    for (int iRank = 0; iRank < size; ++iRank) {
+      if (radius[iRank] < 0.0) continue;
+      if (!std::isinf(radius[iRank]) &&
+          MinDistanceBetweenBoxes(nDim, localBox.data(), targetBox[iRank]) > radius[iRank]) continue;
+
+      for (auto iPoint : ownedPoints) {
+        passivedouble x[3] = {0.0};
+        for (auto iDim = 0u; iDim < nDim; ++iDim)
+          x[iDim] = SU2_TYPE::GetValue(donor_geometry->nodes->GetCoord(iPoint, iDim));
+        if (IsNearBox(nDim, x, targetBox[iRank], radius[iRank])) sendPoints[iRank].push_back(iPoint);
+      }
+    }
+  }
+
+  /*--- Communicate the sizes and then the data. ---*/
+  vector<int> nSend(size), nRecv(size), sendDispl(size+1,0), recvDispl(size+1,0);
+  for (int iRank = 0; iRank < size; ++iRank) nSend[iRank] = sendPoints[iRank].size();
+
+  SU2_MPI::Alltoall(nSend.data(), 1, MPI_INT, nRecv.data(), 1, MPI_INT, MPI_COMM_WORLD);
+
+  for (int iRank = 0; iRank < size; ++iRank) {
+    sendDispl[iRank+1] = sendDispl[iRank] + nSend[iRank];
+    recvDispl[iRank+1] = recvDispl[iRank] + nRecv[iRank];
+  }
+  const auto nTotalSend = sendDispl[size], nTotalRecv = recvDispl[size];
+
+  vector<su2double> sendCoord(max(nTotalSend*nDim,1));
+  vector<long> sendPoint(max(nTotalSend,1));
+
+  for (int iRank = 0, iSend = 0; iRank < size; ++iRank) {
+    for (auto iPoint : sendPoints[iRank]) {
+      for (auto iDim = 0u; iDim < nDim; ++iDim)
+        sendCoord[iSend*nDim+iDim] = donor_geometry->nodes->GetCoord(iPoint, iDim);
+      sendPoint[iSend] = donor_geometry->nodes->GetGlobalIndex(iPoint);
+      ++iSend;
+    }
+  }
+
+  coord.resize(nTotalRecv, nDim);
+  globalPoint.resize(nTotalRecv);
+  processor.resize(nTotalRecv);
+
+  SU2_MPI::Alltoallv(sendPoint.data(), nSend.data(), sendDispl.data(), MPI_LONG,
+                     globalPoint.data(), nRecv.data(), recvDispl.data(), MPI_LONG, MPI_COMM_WORLD);
+
+  for (int iRank = 0; iRank < size; ++iRank) {
+    for (auto i = recvDispl[iRank]; i < recvDispl[iRank+1]; ++i) processor[i] = iRank;
+  }
+  for (int iRank = 0; iRank < size; ++iRank) {
+    nSend[iRank] *= nDim; sendDispl[iRank] *= nDim;
+    nRecv[iRank] *= nDim; recvDispl[iRank] *= nDim;
+  }
+  SU2_MPI::Alltoallv(sendCoord.data(), nSend.data(), sendDispl.data(), MPI_DOUBLE,
+                     coord.data(), nRecv.data(), recvDispl.data(), MPI_DOUBLE, MPI_COMM_WORLD);
+
+  return nTotalRecv;
+}
+
+unsigned long CInterpolator::Distribute_ElementInfo(int markDonor, unsigned short nDim,
+                                                    const su2passivematrix& targetBox,
+                                                    const vector<passivedouble>& radius,
+                                                    vector<unsigned short>& numNodes,
+                                                    su2matrix<long>& idxNodes) const {
+
+  const auto maxElemNodes = (nDim == 2u)? 2u : 4u; // line and quad respectively
+
+  const auto nElemDonor = (markDonor != -1)? donor_geometry->GetnElem_Bound(markDonor) : 0ul;
+
+  /*--- Bounding box of the local elements, to quickly discard ranks that are far away. ---*/
+  vector<passivedouble> localBox(2*nDim);
+  for (auto iDim = 0u; iDim < nDim; ++iDim) {
+    localBox[iDim] = numeric_limits<passivedouble>::max();
+    localBox[nDim+iDim] = numeric_limits<passivedouble>::lowest();
+  }
+  for (auto iElem = 0ul; iElem < nElemDonor; ++iElem) {
+    const auto elem = donor_geometry->bound[markDonor][iElem];
+    assert(elem->GetnNodes() <= maxElemNodes && "Donor element has too many nodes.");
+
+    for (auto iNode = 0u; iNode < elem->GetnNodes(); ++iNode) {
+      for (auto iDim = 0u; iDim < nDim; ++iDim) {
+        const auto x = SU2_TYPE::GetValue(donor_geometry->nodes->GetCoord(elem->GetNode(iNode), iDim));
+        localBox[iDim] = min(localBox[iDim], x);
+        localBox[nDim+iDim] = max(localBox[nDim+iDim], x);
+      }
+    }
+  }
+
+  /*--- Select the elements for each rank. ---*/
+  vector<vector<unsigned long> > sendElems(size);
+
+  for (int iRank = 0; (iRank < size) && (nElemDonor > 0); ++iRank) {
+    if (radius[iRank] < 0.0) continue;
+    if (!std::isinf(radius[iRank]) &&
+        MinDistanceBetweenBoxes(nDim, localBox.data(), targetBox[iRank]) > radius[iRank]) continue;
+
+    for (auto iElem = 0ul; iElem < nElemDonor; ++iElem) {
+      const auto elem = donor_geometry->bound[markDonor][iElem];
+
+      for (auto iNode = 0u; iNode < elem->GetnNodes(); ++iNode) {
+        passivedouble x[3] = {0.0};
+        for (auto iDim = 0u; iDim < nDim; ++iDim)
+          x[iDim] = SU2_TYPE::GetValue(donor_geometry->nodes->GetCoord(elem->GetNode(iNode), iDim));
+        if (IsNearBox(nDim, x, targetBox[iRank], radius[iRank])) {
+          sendElems[iRank].push_back(iElem);
+          break;
+        }
+      }
+    }
+  }
+
+  /*--- Communicate the sizes and then the data. ---*/
+  vector<int> nSend(size), nRecv(size), sendDispl(size+1,0), recvDispl(size+1,0);
+  for (int iRank = 0; iRank < size; ++iRank) nSend[iRank] = sendElems[iRank].size();
+
+  SU2_MPI::Alltoall(nSend.data(), 1, MPI_INT, nRecv.data(), 1, MPI_INT, MPI_COMM_WORLD);
+
+  for (int iRank = 0; iRank < size; ++iRank) {
+    sendDispl[iRank+1] = sendDispl[iRank] + nSend[iRank];
+    recvDispl[iRank+1] = recvDispl[iRank] + nRecv[iRank];
+  }
+  const auto nTotalSend = sendDispl[size], nTotalRecv = recvDispl[size];
+
+  vector<unsigned short> sendNum(max(nTotalSend,1));
+  su2matrix<long> sendIdx(max(nTotalSend,1), maxElemNodes);
+  sendIdx = -1;
+
+  for (int iRank = 0, iSend = 0; iRank < size; ++iRank) {
+    for (auto iElem : sendElems[iRank]) {
+      const auto elem = donor_geometry->bound[markDonor][iElem];
+      sendNum[iSend] = elem->GetnNodes();
+      for (auto iNode = 0u; iNode < elem->GetnNodes(); ++iNode)
+        sendIdx(iSend, iNode) = donor_geometry->nodes->GetGlobalIndex(elem->GetNode(iNode));
+      ++iSend;
+    }
+  }
+
+  numNodes.resize(max(nTotalRecv,1));
+  idxNodes.resize(max(nTotalRecv,1), maxElemNodes);
+
+  SU2_MPI::Alltoallv(sendNum.data(), nSend.data(), sendDispl.data(), MPI_UNSIGNED_SHORT,
+                     numNodes.data(), nRecv.data(), recvDispl.data(), MPI_UNSIGNED_SHORT, MPI_COMM_WORLD);
+
+  for (int iRank = 0; iRank < size; ++iRank) {
+    nSend[iRank] *= maxElemNodes; sendDispl[iRank] *= maxElemNodes;
+    nRecv[iRank] *= maxElemNodes; recvDispl[iRank] *= maxElemNodes;
+  }
+  SU2_MPI::Alltoallv(sendIdx.data(), nSend.data(), sendDispl.data(), MPI_LONG,
+                     idxNodes.data(), nRecv.data(), recvDispl.data(), MPI_LONG, MPI_COMM_WORLD);
+
+  return nTotalRecv;
+}
+
+void CInterpolator::ReconstructBoundaryCoord(unsigned long val_zone, int val_marker, su2double* coord) const {
+
+  const CGeometry *geom = Geometry[val_zone][INST_0][MESH_0];
+  const auto nDim = geom->GetnDim();
+  const auto nVertex = (val_marker != -1)? geom->GetnVertex(val_marker) : 0ul;
+
+  /*--- Same vertices (owned by the rank) and order as ReconstructBoundary, ranks are concatenated in order. ---*/
+
+  vector<su2double> sendCoord;
+  sendCoord.reserve(nVertex*nDim);
+
+  for (auto iVertex = 0ul; iVertex < nVertex; iVertex++) {
+    const auto iPoint = geom->vertex[val_marker][iVertex]->GetNode();
+    if (geom->nodes->GetDomain(iPoint)) {
+      for (auto iDim = 0u; iDim < nDim; iDim++)
+        sendCoord.push_back(geom->nodes->GetCoord(iPoint, iDim));
+    }
+  }
+
+  int nSend = sendCoord.size();
+  vector<int> nRecv(size), displ(size, 0);
+  SU2_MPI::Allgather(&nSend, 1, MPI_INT, nRecv.data(), 1, MPI_INT, MPI_COMM_WORLD);
+  for (int iRank = 1; iRank < size; iRank++) displ[iRank] = displ[iRank-1] + nRecv[iRank-1];
+
+  SU2_MPI::Allgatherv(sendCoord.data(), nSend, MPI_DOUBLE, coord, nRecv.data(), displ.data(), MPI_DOUBLE,
+                      MPI_COMM_WORLD);
+}
+
 void CInterpolator::ReconstructBoundary(unsigned long val_zone, int val_marker){
 
   CGeometry *geom = Geometry[val_zone][INST_0][MESH_0];
@@ -353,18 +717,23 @@ void CInterpolator::ReconstructBoundary(unsigned long val_zone, int val_marker){
 #endif
 
   if (rank == MASTER_NODE){
+
+    /*--- Map the global indices of the linked nodes to the gathered vertices (the first one if repeated). ---*/
+    unordered_map<long, unsigned long> globalToVertex;
+    globalToVertex.reserve(nGlobalVertex);
+    for (kVertex = 0; kVertex < nGlobalVertex; kVertex++)
+      globalToVertex.emplace(Buffer_Receive_GlobalPoint[kVertex], kVertex);
+
     for (iVertex = 0; iVertex < nGlobalVertex; iVertex++){
       count = 0;
       uptr = &Buffer_Receive_LinkedNodes[ Buffer_Receive_StartLinkedNodes[iVertex] ];
 
       for (jVertex = 0; jVertex < Buffer_Receive_nLinkedNodes[iVertex]; jVertex++){
         iTmp = uptr[ jVertex ];
-        for (kVertex = 0; kVertex < nGlobalVertex; kVertex++){
-          if( Buffer_Receive_GlobalPoint[kVertex] == long(iTmp) ){
-            uptr[ jVertex ] = kVertex;
-            count++;
-            break;
-          }
+        const auto it = globalToVertex.find(long(iTmp));
+        if (it != globalToVertex.end()) {
+          uptr[ jVertex ] = it->second;
+          count++;
         }
 
         if( count != (jVertex+1) ){
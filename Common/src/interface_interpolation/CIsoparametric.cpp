@@ -87,57 +87,62 @@ void CIsoparametric::SetTransferCoeff(const CConfig* const* config) {
     if (markDonor != -1) nVertexDonor = donor_geometry->GetnVertex(markDonor);
     if (markTarget != -1) nVertexTarget = target_geometry->GetnVertex(markTarget);
 
-    /*--- Sets MaxLocalVertex_Donor, Buffer_Receive_nVertex_Donor. ---*/
-    Determine_ArraySize(markDonor, markTarget, nVertexDonor, nDim);
-
-    const auto nGlobalVertexDonor = accumulate(Buffer_Receive_nVertex_Donor,
-                                    Buffer_Receive_nVertex_Donor+nProcessor, 0ul);
-
-    Buffer_Send_Coord = new su2double [ MaxLocalVertex_Donor * nDim ];
-    Buffer_Send_GlobalPoint = new long [ MaxLocalVertex_Donor ];
-    Buffer_Receive_Coord = new su2double [ nProcessor * MaxLocalVertex_Donor * nDim ];
-    Buffer_Receive_GlobalPoint = new long [ nProcessor * MaxLocalVertex_Donor ];
-
-    /*--- Collect coordinates and global point indices. ---*/
-    Collect_VertexInfo(markDonor, markTarget, nVertexDonor, nDim);
     if (nVertexTarget) targetVertices[markTarget].resize(nVertexTarget);
 
-    /*--- Compress the vertex information, and build a map of global point to "compressed
-     *    index" to then reconstruct the donor elements in local index space. ---*/
+    /*--- Collect the donor points and elements, either all of them, or only those that can be used by
+     *    the targets of each rank. The latter are the elements with a node that can be the closest to a
+     *    target, and the points of those elements, which are at most one element size further away. ---*/
 
-    su2activematrix donorCoord(nGlobalVertexDonor, nDim);
-    vector<long> donorPoint(nGlobalVertexDonor);
-    vector<int> donorProc(nGlobalVertexDonor);
-    unordered_map<long, unsigned long> globalToLocalMap;
+    su2activematrix donorCoord;
+    vector<long> donorPoint;
+    vector<int> donorProc;
+    unsigned long nGlobalVertexDonor = 0, nGlobalElemDonor = 0;
+
+    vector<unsigned long> allNumElem;
+    vector<unsigned short> elemNumNodes;
+    su2matrix<long> elemIdxNodes;
 
-    auto iCount = 0ul;
-    for (int iProcessor = 0; iProcessor < nProcessor; ++iProcessor) {
-      auto offset = iProcessor * MaxLocalVertex_Donor;
-      for (auto iVertex = 0ul; iVertex < Buffer_Receive_nVertex_Donor[iProcessor]; ++iVertex) {
-        for (int iDim = 0; iDim < nDim; ++iDim)
-          donorCoord(iCount,iDim) = Buffer_Receive_Coord[(offset+iVertex)*nDim + iDim];
-        donorPoint[iCount] = Buffer_Receive_GlobalPoint[offset+iVertex];
-        donorProc[iCount] = iProcessor;
-        assert((globalToLocalMap.count(donorPoint[iCount]) == 0) && "Duplicate donor point found.");
-        globalToLocalMap[donorPoint[iCount]] = iCount;
-        ++iCount;
+    if (config[donorZone]->GetDistributedDonorSearch()) {
+      vector<unsigned long> numDonor;
+      const auto targetBox = Gather_BoundingBoxes(target_geometry, markTarget, nDim);
+      const auto donorBox = Gather_BoundingBoxes(donor_geometry, markDonor, nDim, &numDonor);
+      const auto elemRadius = DonorSearchRadius(targetBox, donorBox, numDonor, 1);
+
+      passivedouble elemSize = 0.0;
+      const auto nElemDonor = (markDonor != -1)? donor_geometry->GetnElem_Bound(markDonor) : 0ul;
+      for (auto iElem = 0ul; iElem < nElemDonor; ++iElem) {
+        const auto elem = donor_geometry->bound[markDonor][iElem];
+        for (auto iNode = 0u; iNode < elem->GetnNodes(); ++iNode)
+          for (auto jNode = iNode+1; jNode < elem->GetnNodes(); ++jNode)
+            elemSize = max(elemSize, SU2_TYPE::GetValue(Distance(nDim,
+                                     donor_geometry->nodes->GetCoord(elem->GetNode(iNode)),
+                                     donor_geometry->nodes->GetCoord(elem->GetNode(jNode)))));
       }
-    }
-    assert((iCount == nGlobalVertexDonor) && "Global donor point count mismatch.");
+      passivedouble maxElemSize = 0.0;
+      SelectMPIWrapper<passivedouble>::W::Allreduce(&elemSize, &maxElemSize, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
 
-    delete[] Buffer_Send_Coord;
-    delete[] Buffer_Send_GlobalPoint;
-    delete[] Buffer_Receive_Coord;
-    delete[] Buffer_Receive_GlobalPoint;
+      auto vertexRadius = elemRadius;
+      for (auto& r : vertexRadius) if (r >= 0.0) r += maxElemSize;
 
-    /*--- Collect donor element (face) information. ---*/
+      nGlobalVertexDonor = Distribute_VertexInfo(markDonor, nDim, targetBox, vertexRadius,
+                                                 donorCoord, donorPoint, donorProc);
+      nGlobalElemDonor = Distribute_ElementInfo(markDonor, nDim, targetBox, elemRadius,
+                                                elemNumNodes, elemIdxNodes);
+    }
+    else {
+      nGlobalVertexDonor = Collect_VertexInfo(markDonor, markTarget, nVertexDonor, nDim,
+                                              donorCoord, donorPoint, donorProc);
+      nGlobalElemDonor = Collect_ElementInfo(markDonor, nDim, true, allNumElem, elemNumNodes, elemIdxNodes);
+    }
 
-    vector<unsigned long> allNumElem;
-    vector<unsigned short> elemNumNodes;
-    su2matrix<long> elemIdxNodes;
+    /*--- Build a map of global point to "compressed index" to then reconstruct
+     *    the donor elements in local index space. ---*/
 
-    const auto nGlobalElemDonor = Collect_ElementInfo(markDonor, nDim, true,
-                                    allNumElem, elemNumNodes, elemIdxNodes);
+    unordered_map<long, unsigned long> globalToLocalMap;
+    for (auto iCount = 0ul; iCount < nGlobalVertexDonor; ++iCount) {
+      assert((globalToLocalMap.count(donorPoint[iCount]) == 0) && "Duplicate donor point found.");
+      globalToLocalMap[donorPoint[iCount]] = iCount;
+    }
 
     /*--- Map the node to "local" indices and create a list of connected elements for each vertex. ---*/
 
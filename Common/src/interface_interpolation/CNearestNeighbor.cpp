@@ -79,20 +79,27 @@ void CNearestNeighbor::SetTransferCoeff(const CConfig* const* config) {
     if (markDonor != -1) nVertexDonor = donor_geometry->GetnVertex(markDonor);
     if (markTarget != -1) nVertexTarget = target_geometry->GetnVertex(markTarget);
 
-    /*--- Sets MaxLocalVertex_Donor, Buffer_Receive_nVertex_Donor. ---*/
-    Determine_ArraySize(markDonor, markTarget, nVertexDonor, nDim);
     if (nVertexTarget) targetVertices[markTarget].resize(nVertexTarget);
 
-    const auto nPossibleDonor = accumulate(Buffer_Receive_nVertex_Donor,
-                                Buffer_Receive_nVertex_Donor+nProcessor, 0ul);
+    /*--- Collect coordinates, global point indices, and owner of the possible donors,
+     *    either all of them, or only those that can be among the closest to our targets. ---*/
+    su2activematrix donorCoord;
+    vector<long> donorPoint;
+    vector<int> donorProc;
+    unsigned long nPossibleDonor = 0;
 
-    Buffer_Send_Coord = new su2double [ MaxLocalVertex_Donor * nDim ];
-    Buffer_Send_GlobalPoint = new long [ MaxLocalVertex_Donor ];
-    Buffer_Receive_Coord = new su2double [ nProcessor * MaxLocalVertex_Donor * nDim ];
-    Buffer_Receive_GlobalPoint = new long [ nProcessor * MaxLocalVertex_Donor ];
+    if (config[donorZone]->GetDistributedDonorSearch()) {
+      vector<unsigned long> numDonor;
+      const auto targetBox = Gather_BoundingBoxes(target_geometry, markTarget, nDim);
+      const auto donorBox = Gather_BoundingBoxes(donor_geometry, markDonor, nDim, &numDonor);
+      const auto radius = DonorSearchRadius(targetBox, donorBox, numDonor, nDonor);
 
-    /*--- Collect coordinates and global point indices. ---*/
-    Collect_VertexInfo(markDonor, markTarget, nVertexDonor, nDim);
+      nPossibleDonor = Distribute_VertexInfo(markDonor, nDim, targetBox, radius, donorCoord, donorPoint, donorProc);
+    }
+    else {
+      nPossibleDonor = Collect_VertexInfo(markDonor, markTarget, nVertexDonor, nDim,
+                                          donorCoord, donorPoint, donorProc);
+    }
 
     /*--- Find the closest donor points to each target. ---*/
     SU2_OMP_PARALLEL
@@ -116,16 +123,9 @@ void CNearestNeighbor::SetTransferCoeff(const CConfig* const* config) {
       const su2double* Coord_i = target_geometry->nodes->GetCoord(Point_Target);
 
       /*--- Compute all distances. ---*/
-      for (int iProcessor = 0, iDonor = 0; iProcessor < nProcessor; ++iProcessor) {
-        for (auto jVertex = 0ul; jVertex < Buffer_Receive_nVertex_Donor[iProcessor]; ++jVertex) {
-
-          const auto idx = iProcessor*MaxLocalVertex_Donor + jVertex;
-          const auto pGlobalPoint = Buffer_Receive_GlobalPoint[idx];
-          const su2double* Coord_j = &Buffer_Receive_Coord[idx*nDim];
-          const auto dist2 = GeometryToolbox::SquaredDistance(nDim, Coord_i, Coord_j);
-
-          donorInfo[iDonor++] = DonorInfo(dist2, pGlobalPoint, iProcessor);
-        }
+      for (auto iDonor = 0ul; iDonor < nPossibleDonor; ++iDonor) {
+        const auto dist2 = GeometryToolbox::SquaredDistance(nDim, Coord_i, donorCoord[iDonor]);
+        donorInfo[iDonor] = DonorInfo(dist2, donorPoint[iDonor], donorProc[iDonor]);
       }
 
       /*--- Find k closest points. ---*/
@@ -166,12 +166,6 @@ void CNearestNeighbor::SetTransferCoeff(const CConfig* const* config) {
     }
     } // end SU2_OMP_PARALLEL
 
-    delete[] Buffer_Send_Coord;
-    delete[] Buffer_Send_GlobalPoint;
-
-    delete[] Buffer_Receive_Coord;
-    delete[] Buffer_Receive_GlobalPoint;
-
   }
 
   delete[] Buffer_Receive_nVertex_Donor;
@@ -28,6 +28,7 @@
 #include "../../include/interface_interpolation/CRadialBasisFunction.hpp"
 #include "../../include/CConfig.hpp"
 #include "../../include/geometry/CGeometry.hpp"
+#include "../../include/adt/CADTPointsOnlyClass.hpp"
 #include "../../include/toolboxes/CSymmetricMatrix.hpp"
 #include "../../include/toolboxes/geometry_toolbox.hpp"
 
@@ -44,6 +45,200 @@ extern "C" void dgemm_(const char*, const char*, const int*, const int*, const i
 #define DGEMM dgemm_
 #endif
 
+/*--- Sparse method: relative tolerance and iteration limit of the Krylov solver, and distance (in support
+ *    radii) from the targets of a rank within which it receives the donors (distributed donor search). ---*/
+constexpr passivedouble sparseTolerance = 1e-10;
+constexpr unsigned long sparseMaxIter = 1000;
+constexpr passivedouble sparseHaloRadii = 6.0;
+
+namespace {
+/*!
+ * \brief Global kernel matrix (sparse, SPD, CSR storage) of the sparse method, and its preconditioner.
+ * \note The preconditioner is a factorized sparse approximate inverse, G^T * G ~ M^-1, with G lower triangular
+ *       and the pattern of M. Each row of G is computed from a small dense system (the rows are independent),
+ *       and applying it does not couple entries that are further apart than the support radius (unlike an
+ *       incomplete factorization), which keeps the locality of the solves with sparse right hand sides.
+ */
+struct CKernelMatrix {
+  vector<unsigned long> rowPtr, colInd;        /*!< \brief Sparse pattern (sorted columns). */
+  vector<passivedouble> values;                /*!< \brief Entries of M. */
+  vector<unsigned long> precPtr, precInd;      /*!< \brief Rows of G (columns <= row). */
+  vector<passivedouble> precVal;
+  vector<unsigned long> precTPtr, precTInd;    /*!< \brief Rows of G^T. */
+  vector<passivedouble> precTVal;
+
+  passivedouble Get(unsigned long i, unsigned long j) const {
+    const auto first = colInd.begin()+rowPtr[i], last = colInd.begin()+rowPtr[i+1];
+    const auto it = lower_bound(first, last, j);
+    return (it != last && *it == j)? values[it-colInd.begin()] : 0.0;
+  }
+
+  void BuildPreconditioner() {
+    const auto n = rowPtr.size()-1;
+
+    precPtr.assign(n+1, 0);
+    for (auto i = 0ul; i < n; ++i)
+      precPtr[i+1] = precPtr[i] + (upper_bound(colInd.begin()+rowPtr[i], colInd.begin()+rowPtr[i+1], i) -
+                                   (colInd.begin()+rowPtr[i]));
+    precInd.resize(precPtr.back());
+    precVal.resize(precPtr.back());
+
+    SU2_OMP_PARALLEL
+    {
+    CSymmetricMatrix local;
+
+    SU2_OMP_FOR_DYN(64)
+    for (auto i = 0ul; i < n; ++i) {
+      /*--- M restricted to the lower pattern of row i, the last column of its inverse is the row of G. ---*/
+      const int m = precPtr[i+1] - precPtr[i];
+      const auto cols = &colInd[rowPtr[i]];
+      local.Initialize(m);
+      for (int k = 0; k < m; ++k)
+        for (int l = k; l < m; ++l) local(k,l) = Get(cols[k], cols[l]);
+      local.Invert(true);
+
+      const passivedouble scale = 1.0 / sqrt(local(m-1,m-1));
+      for (int k = 0; k < m; ++k) {
+        precInd[precPtr[i]+k] = cols[k];
+        precVal[precPtr[i]+k] = local(k,m-1) * scale;
+      }
+    }
+    }
+
+    /*--- Transpose, to scatter from the columns of G. ---*/
+    precTPtr.assign(n+1, 0);
+    for (const auto j : precInd) ++precTPtr[j+1];
+    for (auto j = 0ul; j < n; ++j) precTPtr[j+1] += precTPtr[j];
+    precTInd.resize(precInd.size());
+    precTVal.resize(precVal.size());
+    vector<unsigned long> pos(precTPtr.begin(), precTPtr.end()-1);
+    for (auto i = 0ul; i < n; ++i) {
+      for (auto k = precPtr[i]; k < precPtr[i+1]; ++k) {
+        const auto j = precInd[k];
+        precTInd[pos[j]] = i;
+        precTVal[pos[j]++] = precVal[k];
+      }
+    }
+  }
+};
+
+/*!
+ * \brief Preconditioned conjugate gradients on the kernel matrix of the sparse method.
+ * \note Only the entries reachable from the right hand side by the matrix-vector products (and by the
+ *       applications of the preconditioner) are visited, therefore the cost of a solve with a sparse right
+ *       hand side does not scale with the size of the matrix.
+ */
+class CKernelCG {
+  const CKernelMatrix& mat;
+  vector<passivedouble> x, r, p, q, y, z;  /*!< \brief Zero outside of the active entries. */
+  vector<char> isActive;
+  vector<unsigned long> active;
+
+  void Activate(unsigned long i) {
+    if (isActive[i]) return;
+    isActive[i] = true;
+    active.push_back(i);
+  }
+
+  /*!
+   * \brief out = A * in, with A in CSR storage and given by rows or by columns (transposed scatter).
+   */
+  void Scatter(const vector<unsigned long>& ptr, const vector<unsigned long>& ind, const vector<passivedouble>& val,
+               const vector<passivedouble>& in, vector<passivedouble>& out) {
+    const auto nActive = active.size();
+    for (auto k = 0ul; k < nActive; ++k) out[active[k]] = 0.0;
+    for (auto k = 0ul; k < nActive; ++k) {
+      const auto i = active[k];
+      if (in[i] == 0.0) continue;
+      for (auto l = ptr[i]; l < ptr[i+1]; ++l) {
+        Activate(ind[l]);
+        out[ind[l]] += val[l] * in[i];
+      }
+    }
+  }
+
+  /*!
+   * \brief z = G^T * G * r.
+   */
+  void Precondition() {
+    Scatter(mat.precTPtr, mat.precTInd, mat.precTVal, r, y);
+    Scatter(mat.precPtr, mat.precInd, mat.precVal, y, z);
+  }
+
+public:
+  explicit CKernelCG(const CKernelMatrix& mat_) : mat(mat_) {
+    const auto n = mat.rowPtr.size()-1;
+    for (auto vec : {&x, &r, &p, &q, &y, &z}) vec->resize(n, 0.0);
+    isActive.resize(n, false);
+  }
+
+  /*!
+   * \brief Entries of the solution that may be non-zero (in no particular order).
+   */
+  const vector<unsigned long>& Active() const { return active; }
+
+  passivedouble Solution(unsigned long i) const { return x[i]; }
+
+  /*!
+   * \brief Solve for the right hand side given by the indices and values of its non-zeros.
+   * \return Number of iterations.
+   */
+  unsigned long Solve(const vector<unsigned long>& idx, const vector<passivedouble>& val, bool& converged) {
+    for (const auto i : active) {
+      x[i] = r[i] = p[i] = q[i] = y[i] = z[i] = 0.0;
+      isActive[i] = false;
+    }
+    active.clear();
+
+    passivedouble rr = 0.0;
+    for (auto k = 0ul; k < idx.size(); ++k) {
+      Activate(idx[k]);
+      r[idx[k]] = val[k];
+      rr += val[k]*val[k];
+    }
+    converged = true;
+    if (rr == 0.0) return 0;
+    const passivedouble tol2 = pow(sparseTolerance, 2) * rr;
+
+    Precondition();
+    passivedouble rz = 0.0;
+    for (const auto i : active) {
+      p[i] = z[i];
+      rz += r[i]*z[i];
+    }
+
+    const auto maxIter = min(sparseMaxIter, 2*x.size()+10);
+    for (auto iter = 1ul; iter <= maxIter; ++iter) {
+
+      /*--- q = M*p, the matrix is symmetric, the rows are scattered as columns. ---*/
+      Scatter(mat.rowPtr, mat.colInd, mat.values, p, q);
+
+      passivedouble pq = 0.0;
+      for (const auto i : active) pq += p[i]*q[i];
+      const passivedouble alpha = rz / pq;
+
+      passivedouble rrNew = 0.0;
+      for (const auto i : active) {
+        x[i] += alpha * p[i];
+        r[i] -= alpha * q[i];
+        rrNew += r[i]*r[i];
+      }
+      if (rrNew <= tol2) return iter;
+
+      Precondition();
+      passivedouble rzNew = 0.0;
+      for (const auto i : active) rzNew += r[i]*z[i];
+
+      const passivedouble beta = rzNew / rz;
+      rz = rzNew;
+      for (const auto i : active) p[i] = z[i] + beta * p[i];
+    }
+    converged = false;
+    return maxIter;
+  }
+};
+} // namespace
+
 
 CRadialBasisFunction::CRadialBasisFunction(CGeometry ****geometry_container, const CConfig* const* config,
                                            unsigned int iZone, unsigned int jZone) :
@@ -61,6 +256,11 @@ void CRadialBasisFunction::PrintStatistics() const {
   else if (MaxCorrection < 2.0 && AvgCorrection < 1.05) cout << " (warning)\n";
   else cout << " <<< WARNING >>>\n";
   cout << "  Interpolation matrix is " << Density << "% dense." << endl;
+  if (Sparse) {
+    cout << "  Avg. number of CG iterations per target point: " << AvgIterations;
+    if (NotConverged) cout << " (" << NotConverged << " solves did not converge)";
+    cout << endl;
+  }
   cout.unsetf(ios::floatfield);
 }
 
@@ -101,6 +301,12 @@ void CRadialBasisFunction::SetTransferCoeff(const CConfig* const* config) {
   const bool usePolynomial = config[donorZone]->GetRadialBasisFunctionPolynomialOption();
   const su2double paramRBF = config[donorZone]->GetRadialBasisFunctionParameter();
   const su2double pruneTol = config[donorZone]->GetRadialBasisFunctionPruneTol();
+  const bool distributed = config[donorZone]->GetDistributedDonorSearch();
+  Sparse = config[donorZone]->GetRadialBasisFunctionSparse();
+
+  if (Sparse && (kindRBF != WENDLAND_C2))
+    SU2_MPI::Error("The sparse RBF interpolation requires a compactly supported function (WENDLAND_C2).",
+                   CURRENT_FUNCTION);
 
   const auto nMarkerInt = config[donorZone]->GetMarker_n_ZoneInterface()/2;
   const int nDim = donor_geometry->GetnDim();
@@ -119,8 +325,19 @@ void CRadialBasisFunction::SetTransferCoeff(const CConfig* const* config) {
   vector<vector<long> > donorGlobalPoint(nMarkerInt);
   vector<vector<int> > donorProcessor(nMarkerInt);
   vector<int> assignedProcessor(nMarkerInt,-1);
+  vector<unsigned long> nGlobalDonor(nMarkerInt,0);
   vector<unsigned long> totalWork(nProcessor,0);
 
+  /*--- Static work scheduling over ranks based on which one has less work currently. ---*/
+  auto AssignProcessor = [&totalWork, nProcessor](unsigned long nGlobalVertexDonor) {
+    int iProcessor = 0;
+    for (int i = 1; i < nProcessor; ++i)
+      if (totalWork[i] < totalWork[iProcessor]) iProcessor = i;
+
+    totalWork[iProcessor] += pow(nGlobalVertexDonor,3); // based on matrix inversion.
+    return iProcessor;
+  };
+
   for (unsigned short iMarkerInt = 0; iMarkerInt < nMarkerInt; ++iMarkerInt) {
 
     /*--- On the donor side: find the tag of the boundary sharing the interface. ---*/
@@ -132,57 +349,69 @@ void CRadialBasisFunction::SetTransferCoeff(const CConfig* const* config) {
     /*--- If the zone does not contain the interface continue to the next pair of markers. ---*/
     if (!CheckInterfaceBoundary(markDonor,markTarget)) continue;
 
-    unsigned long nVertexDonor = 0;
+    unsigned long nVertexDonor = 0, nVertexTarget = 0;
     if (markDonor != -1) nVertexDonor = donor_geometry->GetnVertex(markDonor);
+    if (markTarget != -1) nVertexTarget = target_geometry->GetnVertex(markTarget);
 
-    /*--- Sets MaxLocalVertex_Donor, Buffer_Receive_nVertex_Donor. ---*/
-    Determine_ArraySize(markDonor, markTarget, nVertexDonor, nDim);
+    auto& donorCoord = donorCoordinates[iMarkerInt];
+    auto& donorPoint = donorGlobalPoint[iMarkerInt];
+    auto& donorProc = donorProcessor[iMarkerInt];
 
-    /*--- Compute total number of donor vertices. ---*/
-    const auto nGlobalVertexDonor = accumulate(Buffer_Receive_nVertex_Donor,
-                                    Buffer_Receive_nVertex_Donor+nProcessor, 0ul);
+    if (distributed) {
+      /*--- Sets MaxLocalVertex_Donor, Buffer_Receive_nVertex_Donor. ---*/
+      Determine_ArraySize(markDonor, markTarget, nVertexDonor, nDim);
 
-    /*--- Gather coordinates and global point indices. ---*/
-    Buffer_Send_Coord = new su2double [ MaxLocalVertex_Donor * nDim ];
-    Buffer_Send_GlobalPoint = new long [ MaxLocalVertex_Donor ];
-    Buffer_Receive_Coord = new su2double [ nProcessor * MaxLocalVertex_Donor * nDim ];
-    Buffer_Receive_GlobalPoint = new long [ nProcessor * MaxLocalVertex_Donor ];
+      const auto nGlobalVertexDonor = accumulate(Buffer_Receive_nVertex_Donor,
+                                      Buffer_Receive_nVertex_Donor+nProcessor, 0ul);
+      nGlobalDonor[iMarkerInt] = nGlobalVertexDonor;
+      assignedProcessor[iMarkerInt] = Sparse? rank : AssignProcessor(nGlobalVertexDonor);
 
-    Collect_VertexInfo(markDonor, markTarget, nVertexDonor, nDim);
+      su2passivematrix targetBox;
+      vector<passivedouble> radius(nProcessor, -1.0);
 
-    /*--- Compresses the gathered donor point information to simplify computations. ---*/
-    auto& donorCoord = donorCoordinates[iMarkerInt];
-    auto& donorPoint = donorGlobalPoint[iMarkerInt];
-    auto& donorProc = donorProcessor[iMarkerInt];
-    donorCoord.resize(nGlobalVertexDonor, nDim);
-    donorPoint.resize(nGlobalVertexDonor);
-    donorProc.resize(nGlobalVertexDonor);
-
-    auto iCount = 0ul;
-    for (int iProcessor = 0; iProcessor < nProcessor; ++iProcessor) {
-      auto offset = iProcessor * MaxLocalVertex_Donor;
-      for (auto iVertex = 0ul; iVertex < Buffer_Receive_nVertex_Donor[iProcessor]; ++iVertex) {
-        for (int iDim = 0; iDim < nDim; ++iDim)
-          donorCoord(iCount,iDim) = Buffer_Receive_Coord[(offset+iVertex)*nDim + iDim];
-        donorPoint[iCount] = Buffer_Receive_GlobalPoint[offset+iVertex];
-        donorProc[iCount] = iProcessor;
-        ++iCount;
+      if (Sparse) {
+        vector<unsigned long> numTarget;
+        targetBox = Gather_BoundingBoxes(target_geometry, markTarget, nDim, &numTarget);
+
+        /*--- Each rank computes the coefficients of its targets, the solution of the kernel system
+         *    for a target decays away from it, the donors are only sent to the ranks whose targets
+         *    are within a few support radii of them. ---*/
+        for (int iProcessor = 0; iProcessor < nProcessor; ++iProcessor)
+          if (numTarget[iProcessor] != 0) radius[iProcessor] = sparseHaloRadii * SU2_TYPE::GetValue(paramRBF);
+      }
+      else {
+        /*--- The dense RBF system couples all the donors, they are only sent to the rank that computes
+         *    the interpolation matrix and to the ranks with target points. ---*/
+        vector<unsigned long> allNumVertex(nProcessor);
+        SU2_MPI::Allgather(&nVertexTarget, 1, MPI_UNSIGNED_LONG,
+          allNumVertex.data(), 1, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+
+        for (int iProcessor = 0; iProcessor < nProcessor; ++iProcessor) {
+          if ((iProcessor == assignedProcessor[iMarkerInt]) || (allNumVertex[iProcessor] != 0))
+            radius[iProcessor] = numeric_limits<passivedouble>::infinity();
+        }
+        targetBox.resize(nProcessor, 2*nDim);
+        targetBox = 0.0;
       }
-    }
-    assert((iCount == nGlobalVertexDonor) && "Global donor point count mismatch.");
 
-    delete[] Buffer_Send_Coord;
-    delete[] Buffer_Send_GlobalPoint;
-    delete[] Buffer_Receive_Coord;
-    delete[] Buffer_Receive_GlobalPoint;
+      Distribute_VertexInfo(markDonor, nDim, targetBox, radius, donorCoord, donorPoint, donorProc);
+    }
+    else {
+      /*--- Gather coordinates and global point indices. ---*/
+      const auto nGlobalVertexDonor = Collect_VertexInfo(markDonor, markTarget, nVertexDonor, nDim,
+                                                         donorCoord, donorPoint, donorProc);
+      nGlobalDonor[iMarkerInt] = nGlobalVertexDonor;
+      assignedProcessor[iMarkerInt] = Sparse? rank : AssignProcessor(nGlobalVertexDonor);
+    }
 
     /*--- Give an MPI-independent order to the points (required due to high condition
      *    number of the RBF matrix, avoids diff results with diff number of ranks. ---*/
-    vector<int> order(nGlobalVertexDonor);
+    const int nLocalVertexDonor = donorPoint.size();
+    vector<int> order(nLocalVertexDonor);
     iota(order.begin(), order.end(), 0);
     sort(order.begin(), order.end(), [&donorPoint](int i, int j){return donorPoint[i] < donorPoint[j];});
 
-    for (int i = 0; i < int(nGlobalVertexDonor); ++i) {
+    for (int i = 0; i < nLocalVertexDonor; ++i) {
       int j = order[i];
       while (j < i) j = order[j];
       if (i == j) continue;
@@ -192,15 +421,6 @@ void CRadialBasisFunction::SetTransferCoeff(const CConfig* const* config) {
         swap(donorCoord(i,iDim), donorCoord(j,iDim));
     }
 
-    /*--- Static work scheduling over ranks based on which one has less work currently. ---*/
-    int iProcessor = 0;
-    for (int i = 1; i < nProcessor; ++i)
-      if (totalWork[i] < totalWork[iProcessor]) iProcessor = i;
-
-    totalWork[iProcessor] += pow(nGlobalVertexDonor,3); // based on matrix inversion.
-
-    assignedProcessor[iMarkerInt] = iProcessor;
-
   }
   delete[] Buffer_Receive_nVertex_Donor;
 
@@ -212,7 +432,7 @@ void CRadialBasisFunction::SetTransferCoeff(const CConfig* const* config) {
 
   SU2_OMP_PARALLEL_(for schedule(dynamic,1))
   for (unsigned short iMarkerInt = 0; iMarkerInt < nMarkerInt; ++iMarkerInt) {
-    if (rank == assignedProcessor[iMarkerInt]) {
+    if (!Sparse && (rank == assignedProcessor[iMarkerInt])) {
       ComputeGeneratorMatrix(kindRBF, usePolynomial, paramRBF,
                              donorCoordinates[iMarkerInt], nPolynomialVec[iMarkerInt],
                              keepPolynomialRowVec[iMarkerInt], CinvTrucVec[iMarkerInt]);
@@ -224,6 +444,7 @@ void CRadialBasisFunction::SetTransferCoeff(const CConfig* const* config) {
   /*--- Initialize variables for interpolation statistics. ---*/
   unsigned long totalTargetPoints = 0, totalDonorPoints = 0, denseSize = 0;
   MinDonors = 1<<30; MaxDonors = 0; MaxCorrection = 0.0; AvgCorrection = 0.0;
+  AvgIterations = 0.0; NotConverged = 0;
 
   for (unsigned short iMarkerInt = 0; iMarkerInt < nMarkerInt; iMarkerInt++) {
 
@@ -246,6 +467,21 @@ void CRadialBasisFunction::SetTransferCoeff(const CConfig* const* config) {
     auto& nPolynomial = nPolynomialVec[iMarkerInt];
     auto& keepPolynomialRow = keepPolynomialRowVec[iMarkerInt];
 
+    if (Sparse) {
+      /*--- No generator matrix, each rank computes the coefficients of its targets. ---*/
+      unsigned long nTarget = 0;
+      totalDonorPoints += ComputeSparseCoefficients(kindRBF, usePolynomial, SU2_TYPE::GetValue(paramRBF),
+                                                    SU2_TYPE::GetValue(pruneTol), markTarget, donorCoord,
+                                                    donorPoint, donorProc, nTarget);
+      totalTargetPoints += nTarget;
+      denseSize += nTarget*nGlobalDonor[iMarkerInt];
+
+      donorCoord.resize(0,0);
+      vector<long>().swap(donorPoint);
+      vector<int>().swap(donorProc);
+      continue;
+    }
+
     const auto nGlobalVertexDonor = donorCoord.rows();
 
 #ifdef HAVE_MPI
@@ -410,10 +646,12 @@ void CRadialBasisFunction::SetTransferCoeff(const CConfig* const* config) {
   Reduce(MPI_SUM, denseSize);
   Reduce(MPI_MIN, MinDonors);
   Reduce(MPI_MAX, MaxDonors);
+  Reduce(MPI_SUM, NotConverged);
 #ifdef HAVE_MPI
-  passivedouble tmp1 = AvgCorrection, tmp2 = MaxCorrection;
+  passivedouble tmp1 = AvgCorrection, tmp2 = MaxCorrection, tmp3 = AvgIterations;
   MPI_Allreduce(&tmp1, &AvgCorrection, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
   MPI_Allreduce(&tmp2, &MaxCorrection, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+  MPI_Allreduce(&tmp3, &AvgIterations, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
 #endif
   if (totalTargetPoints == 0)
     SU2_MPI::Error("Somehow there are no target interpolation points.", CURRENT_FUNCTION);
@@ -427,10 +665,276 @@ void CRadialBasisFunction::SetTransferCoeff(const CConfig* const* config) {
   MaxCorrection += 1.0; // put back the reference "1"
   AvgCorrection = AvgCorrection / totalTargetPoints + 1.0;
   AvgDonors = totalDonorPoints / totalTargetPoints;
+  AvgIterations /= totalTargetPoints;
   Density = totalDonorPoints / (0.01*denseSize);
 
 }
 
+unsigned long CRadialBasisFunction::ComputeSparseCoefficients(ENUM_RADIALBASIS type, bool usePolynomial,
+                           passivedouble radius, passivedouble pruneTol, int markTarget,
+                           const su2activematrix& donorCoord, const vector<long>& donorPoint,
+                           const vector<int>& donorProc, unsigned long& nTarget) {
+
+  const su2double interfaceCoordTol = 1e6 * numeric_limits<passivedouble>::epsilon();
+
+  const auto nVertexTarget = (markTarget != -1)? target_geometry->GetnVertex(markTarget) : 0ul;
+  const auto nDonor = donorCoord.rows();
+  const int nDim = donorCoord.cols();
+
+  /*--- Only the owned target points are processed. ---*/
+  vector<unsigned long> targets;
+  for (auto iVertex = 0ul; iVertex < nVertexTarget; ++iVertex) {
+    const auto iPoint = target_geometry->vertex[markTarget][iVertex]->GetNode();
+    if (target_geometry->nodes->GetDomain(iPoint)) targets.push_back(iVertex);
+  }
+  nTarget = targets.size();
+  if (nTarget == 0) return 0;
+  targetVertices[markTarget].resize(nVertexTarget);
+
+  /*--- Without donors all targets are left empty, which is caught by the sanity checks. ---*/
+  if (nDonor == 0) { MinDonors = 0; return 0; }
+
+  /*--- Search tree over the donors, and global sparse kernel matrix (M) between them (CSR). ---*/
+  vector<unsigned long> ids(nDonor);
+  iota(ids.begin(), ids.end(), 0ul);
+  CADTPointsOnlyClass tree(nDim, nDonor, const_cast<su2double*>(donorCoord.data()), ids.data(), false);
+
+  vector<vector<unsigned long> > neighbors(nDonor);
+  SU2_OMP_PARALLEL_(for schedule(dynamic,64))
+  for (auto iDonor = 0ul; iDonor < nDonor; ++iDonor) {
+    tree.DetermineNodesWithinRadius(donorCoord[iDonor], radius, neighbors[iDonor]);
+    sort(neighbors[iDonor].begin(), neighbors[iDonor].end());
+  }
+
+  CKernelMatrix kernel;
+  auto& rowPtr = kernel.rowPtr;
+  rowPtr.assign(nDonor+1, 0);
+  for (auto iDonor = 0ul; iDonor < nDonor; ++iDonor)
+    rowPtr[iDonor+1] = rowPtr[iDonor] + neighbors[iDonor].size();
+
+  kernel.colInd.resize(rowPtr.back());
+  kernel.values.resize(rowPtr.back());
+
+  SU2_OMP_PARALLEL_(for schedule(dynamic,64))
+  for (auto iDonor = 0ul; iDonor < nDonor; ++iDonor) {
+    auto k = rowPtr[iDonor];
+    for (const auto jDonor : neighbors[iDonor]) {
+      const auto dist = GeometryToolbox::Distance(nDim, donorCoord[iDonor], donorCoord[jDonor]);
+      kernel.colInd[k] = jDonor;
+      kernel.values[k] = SU2_TYPE::GetValue(Get_RadialBasisValue(type, radius, dist));
+      ++k;
+    }
+    vector<unsigned long>().swap(neighbors[iDonor]);
+  }
+
+  /*--- The preconditioner is computed once and used by the solves of all the targets. ---*/
+  kernel.BuildPreconditioner();
+
+  /*--- Polynomial term, via the Schur complement of M in the augmented system. The donor side is the same
+   *    for all targets: Z = M^-1 * P^T (dense, one solve per polynomial term), and S^-1 = (P * Z)^-1. ---*/
+  int nPolynomial = -1;
+  vector<int> keepPolynomialRow(nDim, 1);
+  su2passivematrix P, Z;
+  CSymmetricMatrix Sinv;
+  vector<passivedouble> maxZ;
+  vector<unsigned long> orderZ;
+
+  if (usePolynomial) {
+    P.resize(1+nDim, nDonor);
+    for (auto iDonor = 0ul; iDonor < nDonor; ++iDonor) {
+      P(0, iDonor) = 1.0;
+      for (int iDim = 0; iDim < nDim; ++iDim)
+        P(1+iDim, iDonor) = SU2_TYPE::GetValue(donorCoord(iDonor, iDim));
+    }
+
+    /*--- Check if points lie on a plane and remove one coordinate from P if so. ---*/
+    nPolynomial = CheckPolynomialTerms(interfaceCoordTol, keepPolynomialRow, P);
+
+    Z.resize(1+nPolynomial, nDonor);
+
+    SU2_OMP_PARALLEL
+    {
+    CKernelCG solver(kernel);
+    vector<passivedouble> rhs(nDonor);
+    unsigned long notConverged = 0;
+
+    SU2_OMP_FOR_DYN(1)
+    for (int iPoly = 0; iPoly <= nPolynomial; ++iPoly) {
+      rhs.assign(P[iPoly], P[iPoly]+nDonor);
+      bool converged;
+      solver.Solve(ids, rhs, converged);
+      notConverged += !converged;
+      for (auto iDonor = 0ul; iDonor < nDonor; ++iDonor) Z(iPoly, iDonor) = solver.Solution(iDonor);
+    }
+    SU2_OMP_ATOMIC
+    NotConverged += notConverged;
+    }
+
+    Sinv.Initialize(1+nPolynomial);
+    for (int i = 0; i <= nPolynomial; ++i)
+      for (int j = i; j <= nPolynomial; ++j) {
+        Sinv(i,j) = 0.0;
+        for (auto k = 0ul; k < nDonor; ++k) Sinv(i,j) += P(i,k) * Z(j,k);
+      }
+    Sinv.Invert(false);
+
+    /*--- Donors by decreasing magnitude of Z, to bound the polynomial part of the coefficients. ---*/
+    maxZ.assign(nDonor, 0.0);
+    for (int iPoly = 0; iPoly <= nPolynomial; ++iPoly)
+      for (auto iDonor = 0ul; iDonor < nDonor; ++iDonor)
+        maxZ[iDonor] = max(maxZ[iDonor], fabs(Z(iPoly,iDonor)));
+
+    orderZ.resize(nDonor);
+    iota(orderZ.begin(), orderZ.end(), 0ul);
+    sort(orderZ.begin(), orderZ.end(), [&maxZ](unsigned long i, unsigned long j) { return maxZ[i] > maxZ[j]; });
+  }
+
+  unsigned long totalDonorPoints = 0;
+
+  SU2_OMP_PARALLEL
+  {
+  /*--- Thread-local workspace. ---*/
+  CKernelCG solver(kernel);
+  vector<unsigned long> patch, nonZeros, perm, sortedIdx;
+  vector<passivedouble> rhs, coeff, sortedCoeff;
+  vector<passivedouble> res(1+nPolynomial), w(1+nPolynomial);
+  vector<char> isNonZero(usePolynomial? nDonor : 0, false);
+
+  /*--- Thread-local variables for statistics. ---*/
+  unsigned long minDonors = 1<<30, maxDonors = 0, totalDonors = 0, iterations = 0, notConverged = 0;
+  passivedouble sumCorr = 0.0, maxCorr = 0.0;
+
+  SU2_OMP_FOR_DYN(roundUpDiv(nTarget, 4*omp_get_num_threads()))
+  for (auto iTarget = 0ul; iTarget < nTarget; ++iTarget) {
+
+    const auto iVertexTarget = targets[iTarget];
+    const auto pointTarget = target_geometry->vertex[markTarget][iVertexTarget]->GetNode();
+    const auto coordTarget = target_geometry->nodes->GetCoord(pointTarget);
+    auto& targetVertex = targetVertices[markTarget][iVertexTarget];
+
+    /*--- Right hand side, function values at the target, non-zero only for the donors within the radius. ---*/
+    tree.DetermineNodesWithinRadius(coordTarget, radius, patch);
+
+    rhs.resize(patch.size());
+    bool active = false;
+    for (auto i = 0ul; i < patch.size(); ++i) {
+      const auto dist = GeometryToolbox::Distance(nDim, coordTarget, donorCoord[patch[i]]);
+      rhs[i] = SU2_TYPE::GetValue(Get_RadialBasisValue(type, radius, dist));
+      active |= (rhs[i] != 0.0);
+    }
+    if (!active && !usePolynomial) {
+      targetVertex.resize(0);
+      minDonors = 0;
+      continue;
+    }
+
+    /*--- Kernel part of the coefficients, x = M^-1 * f. ---*/
+    bool converged;
+    iterations += solver.Solve(patch, rhs, converged);
+    notConverged += !converged;
+
+    if (usePolynomial) {
+      /*--- coeff = x + Z * S^-1 * (p(target) - P * x), this term couples the target to all donors. ---*/
+      res[0] = 1.0;
+      for (int iDim = 0, idx = 1; iDim < nDim; ++iDim) {
+        if (!keepPolynomialRow[iDim]) continue;
+        res[idx++] = SU2_TYPE::GetValue(coordTarget[iDim]);
+      }
+      for (const auto i : solver.Active())
+        for (int iPoly = 0; iPoly <= nPolynomial; ++iPoly)
+          res[iPoly] -= P(iPoly,i) * solver.Solution(i);
+
+      Sinv.MatVecMult(res.begin(), w.begin());
+
+      auto polyCoeff = [&](unsigned long i) {
+        passivedouble c = 0.0;
+        for (int iPoly = 0; iPoly <= nPolynomial; ++iPoly) c += w[iPoly] * Z(iPoly,i);
+        return c;
+      };
+
+      nonZeros = solver.Active();
+      coeff.resize(nonZeros.size());
+      passivedouble maxCoeff = 0.0;
+      for (auto k = 0ul; k < nonZeros.size(); ++k) {
+        const auto i = nonZeros[k];
+        isNonZero[i] = true;
+        coeff[k] = solver.Solution(i) + polyCoeff(i);
+        maxCoeff = max(maxCoeff, fabs(coeff[k]));
+      }
+
+      /*--- Outside the support of x the coefficients are only the polynomial part, bounded by |w|_1 * max|Z|.
+       *    Visiting the donors by decreasing bound, the remaining ones can be skipped once they would all be
+       *    pruned, i.e. the cost is proportional to the number of donors kept (not to nDonor). ---*/
+      passivedouble sumW = 0.0;
+      for (int iPoly = 0; iPoly <= nPolynomial; ++iPoly) sumW += fabs(w[iPoly]);
+
+      for (const auto i : orderZ) {
+        if (sumW * maxZ[i] <= pruneTol * maxCoeff) break;
+        if (isNonZero[i]) continue;
+        nonZeros.push_back(i);
+        coeff.push_back(polyCoeff(i));
+        maxCoeff = max(maxCoeff, fabs(coeff.back()));
+      }
+      for (const auto i : nonZeros) isNonZero[i] = false;
+
+      /*--- Order the donors by index, to have the same order with any number of threads. ---*/
+      perm.resize(nonZeros.size());
+      iota(perm.begin(), perm.end(), 0ul);
+      sort(perm.begin(), perm.end(), [&nonZeros](unsigned long a, unsigned long b) { return nonZeros[a] < nonZeros[b]; });
+      sortedIdx.resize(perm.size());
+      sortedCoeff.resize(perm.size());
+      for (auto k = 0ul; k < perm.size(); ++k) {
+        sortedIdx[k] = nonZeros[perm[k]];
+        sortedCoeff[k] = coeff[perm[k]];
+      }
+      nonZeros.swap(sortedIdx);
+      coeff.swap(sortedCoeff);
+    }
+    else {
+      nonZeros = solver.Active();
+      sort(nonZeros.begin(), nonZeros.end());
+      coeff.resize(nonZeros.size());
+      for (auto i = 0ul; i < nonZeros.size(); ++i) coeff[i] = solver.Solution(nonZeros[i]);
+    }
+
+    /*--- Prune small coefficients. ---*/
+    auto info = PruneSmallCoefficients(pruneTol, nonZeros.size(), coeff.begin());
+    auto nnz = info.first;
+    totalDonors += nnz;
+    minDonors = min(minDonors, nnz);
+    maxDonors = max(maxDonors, nnz);
+    auto corr = fabs(info.second-1.0);
+    sumCorr += corr;
+    maxCorr = max(maxCorr, corr);
+
+    /*--- Allocate and set donor information for this target point. ---*/
+    targetVertex.resize(nnz);
+
+    for (unsigned long i = 0, iSet = 0; i < nonZeros.size(); ++i) {
+      if (fabs(coeff[i]) > 0.0) {
+        targetVertex.processor[iSet] = donorProc[nonZeros[i]];
+        targetVertex.globalPoint[iSet] = donorPoint[nonZeros[i]];
+        targetVertex.coefficient[iSet] = coeff[i];
+        ++iSet;
+      }
+    }
+  } // end target vertex loop
+
+  SU2_OMP_CRITICAL
+  {
+    totalDonorPoints += totalDonors;
+    MinDonors = min(MinDonors, minDonors);
+    MaxDonors = max(MaxDonors, maxDonors);
+    AvgCorrection += sumCorr;
+    MaxCorrection = max(MaxCorrection, maxCorr);
+    AvgIterations += iterations;
+    NotConverged += notConverged;
+  }
+  } // end SU2_OMP_PARALLEL
+
+  return totalDonorPoints;
+}
+
 void CRadialBasisFunction::ComputeGeneratorMatrix(ENUM_RADIALBASIS type, bool usePolynomial,
                            su2double radius, const su2activematrix& coords, int& nPolynomial,
                            vector<int>& keepPolynomialRow, su2passivematrix& C_inv_trunc) {
@@ -584,6 +1088,11 @@ int CRadialBasisFunction::CheckPolynomialTerms(su2double max_diff_tol, vector<in
     for (auto i = remove_row+1; i < m-1; ++i)
       for (int j = 0; j < n; ++j)
         P(i,j) = P(i+1,j);
+
+    /*--- Drop the row left over at the bottom (rows are contiguous). ---*/
+    su2passivematrix Pkept(m-1, n);
+    memcpy(Pkept.data(), P.data(), Pkept.size()*sizeof(passivedouble));
+    P = move(Pkept);
   }
 
   return n_polynomial;
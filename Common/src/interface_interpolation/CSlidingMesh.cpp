@@ -29,6 +29,9 @@
 #include "../../include/CConfig.hpp"
 #include "../../include/geometry/CGeometry.hpp"
 #include "../../include/toolboxes/geometry_toolbox.hpp"
+#include "../../include/adt/CADTPointsOnlyClass.hpp"
+#include <memory>
+#include <unordered_map>
 
 
 CSlidingMesh::CSlidingMesh(CGeometry ****geometry_container, const CConfig* const* config,
@@ -60,7 +63,7 @@ void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
 
   /* --- Geometrical variables --- */
 
-  su2double *Coord_i, *Coord_j, dist, mindist, *Normal;
+  su2double *Coord_i, *Normal;
   su2double Area, Area_old, tmp_Area;
   su2double LineIntersectionLength, *Direction, length;
 
@@ -87,6 +90,7 @@ void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
   /* --- Donor variables --- */
 
   unsigned long donor_StartIndex, donor_forward_point, donor_backward_point, donor_iPoint, donor_OldiPoint;
+  long seed;
   unsigned long nEdges_donor, nNode_donor, nGlobalVertex_Donor;
 
   unsigned long nDonorPoints, iDonor;
@@ -98,6 +102,7 @@ void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
   su2double **donor_element, *DonorPoint_Coord;
 
   targetVertices.resize(config[targetZone]->GetnMarker_All());
+  donorSeed.resize(config[targetZone]->GetnMarker_All());
 
   /* 1 - Variable pre-processing */
 
@@ -122,6 +127,9 @@ void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
   /*--- Number of markers on the FSI interface ---*/
   nMarkerInt = (int)( config[ donorZone ]->GetMarker_n_ZoneInterface() ) / 2;
 
+  targetBoundary.resize(nMarkerInt);
+  donorBoundary.resize(nMarkerInt);
+
   /*--- For the number of markers on the interface... ---*/
   for ( iMarkerInt = 0; iMarkerInt < nMarkerInt; iMarkerInt++ ){
 
@@ -142,28 +150,57 @@ void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
     */
 
     /*--- Target boundary ---*/
-    ReconstructBoundary(targetZone, markTarget);
+    auto& target = targetBoundary[iMarkerInt];
+    GatherBoundary(targetZone, markTarget, target);
 
-    nGlobalVertex_Target = nGlobalVertex;
+    nGlobalVertex_Target = target.nVertex;
 
-    TargetPoint_Coord       = Buffer_Receive_Coord;
-    Target_GlobalPoint      = Buffer_Receive_GlobalPoint;
-    Target_nLinkedNodes     = Buffer_Receive_nLinkedNodes;
-    Target_StartLinkedNodes = Buffer_Receive_StartLinkedNodes;
-    Target_LinkedNodes      = Buffer_Receive_LinkedNodes;
-    Target_Proc             = Buffer_Receive_Proc;
+    TargetPoint_Coord       = target.coord.data();
+    Target_GlobalPoint      = target.globalPoint.data();
+    Target_nLinkedNodes     = target.nLinkedNodes.data();
+    Target_StartLinkedNodes = target.startLinkedNodes.data();
+    Target_LinkedNodes      = target.linkedNodes.data();
+    Target_Proc             = target.proc.data();
 
     /*--- Donor boundary ---*/
-    ReconstructBoundary(donorZone, markDonor);
-
-    nGlobalVertex_Donor = nGlobalVertex;
-
-    DonorPoint_Coord       = Buffer_Receive_Coord;
-    Donor_GlobalPoint      = Buffer_Receive_GlobalPoint;
-    Donor_nLinkedNodes     = Buffer_Receive_nLinkedNodes;
-    Donor_StartLinkedNodes = Buffer_Receive_StartLinkedNodes;
-    Donor_LinkedNodes      = Buffer_Receive_LinkedNodes;
-    Donor_Proc             = Buffer_Receive_Proc;
+    auto& donor = donorBoundary[iMarkerInt];
+    GatherBoundary(donorZone, markDonor, donor);
+
+    nGlobalVertex_Donor = donor.nVertex;
+
+    DonorPoint_Coord       = donor.coord.data();
+    Donor_GlobalPoint      = donor.globalPoint.data();
+    Donor_nLinkedNodes     = donor.nLinkedNodes.data();
+    Donor_StartLinkedNodes = donor.startLinkedNodes.data();
+    Donor_LinkedNodes      = donor.linkedNodes.data();
+    Donor_Proc             = donor.proc.data();
+
+    /*--- Set up the search of the donor node from which the supermesh of a target node is built. The walk from
+     * the donor found at the previous call (a few nodes away after one time step of a sliding interface) is
+     * tried first, the search tree of the donor nodes is built when needed. ---*/
+
+    const auto& targetIndex = target.index;
+    const auto& donorIndex = donor.index;
+
+    unique_ptr<CADTPointsOnlyClass> donorTree;
+    vector<unsigned long> donorTreeID;
+
+    auto FindStartDonor = [&](const su2double* coord, long seedPoint) {
+      const auto it = donorIndex.find(seedPoint);
+      if (it != donorIndex.end())
+        return WalkToClosestVertex(nDim, coord, Donor_LinkedNodes, Donor_StartLinkedNodes, Donor_nLinkedNodes,
+                                   DonorPoint_Coord, it->second);
+      if (!donorTree) {
+        donorTreeID.resize(nGlobalVertex_Donor);
+        iota(donorTreeID.begin(), donorTreeID.end(), 0ul);
+        donorTree.reset(new CADTPointsOnlyClass(nDim, nGlobalVertex_Donor, DonorPoint_Coord, donorTreeID.data(), false));
+      }
+      su2double dist;
+      unsigned long closest = 0;
+      int rankID;
+      donorTree->DetermineNearestNode(coord, dist, closest, rankID);
+      return closest;
+    };
 
     /*--- Starts building the supermesh layer (2D or 3D) ---*/
     /* - For each target node, it first finds the closest donor point
@@ -171,7 +208,10 @@ void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
      * - Starting from the closest donor node, it expands the supermesh by including
      * donor elements neighboring the initial one, until the overall target area is fully covered.
      */
-    if (nVertexTarget) targetVertices[markTarget].resize(nVertexTarget);
+    if (nVertexTarget) {
+      targetVertices[markTarget].resize(nVertexTarget);
+      donorSeed[markTarget].resize(nVertexTarget, -1);
+    }
 
     if(nDim == 2){
 
@@ -197,37 +237,9 @@ void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
 
           Coord_i = target_geometry->nodes->GetCoord(target_iPoint);
 
-          /*--- Brute force to find the closest donor_node ---*/
-
-          mindist = 1E6;
-          donor_StartIndex = 0;
-
-          for (donor_iPoint = 0; donor_iPoint < nGlobalVertex_Donor; donor_iPoint++) {
-
-            Coord_j = &DonorPoint_Coord[ donor_iPoint * nDim ];
-
-            dist = GeometryToolbox::Distance(nDim, Coord_i, Coord_j);
-
-            if (dist < mindist) {
-              mindist = dist;
-              donor_StartIndex = donor_iPoint;
-            }
-
-            if (dist == 0.0){
-              donor_StartIndex = donor_iPoint;
-              break;
-            }
-          }
-
-          donor_iPoint    = donor_StartIndex;
-          donor_OldiPoint = donor_iPoint;
-
           /*--- Contruct information regarding the target cell ---*/
 
-          long dPoint = target_geometry->nodes->GetGlobalIndex(target_iPoint);
-          for (jVertexTarget = 0; jVertexTarget < nGlobalVertex_Target; jVertexTarget++)
-            if( dPoint == Target_GlobalPoint[jVertexTarget] )
-              break;
+          jVertexTarget = targetIndex.at(target_geometry->nodes->GetGlobalIndex(target_iPoint));
 
           if ( Target_nLinkedNodes[jVertexTarget] == 1 ){
             target_segment[0] = Target_LinkedNodes[ Target_StartLinkedNodes[jVertexTarget] ];
@@ -255,164 +267,182 @@ void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
 
           length = GeometryToolbox::Distance(nDim, target_iMidEdge_point, target_jMidEdge_point);
 
-          check = false;
+          /*--- Start from the donor of the previous call, if the supermesh built from there is empty
+           * (or there is no previous donor) start from the closest donor node. ---*/
 
-          /*--- Proceeds along the forward direction (depending on which connected boundary node is found first) ---*/
+          seed = donorSeed[markTarget][iVertex];
 
-          while( !check ){
+          while (true) {
 
-            /*--- Proceeds until the value of the intersection area is null ---*/
+            donor_StartIndex = FindStartDonor(Coord_i, seed);
+            donor_iPoint     = donor_StartIndex;
+            donor_OldiPoint  = donor_iPoint;
+            nDonorPoints     = 0;
 
-            if ( Donor_nLinkedNodes[donor_iPoint] == 1 ){
-              donor_forward_point  = Donor_LinkedNodes[ Donor_StartLinkedNodes[donor_iPoint] ];
-              donor_backward_point = donor_iPoint;
-            }
-            else{
-              uptr = &Donor_LinkedNodes[ Donor_StartLinkedNodes[donor_iPoint] ];
+            check = false;
+
+            /*--- Proceeds along the forward direction (depending on which connected boundary node is found first) ---*/
+
+            while( !check ){
+
+              /*--- Proceeds until the value of the intersection area is null ---*/
 
-              if( donor_OldiPoint != uptr[0] ){
-                donor_forward_point  = uptr[0];
-                donor_backward_point = uptr[1];
+              if ( Donor_nLinkedNodes[donor_iPoint] == 1 ){
+                donor_forward_point  = Donor_LinkedNodes[ Donor_StartLinkedNodes[donor_iPoint] ];
+                donor_backward_point = donor_iPoint;
               }
               else{
-                donor_forward_point  = uptr[1];
-                donor_backward_point = uptr[0];
-              }
-            }
+                uptr = &Donor_LinkedNodes[ Donor_StartLinkedNodes[donor_iPoint] ];
 
-            if(donor_iPoint >= nGlobalVertex_Donor){
-              check = true;
-              continue;
-            }
+                if( donor_OldiPoint != uptr[0] ){
+                  donor_forward_point  = uptr[0];
+                  donor_backward_point = uptr[1];
+                }
+                else{
+                  donor_forward_point  = uptr[1];
+                  donor_backward_point = uptr[0];
+                }
+              }
 
-            for(iDim = 0; iDim < nDim; iDim++){
-              donor_iMidEdge_point[iDim] = ( DonorPoint_Coord[ donor_forward_point  * nDim + iDim] +
-                                             DonorPoint_Coord[ donor_iPoint * nDim + iDim] ) / 2;
-              donor_jMidEdge_point[iDim] = ( DonorPoint_Coord[ donor_backward_point * nDim + iDim] +
-                                             DonorPoint_Coord[ donor_iPoint * nDim + iDim] ) / 2;
-            }
+              if(donor_iPoint >= nGlobalVertex_Donor){
+                check = true;
+                continue;
+              }
 
-            LineIntersectionLength = ComputeLineIntersectionLength(nDim, target_iMidEdge_point, target_jMidEdge_point,
-                                                                   donor_iMidEdge_point, donor_jMidEdge_point, Direction);
+              for(iDim = 0; iDim < nDim; iDim++){
+                donor_iMidEdge_point[iDim] = ( DonorPoint_Coord[ donor_forward_point  * nDim + iDim] +
+                                               DonorPoint_Coord[ donor_iPoint * nDim + iDim] ) / 2;
+                donor_jMidEdge_point[iDim] = ( DonorPoint_Coord[ donor_backward_point * nDim + iDim] +
+                                               DonorPoint_Coord[ donor_iPoint * nDim + iDim] ) / 2;
+              }
 
-            if ( LineIntersectionLength == 0.0 ){
-              check = true;
-              continue;
-            }
+              LineIntersectionLength = ComputeLineIntersectionLength(nDim, target_iMidEdge_point, target_jMidEdge_point,
+                                                                     donor_iMidEdge_point, donor_jMidEdge_point, Direction);
 
-            /*--- In case the element intersects the target cell, update the auxiliary communication data structure ---*/
+              if ( LineIntersectionLength == 0.0 ){
+                check = true;
+                continue;
+              }
 
-            tmp_Coeff_Vect = new     su2double[ nDonorPoints + 1 ];
-            tmp_Donor_Vect = new unsigned long[ nDonorPoints + 1 ];
-            tmp_storeProc  = new unsigned long[ nDonorPoints + 1 ];
+              /*--- In case the element intersects the target cell, update the auxiliary communication data structure ---*/
 
-            for( iDonor = 0; iDonor < nDonorPoints; iDonor++){
-              tmp_Donor_Vect[iDonor] = Donor_Vect[iDonor];
-              tmp_Coeff_Vect[iDonor] = Coeff_Vect[iDonor];
-              tmp_storeProc[iDonor]  = storeProc[iDonor];
-            }
+              tmp_Coeff_Vect = new     su2double[ nDonorPoints + 1 ];
+              tmp_Donor_Vect = new unsigned long[ nDonorPoints + 1 ];
+              tmp_storeProc  = new unsigned long[ nDonorPoints + 1 ];
 
-            tmp_Donor_Vect[ nDonorPoints ] = donor_iPoint;
-            tmp_Coeff_Vect[ nDonorPoints ] = LineIntersectionLength / length;
-            tmp_storeProc[  nDonorPoints ] = Donor_Proc[donor_iPoint];
+              for( iDonor = 0; iDonor < nDonorPoints; iDonor++){
+                tmp_Donor_Vect[iDonor] = Donor_Vect[iDonor];
+                tmp_Coeff_Vect[iDonor] = Coeff_Vect[iDonor];
+                tmp_storeProc[iDonor]  = storeProc[iDonor];
+              }
 
-            delete [] Donor_Vect;
-            delete [] Coeff_Vect;
-            delete [] storeProc;
+              tmp_Donor_Vect[ nDonorPoints ] = donor_iPoint;
+              tmp_Coeff_Vect[ nDonorPoints ] = LineIntersectionLength / length;
+              tmp_storeProc[  nDonorPoints ] = Donor_Proc[donor_iPoint];
 
-            Donor_Vect = tmp_Donor_Vect;
-            Coeff_Vect = tmp_Coeff_Vect;
-            storeProc  = tmp_storeProc;
+              delete [] Donor_Vect;
+              delete [] Coeff_Vect;
+              delete [] storeProc;
 
-            donor_OldiPoint = donor_iPoint;
-            donor_iPoint    = donor_forward_point;
+              Donor_Vect = tmp_Donor_Vect;
+              Coeff_Vect = tmp_Coeff_Vect;
+              storeProc  = tmp_storeProc;
 
-            nDonorPoints++;
-          }
+              donor_OldiPoint = donor_iPoint;
+              donor_iPoint    = donor_forward_point;
 
-          if ( Donor_nLinkedNodes[donor_StartIndex] == 2 ){
-            check = false;
+              nDonorPoints++;
+            }
 
-            uptr = &Donor_LinkedNodes[ Donor_StartLinkedNodes[donor_StartIndex] ];
+            if ( Donor_nLinkedNodes[donor_StartIndex] == 2 ){
+              check = false;
 
-            donor_iPoint = uptr[1];
-            donor_OldiPoint = donor_StartIndex;
-          }
-          else
-            check = true;
+              uptr = &Donor_LinkedNodes[ Donor_StartLinkedNodes[donor_StartIndex] ];
 
-          /*--- Proceeds along the backward direction (depending on which connected boundary node is found first) ---*/
+              donor_iPoint = uptr[1];
+              donor_OldiPoint = donor_StartIndex;
+            }
+            else
+              check = true;
 
-          while( !check ){
+            /*--- Proceeds along the backward direction (depending on which connected boundary node is found first) ---*/
 
-            /*--- Proceeds until the value of the intersection length is null ---*/
-            if ( Donor_nLinkedNodes[donor_iPoint] == 1 ){
-              donor_forward_point  = donor_OldiPoint;
-              donor_backward_point = donor_iPoint;
-            }
-            else{
-              uptr = &Donor_LinkedNodes[ Donor_StartLinkedNodes[donor_iPoint] ];
+            while( !check ){
 
-              if( donor_OldiPoint != uptr[0] ){
-                donor_forward_point  = uptr[0];
-                donor_backward_point = uptr[1];
+              /*--- Proceeds until the value of the intersection length is null ---*/
+              if ( Donor_nLinkedNodes[donor_iPoint] == 1 ){
+                donor_forward_point  = donor_OldiPoint;
+                donor_backward_point = donor_iPoint;
               }
               else{
-                donor_forward_point  = uptr[1];
-                donor_backward_point = uptr[0];
+                uptr = &Donor_LinkedNodes[ Donor_StartLinkedNodes[donor_iPoint] ];
+
+                if( donor_OldiPoint != uptr[0] ){
+                  donor_forward_point  = uptr[0];
+                  donor_backward_point = uptr[1];
+                }
+                else{
+                  donor_forward_point  = uptr[1];
+                  donor_backward_point = uptr[0];
+                }
               }
-            }
 
-            if(donor_iPoint >= nGlobalVertex_Donor){
-              check = true;
-              continue;
-            }
+              if(donor_iPoint >= nGlobalVertex_Donor){
+                check = true;
+                continue;
+              }
 
-            for(iDim = 0; iDim < nDim; iDim++){
-              donor_iMidEdge_point[iDim] = ( DonorPoint_Coord[ donor_forward_point  * nDim + iDim] +
-                                             DonorPoint_Coord[ donor_iPoint * nDim + iDim] ) / 2;
-              donor_jMidEdge_point[iDim] = ( DonorPoint_Coord[ donor_backward_point * nDim + iDim] +
-                                             DonorPoint_Coord[ donor_iPoint * nDim + iDim] ) / 2;
-            }
+              for(iDim = 0; iDim < nDim; iDim++){
+                donor_iMidEdge_point[iDim] = ( DonorPoint_Coord[ donor_forward_point  * nDim + iDim] +
+                                               DonorPoint_Coord[ donor_iPoint * nDim + iDim] ) / 2;
+                donor_jMidEdge_point[iDim] = ( DonorPoint_Coord[ donor_backward_point * nDim + iDim] +
+                                               DonorPoint_Coord[ donor_iPoint * nDim + iDim] ) / 2;
+              }
 
-            LineIntersectionLength = ComputeLineIntersectionLength(nDim, target_iMidEdge_point, target_jMidEdge_point,
-                                                                   donor_iMidEdge_point, donor_jMidEdge_point, Direction);
+              LineIntersectionLength = ComputeLineIntersectionLength(nDim, target_iMidEdge_point, target_jMidEdge_point,
+                                                                     donor_iMidEdge_point, donor_jMidEdge_point, Direction);
 
-            if ( LineIntersectionLength == 0.0 ){
-              check = true;
-              continue;
-            }
+              if ( LineIntersectionLength == 0.0 ){
+                check = true;
+                continue;
+              }
 
-            /*--- In case the element intersects the target cell, update the auxiliary communication data structure ---*/
+              /*--- In case the element intersects the target cell, update the auxiliary communication data structure ---*/
 
-            tmp_Coeff_Vect = new     su2double[ nDonorPoints + 1 ];
-            tmp_Donor_Vect = new unsigned long[ nDonorPoints + 1 ];
-            tmp_storeProc  = new unsigned long[ nDonorPoints + 1 ];
+              tmp_Coeff_Vect = new     su2double[ nDonorPoints + 1 ];
+              tmp_Donor_Vect = new unsigned long[ nDonorPoints + 1 ];
+              tmp_storeProc  = new unsigned long[ nDonorPoints + 1 ];
 
-            for( iDonor = 0; iDonor < nDonorPoints; iDonor++){
-              tmp_Donor_Vect[iDonor] = Donor_Vect[iDonor];
-              tmp_Coeff_Vect[iDonor] = Coeff_Vect[iDonor];
-              tmp_storeProc[iDonor]  = storeProc[iDonor];
-            }
+              for( iDonor = 0; iDonor < nDonorPoints; iDonor++){
+                tmp_Donor_Vect[iDonor] = Donor_Vect[iDonor];
+                tmp_Coeff_Vect[iDonor] = Coeff_Vect[iDonor];
+                tmp_storeProc[iDonor]  = storeProc[iDonor];
+              }
 
-            tmp_Coeff_Vect[ nDonorPoints ] = LineIntersectionLength / length;
-            tmp_Donor_Vect[ nDonorPoints ] = donor_iPoint;
-            tmp_storeProc[  nDonorPoints ] = Donor_Proc[donor_iPoint];
+              tmp_Coeff_Vect[ nDonorPoints ] = LineIntersectionLength / length;
+              tmp_Donor_Vect[ nDonorPoints ] = donor_iPoint;
+              tmp_storeProc[  nDonorPoints ] = Donor_Proc[donor_iPoint];
 
-            delete [] Donor_Vect;
-            delete [] Coeff_Vect;
-            delete [] storeProc;
+              delete [] Donor_Vect;
+              delete [] Coeff_Vect;
+              delete [] storeProc;
 
-            Donor_Vect = tmp_Donor_Vect;
-            Coeff_Vect = tmp_Coeff_Vect;
-            storeProc  = tmp_storeProc;
+              Donor_Vect = tmp_Donor_Vect;
+              Coeff_Vect = tmp_Coeff_Vect;
+              storeProc  = tmp_storeProc;
 
-            donor_OldiPoint = donor_iPoint;
-            donor_iPoint    = donor_forward_point;
+              donor_OldiPoint = donor_iPoint;
+              donor_iPoint    = donor_forward_point;
 
-            nDonorPoints++;
+              nDonorPoints++;
+            }
+
+            if (nDonorPoints > 0 || seed < 0) break;
+            seed = -1;
           }
 
+          donorSeed[markTarget][iVertex] = Donor_GlobalPoint[donor_StartIndex];
+
           /*--- Set the communication data structure and copy data from the auxiliary vectors ---*/
 
           targetVertices[markTarget][iVertex].resize(nDonorPoints);
@@ -459,11 +489,7 @@ void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
         for (iDim = 0; iDim < nDim; iDim++)
           Coord_i[iDim] = target_geometry->nodes->GetCoord(target_iPoint, iDim);
 
-        long dPoint = target_geometry->nodes->GetGlobalIndex(target_iPoint);
-        for (target_iPoint = 0; target_iPoint < nGlobalVertex_Target; target_iPoint++){
-          if( dPoint == Target_GlobalPoint[target_iPoint] )
-            break;
-        }
+        target_iPoint = targetIndex.at(target_geometry->nodes->GetGlobalIndex(target_iPoint));
 
         /*--- Build local surface dual mesh for target element ---*/
 
@@ -478,208 +504,205 @@ void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
         nNode_target = Build_3D_surface_element(Target_LinkedNodes, Target_StartLinkedNodes, Target_nLinkedNodes,
                                                 TargetPoint_Coord, target_iPoint, target_element);
 
-        /*--- Brute force to find the closest donor_node ---*/
-
-        mindist = 1E6;
-        donor_StartIndex = 0;
-
-        for (donor_iPoint = 0; donor_iPoint < nGlobalVertex_Donor; donor_iPoint++) {
+        /*--- Start from the donor of the previous call, if the supermesh built from there is empty
+         * (or there is no previous donor) start from the closest donor node. ---*/
 
-          Coord_j = &DonorPoint_Coord[ donor_iPoint * nDim ];
+        seed = donorSeed[markTarget][iVertex];
 
-          dist = GeometryToolbox::Distance(nDim, Coord_i, Coord_j);
+        while (true) {
 
-          if (dist < mindist) {
-            mindist = dist;
-            donor_StartIndex = donor_iPoint;
-          }
-
-          if (dist == 0.0){
-            donor_StartIndex = donor_iPoint;
-            break;
-          }
-        }
+          donor_StartIndex = FindStartDonor(Coord_i, seed);
 
-        donor_iPoint = donor_StartIndex;
+          donor_iPoint = donor_StartIndex;
 
-        nEdges_donor = Donor_nLinkedNodes[donor_iPoint];
+          nEdges_donor = Donor_nLinkedNodes[donor_iPoint];
 
-        donor_element = new su2double*[ 2*nEdges_donor + 2 ];
-        for (ii = 0; ii < 2*nEdges_donor + 2; ii++)
-          donor_element[ii] = new su2double[nDim];
+          donor_element = new su2double*[ 2*nEdges_donor + 2 ];
+          for (ii = 0; ii < 2*nEdges_donor + 2; ii++)
+            donor_element[ii] = new su2double[nDim];
 
-        nNode_donor = Build_3D_surface_element(Donor_LinkedNodes, Donor_StartLinkedNodes, Donor_nLinkedNodes,
-                                               DonorPoint_Coord, donor_iPoint, donor_element);
+          nNode_donor = Build_3D_surface_element(Donor_LinkedNodes, Donor_StartLinkedNodes, Donor_nLinkedNodes,
+                                                 DonorPoint_Coord, donor_iPoint, donor_element);
 
-        Area = 0;
-        for (ii = 1; ii < nNode_target-1; ii++){
-          for (jj = 1; jj < nNode_donor-1; jj++){
-            Area += Compute_Triangle_Intersection(target_element[0], target_element[ii], target_element[ii+1],
-                                                  donor_element[0], donor_element[jj], donor_element[jj+1], Normal);
+          Area = 0;
+          for (ii = 1; ii < nNode_target-1; ii++){
+            for (jj = 1; jj < nNode_donor-1; jj++){
+              Area += Compute_Triangle_Intersection(target_element[0], target_element[ii], target_element[ii+1],
+                                                    donor_element[0], donor_element[jj], donor_element[jj+1], Normal);
+            }
           }
-        }
 
-        for (ii = 0; ii < 2*nEdges_donor + 2; ii++)
-          delete [] donor_element[ii];
-        delete [] donor_element;
+          for (ii = 0; ii < 2*nEdges_donor + 2; ii++)
+            delete [] donor_element[ii];
+          delete [] donor_element;
 
-        nDonorPoints = 1;
+          nDonorPoints = 1;
 
-        /*--- In case the element intersect the target cell update the auxiliary communication data structure ---*/
+          /*--- In case the element intersect the target cell update the auxiliary communication data structure ---*/
 
-        Coeff_Vect = new     su2double[ nDonorPoints ];
-        Donor_Vect = new unsigned long[ nDonorPoints ];
-        storeProc  = new unsigned long[ nDonorPoints ];
+          Coeff_Vect = new     su2double[ nDonorPoints ];
+          Donor_Vect = new unsigned long[ nDonorPoints ];
+          storeProc  = new unsigned long[ nDonorPoints ];
 
-        Coeff_Vect[0] = Area;
-        Donor_Vect[0] = donor_iPoint;
-        storeProc[0]  = Donor_Proc[donor_iPoint];
+          Coeff_Vect[0] = Area;
+          Donor_Vect[0] = donor_iPoint;
+          storeProc[0]  = Donor_Proc[donor_iPoint];
 
-        alreadyVisitedDonor = new unsigned long[1];
+          alreadyVisitedDonor = new unsigned long[1];
 
-        alreadyVisitedDonor[0] = donor_iPoint;
-        nAlreadyVisited = 1;
-        StartVisited = 0;
+          alreadyVisitedDonor[0] = donor_iPoint;
+          nAlreadyVisited = 1;
+          StartVisited = 0;
 
-        Area_old = -1;
+          Area_old = -1;
 
-        while( Area > Area_old ){
+          while( Area > Area_old ){
 
-          /*
-           * - Starting from the closest donor_point, it expands the supermesh by a countour search pattern.
-           * - The closest donor element becomes the core, at each iteration a new layer of elements around the core is taken into account
-           */
+            /*
+             * - Starting from the closest donor_point, it expands the supermesh by a countour search pattern.
+             * - The closest donor element becomes the core, at each iteration a new layer of elements around the core is taken into account
+             */
 
-          Area_old = Area;
+            Area_old = Area;
 
-          ToVisit = nullptr;
-          nToVisit = 0;
+            ToVisit = nullptr;
+            nToVisit = 0;
 
-          for( iNodeVisited = StartVisited; iNodeVisited < nAlreadyVisited; iNodeVisited++ ){
+            for( iNodeVisited = StartVisited; iNodeVisited < nAlreadyVisited; iNodeVisited++ ){
 
-            vPoint = alreadyVisitedDonor[ iNodeVisited ];
+              vPoint = alreadyVisitedDonor[ iNodeVisited ];
 
-            nEdgeVisited = Donor_nLinkedNodes[vPoint];
+              nEdgeVisited = Donor_nLinkedNodes[vPoint];
 
-            for (iEdgeVisited = 0; iEdgeVisited < nEdgeVisited; iEdgeVisited++){
+              for (iEdgeVisited = 0; iEdgeVisited < nEdgeVisited; iEdgeVisited++){
 
-              donor_iPoint = Donor_LinkedNodes[ Donor_StartLinkedNodes[vPoint] + iEdgeVisited];
+                donor_iPoint = Donor_LinkedNodes[ Donor_StartLinkedNodes[vPoint] + iEdgeVisited];
 
-              /*--- Check if the node to visit is already listed in the data structure to avoid double visits ---*/
+                /*--- Check if the node to visit is already listed in the data structure to avoid double visits ---*/
 
-              check = 0;
+                check = 0;
 
-              for( jj = 0; jj < nAlreadyVisited; jj++ ){
-                if( donor_iPoint == alreadyVisitedDonor[jj] ){
-                  check = 1;
-                  break;
-                }
-              }
-
-              if( check == 0 && ToVisit != nullptr){
-                for( jj = 0; jj < nToVisit; jj++ )
-                  if( donor_iPoint == ToVisit[jj] ){
+                for( jj = 0; jj < nAlreadyVisited; jj++ ){
+                  if( donor_iPoint == alreadyVisitedDonor[jj] ){
                     check = 1;
                     break;
                   }
-              }
+                }
 
-              if( check == 0 ){
-                /*--- If the node was not already visited, visit it and list it into data structure ---*/
+                if( check == 0 && ToVisit != nullptr){
+                  for( jj = 0; jj < nToVisit; jj++ )
+                    if( donor_iPoint == ToVisit[jj] ){
+                      check = 1;
+                      break;
+                    }
+                }
 
-                tmpVect = new unsigned long[ nToVisit + 1 ];
+                if( check == 0 ){
+                  /*--- If the node was not already visited, visit it and list it into data structure ---*/
 
-                for( jj = 0; jj < nToVisit; jj++ )
-                  tmpVect[jj] = ToVisit[jj];
-                tmpVect[nToVisit] = donor_iPoint;
+                  tmpVect = new unsigned long[ nToVisit + 1 ];
 
+                  for( jj = 0; jj < nToVisit; jj++ )
+                    tmpVect[jj] = ToVisit[jj];
+                  tmpVect[nToVisit] = donor_iPoint;
 
-                  delete [] ToVisit;
 
-                ToVisit = tmpVect;
-                tmpVect = nullptr;
+                    delete [] ToVisit;
 
-                nToVisit++;
+                  ToVisit = tmpVect;
+                  tmpVect = nullptr;
 
-                /*--- Find the value of the intersection area between the current donor element and the target element --- */
+                  nToVisit++;
 
-                nEdges_donor = Donor_nLinkedNodes[donor_iPoint];
+                  /*--- Find the value of the intersection area between the current donor element and the target element --- */
 
-                donor_element = new su2double*[ 2*nEdges_donor + 2 ];
-                for (ii = 0; ii < 2*nEdges_donor + 2; ii++)
-                  donor_element[ii] = new su2double[nDim];
+                  nEdges_donor = Donor_nLinkedNodes[donor_iPoint];
 
-                nNode_donor = Build_3D_surface_element(Donor_LinkedNodes, Donor_StartLinkedNodes, Donor_nLinkedNodes,
-                                                       DonorPoint_Coord, donor_iPoint, donor_element);
+                  donor_element = new su2double*[ 2*nEdges_donor + 2 ];
+                  for (ii = 0; ii < 2*nEdges_donor + 2; ii++)
+                    donor_element[ii] = new su2double[nDim];
 
-                tmp_Area = 0;
-                for (ii = 1; ii < nNode_target-1; ii++)
-                  for (jj = 1; jj < nNode_donor-1; jj++)
-                    tmp_Area += Compute_Triangle_Intersection(target_element[0], target_element[ii], target_element[ii+1],
-                                                              donor_element[0], donor_element[jj], donor_element[jj+1], Normal);
+                  nNode_donor = Build_3D_surface_element(Donor_LinkedNodes, Donor_StartLinkedNodes, Donor_nLinkedNodes,
+                                                         DonorPoint_Coord, donor_iPoint, donor_element);
 
-                for (ii = 0; ii < 2*nEdges_donor + 2; ii++)
-                  delete [] donor_element[ii];
-                delete [] donor_element;
+                  tmp_Area = 0;
+                  for (ii = 1; ii < nNode_target-1; ii++)
+                    for (jj = 1; jj < nNode_donor-1; jj++)
+                      tmp_Area += Compute_Triangle_Intersection(target_element[0], target_element[ii], target_element[ii+1],
+                                                                donor_element[0], donor_element[jj], donor_element[jj+1], Normal);
 
-                /*--- In case the element intersect the target cell update the auxiliary communication data structure ---*/
+                  for (ii = 0; ii < 2*nEdges_donor + 2; ii++)
+                    delete [] donor_element[ii];
+                  delete [] donor_element;
 
-                tmp_Coeff_Vect = new     su2double[ nDonorPoints + 1 ];
-                tmp_Donor_Vect = new unsigned long[ nDonorPoints + 1 ];
-                tmp_storeProc  = new unsigned long[ nDonorPoints + 1 ];
+                  /*--- In case the element intersect the target cell update the auxiliary communication data structure ---*/
 
-                for( iDonor = 0; iDonor < nDonorPoints; iDonor++){
-                  tmp_Donor_Vect[iDonor] = Donor_Vect[iDonor];
-                  tmp_Coeff_Vect[iDonor] = Coeff_Vect[iDonor];
-                  tmp_storeProc[iDonor]  = storeProc[iDonor];
-                }
+                  tmp_Coeff_Vect = new     su2double[ nDonorPoints + 1 ];
+                  tmp_Donor_Vect = new unsigned long[ nDonorPoints + 1 ];
+                  tmp_storeProc  = new unsigned long[ nDonorPoints + 1 ];
 
-                tmp_Coeff_Vect[ nDonorPoints ] = tmp_Area;
-                tmp_Donor_Vect[ nDonorPoints ] = donor_iPoint;
-                tmp_storeProc[  nDonorPoints ] = Donor_Proc[donor_iPoint];
+                  for( iDonor = 0; iDonor < nDonorPoints; iDonor++){
+                    tmp_Donor_Vect[iDonor] = Donor_Vect[iDonor];
+                    tmp_Coeff_Vect[iDonor] = Coeff_Vect[iDonor];
+                    tmp_storeProc[iDonor]  = storeProc[iDonor];
+                  }
+
+                  tmp_Coeff_Vect[ nDonorPoints ] = tmp_Area;
+                  tmp_Donor_Vect[ nDonorPoints ] = donor_iPoint;
+                  tmp_storeProc[  nDonorPoints ] = Donor_Proc[donor_iPoint];
 
-                delete [] Donor_Vect;
-                delete [] Coeff_Vect;
-                delete [] storeProc;
+                  delete [] Donor_Vect;
+                  delete [] Coeff_Vect;
+                  delete [] storeProc;
 
-                Donor_Vect = tmp_Donor_Vect;
-                Coeff_Vect = tmp_Coeff_Vect;
-                storeProc  = tmp_storeProc;
+                  Donor_Vect = tmp_Donor_Vect;
+                  Coeff_Vect = tmp_Coeff_Vect;
+                  storeProc  = tmp_storeProc;
 
-                tmp_Coeff_Vect = nullptr;
-                tmp_Donor_Vect = nullptr;
-                tmp_storeProc  = nullptr;
+                  tmp_Coeff_Vect = nullptr;
+                  tmp_Donor_Vect = nullptr;
+                  tmp_storeProc  = nullptr;
 
-                nDonorPoints++;
+                  nDonorPoints++;
 
-                Area += tmp_Area;
+                  Area += tmp_Area;
+                }
               }
             }
-          }
 
-          /*--- Update auxiliary data structure ---*/
+            /*--- Update auxiliary data structure ---*/
 
-          StartVisited = nAlreadyVisited;
+            StartVisited = nAlreadyVisited;
 
-          tmpVect = new unsigned long[ nAlreadyVisited + nToVisit ];
+            tmpVect = new unsigned long[ nAlreadyVisited + nToVisit ];
 
-          for( jj = 0; jj < nAlreadyVisited; jj++ )
-            tmpVect[jj] = alreadyVisitedDonor[jj];
+            for( jj = 0; jj < nAlreadyVisited; jj++ )
+              tmpVect[jj] = alreadyVisitedDonor[jj];
 
-          for( jj = 0; jj < nToVisit; jj++ )
-            tmpVect[ nAlreadyVisited + jj ] = ToVisit[jj];
+            for( jj = 0; jj < nToVisit; jj++ )
+              tmpVect[ nAlreadyVisited + jj ] = ToVisit[jj];
 
 
-          delete [] alreadyVisitedDonor;
+            delete [] alreadyVisitedDonor;
+
+            alreadyVisitedDonor = tmpVect;
+
+            nAlreadyVisited += nToVisit;
 
-          alreadyVisitedDonor = tmpVect;
+            delete [] ToVisit;
+          }
+
+          delete [] alreadyVisitedDonor;
 
-          nAlreadyVisited += nToVisit;
+          if (Area > 0.0 || seed < 0) break;
+          seed = -1;
 
-          delete [] ToVisit;
+          delete [] Donor_Vect;
+          delete [] Coeff_Vect;
+          delete [] storeProc;
         }
 
-        delete [] alreadyVisitedDonor;
+        donorSeed[markTarget][iVertex] = Donor_GlobalPoint[donor_StartIndex];
 
         /*--- Set the communication data structure and copy data from the auxiliary vectors ---*/
 
@@ -701,20 +724,6 @@ void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
       }
     }
 
-    delete [] TargetPoint_Coord;
-    delete [] Target_GlobalPoint;
-    delete [] Target_Proc;
-    delete [] Target_nLinkedNodes;
-    delete [] Target_LinkedNodes;
-    delete [] Target_StartLinkedNodes;
-
-    delete [] DonorPoint_Coord;
-    delete [] Donor_GlobalPoint;
-    delete [] Donor_Proc;
-    delete [] Donor_nLinkedNodes;
-    delete [] Donor_StartLinkedNodes;
-    delete [] Donor_LinkedNodes;
-
   }
 
   delete [] Normal;
@@ -725,6 +734,72 @@ void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
   delete [] storeProc;
 }
 
+void CSlidingMesh::GatherBoundary(unsigned long zone, int marker, GatheredBoundary& boundary) {
+
+  if (boundary.gathered) {
+    ReconstructBoundaryCoord(zone, marker, boundary.coord.data());
+    return;
+  }
+
+  const auto nDim = Geometry[zone][INST_0][MESH_0]->GetnDim();
+
+  ReconstructBoundary(zone, marker);
+
+  const auto nVertex = nGlobalVertex;
+
+  /*--- Linked nodes that are not on the boundary were removed, the offsets into the array were not updated. ---*/
+  unsigned long nLinkedNodes = 0;
+  for (auto iVertex = 0ul; iVertex < nVertex; iVertex++)
+    nLinkedNodes = max(nLinkedNodes, Buffer_Receive_StartLinkedNodes[iVertex] + Buffer_Receive_nLinkedNodes[iVertex]);
+
+  boundary.nVertex = nVertex;
+  boundary.coord.assign(Buffer_Receive_Coord, Buffer_Receive_Coord + nVertex*nDim);
+  boundary.globalPoint.assign(Buffer_Receive_GlobalPoint, Buffer_Receive_GlobalPoint + nVertex);
+  boundary.proc.assign(Buffer_Receive_Proc, Buffer_Receive_Proc + nVertex);
+  boundary.nLinkedNodes.assign(Buffer_Receive_nLinkedNodes, Buffer_Receive_nLinkedNodes + nVertex);
+  boundary.startLinkedNodes.assign(Buffer_Receive_StartLinkedNodes, Buffer_Receive_StartLinkedNodes + nVertex);
+  boundary.linkedNodes.assign(Buffer_Receive_LinkedNodes, Buffer_Receive_LinkedNodes + nLinkedNodes);
+
+  delete [] Buffer_Receive_Coord;            Buffer_Receive_Coord            = nullptr;
+  delete [] Buffer_Receive_GlobalPoint;      Buffer_Receive_GlobalPoint      = nullptr;
+  delete [] Buffer_Receive_Proc;             Buffer_Receive_Proc             = nullptr;
+  delete [] Buffer_Receive_nLinkedNodes;     Buffer_Receive_nLinkedNodes     = nullptr;
+  delete [] Buffer_Receive_StartLinkedNodes; Buffer_Receive_StartLinkedNodes = nullptr;
+  delete [] Buffer_Receive_LinkedNodes;      Buffer_Receive_LinkedNodes      = nullptr;
+
+  /*--- Index the boundary by global index. ---*/
+  boundary.index.reserve(nVertex);
+  for (auto iVertex = 0ul; iVertex < nVertex; iVertex++)
+    boundary.index.emplace(boundary.globalPoint[iVertex], iVertex);
+
+  boundary.gathered = true;
+}
+
+unsigned long CSlidingMesh::WalkToClosestVertex(unsigned short nDim, const su2double *point, const unsigned long *map,
+                                                const unsigned long *startIndex, const unsigned long* nNeighbor,
+                                                const su2double *coord, unsigned long seed) {
+
+  auto closest = seed;
+  auto mindist = GeometryToolbox::SquaredDistance(nDim, point, &coord[seed*nDim]);
+  bool moved = true;
+
+  while (moved && mindist > 0.0) {
+    moved = false;
+    const auto current = closest;
+
+    for (auto iNeighbor = 0ul; iNeighbor < nNeighbor[current]; iNeighbor++) {
+      const auto jVertex = map[startIndex[current] + iNeighbor];
+      const auto dist = GeometryToolbox::SquaredDistance(nDim, point, &coord[jVertex*nDim]);
+      if (dist < mindist) {
+        mindist = dist;
+        closest = jVertex;
+        moved = true;
+      }
+    }
+  }
+  return closest;
+}
+
 int CSlidingMesh::Build_3D_surface_element(const unsigned long *map, const unsigned long *startIndex,
                                            const unsigned long* nNeighbor, const su2double *coord,
                                            unsigned long centralNode, su2double** element) {
@@ -333,5 +333,8 @@ void CPastixWrapper<ScalarType>::Factorize(CGeometry *geometry, const CConfig *c
 template class CPastixWrapper<su2double>;
 #else
 template class CPastixWrapper<su2mixedfloat>;
+#ifdef USE_RUNTIME_MIXED_PRECISION
+template class CPastixWrapper<float>;
+#endif
 #endif
 #endif
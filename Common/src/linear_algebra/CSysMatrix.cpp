@@ -31,8 +31,10 @@
 #include "../../include/CConfig.hpp"
 #include "../../include/parallelization/omp_structure.hpp"
 #include "../../include/toolboxes/allocation_toolbox.hpp"
+#include "../../include/toolboxes/CPerformanceTracer.hpp"
 
 #include <cmath>
+#include <limits>
 
 template<class ScalarType>
 CSysMatrix<ScalarType>::CSysMatrix() :
@@ -40,16 +42,19 @@ CSysMatrix<ScalarType>::CSysMatrix() :
   size(SU2_MPI::GetSize()) {
 
   nPoint = nPointDomain = nVar = nEqn = 0;
+  kernel_size = 0;
   nnz = nnz_ilu = 0;
   ilu_fill_in = 0;
   nLinelet = 0;
 
   omp_partitions    = nullptr;
+  omp_levels        = false;
 
   matrix            = nullptr;
   row_ptr           = nullptr;
   dia_ptr           = nullptr;
   col_ind           = nullptr;
+  col_ptr           = nullptr;
 
   ILU_matrix        = nullptr;
   row_ptr_ilu       = nullptr;
@@ -128,6 +133,9 @@ void CSysMatrix<ScalarType>::Initialize(unsigned long npoint, unsigned long npoi
   nVar = nvar;
   nEqn = neqn;
   nPoint = npoint;
+
+  /*--- Square blocks of common sizes use kernels specialized at compile time. ---*/
+  kernel_size = (nVar == nEqn && IsSpecializedBlockSize(nVar))? nVar : 0;
   nPointDomain = npointdomain;
 
   /*--- Get sparse structure pointers from geometry,
@@ -199,6 +207,11 @@ void CSysMatrix<ScalarType>::Initialize(unsigned long npoint, unsigned long npoi
     omp_partitions[part] = part * pts_per_part;
   omp_partitions[omp_num_parts] = nPointDomain;
 
+  /*--- Alternatively, level scheduling of the sweeps. ---*/
+
+  omp_levels = (config->GetKind_Linear_Solver_Prec_Schedule() == PREC_SCHEDULE_LEVELS);
+  if (omp_levels) SetupLevelScheduling(ilu_needed, prec);
+
   /*--- Generate MKL Kernels ---*/
 
 #ifdef USE_MKL
@@ -226,6 +239,52 @@ void CSysMatrix<ScalarType>::Initialize(unsigned long npoint, unsigned long npoi
 
 }
 
+template<class ScalarType>
+void CSysMatrix<ScalarType>::SetupLevelScheduling(bool ilu_needed, unsigned short report) {
+
+  /*--- Forward and backward schedules of LU_SGS (matrix pattern) and ILU (ILU pattern). ---*/
+
+  levels_lower = levelSchedule(nPointDomain, row_ptr, col_ind, dia_ptr, false);
+  levels_upper = levelSchedule(nPointDomain, row_ptr, col_ind, dia_ptr, true);
+
+  if (ilu_needed) {
+    levels_lower_ilu = levelSchedule(nPointDomain, row_ptr_ilu, col_ind_ilu, dia_ptr_ilu, false);
+    levels_upper_ilu = levelSchedule(nPointDomain, row_ptr_ilu, col_ind_ilu, dia_ptr_ilu, true);
+  }
+
+  if ((report != ILU) && (report != LU_SGS)) return;
+
+  const auto& lower = (report == ILU)? levels_lower_ilu : levels_lower;
+  const auto& upper = (report == ILU)? levels_upper_ilu : levels_upper;
+
+  /*--- Parallel efficiency of a sweep (see LevelScheduledLoop), the work
+   *    is quantized by the levels, small levels are done by one thread. ---*/
+
+  const unsigned long nThread = omp_get_max_threads();
+
+  auto efficiency = [&](const CCompressedSparsePatternUL& levels) {
+    unsigned long real = 0;
+    for (auto iLevel = 0ul; iLevel < levels.getOuterSize(); ++iLevel) {
+      const auto size = levels.getNumNonZeros(iLevel);
+      real += (size >= OMP_MIN_SIZE)? roundUpDiv(size, nThread) : size;
+    }
+    return (real > 0)? passivedouble(nPointDomain) / (nThread * real) : 1.0;
+  };
+
+  unsigned long nLevel[] = {lower.getOuterSize(), upper.getOuterSize()}, maxLevel[2] = {0};
+  passivedouble parallelEff[] = {efficiency(lower), efficiency(upper)}, minEff[2] = {0.0};
+
+  SU2_MPI::Reduce(nLevel, maxLevel, 2, MPI_UNSIGNED_LONG, MPI_MAX, MASTER_NODE, MPI_COMM_WORLD);
+  SU2_MPI::Reduce(parallelEff, minEff, 2, MPI_DOUBLE, MPI_MIN, MASTER_NODE, MPI_COMM_WORLD);
+
+  if (rank == MASTER_NODE) {
+    cout << "Level scheduling of the " << ((report == ILU)? "ILU" : "LU_SGS") << " preconditioner: "
+         << maxLevel[0] << " forward and " << maxLevel[1] << " backward levels,\n"
+         << "  parallel efficiency with " << nThread << " threads " << minEff[0] << " (forward) and "
+         << minEff[1] << " (backward)." << endl;
+  }
+}
+
 template<class ScalarType>
 template<class OtherType>
 void CSysMatrix<ScalarType>::InitiateComms(const CSysVector<OtherType> & x,
@@ -234,6 +293,8 @@ void CSysMatrix<ScalarType>::InitiateComms(const CSysVector<OtherType> & x,
                                            unsigned short commType) const {
   if (geometry->nP2PSend == 0) return;
 
+  CTraceScope trace("CSysMatrix::InitiateComms", "mpi");
+
   /*--- Local variables ---*/
 
   unsigned short iVar;
@@ -382,6 +443,8 @@ void CSysMatrix<ScalarType>::CompleteComms(CSysVector<OtherType> & x,
                                            unsigned short commType) const {
   if (geometry->nP2PRecv == 0) return;
 
+  CTraceScope trace("CSysMatrix::CompleteComms", "mpi");
+
   /*--- Local variables ---*/
 
   unsigned short iVar;
@@ -406,7 +469,10 @@ void CSysMatrix<ScalarType>::CompleteComms(CSysVector<OtherType> & x,
      the order they arrive. ---*/
 
     SU2_OMP_MASTER
-    SU2_MPI::Waitany(geometry->nP2PRecv, geometry->req_P2PRecv, &ind, &status);
+    {
+      CTraceWaitScope traceWait("MPI_Waitany");
+      SU2_MPI::Waitany(geometry->nP2PRecv, geometry->req_P2PRecv, &ind, &status);
+    }
     SU2_OMP_BARRIER
 
     /*--- Once we have recv'd a message, get the source rank. ---*/
@@ -499,7 +565,10 @@ void CSysMatrix<ScalarType>::CompleteComms(CSysVector<OtherType> & x,
 
 #ifdef HAVE_MPI
   SU2_OMP_MASTER
-  SU2_MPI::Waitall(geometry->nP2PSend, geometry->req_P2PSend, MPI_STATUS_IGNORE);
+  {
+    CTraceWaitScope traceWait("MPI_Waitall");
+    SU2_MPI::Waitall(geometry->nP2PSend, geometry->req_P2PSend, MPI_STATUS_IGNORE);
+  }
 #endif
   SU2_OMP_BARRIER
 
@@ -512,11 +581,15 @@ void CSysMatrix<ScalarType>::SetValZero() {
   const auto begin = chunk * omp_get_thread_num();
   const auto mySize = min(chunk, size-begin) * sizeof(ScalarType);
   memset(&matrix[begin], 0, mySize);
+  SU2_OMP_MASTER
+  ++valuesVersion;
   SU2_OMP_BARRIER
 }
 
 template<class ScalarType>
 void CSysMatrix<ScalarType>::SetValDiagonalZero() {
+  SU2_OMP_MASTER
+  ++valuesVersion;
   SU2_OMP_FOR_STAT(omp_heavy_size)
   for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint)
     for (auto index = 0ul; index < nVar*nEqn; ++index)
@@ -532,83 +605,27 @@ void CSysMatrix<ScalarType>::Gauss_Elimination(ScalarType* matrix, ScalarType* v
   LAPACKE_dgetrf( LAPACK_ROW_MAJOR, nVar, nVar, matrix, nVar, ipiv);
   LAPACKE_dgetrs( LAPACK_ROW_MAJOR, 'N', nVar, 1, matrix, nVar, ipiv, vec, 1 );
 #else
-#define A(I,J) matrix[(I)*nVar+(J)]
-
-  /*--- Transform system in Upper Matrix ---*/
-  for (auto iVar = 1ul; iVar < nVar; iVar++) {
-    for (auto jVar = 0ul; jVar < iVar; jVar++) {
-      ScalarType weight = A(iVar,jVar) / A(jVar,jVar);
-      for (auto kVar = jVar; kVar < nVar; kVar++)
-        A(iVar,kVar) -= weight * A(jVar,kVar);
-      vec[iVar] -= weight * vec[jVar];
-    }
-  }
-
-  /*--- Backwards substitution ---*/
-  for (auto iVar = nVar; iVar > 0ul;) {
-    iVar--; // unsigned type
-    for (auto jVar = iVar+1; jVar < nVar; jVar++)
-      vec[iVar] -= A(iVar,jVar) * vec[jVar];
-    vec[iVar] /= A(iVar,iVar);
-  }
-#undef A
+  BLOCK_KERNEL_DISPATCH(gauss_elimination_impl<ScalarType>(N, matrix, vec))
 #endif
 }
 
 template<class ScalarType>
 void CSysMatrix<ScalarType>::MatrixInverse(ScalarType *matrix, ScalarType *inverse) const {
 
-  /*--- This is a generalization of Gaussian elimination for multiple rhs' (the basis vectors).
-   We could call "Gauss_Elimination" multiple times or fully generalize it for multiple rhs,
-   the performance of both routines would suffer in both cases without the use of exotic templating.
-   And so it feels reasonable to have some duplication here. ---*/
-
   assert((matrix != inverse) && "Output cannot be the same as the input.");
 
-#define M(I,J) inverse[(I)*nVar+(J)]
-
-  /*--- Initialize the inverse with the identity. ---*/
+#ifdef USE_MKL_LAPACK
+  // With MKL_DIRECT_CALL enabled, this is significantly faster than native code on Intel Architectures.
   for (auto iVar = 0ul; iVar < nVar; iVar++)
     for (auto jVar = 0ul; jVar < nVar; jVar++)
-      M(iVar,jVar) = ScalarType(iVar==jVar);
+      inverse[iVar*nVar+jVar] = ScalarType(iVar==jVar);
 
-  /*--- Inversion ---*/
-#ifdef USE_MKL_LAPACK
-  // With MKL_DIRECT_CALL enabled, this is significantly faster than native code on Intel Architectures.
   lapack_int ipiv[MAXNVAR];
   LAPACKE_dgetrf( LAPACK_ROW_MAJOR, nVar, nVar, matrix, nVar, ipiv );
   LAPACKE_dgetrs( LAPACK_ROW_MAJOR, 'N', nVar, nVar, matrix, nVar, ipiv, inverse, nVar );
 #else
-#define A(I,J) matrix[(I)*nVar+(J)]
-
-  /*--- Transform system in Upper Matrix ---*/
-  for (auto iVar = 1ul; iVar < nVar; iVar++) {
-    for (auto jVar = 0ul; jVar < iVar; jVar++)
-    {
-      ScalarType weight = A(iVar,jVar) / A(jVar,jVar);
-
-      for (auto kVar = jVar; kVar < nVar; kVar++)
-        A(iVar,kVar) -= weight * A(jVar,kVar);
-
-      /*--- at this stage M is lower triangular so not all cols need updating ---*/
-      for (auto kVar = 0ul; kVar <= jVar; kVar++)
-        M(iVar,kVar) -= weight * M(jVar,kVar);
-    }
-  }
-
-  /*--- Backwards substitution ---*/
-  for (auto iVar = nVar; iVar > 0ul;) {
-    iVar--; // unsigned type
-    for (auto jVar = iVar+1; jVar < nVar; jVar++)
-      for (auto kVar = 0ul; kVar < nVar; kVar++)
-        M(iVar,kVar) -= A(iVar,jVar) * M(jVar,kVar);
-
-    for (auto kVar = 0ul; kVar < nVar; kVar++)
-      M(iVar,kVar) /= A(iVar,iVar);
-  }
-#undef A
+  BLOCK_KERNEL_DISPATCH(matrix_inverse_impl<ScalarType>(N, matrix, inverse))
 #endif
-#undef M
 }
 
 template<class ScalarType>
@@ -762,6 +779,14 @@ void CSysMatrix<ScalarType>::BuildILUPreconditioner(bool transposed) {
 
   /*--- Transform system in Upper Matrix ---*/
 
+  if (omp_levels) {
+    /*--- The rows of each level only depend on rows of previous levels. ---*/
+    LevelScheduledLoop(levels_lower_ilu, [&](unsigned long iPoint) {
+      ILUFactorizeRow(iPoint, 0, nPointDomain);
+    });
+    return;
+  }
+
   /*--- OpenMP Parallelization, a loop construct is used to ensure
    *    the preconditioner is computed correctly even if called
    *    outside of a parallel section. ---*/
@@ -776,61 +801,8 @@ void CSysMatrix<ScalarType>::BuildILUPreconditioner(bool transposed) {
      *    to row/col "end-1" (i.e. the range [begin,end[). Which is exactly
      *    what the MPI-only implementation does. ---*/
 
-    ScalarType weight[MAXNVAR*MAXNVAR], aux_block[MAXNVAR*MAXNVAR];
-
-    for (auto iPoint = begin+1; iPoint < end; iPoint++) {
-
-      /*--- Invert and store the previous diagonal block to later compute the weight. ---*/
-
-      InverseDiagonalBlock_ILUMatrix(iPoint-1, &invM[(iPoint-1)*nVar*nVar]);
-
-      /*--- For this row (unknown), loop over its lower diagonal entries. ---*/
-
-      for (auto index = row_ptr_ilu[iPoint]; index < dia_ptr_ilu[iPoint]; index++) {
-
-        /*--- jPoint is the column index (jPoint < iPoint). ---*/
-
-        auto jPoint = col_ind_ilu[index];
-
-        /*--- We only care about the sub matrix within "begin" and "end-1". ---*/
-
-        if (jPoint < begin) continue;
-
-        /*--- Multiply the block by the inverse of the corresponding diagonal block. ---*/
-
-        auto Block_ij = &ILU_matrix[index*nVar*nVar];
-        MatrixMatrixProduct(Block_ij, &invM[jPoint*nVar*nVar], weight);
-
-        /*--- "weight" holds Aij*inv(Ajj). Jump to the upper part of the jPoint row. ---*/
-
-        for (auto index_ = dia_ptr_ilu[jPoint]+1; index_ < row_ptr_ilu[jPoint+1]; index_++) {
-
-          /*--- Get the column index (kPoint > jPoint). ---*/
-
-          auto kPoint = col_ind_ilu[index_];
-
-          if (kPoint >= end) break;
-
-          /*--- If Aik exists, update it: Aik -= Aij*inv(Ajj)*Ajk ---*/
-
-          auto Block_ik = GetBlock_ILUMatrix(iPoint, kPoint);
-
-          if (Block_ik != nullptr) {
-            auto Block_jk = &ILU_matrix[index_*nVar*nVar];
-            MatrixMatrixProduct(weight, Block_jk, aux_block);
-            MatrixSubtraction(Block_ik, aux_block, Block_ik);
-          }
-        }
-
-        /*--- Lastly, store "weight" in the lower triangular part, which
-         will be reused during the forward solve in the precon/smoother. ---*/
-
-        for (auto iVar = 0ul; iVar < nVar*nVar; ++iVar)
-          Block_ij[iVar] = weight[iVar];
-      }
-    }
-    InverseDiagonalBlock_ILUMatrix(end-1, &invM[(end-1)*nVar*nVar]);
-
+    for (auto iPoint = begin; iPoint < end; iPoint++)
+      ILUFactorizeRow(iPoint, begin, end);
   }
 
 }
@@ -841,48 +813,47 @@ void CSysMatrix<ScalarType>::ComputeILUPreconditioner(const CSysVector<ScalarTyp
   /*--- Coherent view of vectors. ---*/
   SU2_OMP_BARRIER
 
-  /*--- OpenMP Parallelization ---*/
-  SU2_OMP_FOR_STAT(1)
-  for(unsigned long thread = 0; thread < omp_num_parts; ++thread)
-  {
-    const auto begin = omp_partitions[thread];
-    const auto end = omp_partitions[thread+1];
-
-    ScalarType aux_vec[MAXNVAR];
-
-    /*--- Copy vector to then work on prod in place ---*/
+  if (omp_levels) {
+    /*--- Copy vector to then work on prod in place. ---*/
+    SU2_OMP_FOR_STAT(omp_heavy_size)
+    for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++)
+      for (auto iVar = 0ul; iVar < nVar; iVar++)
+        prod(iPoint,iVar) = vec(iPoint,iVar);
+
+    /*--- Forward and backward solves over the levels of each triangle. ---*/
+    LevelScheduledLoop(levels_lower_ilu, [&](unsigned long iPoint) {
+      ILUForwardRow(prod, iPoint, 0);
+    });
+    LevelScheduledLoop(levels_upper_ilu, [&](unsigned long iPoint) {
+      ILUBackwardRow(prod, iPoint, nPointDomain);
+    });
+  }
+  else {
+    /*--- OpenMP Parallelization ---*/
+    SU2_OMP_FOR_STAT(1)
+    for(unsigned long thread = 0; thread < omp_num_parts; ++thread)
+    {
+      const auto begin = omp_partitions[thread];
+      const auto end = omp_partitions[thread+1];
 
-    for (auto iVar = begin*nVar; iVar < end*nVar; iVar++)
-      prod[iVar] = vec[iVar];
+      /*--- Copy vector to then work on prod in place ---*/
 
-    /*--- Forward solve the system using the lower matrix entries that
-     were computed and stored during the ILU preprocessing. Note
-     that we are overwriting the residual vector as we go. ---*/
+      for (auto iVar = begin*nVar; iVar < end*nVar; iVar++)
+        prod[iVar] = vec[iVar];
 
-    for (auto iPoint = begin+1; iPoint < end; iPoint++) {
-      for (auto index = row_ptr_ilu[iPoint]; index < dia_ptr_ilu[iPoint]; index++) {
-        auto jPoint = col_ind_ilu[index];
-        if (jPoint < begin) continue;
-        auto Block_ij = &ILU_matrix[index*nVar*nVar];
-        MatrixVectorProductSub(Block_ij, &prod[jPoint*nVar], &prod[iPoint*nVar]);
-      }
-    }
+      /*--- Forward solve the system using the lower matrix entries that
+       were computed and stored during the ILU preprocessing. Note
+       that we are overwriting the residual vector as we go. ---*/
 
-    /*--- Backwards substitution (starts at the last row) ---*/
+      for (auto iPoint = begin+1; iPoint < end; iPoint++)
+        ILUForwardRow(prod, iPoint, begin);
 
-    for (auto iPoint = end; iPoint > begin;) {
-      iPoint--; // unsigned type
-      for (auto iVar = 0ul; iVar < nVar; iVar++)
-        aux_vec[iVar] = prod[iPoint*nVar+iVar];
+      /*--- Backwards substitution (starts at the last row) ---*/
 
-      for (auto index = dia_ptr_ilu[iPoint]+1; index < row_ptr_ilu[iPoint+1]; index++) {
-        auto jPoint = col_ind_ilu[index];
-        if (jPoint >= end) break;
-        auto Block_ij = &ILU_matrix[index*nVar*nVar];
-        MatrixVectorProductSub(Block_ij, &prod[jPoint*nVar], aux_vec);
+      for (auto iPoint = end; iPoint > begin;) {
+        iPoint--; // unsigned type
+        ILUBackwardRow(prod, iPoint, end);
       }
-
-      MatrixVectorProduct(&invM[iPoint*nVar*nVar], aux_vec, &prod[iPoint*nVar]);
     }
   }
 
@@ -902,25 +873,26 @@ void CSysMatrix<ScalarType>::ComputeLU_SGSPreconditioner(const CSysVector<Scalar
   /*--- Coherent view of vectors. ---*/
   SU2_OMP_BARRIER
 
-  /*--- OpenMP Parallelization ---*/
-  SU2_OMP_FOR_STAT(1)
-  for(unsigned long thread = 0; thread < omp_num_parts; ++thread)
-  {
-    const auto begin = omp_partitions[thread];
-    const auto end = omp_partitions[thread+1];
-
-    /*--- Each thread will work on the submatrix defined from row/col "begin"
-     *    to row/col "end-1", except the last thread that also considers halos.
-     *    This is NOT exactly equivalent to the MPI implementation on the same
-     *    number of domains, for that we would need to define "thread-halos". ---*/
+  if (omp_levels) {
+    LevelScheduledLoop(levels_lower, [&](unsigned long iPoint) {
+      LU_SGSForwardRow(vec, prod, iPoint, 0);
+    });
+  }
+  else {
+    /*--- OpenMP Parallelization ---*/
+    SU2_OMP_FOR_STAT(1)
+    for(unsigned long thread = 0; thread < omp_num_parts; ++thread)
+    {
+      const auto begin = omp_partitions[thread];
+      const auto end = omp_partitions[thread+1];
 
-    ScalarType low_prod[MAXNVAR];
+      /*--- Each thread will work on the submatrix defined from row/col "begin"
+       *    to row/col "end-1", except the last thread that also considers halos.
+       *    This is NOT exactly equivalent to the MPI implementation on the same
+       *    number of domains, for that we would need to define "thread-halos". ---*/
 
-    for (auto iPoint = begin; iPoint < end; ++iPoint) {
-      auto idx = iPoint*nVar;
-      LowerProduct(prod, iPoint, begin, low_prod);        // Compute L.x*
-      VectorSubtraction(&vec[idx], low_prod, &prod[idx]); // Compute y = b - L.x*
-      Gauss_Elimination(iPoint, &prod[idx]);              // Solve D.x* = y
+      for (auto iPoint = begin; iPoint < end; ++iPoint)
+        LU_SGSForwardRow(vec, prod, iPoint, begin);
     }
   }
 
@@ -931,25 +903,27 @@ void CSysMatrix<ScalarType>::ComputeLU_SGSPreconditioner(const CSysVector<Scalar
 
   /*--- Second part of the symmetric iteration: (D+U).x_(1) = D.x* ---*/
 
-  /*--- OpenMP Parallelization ---*/
-  SU2_OMP_FOR_STAT(1)
-  for(unsigned long thread = 0; thread < omp_num_parts; ++thread)
-  {
-    const auto begin = omp_partitions[thread];
-    const auto row_end = omp_partitions[thread+1];
-    /*--- On the last thread partition the upper
-     *    product should consider halo columns. ---*/
-    const auto col_end = (row_end==nPointDomain)? nPoint : row_end;
-
-    ScalarType up_prod[MAXNVAR], dia_prod[MAXNVAR];
-
-    for (auto iPoint = row_end; iPoint > begin;) {
-      iPoint--; // because of unsigned type
-      auto idx = iPoint*nVar;
-      DiagonalProduct(prod, iPoint, dia_prod);          // Compute D.x*
-      UpperProduct(prod, iPoint, col_end, up_prod);     // Compute U.x_(n+1)
-      VectorSubtraction(dia_prod, up_prod, &prod[idx]); // Compute y = D.x*-U.x_(n+1)
-      Gauss_Elimination(iPoint, &prod[idx]);            // Solve D.x* = y
+  if (omp_levels) {
+    /*--- Halo columns are not dependencies, they are simply used. ---*/
+    LevelScheduledLoop(levels_upper, [&](unsigned long iPoint) {
+      LU_SGSBackwardRow(prod, iPoint, nPoint);
+    });
+  }
+  else {
+    /*--- OpenMP Parallelization ---*/
+    SU2_OMP_FOR_STAT(1)
+    for(unsigned long thread = 0; thread < omp_num_parts; ++thread)
+    {
+      const auto begin = omp_partitions[thread];
+      const auto row_end = omp_partitions[thread+1];
+      /*--- On the last thread partition the upper
+       *    product should consider halo columns. ---*/
+      const auto col_end = (row_end==nPointDomain)? nPoint : row_end;
+
+      for (auto iPoint = row_end; iPoint > begin;) {
+        iPoint--; // because of unsigned type
+        LU_SGSBackwardRow(prod, iPoint, col_end);
+      }
     }
   }
 
@@ -1232,6 +1206,535 @@ void CSysMatrix<ScalarType>::ComputeLineletPreconditioner(const CSysVector<Scala
 
 }
 
+template<class ScalarType>
+void CSysMatrix<ScalarType>::SetupAMGHierarchy(const CConfig *config) {
+
+  assert(omp_get_thread_num()==0 && "The AMG hierarchy cannot be created by multiple threads.");
+
+  const unsigned long maxLevels = max<unsigned short>(config->GetLinear_Solver_AMG_Levels(), 1);
+  const passivedouble theta = SU2_TYPE::GetValue(config->GetLinear_Solver_AMG_Strength());
+  amg_sweeps = max<unsigned short>(config->GetLinear_Solver_AMG_Sweeps(), 1);
+
+  const auto blkSz = nVar*nVar;
+  const auto unassigned = numeric_limits<unsigned long>::max();
+
+  /*--- The levels refer to each other's data, the storage cannot be reallocated. ---*/
+  AMGLevels.clear();
+  AMGLevels.reserve(maxLevels);
+
+  /*--- The finest level is a copy of the matrix restricted to the domain points (the values are copied
+   *    by each build), the preconditioner must not change if the matrix is modified after it is built. ---*/
+  AMGLevels.emplace_back();
+  {
+    auto& finest = AMGLevels[0];
+    finest.nPoint = nPointDomain;
+    finest.row_ptr_data.assign(row_ptr, row_ptr+nPointDomain+1);
+    finest.dia_ptr_data.assign(dia_ptr, dia_ptr+nPointDomain);
+    finest.col_ind_data.assign(col_ind, col_ind+row_ptr[nPointDomain]);
+    finest.matrix_data.assign(matrix, matrix+row_ptr[nPointDomain]*blkSz);
+    finest.row_ptr = finest.row_ptr_data.data();
+    finest.dia_ptr = finest.dia_ptr_data.data();
+    finest.col_ind = finest.col_ind_data.data();
+    finest.matrix = finest.matrix_data.data();
+  }
+  AMGSourceRowPtr = row_ptr;
+  AMGSourceColInd = col_ind;
+
+  /*--- Frobenius norm of a block, used to measure the strength of connection. ---*/
+  auto blockNorm = [blkSz](const ScalarType* block) {
+    ScalarType sum = 0.0;
+    for (auto k = 0ul; k < blkSz; ++k) sum += block[k]*block[k];
+    return sqrt(SU2_TYPE::GetValue(sum));
+  };
+
+  while (AMGLevels.size() < maxLevels) {
+
+    auto& fine = AMGLevels.back();
+    const auto n = fine.nPoint;
+
+    if (n*nVar <= AMG_COARSE_SIZE) break;
+
+    /*--- Strength of the off-diagonal blocks relative to the diagonal blocks of their row and column,
+     *    the operators of the coarse levels are formed as they are created (see below). ---*/
+
+    vector<passivedouble> diagNorm(n), strength(fine.row_ptr[n], 0.0);
+
+    for (auto i = 0ul; i < n; ++i)
+      diagNorm[i] = blockNorm(&fine.matrix[fine.dia_ptr[i]*blkSz]);
+
+    for (auto i = 0ul; i < n; ++i) {
+      for (auto k = fine.row_ptr[i]; k < fine.row_ptr[i+1]; ++k) {
+        const auto j = fine.col_ind[k];
+        if (j == i || j >= n) continue;
+        const passivedouble scale = sqrt(diagNorm[i]*diagNorm[j]);
+        strength[k] = (scale > 0.0)? blockNorm(&fine.matrix[k*blkSz]) / scale : 0.0;
+      }
+    }
+
+    /*--- Greedy aggregation in three passes. First, aggregates are seeded from points
+     *    whose strongly connected neighbors are all free. ---*/
+
+    auto& agg = fine.aggregate;
+    agg.assign(n, unassigned);
+    unsigned long nAgg = 0;
+
+    for (auto i = 0ul; i < n; ++i) {
+      if (agg[i] != unassigned) continue;
+
+      bool free = true, isolated = true;
+      for (auto k = fine.row_ptr[i]; k < fine.row_ptr[i+1]; ++k) {
+        if (strength[k] < theta) continue;
+        isolated = false;
+        free &= (agg[fine.col_ind[k]] == unassigned);
+      }
+      if (!free || isolated) continue;
+
+      agg[i] = nAgg;
+      for (auto k = fine.row_ptr[i]; k < fine.row_ptr[i+1]; ++k)
+        if (strength[k] >= theta) agg[fine.col_ind[k]] = nAgg;
+      ++nAgg;
+    }
+
+    /*--- Second, the remaining points join the aggregate they are most strongly connected to. ---*/
+
+    const auto seeded = agg;
+
+    for (auto i = 0ul; i < n; ++i) {
+      if (agg[i] != unassigned) continue;
+
+      passivedouble maxStrength = 0.0;
+      for (auto k = fine.row_ptr[i]; k < fine.row_ptr[i+1]; ++k) {
+        const auto j = fine.col_ind[k];
+        if (strength[k] > maxStrength && seeded[j] != unassigned) {
+          maxStrength = strength[k];
+          agg[i] = seeded[j];
+        }
+      }
+    }
+
+    /*--- Lastly, what is left forms new aggregates with its free strong neighbors. ---*/
+
+    for (auto i = 0ul; i < n; ++i) {
+      if (agg[i] != unassigned) continue;
+
+      agg[i] = nAgg;
+      for (auto k = fine.row_ptr[i]; k < fine.row_ptr[i+1]; ++k) {
+        const auto j = fine.col_ind[k];
+        if (strength[k] >= theta && agg[j] == unassigned) agg[j] = nAgg;
+      }
+      ++nAgg;
+    }
+
+    /*--- Stop if the coarsening stagnates, the coarse level would be almost as expensive. ---*/
+
+    if (5*nAgg > 4*n) {
+      agg.clear();
+      break;
+    }
+
+    /*--- Points of each aggregate. ---*/
+
+    fine.agg_ptr.assign(nAgg+1, 0);
+    for (auto i = 0ul; i < n; ++i) ++fine.agg_ptr[agg[i]+1];
+    for (auto I = 0ul; I < nAgg; ++I) fine.agg_ptr[I+1] += fine.agg_ptr[I];
+
+    fine.agg_pts.resize(n);
+    vector<unsigned long> pos(fine.agg_ptr.begin(), fine.agg_ptr.end()-1);
+    for (auto i = 0ul; i < n; ++i) fine.agg_pts[pos[agg[i]]++] = i;
+
+    /*--- Sparse pattern of the coarse level, block IJ exists if any point of I is connected to a point of J. ---*/
+
+    AMGLevel coarse;
+    coarse.nPoint = nAgg;
+    coarse.row_ptr_data.reserve(nAgg+1);
+    coarse.dia_ptr_data.reserve(nAgg);
+    coarse.row_ptr_data.push_back(0);
+
+    vector<unsigned long> cols;
+
+    for (auto I = 0ul; I < nAgg; ++I) {
+      cols.clear();
+      for (auto p = fine.agg_ptr[I]; p < fine.agg_ptr[I+1]; ++p) {
+        const auto i = fine.agg_pts[p];
+        for (auto k = fine.row_ptr[i]; k < fine.row_ptr[i+1]; ++k)
+          if (fine.col_ind[k] < n) cols.push_back(agg[fine.col_ind[k]]);
+      }
+      sort(cols.begin(), cols.end());
+      cols.erase(unique(cols.begin(), cols.end()), cols.end());
+
+      const auto offset = coarse.col_ind_data.size();
+      coarse.dia_ptr_data.push_back(offset + (lower_bound(cols.begin(), cols.end(), I) - cols.begin()));
+      coarse.col_ind_data.insert(coarse.col_ind_data.end(), cols.begin(), cols.end());
+      coarse.row_ptr_data.push_back(coarse.col_ind_data.size());
+    }
+
+    /*--- Map each block of the fine level to the coarse block it is summed into. ---*/
+
+    fine.coarse_nnz.assign(fine.row_ptr[n], unassigned);
+
+    for (auto i = 0ul; i < n; ++i) {
+      const auto I = agg[i];
+      const auto first = coarse.col_ind_data.begin() + coarse.row_ptr_data[I];
+      const auto last = coarse.col_ind_data.begin() + coarse.row_ptr_data[I+1];
+
+      for (auto k = fine.row_ptr[i]; k < fine.row_ptr[i+1]; ++k) {
+        const auto j = fine.col_ind[k];
+        if (j >= n) continue;
+        fine.coarse_nnz[k] = lower_bound(first, last, agg[j]) - coarse.col_ind_data.begin();
+      }
+    }
+
+    coarse.matrix_data.resize(coarse.col_ind_data.size()*blkSz, 0.0);
+
+    AMGLevels.push_back(move(coarse));
+
+    auto& added = AMGLevels.back();
+    added.row_ptr = added.row_ptr_data.data();
+    added.dia_ptr = added.dia_ptr_data.data();
+    added.col_ind = added.col_ind_data.data();
+    added.matrix = added.matrix_data.data();
+
+    /*--- The coarse operator is needed to aggregate the next level. ---*/
+
+    for (auto I = 0ul; I < nAgg; ++I)
+      ComputeAMGCoarseRow(AMGLevels.size()-1, I);
+  }
+
+  /*--- Working memory, and thread partitions of the smoother. ---*/
+
+  for (auto& level : AMGLevels) {
+    const auto n = level.nPoint;
+    level.invD.resize(n*blkSz, 0.0);
+    level.sol.resize(n*nVar, 0.0);
+    level.rhs.resize(n*nVar, 0.0);
+    level.old.resize(n*nVar, 0.0);
+
+    const auto nParts = max<unsigned long>(min<unsigned long>(omp_num_parts, n), 1);
+    const auto ptsPerPart = roundUpDiv(n, nParts);
+    level.partitions.resize(nParts+1);
+    for (auto part = 0ul; part < nParts; ++part)
+      level.partitions[part] = min(part*ptsPerPart, n);
+    level.partitions[nParts] = n;
+  }
+
+  /*--- Dense factorization of the coarsest level if it is small enough. ---*/
+
+  const auto nCoarse = AMGLevels.back().nPoint*nVar;
+
+  if (nCoarse <= AMG_COARSE_SIZE) {
+    AMGCoarseLU.resize(nCoarse*nCoarse);
+    AMGCoarsePivot.resize(nCoarse);
+  }
+  else {
+    AMGCoarseLU.clear();
+    AMGCoarsePivot.clear();
+  }
+
+}
+
+template<class ScalarType>
+void CSysMatrix<ScalarType>::ComputeAMGCoarseRow(unsigned long iLevel, unsigned long iRow) {
+
+  const auto blkSz = nVar*nVar;
+  const auto unassigned = numeric_limits<unsigned long>::max();
+
+  const auto& fine = AMGLevels[iLevel-1];
+  auto& coarse = AMGLevels[iLevel];
+
+  auto coarse_row = &coarse.matrix_data[coarse.row_ptr[iRow]*blkSz];
+  for (auto k = 0ul; k < (coarse.row_ptr[iRow+1]-coarse.row_ptr[iRow])*blkSz; ++k)
+    coarse_row[k] = 0.0;
+
+  for (auto p = fine.agg_ptr[iRow]; p < fine.agg_ptr[iRow+1]; ++p) {
+    const auto i = fine.agg_pts[p];
+    for (auto k = fine.row_ptr[i]; k < fine.row_ptr[i+1]; ++k) {
+      if (fine.coarse_nnz[k] == unassigned) continue;
+      auto block = &coarse.matrix_data[fine.coarse_nnz[k]*blkSz];
+      SU2_OMP_SIMD
+      for (auto iVar = 0ul; iVar < blkSz; ++iVar)
+        block[iVar] += fine.matrix[k*blkSz+iVar];
+    }
+  }
+}
+
+template<class ScalarType>
+void CSysMatrix<ScalarType>::BuildAMGPreconditioner(const CConfig *config) {
+
+  /*--- The aggregation is done once, when the matrix is first built, and is then
+   *    re-used (only the coarse operators are updated) since it depends mostly
+   *    on the sparse pattern, which is fixed. ---*/
+
+  /*--- The hierarchy is created again if the sparse pattern changed (e.g. the matrix was initialized again). ---*/
+
+  const bool setup = AMGLevels.empty() || (AMGSourceRowPtr != row_ptr) || (AMGSourceColInd != col_ind);
+  SU2_OMP_BARRIER
+
+  if (setup) {
+    SU2_OMP_MASTER
+    SetupAMGHierarchy(config);
+    SU2_OMP_BARRIER
+  }
+
+  const auto blkSz = nVar*nVar;
+
+  /*--- Copy of the current values of the matrix, made during the setup on the first build. ---*/
+
+  if (!setup) {
+    auto& finest = AMGLevels[0];
+    SU2_OMP_FOR_STAT(OMP_MAX_SIZE_L)
+    for (auto k = 0ul; k < finest.matrix_data.size(); ++k)
+      finest.matrix_data[k] = matrix[k];
+  }
+
+  /*--- Galerkin coarse operators, formed during the setup on the first build. ---*/
+
+  for (auto iLevel = 1ul; iLevel < AMGLevels.size() && !setup; ++iLevel) {
+    SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
+    for (auto I = 0ul; I < AMGLevels[iLevel].nPoint; ++I)
+      ComputeAMGCoarseRow(iLevel, I);
+  }
+
+  /*--- Inverse diagonal blocks for the smoother. ---*/
+
+  for (auto& level : AMGLevels) {
+    SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
+    for (auto i = 0ul; i < level.nPoint; ++i) {
+      ScalarType block[MAXNVAR*MAXNVAR];
+      MatrixCopy(&level.matrix[level.dia_ptr[i]*blkSz], block);
+      MatrixInverse(block, &level.invD[i*blkSz]);
+    }
+  }
+
+  /*--- LU factorization (with partial pivoting) of the coarsest level. ---*/
+
+  if (AMGCoarseLU.empty()) return;
+
+  SU2_OMP_MASTER
+  {
+    const auto& level = AMGLevels.back();
+    const auto n = level.nPoint*nVar;
+    auto LU = AMGCoarseLU.data();
+
+    for (auto k = 0ul; k < n*n; ++k) LU[k] = 0.0;
+
+    passivedouble scale = 0.0;
+
+    for (auto i = 0ul; i < level.nPoint; ++i) {
+      for (auto k = level.row_ptr[i]; k < level.row_ptr[i+1]; ++k) {
+        const auto j = level.col_ind[k];
+        for (auto iVar = 0ul; iVar < nVar; ++iVar)
+          for (auto jVar = 0ul; jVar < nVar; ++jVar)
+            LU[(i*nVar+iVar)*n + j*nVar+jVar] = level.matrix[k*blkSz + iVar*nVar+jVar];
+      }
+    }
+    for (auto k = 0ul; k < n*n; ++k)
+      scale = max(scale, fabs(SU2_TYPE::GetValue(LU[k])));
+
+    /*--- Pivots that are zero to round-off (relative to the largest entry) are replaced by that
+     *    threshold, this regularizes singular coarse operators (e.g. of pure Neumann problems) with
+     *    a perturbation of the order of the round-off, which is enough for the coarse correction. ---*/
+    const passivedouble minPivot = 100 * numeric_limits<passivedouble>::epsilon() * scale;
+    AMGRegularizedPivots = 0;
+
+    for (auto col = 0ul; col < n; ++col) {
+
+      auto pivot = col;
+      for (auto row = col+1; row < n; ++row)
+        if (fabs(LU[row*n+col]) > fabs(LU[pivot*n+col])) pivot = row;
+
+      AMGCoarsePivot[col] = pivot;
+      if (pivot != col)
+        for (auto k = 0ul; k < n; ++k) swap(LU[col*n+k], LU[pivot*n+k]);
+
+      const passivedouble pivotValue = SU2_TYPE::GetValue(LU[col*n+col]);
+
+      if (!std::isfinite(pivotValue))
+        SU2_MPI::Error("The coarsest level of the AMG hierarchy has non-finite entries.", CURRENT_FUNCTION);
+
+      if (fabs(pivotValue) <= minPivot) {
+        LU[col*n+col] = (pivotValue < 0.0)? -minPivot : minPivot;
+        ++AMGRegularizedPivots;
+      }
+
+      for (auto row = col+1; row < n; ++row) {
+        const ScalarType weight = LU[row*n+col] / LU[col*n+col];
+        LU[row*n+col] = weight;
+        for (auto k = col+1; k < n; ++k) LU[row*n+k] -= weight * LU[col*n+k];
+      }
+    }
+  }
+  SU2_OMP_BARRIER
+
+}
+
+template<class ScalarType>
+void CSysMatrix<ScalarType>::AMGSmooth(unsigned long iLevel, unsigned long nSweeps, bool forward) const {
+
+  auto& level = AMGLevels[iLevel];
+  const auto blkSz = nVar*nVar;
+  const auto nParts = level.partitions.size()-1;
+
+  for (auto iSweep = 0ul; iSweep < nSweeps; ++iSweep) {
+
+    /*--- Values owned by other threads are lagged by one sweep, this avoids races
+     *    and makes the result independent of the thread scheduling. ---*/
+
+    SU2_OMP_FOR_STAT(OMP_MAX_SIZE_L)
+    for (auto k = 0ul; k < level.nPoint*nVar; ++k)
+      level.old[k] = level.sol[k];
+
+    SU2_OMP_FOR_STAT(1)
+    for (auto part = 0ul; part < nParts; ++part) {
+
+      const auto begin = level.partitions[part];
+      const auto end = level.partitions[part+1];
+
+      ScalarType res[MAXNVAR];
+
+      for (auto iter = 0ul; iter < end-begin; ++iter) {
+
+        const auto i = forward? begin+iter : end-1-iter;
+
+        for (auto iVar = 0ul; iVar < nVar; ++iVar)
+          res[iVar] = level.rhs[i*nVar+iVar];
+
+        for (auto k = level.row_ptr[i]; k < level.row_ptr[i+1]; ++k) {
+          const auto j = level.col_ind[k];
+          if (j == i || j >= level.nPoint) continue;
+          const auto& x = (j >= begin && j < end)? level.sol : level.old;
+          MatrixVectorProductSub(&level.matrix[k*blkSz], &x[j*nVar], res);
+        }
+
+        MatrixVectorProduct(&level.invD[i*blkSz], res, &level.sol[i*nVar]);
+      }
+    }
+  }
+
+}
+
+template<class ScalarType>
+void CSysMatrix<ScalarType>::AMGCycle(unsigned long iLevel) const {
+
+  auto& level = AMGLevels[iLevel];
+  const auto blkSz = nVar*nVar;
+
+  /*--- Coarsest level, direct solve if it is small enough, otherwise more smoothing. ---*/
+
+  if (iLevel+1 == AMGLevels.size()) {
+
+    if (AMGCoarseLU.empty()) {
+      AMGSmooth(iLevel, 2*amg_sweeps, true);
+      AMGSmooth(iLevel, 2*amg_sweeps, false);
+      return;
+    }
+
+    SU2_OMP_MASTER
+    {
+      const auto n = level.nPoint*nVar;
+      const auto LU = AMGCoarseLU.data();
+      auto x = level.sol.data();
+
+      for (auto k = 0ul; k < n; ++k) x[k] = level.rhs[k];
+
+      for (auto k = 0ul; k < n; ++k) swap(x[k], x[AMGCoarsePivot[k]]);
+
+      for (auto row = 1ul; row < n; ++row)
+        for (auto k = 0ul; k < row; ++k)
+          x[row] -= LU[row*n+k] * x[k];
+
+      for (auto row = n; row > 0ul;) {
+        row--; // unsigned type
+        for (auto k = row+1; k < n; ++k)
+          x[row] -= LU[row*n+k] * x[k];
+        x[row] /= LU[row*n+row];
+      }
+    }
+    SU2_OMP_BARRIER
+    return;
+  }
+
+  auto& coarse = AMGLevels[iLevel+1];
+
+  /*--- Pre-smoothing, starting from a zero solution. ---*/
+
+  AMGSmooth(iLevel, amg_sweeps, true);
+
+  /*--- Restrict the residual, i.e. sum it over each aggregate. ---*/
+
+  SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
+  for (auto I = 0ul; I < coarse.nPoint; ++I) {
+
+    ScalarType res[MAXNVAR];
+
+    for (auto iVar = 0ul; iVar < nVar; ++iVar) {
+      coarse.rhs[I*nVar+iVar] = 0.0;
+      coarse.sol[I*nVar+iVar] = 0.0;
+    }
+
+    for (auto p = level.agg_ptr[I]; p < level.agg_ptr[I+1]; ++p) {
+      const auto i = level.agg_pts[p];
+
+      for (auto iVar = 0ul; iVar < nVar; ++iVar)
+        res[iVar] = level.rhs[i*nVar+iVar];
+
+      for (auto k = level.row_ptr[i]; k < level.row_ptr[i+1]; ++k) {
+        const auto j = level.col_ind[k];
+        if (j < level.nPoint)
+          MatrixVectorProductSub(&level.matrix[k*blkSz], &level.sol[j*nVar], res);
+      }
+
+      for (auto iVar = 0ul; iVar < nVar; ++iVar)
+        coarse.rhs[I*nVar+iVar] += res[iVar];
+    }
+  }
+
+  /*--- Coarse grid correction. ---*/
+
+  AMGCycle(iLevel+1);
+
+  /*--- Prolongate the correction, i.e. inject it into the points of each aggregate. ---*/
+
+  SU2_OMP_FOR_STAT(OMP_MAX_SIZE_H)
+  for (auto i = 0ul; i < level.nPoint; ++i) {
+    const auto I = level.aggregate[i];
+    for (auto iVar = 0ul; iVar < nVar; ++iVar)
+      level.sol[i*nVar+iVar] += coarse.sol[I*nVar+iVar];
+  }
+
+  /*--- Post-smoothing, in the reverse order to keep the cycle "symmetric". ---*/
+
+  AMGSmooth(iLevel, amg_sweeps, false);
+
+}
+
+template<class ScalarType>
+void CSysMatrix<ScalarType>::ComputeAMGPreconditioner(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
+                                                      CGeometry *geometry, const CConfig *config) const {
+
+  auto& fine = AMGLevels[0];
+
+  /*--- Coherent view of vectors. ---*/
+  SU2_OMP_BARRIER
+
+  SU2_OMP_FOR_STAT(OMP_MAX_SIZE_L)
+  for (auto k = 0ul; k < nPointDomain*nVar; ++k) {
+    fine.rhs[k] = vec[k];
+    fine.sol[k] = 0.0;
+  }
+
+  AMGCycle(0);
+
+  SU2_OMP_FOR_STAT(OMP_MAX_SIZE_L)
+  for (auto k = 0ul; k < nPointDomain*nVar; ++k)
+    prod[k] = fine.sol[k];
+
+  /*--- MPI Parallelization ---*/
+
+  InitiateComms(prod, geometry, config, SOLUTION_MATRIX);
+  CompleteComms(prod, geometry, config, SOLUTION_MATRIX);
+
+}
+
 template<class ScalarType>
 void CSysMatrix<ScalarType>::ComputeResidual(const CSysVector<ScalarType> & sol, const CSysVector<ScalarType> & f,
                                              CSysVector<ScalarType> & res) const {
@@ -1331,6 +1834,9 @@ void CSysMatrix<ScalarType>::EnforceSolutionAtDOF(unsigned long node_i, unsigned
 template<class ScalarType>
 void CSysMatrix<ScalarType>::SetDiagonalAsColumnSum() {
 
+  SU2_OMP_MASTER
+  ++valuesVersion;
+
   SU2_OMP_FOR_DYN(omp_heavy_size)
   for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
 
@@ -1418,4 +1924,10 @@ template void CSysMatrix<su2mixedfloat>::EnforceSolutionAtDOF(unsigned long, uns
 template void CSysMatrix<su2mixedfloat>::InitiateComms(const CSysVector<su2double>&, CGeometry*, const CConfig*, unsigned short) const;
 template void CSysMatrix<su2mixedfloat>::CompleteComms(CSysVector<su2double>&, CGeometry*, const CConfig*, unsigned short) const;
 #endif
+#ifdef USE_RUNTIME_MIXED_PRECISION
+/*--- Float copy of the double matrix, for the mixed precision mode of CSysSolve. ---*/
+template class CSysMatrix<float>;
+template void CSysMatrix<float>::InitiateComms(const CSysVector<float>&, CGeometry*, const CConfig*, unsigned short) const;
+template void CSysMatrix<float>::CompleteComms(CSysVector<float>&, CGeometry*, const CConfig*, unsigned short) const;
+#endif
 #endif // CODI_FORWARD_TYPE
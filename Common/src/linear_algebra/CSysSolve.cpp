@@ -34,6 +34,7 @@
 #include "../../include/linear_algebra/CSysMatrix.hpp"
 #include "../../include/linear_algebra/CMatrixVectorProduct.hpp"
 #include "../../include/linear_algebra/CPreconditioner.hpp"
+#include "../../include/toolboxes/CPerformanceTracer.hpp"
 
 #include <limits>
 
@@ -56,10 +57,15 @@ CSysSolve<ScalarType>::CSysSolve(const bool mesh_deform_mode) :
   bcg_ready(false),
   gmres_ready(false),
   smooth_ready(false),
+  pgmres_ready(false),
+  pbcg_ready(false),
   LinSysSol_ptr(nullptr),
   LinSysRes_ptr(nullptr) {
 }
 
+template<class ScalarType>
+CSysSolve<ScalarType>::~CSysSolve() = default;
+
 template<class ScalarType>
 void CSysSolve<ScalarType>::ApplyGivens(ScalarType s, ScalarType c, ScalarType & h1, ScalarType & h2) const {
 
@@ -198,6 +204,62 @@ void CSysSolve<ScalarType>::WriteWarning(ScalarType res_calc, ScalarType res_tru
   cout << "# true_res - calc_res = " << res_true - res_calc << endl;
 }
 
+template<class ScalarType>
+void CSysSolve<ScalarType>::StartReduction(const ScalarType* partial, unsigned long n) const {
+
+  /*--- Reduce over threads, the buffers are sized by the solvers when they allocate their work vectors,
+   *    resizing them here would race with threads still reading the result of the previous reduction. ---*/
+
+  assert(n <= redSum.size() && "The reduction buffers are too small.");
+
+  SU2_OMP_CRITICAL
+  for (auto k = 0ul; k < n; ++k) redSum[k] += partial[k];
+
+  SU2_OMP_BARRIER
+
+  /*--- Start the reduction over ranks, AD types cannot use the non-blocking version. ---*/
+
+  SU2_OMP_MASTER {
+#ifdef HAVE_MPI
+    const auto mpi_type = (sizeof(ScalarType) < sizeof(double))? MPI_FLOAT : MPI_DOUBLE;
+    if (std::is_arithmetic<ScalarType>::value)
+      CBaseMPIWrapper::Iallreduce(redSum.data(), redResult.data(), n, mpi_type, MPI_SUM, MPI_COMM_WORLD, &redRequest);
+    else
+      SelectMPIWrapper<ScalarType>::W::Allreduce(redSum.data(), redResult.data(), n, mpi_type, MPI_SUM, MPI_COMM_WORLD);
+#else
+    for (auto k = 0ul; k < n; ++k) redResult[k] = redSum[k];
+#endif
+    redStart = SU2_MPI::Wtime();
+  }
+}
+
+template<class ScalarType>
+void CSysSolve<ScalarType>::FinishReduction(ScalarType* result, unsigned long n) const {
+
+  SU2_OMP_MASTER {
+    const auto now = SU2_MPI::Wtime();
+    redOverlapTime += now - redStart;
+#ifdef HAVE_MPI
+    if (std::is_arithmetic<ScalarType>::value)
+      CBaseMPIWrapper::Wait(&redRequest, MPI_STATUS_IGNORE);
+#endif
+    redWaitTime += SU2_MPI::Wtime() - now;
+
+    /*--- Ready for the next reduction. ---*/
+    for (auto k = 0ul; k < n; ++k) redSum[k] = ScalarType(0);
+  }
+  SU2_OMP_BARRIER
+
+  for (auto k = 0ul; k < n; ++k) result[k] = redResult[k];
+}
+
+template<class ScalarType>
+void CSysSolve<ScalarType>::WriteReductionTimes() const {
+
+  cout << "# Time overlapped with global reductions = " << redOverlapTime << " s\n";
+  cout << "# Time waiting for global reductions     = " << redWaitTime << " s\n" << endl;
+}
+
 template<class ScalarType>
 unsigned long CSysSolve<ScalarType>::CG_LinSolver(const CSysVector<ScalarType> & b, CSysVector<ScalarType> & x,
                                                   const CMatrixVectorProduct<ScalarType> & mat_vec, const CPreconditioner<ScalarType> & precond,
@@ -354,11 +416,11 @@ unsigned long CSysSolve<ScalarType>::FGMRES_LinSolver(const CSysVector<ScalarTyp
     SU2_MPI::Error("FGMRES subspace is too large.", CURRENT_FUNCTION);
   }
 
-  /*--- Allocate if not allocated yet
+  /*--- Allocate if not allocated yet, or if the subspace is larger than the previous one
    Note: elements in w and z are initialized to x to avoid creating
    a temporary CSysVector object for the copy constructor ---*/
 
-  if (!gmres_ready) {
+  if (!gmres_ready || (W.size() < m+1)) {
     SU2_OMP_BARRIER
     SU2_OMP_MASTER {
       W.resize(m+1);
@@ -650,6 +712,395 @@ unsigned long CSysSolve<ScalarType>::BCGSTAB_LinSolver(const CSysVector<ScalarTy
   return i;
 }
 
+template<class ScalarType>
+unsigned long CSysSolve<ScalarType>::PipelinedGMRES_LinSolver(const CSysVector<ScalarType> & b, CSysVector<ScalarType> & x,
+                                                              const CMatrixVectorProduct<ScalarType> & mat_vec, const CPreconditioner<ScalarType> & precond,
+                                                              ScalarType tol, unsigned long m, ScalarType & residual, bool monitoring, const CConfig *config) const {
+
+  const bool master = (SU2_MPI::GetRank() == MASTER_NODE) && (omp_get_thread_num() == 0);
+
+  /*---  Check the subspace size ---*/
+
+  if (m < 1) {
+    SU2_OMP_MASTER
+    SU2_MPI::Error("Number of linear solver iterations must be greater than 0.", CURRENT_FUNCTION);
+  }
+
+  if (m > 5000) {
+    SU2_OMP_MASTER
+    SU2_MPI::Error("GMRES subspace is too large.", CURRENT_FUNCTION);
+  }
+
+  /*--- Allocate if not allocated yet, or if the subspace grew. The basis v and the auxiliary
+   basis z = A M^-1 v (shifted by one, z[i] holds z_{i+1}) are kept, w and u are temporaries. ---*/
+
+  if (!pgmres_ready || (PV.size() < m+1)) {
+    SU2_OMP_BARRIER
+    SU2_OMP_MASTER {
+      PV.resize(m+1);
+      PZ.resize(m+1);
+      for (auto& v : PV) v.Initialize(x.GetNBlk(), x.GetNBlkDomain(), x.GetNVar(), nullptr);
+      for (auto& z : PZ) z.Initialize(x.GetNBlk(), x.GetNBlkDomain(), x.GetNVar(), nullptr);
+      if (PW.size() < 2) PW.resize(2);
+      for (auto& w : PW) w.Initialize(x.GetNBlk(), x.GetNBlkDomain(), x.GetNVar(), nullptr);
+      if (redSum.size() < m+3) {
+        redSum.resize(m+3, ScalarType(0));
+        redResult.resize(m+3, ScalarType(0));
+      }
+      pgmres_ready = true;
+      redOverlapTime = redWaitTime = 0.0;
+    }
+    SU2_OMP_BARRIER
+  }
+  else {
+    SU2_OMP_MASTER
+    redOverlapTime = redWaitTime = 0.0;
+  }
+
+  auto& w = PW[0];
+  auto& u = PW[1];
+
+  /*--- See CSysSolve::FGMRES_LinSolver. ---*/
+
+  su2vector<ScalarType> g(m+1), sn(m+1), cs(m+1), y(m), partial(m+3), result(m+3);
+  g = ScalarType(0);
+  sn = ScalarType(0);
+  cs = ScalarType(0);
+  y = ScalarType(0);
+  su2matrix<ScalarType> H(m+1, m);
+  H = ScalarType(0);
+
+  /*--- Calculate the initial residual (not normalized) and the first vector of the auxiliary basis. ---*/
+
+  mat_vec(x, u);
+  PV[0] = b - u;
+  precond(PV[0], u);
+  mat_vec(u, PZ[0]);
+
+  ScalarType norm0 = 0.0, beta = 0.0;
+  unsigned long i = 0;
+
+  /*--- Each iteration i computes the dot products needed to orthogonalize z_{i+1} against the
+   basis, and the norm of v_i (which is only normalized afterwards). The reduction is overlapped
+   with the computation of the next auxiliary vector, A M^-1 z_{i+1}. Column i-1 of the Hessenberg
+   matrix is completed with the norm of v_i, and column i with the (scaled) dot products. ---*/
+
+  for (i = 0; i <= m; i++) {
+
+    /*--- Start the reduction: |v_i|^2, (z_{i+1}, v_j) for j <= i, and |b|^2 for the first iteration. ---*/
+
+    unsigned long nRed = 1;
+    partial[0] = PV[i].localDot(PV[i]);
+    if (i < m) {
+      for (unsigned long j = 0; j <= i; j++)
+        partial[nRed++] = PZ[i].localDot(PV[j]);
+    }
+    if (i == 0) partial[nRed++] = b.localDot(b);
+
+    StartReduction(partial.data(), nRed);
+
+    /*--- Overlap with the next vector of the auxiliary basis. ---*/
+
+    if (i < m) {
+      precond(PZ[i], u);
+      mat_vec(u, w);
+    }
+
+    FinishReduction(result.data(), nRed);
+
+    const ScalarType hn = sqrt(result[0]);
+
+    if (i == 0) {
+
+      norm0 = sqrt(result[nRed-1]);
+      beta = hn;
+
+      if ((beta < tol*norm0) || (beta < eps)) {
+
+        /*--- System is already solved ---*/
+
+        if (master) cout << "CSysSolve::PipelinedGMRES(): system solved by initial guess." << endl;
+        residual = beta;
+        return 0;
+      }
+
+      g[0] = beta;
+
+      if (tol_type == LinearToleranceType::RELATIVE)
+        norm0 = beta;
+
+      if ((monitoring) && (master)) {
+        WriteHeader("Pipelined GMRES", tol, beta);
+        WriteHistory(i, beta/norm0);
+      }
+    }
+    else {
+
+      /*--- Complete the previous column and apply the Givens rotations (see FGMRES). ---*/
+
+      const auto c = i-1;
+      H[i][c] = hn;
+
+      for (unsigned long k = 0; k < c; k++)
+        ApplyGivens(sn[k], cs[k], H[k][c], H[k+1][c]);
+      GenerateGivens(H[c][c], H[i][c], sn[c], cs[c]);
+      ApplyGivens(sn[c], cs[c], g[c], g[i]);
+
+      beta = fabs(g[i]);
+
+      if (((monitoring) && (master)) && (i % 10 == 0))
+        WriteHistory(i, beta/norm0);
+    }
+
+    /*--- Check if solution has converged, the basis has i vectors. ---*/
+
+    if ((beta < tol*norm0) || (i == m)) break;
+
+    /*--- Normalize v_i and z_{i+1}, and scale the dot products accordingly. ---*/
+
+    PV[i] /= hn;
+    PZ[i] /= hn;
+    w /= hn;
+
+    for (unsigned long j = 0; j < i; j++)
+      H[j][i] = result[1+j] / hn;
+    H[i][i] = result[1+i] / (hn*hn);
+
+    /*--- Next vectors of the basis and of the auxiliary basis. ---*/
+
+    PV[i+1] = PZ[i];
+    for (unsigned long j = 0; j <= i; j++)
+      PV[i+1] -= H[j][i] * PV[j];
+
+    if (i+1 < m) {
+      PZ[i+1] = w;
+      for (unsigned long j = 0; j <= i; j++)
+        PZ[i+1] -= H[j][i] * PZ[j];
+    }
+  }
+
+  /*---  Solve the least-squares system and update solution, x += M^-1 V y. ---*/
+
+  SolveReduced(i, H, g, y);
+  u = ScalarType(0);
+  for (unsigned long k = 0; k < i; k++) {
+    u += y[k] * PV[k];
+  }
+  precond(u, w);
+  x += w;
+
+  /*---  Recalculate final residual (this should be optional) ---*/
+
+  if ((monitoring) && (config->GetComm_Level() == COMM_FULL)) {
+
+    if (master) {
+      WriteFinalResidual("Pipelined GMRES", i, beta/norm0);
+      WriteReductionTimes();
+    }
+
+    mat_vec(x, w);
+    w -= b;
+    ScalarType res = w.norm();
+
+    if (fabs(res - beta) > tol*10) {
+      if (master) {
+        WriteWarning(beta, res, tol);
+      }
+    }
+
+  }
+
+  residual = beta/norm0;
+  return i;
+
+}
+
+template<class ScalarType>
+unsigned long CSysSolve<ScalarType>::PipelinedBCGSTAB_LinSolver(const CSysVector<ScalarType> & b, CSysVector<ScalarType> & x,
+                                                                const CMatrixVectorProduct<ScalarType> & mat_vec, const CPreconditioner<ScalarType> & precond,
+                                                                ScalarType tol, unsigned long m, ScalarType & residual, bool monitoring, const CConfig *config) const {
+
+  const bool master = (SU2_MPI::GetRank() == MASTER_NODE) && (omp_get_thread_num() == 0);
+  ScalarType norm_r = 0.0, norm0 = 0.0;
+  unsigned long i = 0;
+
+  /*--- Check the subspace size ---*/
+
+  if (m < 1) {
+    SU2_OMP_MASTER
+    SU2_MPI::Error("Number of linear solver iterations must be greater than 0.", CURRENT_FUNCTION);
+  }
+
+  /*--- Allocate if not allocated yet ---*/
+
+  constexpr unsigned long nWork = 15;
+
+  if (!pbcg_ready) {
+    SU2_OMP_BARRIER
+    SU2_OMP_MASTER {
+      if (PW.size() < nWork) PW.resize(nWork);
+      for (auto& w : PW) w.Initialize(b.GetNBlk(), b.GetNBlkDomain(), b.GetNVar(), nullptr);
+      if (redSum.size() < 5) {
+        redSum.resize(5, ScalarType(0));
+        redResult.resize(5, ScalarType(0));
+      }
+      pbcg_ready = true;
+    }
+    SU2_OMP_BARRIER
+  }
+
+  SU2_OMP_MASTER
+  redOverlapTime = redWaitTime = 0.0;
+
+  /*--- Preconditioned p-BiCGStab (Cools and Vanroose, 2017), the "t" vectors are preconditioned
+   counterparts (e.g. r_t = M^-1 r), the others satisfy w = A r_t, s = A p_t, z = A s_t, v = A z_t. ---*/
+
+  auto& r = PW[0];   auto& r_t = PW[1];  auto& r_0 = PW[2];
+  auto& w = PW[3];   auto& w_t = PW[4];  auto& t = PW[5];
+  auto& p_t = PW[6]; auto& s = PW[7];    auto& s_t = PW[8];
+  auto& z = PW[9];   auto& z_t = PW[10]; auto& v = PW[11];
+  auto& q = PW[12];  auto& q_t = PW[13]; auto& y = PW[14];
+
+  ScalarType partial[5], result[5];
+
+  /*--- Calculate the initial residual and the auxiliary vectors. ---*/
+
+  mat_vec(x, v);
+  r = b - v;
+  r_0 = r;
+  precond(r, r_t);
+  mat_vec(r_t, w);
+
+  /*--- Start the reduction of the norms and initial scalars, overlapped with t = A M^-1 w. ---*/
+
+  partial[0] = r_0.localDot(r);
+  partial[1] = r_0.localDot(w);
+  partial[2] = r.localDot(r);
+  partial[3] = b.localDot(b);
+  StartReduction(partial, 4);
+
+  precond(w, w_t);
+  mat_vec(w_t, t);
+
+  FinishReduction(result, 4);
+
+  ScalarType rho = result[0];
+  norm_r = sqrt(result[2]);
+  norm0 = sqrt(result[3]);
+
+  if ((norm_r < tol*norm0) || (norm_r < eps)) {
+    if (master) cout << "CSysSolve::PipelinedBCGSTAB(): system solved by initial guess." << endl;
+    return 0;
+  }
+
+  /*--- Set the norm to the initial initial residual value ---*/
+
+  if (tol_type == LinearToleranceType::RELATIVE)
+    norm0 = norm_r;
+
+  /*--- Output header information including initial residual ---*/
+
+  if ((monitoring) && (master)) {
+    WriteHeader("Pipelined BCGSTAB", tol, norm_r);
+    WriteHistory(i, norm_r/norm0);
+  }
+
+  /*--- Initialization ---*/
+
+  ScalarType alpha = rho / result[1], beta = 0.0, omega = 1.0;
+  p_t = ScalarType(0.0); s = ScalarType(0.0); s_t = ScalarType(0.0);
+  z = ScalarType(0.0); z_t = ScalarType(0.0); v = ScalarType(0.0);
+
+  /*--- Loop over all search directions ---*/
+
+  for (i = 0; i < m; i++) {
+
+    /*--- Update the search direction and its auxiliary vectors ---*/
+
+    p_t = r_t + beta * (p_t - omega*s_t);
+    s = w + beta * (s - omega*z);
+    s_t = w_t + beta * (s_t - omega*z_t);
+    z = t + beta * (z - omega*v);
+
+    q = r - alpha * s;
+    q_t = r_t - alpha * s_t;
+    y = w - alpha * z;
+
+    /*--- Start the reduction for omega, overlapped with v = A M^-1 z. ---*/
+
+    partial[0] = q.localDot(y);
+    partial[1] = y.localDot(y);
+    StartReduction(partial, 2);
+
+    precond(z, z_t);
+    mat_vec(z_t, v);
+
+    FinishReduction(result, 2);
+
+    /*--- Calculate step-length omega, avoid division by 0. ---*/
+
+    if (result[1] == ScalarType(0)) break;
+    omega = result[0] / result[1];
+
+    /*--- Update solution and residual ---*/
+
+    x += alpha * p_t + omega * q_t;
+    r = q - omega * y;
+    r_t = q_t - omega * (w_t - alpha * z_t);
+    w = y - omega * (t - alpha * v);
+
+    /*--- Start the reduction for alpha and beta, overlapped with t = A M^-1 w. ---*/
+
+    partial[0] = r_0.localDot(r);
+    partial[1] = r_0.localDot(w);
+    partial[2] = r_0.localDot(s);
+    partial[3] = r_0.localDot(z);
+    partial[4] = r.localDot(r);
+    StartReduction(partial, 5);
+
+    precond(w, w_t);
+    mat_vec(w_t, t);
+
+    FinishReduction(result, 5);
+
+    /*--- The norm of the residual is obtained with the other scalars, i.e. at no extra cost. ---*/
+
+    norm_r = sqrt(result[4]);
+    if (norm_r < tol*norm0) break;
+    if (((monitoring) && (master)) && ((i+1) % 10 == 0))
+      WriteHistory(i+1, norm_r/norm0);
+
+    /*--- Calculate the step-lengths for the next iteration ---*/
+
+    beta = (alpha / omega) * (result[0] / rho);
+    rho = result[0];
+    alpha = rho / (result[1] + beta * result[2] - beta * omega * result[3]);
+
+  }
+
+  /*--- Recalculate final residual (this should be optional) ---*/
+
+  if ((monitoring) && (config->GetComm_Level() == COMM_FULL)) {
+
+    if (master) {
+      WriteFinalResidual("Pipelined BCGSTAB", i, norm_r/norm0);
+      WriteReductionTimes();
+    }
+
+    mat_vec(x, v);
+    r = b - v;
+    ScalarType true_res = r.norm();
+
+    if ((fabs(true_res - norm_r) > tol*10.0) && (master)) {
+      WriteWarning(norm_r, true_res, tol);
+    }
+
+  }
+
+  residual = norm_r/norm0;
+  return i;
+}
+
 template<class ScalarType>
 unsigned long CSysSolve<ScalarType>::Smoother_LinSolver(const CSysVector<ScalarType> & b, CSysVector<ScalarType> & x,
                                                         const CMatrixVectorProduct<ScalarType> & mat_vec, const CPreconditioner<ScalarType> & precond,
@@ -760,6 +1211,151 @@ unsigned long CSysSolve<ScalarType>::Smoother_LinSolver(const CSysVector<ScalarT
   return i;
 }
 
+template<class ScalarType>
+bool CSysSolve<ScalarType>::MixedPrecisionSolve(const MatrixType& Jacobian, CGeometry *geometry, const CConfig *config,
+                                                unsigned short KindSolver, unsigned short KindPrecond, unsigned long MaxIter,
+                                                unsigned long RestartIter, ScalarType& SolverTol, unsigned long& iters,
+                                                ScalarType& residual) {
+#ifndef USE_RUNTIME_MIXED_PRECISION
+  return false;
+#else
+  /*--- Lower bound for the tolerance of the inner solves, and minimum reduction of the residual by
+   *    each correction (else the mode stalled). In float, the relative residual an inner solve can
+   *    attain is roughly cond(A) times the unit round-off (6e-8), for the condition numbers of stiff
+   *    implicit systems (1e4-1e5) this is between 1e-3 and 1e-4. A tighter bound would save little
+   *    (the corrections compound, 1e-3 needs at most one more for the same final residual) while an
+   *    inner solve asked for more than it can attain stagnates, which is then treated as a stall. ---*/
+  constexpr float innerTolMin = 1e-3;
+  constexpr passivedouble stallFactor = 0.5;
+
+  const auto& b = *LinSysRes_ptr;
+  auto& x = *LinSysSol_ptr;
+
+  /*--- Allocate if not allocated yet. ---*/
+
+  SU2_OMP_MASTER {
+    if (!JacobianFloat) {
+      JacobianFloat.reset(new CSysMatrix<float>);
+      SolverFloat.reset(new CSysSolve<float>);
+    }
+    ResRefine.Initialize(b.GetNBlk(), b.GetNBlkDomain(), b.GetNVar(), nullptr);
+    SolFloat.Initialize(b.GetNBlk(), b.GetNBlkDomain(), b.GetNVar(), nullptr);
+  }
+  SU2_OMP_BARRIER
+
+  /*--- The float copy of the matrix, and its preconditioner, are only refreshed if the matrix was
+   *    assembled again (its values were reset) since the last copy, or if it is another matrix. ---*/
+
+  if ((JacobianFloatSource != &Jacobian) || (JacobianFloatVersion != Jacobian.GetValuesVersion())) {
+
+    JacobianFloat->CopyFrom(Jacobian, geometry, config);
+
+    SU2_OMP_MASTER {
+      JacobianFloatSource = &Jacobian;
+      JacobianFloatVersion = Jacobian.GetValuesVersion();
+      PrecondFloat.reset(CPreconditioner<float>::Create(KindPrecond, *JacobianFloat, geometry, config));
+    }
+    SU2_OMP_BARRIER
+
+    CTraceScope tracePrecond("Preconditioner build", "linear solver");
+    PrecondFloat->Build();
+  }
+
+  auto mat_vec = CSysMatrixVectorProduct<ScalarType>(Jacobian, geometry, config);
+  auto mat_vec_float = CSysMatrixVectorProduct<float>(*JacobianFloat, geometry, config);
+  const auto& precond = *PrecondFloat;
+
+  /*--- Iterative refinement, the residual is computed in full precision. ---*/
+
+  ScalarType norm0 = 0.0, res = 0.0, res_old = 0.0;
+  bool stalled = false, innerConverged = true;
+
+  for (unsigned long iRefine = 0; ; ++iRefine) {
+
+    mat_vec(x, ResRefine);
+    ResRefine = b - ResRefine;
+    res = ResRefine.norm();
+
+    if (iRefine == 0)
+      norm0 = (tol_type == LinearToleranceType::RELATIVE)? res : b.norm();
+
+    if ((res <= SolverTol*norm0) || (res < eps) || (iters >= MaxIter)) break;
+
+    /*--- Float cannot make the required progress (the inner solve did not converge), or the
+     *    corrections stopped reducing the residual (e.g. float copy of the matrix inaccurate). ---*/
+
+    if ((iRefine > 0) && (!innerConverged || (res > stallFactor*res_old))) {
+      stalled = true;
+      break;
+    }
+    res_old = res;
+
+    /*--- Compute the correction in float, only as accurately as needed (or possible). ---*/
+
+    ResFloat.PassiveCopy(ResRefine);
+    SolFloat = 0.0f;
+
+    /*--- An inner solve that stagnates may use at most half of the remaining iterations, which
+     *    leaves the other half to the full precision solve. ---*/
+
+    const float innerTol = max(innerTolMin, float(SolverTol*norm0/res));
+    const auto innerIter = (MaxIter - iters + 1) / 2;
+    float innerRes = 0.0f;
+
+    switch (KindSolver) {
+      case BCGSTAB:
+        iters += SolverFloat->BCGSTAB_LinSolver(ResFloat, SolFloat, mat_vec_float, precond, innerTol, innerIter, innerRes, false, config);
+        break;
+      case CONJUGATE_GRADIENT:
+        iters += SolverFloat->CG_LinSolver(ResFloat, SolFloat, mat_vec_float, precond, innerTol, innerIter, innerRes, false, config);
+        break;
+      case PIPELINED_GMRES:
+        iters += SolverFloat->PipelinedGMRES_LinSolver(ResFloat, SolFloat, mat_vec_float, precond, innerTol, innerIter, innerRes, false, config);
+        break;
+      case PIPELINED_BCGSTAB:
+        iters += SolverFloat->PipelinedBCGSTAB_LinSolver(ResFloat, SolFloat, mat_vec_float, precond, innerTol, innerIter, innerRes, false, config);
+        break;
+      case SMOOTHER:
+        iters += SolverFloat->Smoother_LinSolver(ResFloat, SolFloat, mat_vec_float, precond, innerTol, innerIter, innerRes, false, config);
+        break;
+      case RESTARTED_FGMRES:
+        iters += SolverFloat->FGMRES_LinSolver(ResFloat, SolFloat, mat_vec_float, precond, innerTol, min(RestartIter, innerIter), innerRes, false, config);
+        break;
+      default:
+        iters += SolverFloat->FGMRES_LinSolver(ResFloat, SolFloat, mat_vec_float, precond, innerTol, innerIter, innerRes, false, config);
+        break;
+    }
+
+    /*--- For the restarted solver each correction is one restart cycle, converged or not. ---*/
+
+    innerConverged = (innerRes <= innerTol) || (KindSolver == RESTARTED_FGMRES);
+
+    /*--- Apply the correction. ---*/
+
+    ResRefine.PassiveCopy(SolFloat);
+    x += ResRefine;
+  }
+
+  if (stalled) {
+    /*--- Same target for the full precision solve, which starts from the refined solution. ---*/
+    if (tol_type == LinearToleranceType::RELATIVE) {
+      const ScalarType normB = b.norm();
+      if (normB > 0.0) SolverTol *= norm0 / normB;
+    }
+    SU2_OMP_MASTER {
+      mixed_stalled = true;
+      if (SU2_MPI::GetRank() == MASTER_NODE)
+        cout << "WARNING: The mixed precision linear solver stalled, switching to full precision." << endl;
+    }
+    SU2_OMP_BARRIER
+    return false;
+  }
+
+  residual = (norm0 > 0.0)? res/norm0 : res;
+  return true;
+#endif
+}
+
 template<class ScalarType>
 unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType> & Jacobian, const CSysVector<su2double> & LinSysRes,
                                            CSysVector<su2double> & LinSysSol, CGeometry *geometry, const CConfig *config) {
@@ -773,6 +1369,8 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType> & Jacobian, co
    derivatives of the residual in CSysSolve_b.
   ---*/
 
+  CTraceScope trace("CSysSolve::Solve", "linear solver");
+
   unsigned short KindSolver, KindPrecond;
   unsigned long MaxIter, RestartIter;
   ScalarType SolverTol;
@@ -809,11 +1407,16 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType> & Jacobian, co
   if (config->GetDiscrete_Adjoint()) {
 #ifdef CODI_REVERSE_TYPE
 
-    TapeActive = AD::globalTape.isActive();
+    TapeActive = AD::getGlobalTape().isActive();
 
+    /*--- The linear solver is recorded as an external function on the tape of each thread, so that
+     *    the whole team evaluates Solve_b in the reverse sweep. The master thread owns the inputs and
+     *    outputs, the other threads only take part in the worksharing of the adjoint solve. ---*/
     AD::StartExtFunc(false, false);
 
+    SU2_OMP_MASTER
     AD::SetExtFuncIn(&LinSysRes[0], LinSysRes.GetLocSize());
+    SU2_OMP_BARRIER
 
     AD::StopRecording();
 #endif
@@ -823,70 +1426,91 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType> & Jacobian, co
 
   HandleTemporariesIn(LinSysRes, LinSysSol);
 
-  auto mat_vec = CSysMatrixVectorProduct<ScalarType>(Jacobian, geometry, config);
+  unsigned long IterLinSol = 0, IterMixed = 0;
+  ScalarType residual = 0.0, norm0 = 0.0;
   CPreconditioner<ScalarType>* precond = nullptr;
 
-  switch (KindPrecond) {
-    case JACOBI:
-      precond = new CJacobiPreconditioner<ScalarType>(Jacobian, geometry, config, false);
-      break;
-    case ILU:
-      precond = new CILUPreconditioner<ScalarType>(Jacobian, geometry, config, false);
-      break;
-    case LU_SGS:
-      precond = new CLU_SGSPreconditioner<ScalarType>(Jacobian, geometry, config);
-      break;
-    case LINELET:
-      precond = new CLineletPreconditioner<ScalarType>(Jacobian, geometry, config);
-      break;
-    case PASTIX_ILU: case PASTIX_LU_P: case PASTIX_LDLT_P:
-      precond = new CPastixPreconditioner<ScalarType>(Jacobian, geometry, config, KindPrecond, false);
-      break;
-    default:
-      precond = new CJacobiPreconditioner<ScalarType>(Jacobian, geometry, config, false);
-      break;
+  /*--- Try the mixed precision mode first, if it stalls the solve continues in full precision. ---*/
+
+  bool solved = false;
+  if (!mesh_deform && !mixed_stalled && config->GetLinear_Solver_Mixed_Precision() &&
+      (KindSolver != PASTIX_LDLT) && (KindSolver != PASTIX_LU)) {
+    solved = MixedPrecisionSolve(Jacobian, geometry, config, KindSolver, KindPrecond, MaxIter,
+                                 RestartIter, SolverTol, IterMixed, residual);
   }
 
-  /*--- Build preconditioner. ---*/
+  if (!solved) {
 
-  precond->Build();
+    /*--- After a stall, the solve continues from the refined solution with the remaining iterations,
+     *    the tolerance was converted to absolute (relative to the norm of the rhs). ---*/
 
-  /*--- Solve system. ---*/
+    MaxIter -= IterMixed;
+    const bool restoreRelative = (IterMixed > 0) && (tol_type == LinearToleranceType::RELATIVE);
+    if (restoreRelative) {
+      SU2_OMP_BARRIER
+      SU2_OMP_MASTER
+      tol_type = LinearToleranceType::ABSOLUTE;
+      SU2_OMP_BARRIER
+    }
 
-  unsigned long IterLinSol = 0;
-  ScalarType residual = 0.0, norm0 = 0.0;
+    auto mat_vec = CSysMatrixVectorProduct<ScalarType>(Jacobian, geometry, config);
+    precond = CPreconditioner<ScalarType>::Create(KindPrecond, Jacobian, geometry, config);
 
-  switch (KindSolver) {
-    case BCGSTAB:
-      IterLinSol = BCGSTAB_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual, ScreenOutput, config);
-      break;
-    case FGMRES:
-      IterLinSol = FGMRES_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual, ScreenOutput, config);
-      break;
-    case CONJUGATE_GRADIENT:
-      IterLinSol = CG_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual, ScreenOutput, config);
-      break;
-    case RESTARTED_FGMRES:
-      norm0 = LinSysRes_ptr->norm();
-      while (IterLinSol < MaxIter) {
-        /*--- Enforce a hard limit on total number of iterations ---*/
-        unsigned long IterLimit = min(RestartIter, MaxIter-IterLinSol);
-        IterLinSol += FGMRES_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, IterLimit, residual, ScreenOutput, config);
-        if ( residual <= SolverTol*norm0 ) break;
-      }
-      break;
-    case SMOOTHER:
-      IterLinSol = Smoother_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual, ScreenOutput, config);
-      break;
-    case PASTIX_LDLT : case PASTIX_LU:
-      Jacobian.BuildPastixPreconditioner(geometry, config, KindSolver);
-      Jacobian.ComputePastixPreconditioner(*LinSysRes_ptr, *LinSysSol_ptr, geometry, config);
-      IterLinSol = 1;
-      residual = 1e-20;
-      break;
-    default:
-      SU2_MPI::Error("Unknown type of linear solver.",CURRENT_FUNCTION);
+    /*--- Build preconditioner, unless the one of the previous solve is reused. ---*/
+
+    if (!reuse_precond) {
+      CTraceScope tracePrecond("Preconditioner build", "linear solver");
+      precond->Build();
+    }
+
+    /*--- Solve system. ---*/
+
+    switch (KindSolver) {
+      case BCGSTAB:
+        IterLinSol = BCGSTAB_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual, ScreenOutput, config);
+        break;
+      case FGMRES:
+        IterLinSol = FGMRES_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual, ScreenOutput, config);
+        break;
+      case CONJUGATE_GRADIENT:
+        IterLinSol = CG_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual, ScreenOutput, config);
+        break;
+      case PIPELINED_GMRES:
+        IterLinSol = PipelinedGMRES_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual, ScreenOutput, config);
+        break;
+      case PIPELINED_BCGSTAB:
+        IterLinSol = PipelinedBCGSTAB_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual, ScreenOutput, config);
+        break;
+      case RESTARTED_FGMRES:
+        norm0 = LinSysRes_ptr->norm();
+        while (IterLinSol < MaxIter) {
+          /*--- Enforce a hard limit on total number of iterations ---*/
+          unsigned long IterLimit = min(RestartIter, MaxIter-IterLinSol);
+          IterLinSol += FGMRES_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, IterLimit, residual, ScreenOutput, config);
+          if ( residual <= SolverTol*norm0 ) break;
+        }
+        break;
+      case SMOOTHER:
+        IterLinSol = Smoother_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual, ScreenOutput, config);
+        break;
+      case PASTIX_LDLT : case PASTIX_LU:
+        Jacobian.BuildPastixPreconditioner(geometry, config, KindSolver);
+        Jacobian.ComputePastixPreconditioner(*LinSysRes_ptr, *LinSysSol_ptr, geometry, config);
+        IterLinSol = 1;
+        residual = 1e-20;
+        break;
+      default:
+        SU2_MPI::Error("Unknown type of linear solver.",CURRENT_FUNCTION);
+    }
+
+    if (restoreRelative) {
+      SU2_OMP_BARRIER
+      SU2_OMP_MASTER
+      tol_type = LinearToleranceType::RELATIVE;
+      SU2_OMP_BARRIER
+    }
   }
+  IterLinSol += IterMixed;
 
   SU2_OMP_MASTER
   {
@@ -908,6 +1532,7 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType> & Jacobian, co
 
     AD::StartRecording();
 
+    SU2_OMP_MASTER
     AD::SetExtFuncOut(&LinSysSol[0], (int)LinSysSol.GetLocSize());
 
 #ifdef CODI_REVERSE_TYPE
@@ -947,6 +1572,8 @@ template<class ScalarType>
 unsigned long CSysSolve<ScalarType>::Solve_b(CSysMatrix<ScalarType> & Jacobian, const CSysVector<su2double> & LinSysRes,
                                              CSysVector<su2double> & LinSysSol, CGeometry *geometry, const CConfig *config) {
 
+  CTraceScope trace("CSysSolve::Solve_b", "linear solver");
+
   unsigned short KindSolver, KindPrecond;
   unsigned long MaxIter, RestartIter, IterLinSol = 0;
   ScalarType SolverTol, Norm0 = 0.0;
@@ -1014,6 +1641,12 @@ unsigned long CSysSolve<ScalarType>::Solve_b(CSysMatrix<ScalarType> & Jacobian,
     case CONJUGATE_GRADIENT:
       IterLinSol = CG_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, Residual, ScreenOutput, config);
       break;
+    case PIPELINED_GMRES:
+      IterLinSol = PipelinedGMRES_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, Residual, ScreenOutput, config);
+      break;
+    case PIPELINED_BCGSTAB:
+      IterLinSol = PipelinedBCGSTAB_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, Residual, ScreenOutput, config);
+      break;
     case RESTARTED_FGMRES:
       IterLinSol = 0;
       Norm0 = LinSysRes_ptr->norm();
@@ -1050,4 +1683,7 @@ unsigned long CSysSolve<ScalarType>::Solve_b(CSysMatrix<ScalarType> & Jacobian,
 template class CSysSolve<su2double>;
 #else
 template class CSysSolve<su2mixedfloat>;
+#ifdef USE_RUNTIME_MIXED_PRECISION
+template class CSysSolve<float>;
+#endif
 #endif
@@ -29,11 +29,12 @@
 #include "../../include/linear_algebra/CSysSolve.hpp"
 #include "../../include/linear_algebra/CSysMatrix.hpp"
 #include "../../include/linear_algebra/CSysVector.hpp"
+#include "../../include/parallelization/omp_structure.hpp"
 
 #ifdef CODI_REVERSE_TYPE
 template<class ScalarType>
-void CSysSolve_b<ScalarType>::Solve_b(const codi::RealReverse::Real* x, codi::RealReverse::Real* x_b, size_t m,
-                                      const codi::RealReverse::Real* y, const codi::RealReverse::Real* y_b, size_t n,
+void CSysSolve_b<ScalarType>::Solve_b(const su2double::Real* x, su2double::Real* x_b, size_t m,
+                                      const su2double::Real* y, const su2double::Real* y_b, size_t n,
                                       codi::DataStore* d) {
 
   CSysVector<su2double>* LinSysRes_b = nullptr;
@@ -54,16 +55,22 @@ void CSysSolve_b<ScalarType>::Solve_b(const codi::RealReverse::Real* x, codi::Re
   CSysSolve<ScalarType>* solver = nullptr;
   d->getData(solver);
 
+  /*--- This is called by all threads of the team that recorded the solve (see CSysSolve::Solve), only
+   *    the master thread has inputs and outputs (n > 0), the others take part in the adjoint solve. ---*/
+
   /*--- Initialize the right-hand side with the gradient of the solution of the primal linear system ---*/
 
+  SU2_OMP_BARRIER
   for (unsigned long i = 0; i < n; i++) {
     (*LinSysRes_b)[i] = y_b[i];
     (*LinSysSol_b)[i] = 0.0;
   }
+  SU2_OMP_BARRIER
 
   solver->Solve_b(*Jacobian, *LinSysRes_b, *LinSysSol_b, geometry, config);
 
-  for (unsigned long i = 0; i < n; i ++) {
+  SU2_OMP_BARRIER
+  for (unsigned long i = 0; i < m; i ++) {
     x_b[i] = SU2_TYPE::GetValue(LinSysSol_b->operator [](i));
   }
 
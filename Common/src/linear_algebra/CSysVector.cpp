@@ -73,3 +73,7 @@ template class CSysVector<su2double>;
 /*--- In reverse AD (or with mixed precision) we will also have passive (or float) vectors. ---*/
 template class CSysVector<su2mixedfloat>;
 #endif
+#ifdef USE_RUNTIME_MIXED_PRECISION
+/*--- Float vectors for the mixed precision mode of CSysSolve. ---*/
+template class CSysVector<float>;
+#endif
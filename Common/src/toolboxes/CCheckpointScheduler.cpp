@@ -0,0 +1,195 @@
+/*!
+ * \file CCheckpointScheduler.cpp
+ * \brief Implementation of the binomial checkpointing schedule.
+ * \author SU2 Developers
+ * \version 7.1.0 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/toolboxes/CCheckpointScheduler.hpp"
+#include "../../include/parallelization/mpi_structure.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <limits>
+
+using namespace std;
+
+CCheckpointScheduler::CCheckpointScheduler(unsigned long nMemorySlots, unsigned long nDiskSlots,
+                                           string diskFileName) :
+  nMemory(nMemorySlots),
+  nDisk(nDiskSlots),
+  fileName(move(diskFileName)),
+  lastRequest(numeric_limits<long>::max()),
+  memorySlots(nMemorySlots) {
+  stack.reserve(nMemory + nDisk);
+}
+
+CCheckpointScheduler::~CCheckpointScheduler() {
+  for (auto slot = 0ul; slot < nDisk; ++slot) remove(SlotFileName(slot).c_str());
+}
+
+string CCheckpointScheduler::SlotFileName(unsigned long slot) const {
+  return fileName + "_" + to_string(SU2_MPI::GetRank()) + "_" + to_string(slot) + ".dat";
+}
+
+unsigned long CCheckpointScheduler::Beta(unsigned long n, long k) {
+  if (k < 0) return 0;
+
+  /*--- C(n+k, n) = prod_{i=1}^{min} (max+i)/i, exact at each step. ---*/
+  const auto kk = static_cast<unsigned long>(k);
+  const auto lo = min(n, kk), hi = max(n, kk);
+  const auto maxVal = numeric_limits<unsigned long>::max();
+
+  unsigned long result = 1;
+  for (auto i = 1ul; i <= lo; ++i) {
+    const auto num = hi + i;
+    if (result > maxVal / num) return maxVal;
+    result = result * num / i;
+  }
+  return result;
+}
+
+unsigned long CCheckpointScheduler::OptimalSplit(unsigned long nSteps, unsigned long nSnapshots) {
+  /*--- Count the initial state as a snapshot, find the repetition number "r" such that
+   *    Beta(c,r-1) < nSteps <= Beta(c,r). Any split in [Beta(c,r-2), Beta(c,r-1)] that leaves
+   *    [Beta(c-1,r-1), Beta(c-1,r)] steps to the right is optimal, take the largest. ---*/
+  const auto c = nSnapshots + 1;
+  long r = 0;
+  while (Beta(c, r) < nSteps) ++r;
+
+  return min(Beta(c, r-1), nSteps - Beta(c-1, r-1));
+}
+
+unsigned long CCheckpointScheduler::MinimumAdvances(unsigned long nSteps, unsigned long nSnapshots) {
+  if (nSteps <= 1) return 0;
+  if (nSnapshots == 0) return nSteps * (nSteps-1) / 2;
+
+  const auto c = nSnapshots + 1;
+  long r = 0;
+  while (Beta(c, r) < nSteps) ++r;
+
+  return r * nSteps - Beta(c+1, r-1);
+}
+
+vector<CCheckpointScheduler::Operation> CCheckpointScheduler::Request(long step) {
+
+  if (step < 0 || step >= lastRequest) {
+    SU2_MPI::Error("Checkpointed states must be requested in decreasing order.", CURRENT_FUNCTION);
+  }
+  lastRequest = step;
+  ++stats.requests;
+
+  vector<Operation> schedule;
+
+  /*--- Release the snapshots of states that were already used. ---*/
+  while (!stack.empty() && stack.back() > step) stack.pop_back();
+
+  /*--- Exact hit, release the slot since the state is not needed again. ---*/
+  if (!stack.empty() && stack.back() == step) {
+    schedule.push_back({Action::RESTORE, step, stack.size()-1});
+    stack.pop_back();
+    return schedule;
+  }
+
+  /*--- Restore the nearest state and advance, storing snapshots at the binomial split points of the
+   *    remaining interval. Later requests find these snapshots on the top of the stack. ---*/
+  long current = -1;
+  if (stack.empty()) {
+    schedule.push_back({Action::RESTORE_INITIAL, current, 0});
+  }
+  else {
+    current = stack.back();
+    schedule.push_back({Action::RESTORE, current, stack.size()-1});
+  }
+
+  while (current < step) {
+    const auto length = static_cast<unsigned long>(step - current);
+    const auto nFree = GetnSlots() - stack.size();
+
+    long next = step;
+    if (nFree > 0 && length > 1) {
+      next = min(step, current + long(OptimalSplit(length+1, nFree)));
+    }
+    stats.advances += next - current;
+    schedule.push_back({Action::ADVANCE, next, 0});
+    current = next;
+
+    if (current < step) {
+      schedule.push_back({Action::STORE, current, stack.size()});
+      stack.push_back(current);
+    }
+  }
+  stats.maxSlotsUsed = max<unsigned long>(stats.maxSlotsUsed, stack.size());
+
+  return schedule;
+}
+
+void CCheckpointScheduler::Save(unsigned long slot, const vector<passivedouble>& data) {
+
+  if (IsOnDisk(slot)) {
+    const auto start = SU2_MPI::Wtime();
+
+    ofstream file(SlotFileName(slot), ios::binary | ios::trunc);
+    const auto size = static_cast<unsigned long>(data.size());
+    file.write(reinterpret_cast<const char*>(&size), sizeof(size));
+    file.write(reinterpret_cast<const char*>(data.data()), size*sizeof(passivedouble));
+    if (!file.good()) {
+      SU2_MPI::Error("Could not write checkpoint file " + SlotFileName(slot), CURRENT_FUNCTION);
+    }
+
+    ++stats.storesDisk;
+    stats.bytesDisk += size*sizeof(passivedouble);
+    stats.timeDisk += SU2_MPI::Wtime() - start;
+  }
+  else {
+    memorySlots[slot-nDisk] = data;
+
+    ++stats.storesMemory;
+    passivedouble bytes = 0.0;
+    for (const auto& buffer : memorySlots) bytes += buffer.size()*sizeof(passivedouble);
+    stats.bytesMemory = max(stats.bytesMemory, bytes);
+  }
+}
+
+void CCheckpointScheduler::Load(unsigned long slot, vector<passivedouble>& data) {
+
+  if (IsOnDisk(slot)) {
+    const auto start = SU2_MPI::Wtime();
+
+    ifstream file(SlotFileName(slot), ios::binary);
+    unsigned long size = 0;
+    file.read(reinterpret_cast<char*>(&size), sizeof(size));
+    data.resize(size);
+    file.read(reinterpret_cast<char*>(data.data()), size*sizeof(passivedouble));
+    if (!file.good()) {
+      SU2_MPI::Error("Could not read checkpoint file " + SlotFileName(slot), CURRENT_FUNCTION);
+    }
+
+    ++stats.restoresDisk;
+    stats.timeDisk += SU2_MPI::Wtime() - start;
+  }
+  else {
+    data = memorySlots[slot-nDisk];
+    ++stats.restoresMemory;
+  }
+}
@@ -0,0 +1,155 @@
+/*!
+ * \file CPerformanceTracer.cpp
+ * \brief Implementation of the performance tracer.
+ * \author SU2 Developers
+ * \version 7.1.0 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/toolboxes/CPerformanceTracer.hpp"
+#include "../../include/option_structure.hpp"
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <iostream>
+
+bool CPerformanceTracer::enabled = false;
+bool CPerformanceTracer::waitTimer = false;
+passivedouble CPerformanceTracer::waitTime = 0.0;
+passivedouble CPerformanceTracer::origin = 0.0;
+unsigned long CPerformanceTracer::maxEvents = 0;
+std::vector<CPerformanceTracer::ThreadBuffer> CPerformanceTracer::buffers;
+
+namespace {
+/*--- Names are usually literals, but escape them anyway to always produce valid JSON. ---*/
+std::string JSONEscape(const char* str) {
+  std::string out;
+  for (; *str; ++str) {
+    switch (*str) {
+      case '"':  out += "\\\""; break;
+      case '\\': out += "\\\\"; break;
+      case '\n': out += "\\n";  break;
+      case '\t': out += "\\t";  break;
+      default:   out += *str;   break;
+    }
+  }
+  return out;
+}
+}
+
+void CPerformanceTracer::Initialize(unsigned long maxEventsPerThread) {
+
+  maxEvents = maxEventsPerThread;
+
+  /*--- Reserve all the memory upfront so that recording never allocates. ---*/
+
+  buffers.clear();
+  buffers.resize(omp_get_max_threads());
+  for (auto& buffer : buffers) buffer.events.reserve(maxEvents);
+
+  /*--- Synchronize the ranks so that their timelines are (approximately) aligned. ---*/
+
+  SU2_MPI::Barrier(MPI_COMM_WORLD);
+  origin = SU2_MPI::Wtime();
+  enabled = true;
+}
+
+void CPerformanceTracer::AddEvent(const char* name, const char* category, passivedouble start, passivedouble end) {
+
+  const auto thread = omp_get_thread_num();
+  if (thread >= static_cast<int>(buffers.size())) return;
+
+  auto& buffer = buffers[thread];
+  if (buffer.events.size() < maxEvents) buffer.events.push_back({name, category, start, end});
+  else buffer.nDropped++;
+}
+
+void CPerformanceTracer::WriteTrace(const std::string& fileName) {
+
+  if (!enabled) return;
+  enabled = false;
+
+  int rank = 0, size = 1;
+  SU2_MPI::Comm_rank(MPI_COMM_WORLD, &rank);
+  SU2_MPI::Comm_size(MPI_COMM_WORLD, &size);
+
+  /*--- Format the events of this rank, times in microseconds. ---*/
+
+  std::ostringstream trace;
+  trace << std::fixed << std::setprecision(3);
+
+  trace << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << rank << ",\"tid\":0,"
+        << "\"args\":{\"name\":\"Rank " << rank << "\"}}";
+
+  unsigned long nDropped = 0;
+
+  for (auto thread = 0ul; thread < buffers.size(); ++thread) {
+    const auto& buffer = buffers[thread];
+    nDropped += buffer.nDropped;
+    if (buffer.events.empty()) continue;
+
+    trace << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" << rank << ",\"tid\":" << thread
+          << ",\"args\":{\"name\":\"Thread " << thread << "\"}}";
+
+    for (const auto& event : buffer.events) {
+      trace << ",\n{\"name\":\"" << JSONEscape(event.name) << "\",\"cat\":\"" << JSONEscape(event.category)
+            << "\",\"ph\":\"X\",\"ts\":" << event.start*1e6 << ",\"dur\":" << (event.end-event.start)*1e6
+            << ",\"pid\":" << rank << ",\"tid\":" << thread << "}";
+    }
+  }
+
+  /*--- Release the memory. ---*/
+
+  std::vector<ThreadBuffer>().swap(buffers);
+
+  /*--- The ranks append their events to the file in turn. ---*/
+
+  for (int iRank = 0; iRank < size; ++iRank) {
+    if (rank == iRank) {
+      std::ofstream file;
+      if (rank == MASTER_NODE) {
+        file.open(fileName);
+        file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+      }
+      else {
+        file.open(fileName, std::ios::app);
+        file << ",\n";
+      }
+      if (!file.is_open()) {
+        SU2_MPI::Error(std::string("Unable to open the trace file ") + fileName, CURRENT_FUNCTION);
+      }
+      file << trace.str();
+      if (rank == size-1) file << "\n]}\n";
+    }
+    SU2_MPI::Barrier(MPI_COMM_WORLD);
+  }
+
+  unsigned long nDroppedGlobal = nDropped;
+  SU2_MPI::Allreduce(&nDropped, &nDroppedGlobal, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+
+  if (rank == MASTER_NODE) {
+    std::cout << "Performance trace written to " << fileName << ".";
+    if (nDroppedGlobal > 0)
+      std::cout << " " << nDroppedGlobal << " events were dropped, increase PERFORMANCE_TRACE_BUFFER.";
+    std::cout << std::endl;
+  }
+}
@@ -29,6 +29,8 @@
 #pragma once
 #include "CSinglezoneDriver.hpp"
 
+class CCheckpointScheduler;
+
 /*!
  * \class CDiscAdjSinglezoneDriver
  * \brief Class for driving single-zone adjoint solvers.
@@ -56,6 +58,36 @@ protected:
 
   COutputLegacy* output_legacy;
 
+  CCheckpointScheduler* checkpoints = nullptr;  /*!< \brief Provides the primal states of unsteady adjoints. */
+  vector<unsigned short> checkpointSolvers;     /*!< \brief Solvers whose states are stored in the snapshots. */
+  vector<passivedouble> checkpointBuffer;       /*!< \brief Packed primal state. */
+  vector<passivedouble> initialState;           /*!< \brief Packed initial condition of the primal simulation. */
+  COutput* recompute_output = nullptr;          /*!< \brief Monitors the recomputed primal steps (does not write). */
+
+  /*!
+   * \brief Set the primal state (solution and previous time levels) of a time step, recomputing it from the
+   *        snapshots of the checkpointing schedule.
+   * \param[in] step - Index of the primal time step.
+   */
+  void SetPrimalState(long step);
+
+  /*!
+   * \brief Run one primal time step, starting from the state of the previous step.
+   * \param[in] step - Index of the primal time step.
+   */
+  void AdvancePrimal(long step);
+
+  /*!
+   * \brief Copy the primal state of the checkpointed solvers to/from the buffer.
+   */
+  void PackPrimalState();
+  void UnpackPrimalState();
+
+  /*!
+   * \brief Update the auxiliary variables after the primal state is set.
+   */
+  void PreprocessPrimalState();
+
 public:
 
   /*!
@@ -90,6 +122,11 @@ public:
    */
   void Postprocess(void) override;
 
+  /*!
+   * \brief Print the statistics of the solvers and of the unsteady adjoint checkpointing.
+   */
+  void PrintStatistics() override;
+
   /*!
    * \brief Record one iteration of a flow iteration in within multiple zones.
    * \param[in] kind_recording - Type of recording (full list in ENUM_RECORDING, option_structure.hpp)
@@ -330,6 +330,11 @@ public:
    */
   void Postprocessing();
 
+  /*!
+   * \brief Print the statistics gathered during the run, called by Postprocessing before deallocation.
+   */
+  virtual void PrintStatistics();
+
   /*!
    * \brief A virtual member.
    */
@@ -160,6 +160,21 @@ public:
    * \brief Compute translational and vibrational temperatures vector.
    */
   virtual vector<su2double>& ComputeTemperatures(vector<su2double>& val_rhos, su2double rhoEmix, su2double rhoEve, su2double rhoEvel) = 0;
+
+  /*!
+   * \brief Compute the translational and vibrational temperatures of a batch of points.
+   * \note The default calls ComputeTemperatures for each point, the state of the model is not defined afterwards.
+   * \param[in] nPoint - Number of points in the batch.
+   * \param[in] val_rhos - Species densities, species-major (val_rhos[iSpecies*nPoint+iPoint]).
+   * \param[in] rhoEmix - Total energies per unit volume.
+   * \param[in] rhoEve - Vibrational-electronic energies per unit volume.
+   * \param[in] rhoEvel - Kinetic energies per unit volume.
+   * \param[out] val_T - Translational-rotational temperatures.
+   * \param[out] val_Tve - Vibrational-electronic temperatures.
+   */
+  virtual void ComputeBatchTemperatures(unsigned long nPoint, const su2double* val_rhos, const su2double* rhoEmix,
+                                        const su2double* rhoEve, const su2double* rhoEvel, su2double* val_T,
+                                        su2double* val_Tve);
   
   /*!
    * \brief Compute speed of sound.
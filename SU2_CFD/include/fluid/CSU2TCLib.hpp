@@ -61,17 +61,25 @@ private:
   Particle_Mass,                  /*!< \brief Mass of all particles present in the plasma */
   MolarFracWBE,                   /*!< \brief Molar fractions to be used in Wilke/Blottner/Eucken model */
   phis, mus,                      /*!< \brief Auxiliary vectors to be used in Wilke/Blottner/Eucken model */
-  A;                              /*!< \brief Auxiliary vector to be used in net production rate computation */
+  A,                              /*!< \brief Auxiliary vector to be used in net production rate computation */
+  eve_eq;                         /*!< \brief Auxiliary vector of equilibrium vib-el energies for the source term */
 
   su2activematrix CharElTemp,    /*!< \brief Characteristic temperature of electron states. */
   ElDegeneracy,                  /*!< \brief Degeneracy of electron states. */
   RxnConstantTable,              /*!< \brief Table of chemical equiibrium reaction constants */
+  MillikanWhiteA,                /*!< \brief Millikan & White relaxation coefficient A_sr of each species pair. */
+  MillikanWhiteB,                /*!< \brief Millikan & White relaxation coefficient B_sr of each species pair. */
   Blottner,                      /*!< \brief Blottner viscosity coefficients */
   Dij;                           /*!< \brief Binary diffusion coefficients. */
   
+  vector<su2activematrix> RxnConstantTables; /*!< \brief Equilibrium constants of each reaction, set once by the constructor. */
+
   C3DDoubleMatrix Omega00,       /*!< \brief Collision integrals (Omega(0,0)) */
   Omega11;                       /*!< \brief Collision integrals (Omega(1,1)) */
 
+  vector<su2double> BatchWork;   /*!< \brief Work arrays of ComputeBatchTemperatures. */
+  vector<int> BatchConverged;    /*!< \brief Convergence flags of the bisection in ComputeBatchTemperatures. */
+
 public:
 
   /*!
@@ -152,8 +160,23 @@ public:
    */
   vector<su2double>& ComputeTemperatures(vector<su2double>& val_rhos, su2double rhoEmix, su2double rhoEve, su2double rhoEvel) final;
 
+  /*!
+   * \brief Compute translational and vibrational temperatures of a batch of points, the bisections of all
+   *        points advance together (same results as ComputeTemperatures, the state of the model is not changed).
+   */
+  void ComputeBatchTemperatures(unsigned long nPoint, const su2double* val_rhos, const su2double* rhoEmix,
+                                const su2double* rhoEve, const su2double* rhoEvel, su2double* val_T,
+                                su2double* val_Tve) final;
+
   private:
 
+  /*!
+   * \brief V-E energy of one species.
+   * \param[in] iSpecies - Species index.
+   * \param[in] val_T - Vibrational-electronic temperature.
+   */
+  su2double SpeciesEve(unsigned short iSpecies, su2double val_T) const;
+
   /*!
   * \brief Set equilibrium reaction constants for finite-rate chemistry
   */
@@ -161,10 +184,26 @@ public:
 
   /*!
    * \brief Calculates constants used for Keq correlation.
-   * \param[out] A - Reference to coefficient array.
    * \param[in] val_reaction - Reaction number indicator.
+   * \param[in] N - Mixture number density [1/cm^3].
+   */
+  void ComputeKeqConstants(unsigned short val_Reaction, su2double N);
+
+  /*!
+   * \brief Evaluate the Gupta-Yos curve fit of a collision cross section.
+   * \param[in] Omega - Collision integral coefficients (Omega00 or Omega11).
+   * \param[in] iSpecies - Index of the first species of the pair.
+   * \param[in] jSpecies - Index of the second species of the pair.
+   * \param[in] val_T - Temperature of the collision.
+   * \param[in] lnT - Natural logarithm of val_T, computed once by the caller for all pairs.
+   * \return Collision cross section [m^2].
    */
-  void ComputeKeqConstants(unsigned short val_Reaction);
+  inline su2double CollisionCrossSection(const C3DDoubleMatrix& Omega, unsigned short iSpecies,
+                                         unsigned short jSpecies, su2double val_T, su2double lnT) const {
+    return 1E-20 * Omega(iSpecies,jSpecies,3) * pow(val_T, Omega(iSpecies,jSpecies,0)*lnT*lnT
+                                                        + Omega(iSpecies,jSpecies,1)*lnT
+                                                        + Omega(iSpecies,jSpecies,2));
+  }
 
   /*!
    * \brief Get species diffusion coefficients with Wilke/Blottner/Eucken transport model.
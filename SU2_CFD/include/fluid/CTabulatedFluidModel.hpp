@@ -0,0 +1,257 @@
+/*!
+ * \file CTabulatedFluidModel.hpp
+ * \brief Defines a fluid model that interpolates the thermodynamic state from a look-up table.
+ * \author SU2 Developers
+ * \version 7.1.0 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <functional>
+#include <vector>
+
+#include "CFluidModel.hpp"
+
+/*!
+ * \class CTabulatedFluidModel
+ * \brief Fluid model that replaces the evaluations of an "exact" model (ideal gas, Van der Waals, Peng-Robinson)
+ *        by bilinear interpolation in a structured (rho,e) table.
+ * \note The table is read-only and shared by all instances (one per thread), each instance owns an exact model
+ *       which is used to build the table, and to evaluate the states outside of it. The (P,rho) and (rho,T) pairs
+ *       are inverted along lines of constant density, the (P,T), (h,s), and (P,s) pairs with Newton iterations
+ *       on the interpolated state.
+ * \author SU2 Developers
+ */
+class CTabulatedFluidModel final : public CFluidModel {
+ public:
+  /*!
+   * \brief Tabulated quantities, the nodal data is padded to BLOCK_SIZE for alignment to cache lines.
+   */
+  enum : int {
+    P_VAR, T_VAR, C2_VAR, S_VAR, DPDRHO_E, DPDE_RHO, DTDRHO_E, DTDE_RHO,
+    DHDRHO_P, DHDP_RHO, DSDRHO_P, DSDP_RHO, CP_VAR, CV_VAR, VALID_NODE, N_VAR,
+    BLOCK_SIZE = 16
+  };
+  static_assert(int(N_VAR) <= int(BLOCK_SIZE), "Too many tabulated variables.");
+
+  /*!
+   * \brief Type of the nodal data, single precision makes a node one cache line (64 bytes), the
+   *        round-off is well below the interpolation error.
+   */
+  using TableFloat = float;
+
+  /*!
+   * \brief Uniform (rho,e) table, node-major storage so that the 4 corners of a cell are 2 contiguous chunks.
+   */
+  struct CTable {
+    unsigned long nRho = 0, nEnergy = 0;   /*!< \brief Number of nodes in each direction. */
+    passivedouble rhoMin = 0.0, rhoMax = 0.0, eMin = 0.0, eMax = 0.0;
+    passivedouble invDeltaRho = 0.0, invDeltaE = 0.0;
+    passivedouble lastRho = 0.0, lastEnergy = 0.0; /*!< \brief Index of the last nodes, as reals for the bounds checks. */
+    passivedouble maxErrorP = 0.0, maxErrorT = 0.0; /*!< \brief Max. relative errors at the cell centers. */
+    vector<TableFloat> data;
+    vector<passivedouble> columnEnds;      /*!< \brief P and T at the first and last energy node of each density. */
+
+    const TableFloat* node(unsigned long iRho, unsigned long iEnergy) const {
+      return &data[(iRho*nEnergy + iEnergy)*BLOCK_SIZE];
+    }
+    TableFloat* node(unsigned long iRho, unsigned long iEnergy) {
+      return &data[(iRho*nEnergy + iEnergy)*BLOCK_SIZE];
+    }
+    /*!
+     * \brief Values of P_VAR or T_VAR at the first and last energy node of a density node.
+     */
+    const passivedouble* columnEnd(int iVar, unsigned long iRho) const {
+      return &columnEnds[(2*iRho + (iVar == T_VAR))*2];
+    }
+    /*!
+     * \brief Set the column ends from the nodal data.
+     */
+    void SetColumnEnds();
+  };
+
+  /*!
+   * \brief Usage statistics of an instance.
+   */
+  struct CStatistics {
+    unsigned long hits = 0;       /*!< \brief Evaluations answered by the table. */
+    unsigned long misses = 0;     /*!< \brief Evaluations outside the table, answered by the exact model. */
+    unsigned long delegated = 0;  /*!< \brief Evaluations of non-tabulated quantities (NRBC derivatives). */
+    unsigned long samples = 0;    /*!< \brief Number of comparisons against the exact model. */
+    passivedouble maxErrorP = 0.0, maxErrorT = 0.0;  /*!< \brief Max. relative errors of the samples. */
+    passivedouble sumErrorP = 0.0, sumErrorT = 0.0;  /*!< \brief Sum of relative errors of the samples. */
+
+    CStatistics& operator+= (const CStatistics& other);
+  };
+
+  using FactoryType = std::function<CFluidModel*()>;
+
+ private:
+  shared_ptr<const CTable> Table;     /*!< \brief The shared look-up table. */
+  unique_ptr<CFluidModel> ExactModel; /*!< \brief Model used outside the table and for non-tabulated pairs. */
+  unsigned long ErrorSampling;        /*!< \brief Compare every N-th hit against the exact model. */
+  unsigned long HitsToSample;         /*!< \brief Hits left until the next comparison. */
+  CStatistics Stats;
+
+  /*!
+   * \brief Locate the cell containing (rho,e), and compute the normalized coordinates in it.
+   * \return False if the point is outside the table.
+   */
+  bool FindCell(su2double rho, su2double e, unsigned long& iRho, unsigned long& iEnergy,
+                su2double& fRho, su2double& fEnergy) const;
+
+  /*!
+   * \brief Set the state by interpolation in a cell, given the normalized coordinates in it.
+   * \tparam Float - Precision of the arithmetic, the Newton iterations need a smooth (double) interpolation.
+   * \return False if a node of the cell is not valid.
+   */
+  template<class Float>
+  bool InterpolateCell(unsigned long iRho, unsigned long iEnergy, su2double fRho, su2double fEnergy,
+                       su2double rho, su2double e);
+
+  /*!
+   * \brief Set the state from the table, without error sampling or statistics.
+   * \return False if the point is not in a valid cell of the table.
+   */
+  template<class Float>
+  bool Interpolate(su2double rho, su2double e);
+
+  /*!
+   * \brief Set the state from the table, for a density and a value of P_VAR or T_VAR (the energy is found
+   *        along the line of constant density, the variables must increase monotonically with energy).
+   * \return False if the value is not bracketed by the table.
+   */
+  bool InterpolateInverse(int iVar, su2double rho, su2double value);
+
+  /*!
+   * \brief Find the state for a pair of inputs by Newton iterations on (rho,e), starting from the current state.
+   * \param[in] pair - Which input pair, see the implementation.
+   * \return False if the iterations did not converge or left the table.
+   */
+  bool SolveState(int pair, su2double x1, su2double x2);
+
+  /*!
+   * \brief Copy the state of the exact model.
+   */
+  void CopyExactState();
+
+  /*!
+   * \brief Count a table hit, and periodically compare the current state with the exact model.
+   */
+  void CountHit();
+
+  /*!
+   * \brief Check that a table was generated from a model equivalent to the exact one.
+   */
+  static bool IsCompatible(const CTable& table, CFluidModel& model);
+
+ public:
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] table - Look-up table, see BuildTable.
+   * \param[in] exactModel - Model that the table approximates (ownership is taken).
+   * \param[in] errorSampling - Compare every N-th evaluation against the exact model (0 disables).
+   */
+  CTabulatedFluidModel(shared_ptr<const CTable> table, CFluidModel* exactModel, unsigned long errorSampling = 0);
+
+  /*!
+   * \brief Build, or load from file, the table of a model over a range of density and temperature.
+   * \note Must be called outside of parallel regions (it opens one) by all MPI ranks.
+   * \param[in] factory - Creates instances of the exact model (one per thread is created).
+   * \param[in] rhoRange - Density range.
+   * \param[in] TRange - Temperature range, converted to an energy range with the exact model.
+   * \param[in] nRho - Number of nodes in the density direction.
+   * \param[in] nEnergy - Number of nodes in the energy direction.
+   * \param[in] fileName - If not empty, the table is read from it when compatible, otherwise it is written to it.
+   * \return The table, which is reused between calls with the same arguments.
+   */
+  static shared_ptr<const CTable> BuildTable(const FactoryType& factory, const su2double* rhoRange,
+                                             const su2double* TRange, unsigned long nRho,
+                                             unsigned long nEnergy, const string& fileName);
+
+  /*!
+   * \brief Get the usage statistics of this instance.
+   */
+  const CStatistics& GetStatistics() const { return Stats; }
+
+  /*!
+   * \brief Get the table.
+   */
+  const CTable& GetTable() const { return *Table; }
+
+  /*!
+   * \brief Set the Dimensionless State using Density and Internal Energy.
+   * \param[in] rho - first thermodynamic variable.
+   * \param[in] e - second thermodynamic variable.
+   */
+  void SetTDState_rhoe(su2double rho, su2double e) override;
+
+  /*!
+   * \brief Set the Dimensionless State using Pressure and Temperature.
+   * \param[in] P - first thermodynamic variable.
+   * \param[in] T - second thermodynamic variable.
+   */
+  void SetTDState_PT(su2double P, su2double T) override;
+
+  /*!
+   * \brief Set the Dimensionless State using Pressure and Density.
+   * \param[in] P - first thermodynamic variable.
+   * \param[in] rho - second thermodynamic variable.
+   */
+  void SetTDState_Prho(su2double P, su2double rho) override;
+
+  /*!
+   * \brief Set the Dimensionless Internal Energy using Pressure and Density.
+   * \param[in] P - first thermodynamic variable.
+   * \param[in] rho - second thermodynamic variable.
+   */
+  void SetEnergy_Prho(su2double P, su2double rho) override;
+
+  /*!
+   * \brief Set the Dimensionless State using Enthalpy and Entropy.
+   * \param[in] h - first thermodynamic variable.
+   * \param[in] s - second thermodynamic variable.
+   */
+  void SetTDState_hs(su2double h, su2double s) override;
+
+  /*!
+   * \brief Set the Dimensionless State using Density and Temperature.
+   * \param[in] rho - first thermodynamic variable.
+   * \param[in] T - second thermodynamic variable.
+   */
+  void SetTDState_rhoT(su2double rho, su2double T) override;
+
+  /*!
+   * \brief Set the Dimensionless State using Pressure and Entropy.
+   * \param[in] P - first thermodynamic variable.
+   * \param[in] s - second thermodynamic variable.
+   */
+  void SetTDState_Ps(su2double P, su2double s) override;
+
+  /*!
+   * \brief Compute the derivatives needed by the NRBC (not tabulated).
+   * \param[in] P - first thermodynamic variable.
+   * \param[in] rho - second thermodynamic variable.
+   */
+  void ComputeDerivativeNRBC_Prho(su2double P, su2double rho) override;
+};
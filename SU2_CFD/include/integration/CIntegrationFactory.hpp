@@ -44,9 +44,11 @@ public:
    * \brief Create the integration container based on the current main solver
    * \param[in] kindSolver       - The kind of main solver
    * \param[in] solver_container - The solver container
+   * \param[in] config           - Definition of the particular problem
    * \return                  - Pointer to the allocated integration container
    */
-  static CIntegration** CreateIntegrationContainer(ENUM_MAIN_SOLVER kindSolver, const CSolver * const *solver_container);
+  static CIntegration** CreateIntegrationContainer(ENUM_MAIN_SOLVER kindSolver, const CSolver * const *solver_container,
+                                                   const CConfig *config);
 
   /*!
    * \brief Create a new integration instance based on the current sub solver
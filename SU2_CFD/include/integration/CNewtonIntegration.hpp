@@ -0,0 +1,149 @@
+/*!
+ * \file CNewtonIntegration.hpp
+ * \brief Declaration of the Jacobian-free Newton-Krylov integration class.
+ * \author SU2 Developers
+ * \version 7.1.0 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <memory>
+
+#include "CIntegration.hpp"
+#include "../../../Common/include/linear_algebra/CMatrixVectorProduct.hpp"
+#include "../../../Common/include/linear_algebra/CPreconditioner.hpp"
+#include "../../../Common/include/linear_algebra/CSysSolve.hpp"
+
+/*!
+ * \class CNewtonIntegration
+ * \brief Jacobian-free Newton-Krylov integration of the (fine grid) flow equations.
+ * \note The Jacobian of the complete residual is applied by finite differences of the residual evaluation,
+ *       the approximate Jacobian assembled by the solver (e.g. first order) is only used as preconditioner.
+ *       Each Newton step solves (V/dt + dR/dU) dU = -R(U) with FGMRES to a relative tolerance given by the
+ *       Eisenstat-Walker forcing terms. The steps are globalized by pseudo-transient continuation (V/dt, with
+ *       the usual CFL adaptation) and a backtracking line search on the norm of the residual.
+ *       A number of standard (defect-correction) iterations is performed before switching to Newton steps.
+ *       The other solvers (e.g. turbulence) are frozen during the Newton steps.
+ * \author SU2 Developers
+ */
+class CNewtonIntegration final : public CIntegration {
+public:
+#ifndef CODI_FORWARD_TYPE
+  using Scalar = su2mixedfloat;
+#else
+  using Scalar = su2double;
+#endif
+
+private:
+  /*!
+   * \brief Matrix-free Jacobian-vector product, see MatrixFreeProduct.
+   */
+  class CNewtonProduct final : public CMatrixVectorProduct<Scalar> {
+  private:
+    CNewtonIntegration* const newton;
+  public:
+    explicit CNewtonProduct(CNewtonIntegration* ptr) : newton(ptr) {}
+
+    inline void operator()(const CSysVector<Scalar> & u, CSysVector<Scalar> & v) const override {
+      newton->MatrixFreeProduct(u, v);
+    }
+  };
+
+  enum : size_t {OMP_MIN_SIZE = 32};  /*!< \brief Chunk size for small loops. */
+  enum : size_t {OMP_MAX_SIZE = 512}; /*!< \brief Maximum chunk size used in parallel for loops. */
+
+  /*--- Problem being solved, set at the start of each iteration. ---*/
+  CGeometry* geometry = nullptr;
+  CSolver** solvers = nullptr;
+  CSolver* solver = nullptr;
+  CNumerics** numerics = nullptr;
+  CConfig* config = nullptr;
+
+  unsigned long omp_chunk_size = OMP_MIN_SIZE;
+
+  bool setupDone = false;           /*!< \brief The vectors have been allocated. */
+  bool newtonActive = false;        /*!< \brief The startup iterations of the current time step are done. */
+  su2double startupResidual = 0.0;  /*!< \brief Reference residual for the startup iterations. */
+
+  su2double forcing = 0.0;          /*!< \brief Current forcing term (relative tolerance of the Krylov solver). */
+  su2double residualNorm = 0.0;     /*!< \brief Norm of the residual at the start of the current Newton step. */
+  su2double residualNormOld = 0.0;  /*!< \brief Norm of the residual at the start of the previous Newton step. */
+  su2double solutionNorm = 0.0;     /*!< \brief Norm of the solution at the start of the current Newton step. */
+
+  CSysVector<su2double> residual0;  /*!< \brief Residual at the start of the Newton step. */
+  CSysVector<Scalar> rhs, update;   /*!< \brief Right hand side and solution of the Newton system. */
+  CSysSolve<Scalar> krylov;         /*!< \brief Krylov solver (FGMRES). */
+  unique_ptr<CPreconditioner<Scalar> > preconditioner;  /*!< \brief Built from the approximate Jacobian of the solver. */
+
+  /*!
+   * \brief Allocate the work vectors and the preconditioner.
+   */
+  void Setup();
+
+  /*!
+   * \brief Decide if the current iteration is a startup (standard) one.
+   */
+  bool StartupIteration();
+
+  /*!
+   * \brief Standard defect-correction iteration.
+   */
+  void StandardIteration();
+
+  /*!
+   * \brief Inexact Newton iteration.
+   */
+  void NewtonIteration();
+
+  /*!
+   * \brief Evaluate the residual of the current solution into the LinSysRes of the solver, the Jacobian is not updated.
+   */
+  void EvaluateResidual();
+
+  /*!
+   * \brief Apply the Jacobian of the pseudo-transient residual to "u", v = (V/dt) u + (R(U+eps*u) - R(U)) / eps.
+   * \note The base state U is the old solution of the solver, the current solution is overwritten.
+   */
+  void MatrixFreeProduct(const CSysVector<Scalar> & u, CSysVector<Scalar> & v);
+
+public:
+  /*!
+   * \brief Perform one (standard or Newton) iteration of the flow equations, the MG levels are not used.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] numerics_container - Description of the numerical method (the way in which the equations are solved).
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] RunTime_EqSystem - System of equations which is going to be solved.
+   * \param[in] iZone - Zone index.
+   * \param[in] iInst - Instance index.
+   */
+  void MultiGrid_Iteration(CGeometry ****geometry, CSolver *****solver_container,
+                           CNumerics ******numerics_container, CConfig **config,
+                           unsigned short RunTime_EqSystem, unsigned short iZone, unsigned short iInst) override;
+
+  /*!
+   * \brief Get the forcing term (relative tolerance of the Krylov solver) of the last Newton step.
+   */
+  inline su2double GetForcingTerm() const { return forcing; }
+
+};
@@ -29,6 +29,7 @@
 #pragma once
 
 #include "../../../Common/include/parallelization/mpi_structure.hpp"
+#include "../../../Common/include/containers/C2DContainer.hpp"
 
 #include <cmath>
 #include <string>
@@ -36,6 +37,7 @@
 #include <sstream>
 #include <algorithm>
 #include <iostream>
+#include <vector>
 #include <stdlib.h>
 #include <stdio.h>
 
@@ -71,6 +73,23 @@ protected:
 
   unsigned short nVar = 0;
 
+  /*!
+   * \brief Point-to-point communication pattern of an interface marker, built from the donors of the interpolator.
+   * \note Each rank receives only the donor data it needs, from the ranks that own it (which may include itself).
+   */
+  struct CTransferPlan {
+    bool built = false;                   /*!< \brief Whether the plan is up to date with the interpolator. */
+    bool sparse = false;                  /*!< \brief Whether the owners of all donors were found (else use Allgatherv). */
+    vector<unsigned long> donorVertex;    /*!< \brief Vertices of the donor marker owned by this rank that others need. */
+    vector<unsigned long> sendItem;       /*!< \brief Index in donorVertex of each entry of the send buffer. */
+    vector<int> sendRank, sendDispl;      /*!< \brief Destination ranks and offsets of their data in the send buffer. */
+    vector<int> recvRank, recvDispl;      /*!< \brief Source ranks and offsets of their data in the receive buffer. */
+    vector<unsigned long> donorLocation;  /*!< \brief Row of the receive buffer of each donor of the (owned) target vertices. */
+    su2activematrix sendBuffer, recvBuffer;
+    vector<SU2_MPI::Request> requests;
+  };
+  vector<CTransferPlan> transferPlans;    /*!< \brief Communication pattern of each interface marker. */
+
 public:
   /*!
    * \brief Constructor of the class.
@@ -104,6 +123,53 @@ public:
                      CGeometry *donor_geometry, CGeometry *target_geometry,
                      const CConfig *donor_config, const CConfig *target_config);
 
+  /*!
+   * \brief Discard the communication patterns of BroadcastData, they are rebuilt on the next transfer.
+   * \note Must be called when the transfer coefficients of the interpolator are updated.
+   */
+  inline void ResetTransferPlans() { transferPlans.clear(); }
+
+private:
+  /*!
+   * \brief Build the point-to-point communication pattern for the donors of the owned target vertices of a marker.
+   * \note Collective call, falls back to the Allgatherv transfer if the owner of some donor is not correct.
+   * \param[in] interpolator - Object defining the interpolation.
+   * \param[in] donor_geometry - Geometry of the donor mesh.
+   * \param[in] target_geometry - Geometry of the target mesh.
+   * \param[in] markDonor - Index of the donor marker (-1 if not on this rank).
+   * \param[in] markTarget - Index of the target marker (-1 if not on this rank).
+   * \param[out] plan - The communication pattern.
+   */
+  void BuildTransferPlan(const CInterpolator& interpolator, CGeometry *donor_geometry, CGeometry *target_geometry,
+                         int markDonor, int markTarget, CTransferPlan& plan) const;
+
+  /*!
+   * \brief Evaluate the donor variables and exchange them according to the plan (into plan.recvBuffer).
+   * \param[in] donor_solution - Solution from the donor mesh.
+   * \param[in] donor_geometry - Geometry of the donor mesh.
+   * \param[in] donor_config - Definition of the problem at the donor mesh.
+   * \param[in] markDonor - Index of the donor marker.
+   * \param[in,out] plan - The communication pattern and its buffers.
+   */
+  void ExchangeDonorData(CSolver *donor_solution, CGeometry *donor_geometry, const CConfig *donor_config,
+                         int markDonor, CTransferPlan& plan);
+
+  /*!
+   * \brief Gather the donor variables of all ranks on all ranks (for when the owners of the donors are not known).
+   * \param[in] interpolator - Object defining the interpolation.
+   * \param[in] donor_solution - Solution from the donor mesh.
+   * \param[in] donor_geometry - Geometry of the donor mesh.
+   * \param[in] target_geometry - Geometry of the target mesh.
+   * \param[in] donor_config - Definition of the problem at the donor mesh.
+   * \param[in] markDonor - Index of the donor marker (-1 if not on this rank).
+   * \param[in] markTarget - Index of the target marker (-1 if not on this rank).
+   * \param[out] donorVar - Variables of all donor vertices.
+   * \param[out] donorLocation - Row of donorVar of each donor of the (owned) target vertices.
+   */
+  void GatherDonorData(const CInterpolator& interpolator, CSolver *donor_solution, CGeometry *donor_geometry,
+                       CGeometry *target_geometry, const CConfig *donor_config, int markDonor, int markTarget,
+                       su2activematrix& donorVar, vector<unsigned long>& donorLocation);
+
 protected:
   /*!
    * \brief A virtual member.
@@ -29,6 +29,8 @@
 
 #include "CNumericsSIMD.hpp"
 #include "flow/convection/roe.hpp"
+#include "flow/convection/ausm_slau.hpp"
+#include "flow/convection/hllc.hpp"
 #include "flow/convection/centered.hpp"
 #include "flow/diffusion/viscous_fluxes.hpp"
 
@@ -44,6 +46,24 @@ CNumericsSIMD* createUpwindIdealNumerics(const CConfig& config, int iMesh, const
     case ROE:
       obj = new CRoeScheme<ViscousDecorator>(config, iMesh, turbVars);
       break;
+    case AUSM:
+      obj = new CAUSMScheme<ViscousDecorator>(config, iMesh, turbVars);
+      break;
+    case AUSMPLUSUP:
+      obj = new CAUSMPLUSUPScheme<ViscousDecorator>(config, iMesh, turbVars);
+      break;
+    case AUSMPLUSUP2:
+      obj = new CAUSMPLUSUPScheme<ViscousDecorator,true>(config, iMesh, turbVars);
+      break;
+    case SLAU:
+      obj = new CSLAUScheme<ViscousDecorator>(config, iMesh, turbVars);
+      break;
+    case SLAU2:
+      obj = new CSLAUScheme<ViscousDecorator,true>(config, iMesh, turbVars);
+      break;
+    case HLLC:
+      obj = new CHLLCScheme<ViscousDecorator>(config, iMesh, turbVars);
+      break;
   }
   return obj;
 }
@@ -53,7 +73,16 @@ CNumericsSIMD* createUpwindIdealNumerics(const CConfig& config, int iMesh, const
  */
 template<class ViscousDecorator>
 CNumericsSIMD* createUpwindGeneralNumerics(const CConfig& config, int iMesh, const CVariable* turbVars) {
-  return nullptr;
+  CNumericsSIMD* obj = nullptr;
+  switch (config.GetKind_Upwind_Flow()) {
+    case ROE:
+      obj = new CGeneralRoeScheme<ViscousDecorator>(config, iMesh, turbVars);
+      break;
+    case HLLC:
+      obj = new CGeneralHLLCScheme<ViscousDecorator>(config, iMesh, turbVars);
+      break;
+  }
+  return obj;
 }
 
 /*!
@@ -72,6 +72,7 @@ public:
    * \param[in] solution - Solution variables.
    * \param[in] updateType - Type of update done on vector and matrix.
    * \param[in] updateMask - SIMD array of 1's and 0's, the latter prevent the update.
+   * \param[in] implicit - Whether to compute the flux Jacobians and update the matrix.
    * \param[in,out] vector - Target for the fluxes.
    * \param[in,out] matrix - Target for the flux Jacobians.
    * \note The update mask is used to handle "remainder" edges (nEdge mod simdSize).
@@ -82,6 +83,7 @@ public:
                            const CVariable& solution,
                            UpdateType updateType,
                            Double updateMask,
+                           bool implicit,
                            CSysVector<su2double>& vector,
                            SparseMatrixType& matrix) const = 0;
 
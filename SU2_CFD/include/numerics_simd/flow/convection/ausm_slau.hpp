@@ -0,0 +1,425 @@
+/*!
+ * \file ausm_slau.hpp
+ * \brief AUSM and SLAU families of convective schemes.
+ * \author SU2 Developers
+ * \version 7.1.0 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../../CNumericsSIMD.hpp"
+#include "../../util.hpp"
+#include "../variables.hpp"
+#include "common.hpp"
+#include "../../../variables/CEulerVariable.hpp"
+#include "../../../../../Common/include/geometry/CGeometry.hpp"
+
+/*!
+ * \class CAUSMSLAUBase
+ * \brief Base class for the AUSM and SLAU families of schemes, which share the form
+ * F = ||A|| (0.5 mdot (psi_i+psi_j) + 0.5 |mdot| (psi_i-psi_j) + n p), psi = (1, u, H).
+ * Derived classes implement the mass flux (mdot) and pressure (p) in a const
+ * "massAndPressureFluxes" method, the Jacobians are approximated with Roe's.
+ * As in CRoeBase, the viscous contributions are added by the "Base" decorator.
+ * \note The branches of the original (scalar) schemes are replaced by
+ * masks (0 or 1 valued comparisons) so that all lanes follow the same path.
+ */
+template<class Derived, class Base>
+class CAUSMSLAUBase : public Base {
+protected:
+  using Base::nDim;
+  static constexpr size_t nVar = CCompressibleConservatives<nDim>::nVar;
+  static constexpr size_t nPrimVarGrad = nDim+4;
+  static constexpr size_t nPrimVar = Max(Base::nPrimVar, nPrimVarGrad);
+
+  const su2double gamma;
+  const bool finestGrid;
+  const bool dynamicGrid;
+  const bool muscl;
+  const ENUM_LIMITER typeLimiter;
+
+  /*!
+   * \brief Constructor, store some constants and forward args to base.
+   */
+  template<class... Ts>
+  CAUSMSLAUBase(const CConfig& config, unsigned iMesh, Ts&... args) : Base(config, iMesh, args...),
+    gamma(config.GetGamma()),
+    finestGrid(iMesh == MESH_0),
+    dynamicGrid(config.GetDynamic_Grid()),
+    muscl(finestGrid && config.GetMUSCL_Flow()),
+    typeLimiter(static_cast<ENUM_LIMITER>(config.GetKind_SlopeLimit_Flow())) {
+  }
+
+public:
+  /*!
+   * \brief Implementation of the base AUSM/SLAU flux.
+   */
+  void ComputeFlux(Int iEdge,
+                   const CConfig& config,
+                   const CGeometry& geometry,
+                   const CVariable& solution_,
+                   UpdateType updateType,
+                   Double updateMask,
+                   bool implicit,
+                   CSysVector<su2double>& vector,
+                   SparseMatrixType& matrix) const final {
+
+    /*--- Start preaccumulation, inputs are registered
+     *    automatically in "gatherVariables". ---*/
+    AD::StartPreacc();
+
+    const auto& solution = static_cast<const CEulerVariable&>(solution_);
+
+    const auto iPoint = geometry.edges->GetNode(iEdge,0);
+    const auto jPoint = geometry.edges->GetNode(iEdge,1);
+
+    /*--- Geometric properties. ---*/
+
+    const auto vector_ij = distanceVector<nDim>(iPoint, jPoint, geometry.nodes->GetCoord());
+
+    const auto normal = gatherVariables<nDim>(iEdge, geometry.edges->GetNormal());
+    const auto area = norm(normal);
+    VectorDbl<nDim> unitNormal;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      unitNormal(iDim) = normal(iDim) / area;
+    }
+
+    /*--- Reconstructed primitives. ---*/
+
+    CPair<CCompressiblePrimitives<nDim,nPrimVar> > V1st;
+    V1st.i.all = gatherVariables<nPrimVar>(iPoint, solution.GetPrimitive());
+    V1st.j.all = gatherVariables<nPrimVar>(jPoint, solution.GetPrimitive());
+
+    auto V = reconstructPrimitives<CCompressiblePrimitives<nDim,nPrimVarGrad> >(
+                  iPoint, jPoint, muscl, typeLimiter, V1st, vector_ij, solution);
+
+    /*--- Mass and pressure fluxes from the derived class (static polymorphism). ---*/
+
+    const auto derived = static_cast<const Derived*>(this);
+
+    Double mdot, pressure;
+    derived->massAndPressureFluxes(V, unitNormal, iPoint, jPoint, solution, mdot, pressure);
+
+    /*--- Assemble the flux. ---*/
+
+    const Double dissFlux = abs(mdot);
+
+    VectorDbl<nVar> flux;
+    flux(0) = area * mdot;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      flux(iDim+1) = area * (0.5*mdot*(V.i.velocity(iDim)+V.j.velocity(iDim)) +
+                             0.5*dissFlux*(V.i.velocity(iDim)-V.j.velocity(iDim)) +
+                             unitNormal(iDim)*pressure);
+    }
+    flux(nDim+1) = area * (0.5*mdot*(V.i.enthalpy()+V.j.enthalpy()) +
+                           0.5*dissFlux*(V.i.enthalpy()-V.j.enthalpy()));
+
+    /*--- Approximate (Roe) Jacobians. ---*/
+
+    CPair<CCompressibleConservatives<nDim> > U;
+    U.i = compressibleConservatives(V.i);
+    U.j = compressibleConservatives(V.j);
+
+    MatrixDbl<nVar> jac_i, jac_j;
+    if (implicit) {
+      approxRoeJacobians(gamma, area, normal, unitNormal, V, U, jac_i, jac_j);
+    }
+
+    /*--- Correct for grid motion. ---*/
+
+    if (dynamicGrid) {
+      const auto& gridVel = geometry.nodes->GetGridVel();
+      const Double projGridVel = 0.5*(dot(gatherVariables<nDim>(iPoint,gridVel), unitNormal)+
+                                      dot(gatherVariables<nDim>(jPoint,gridVel), unitNormal));
+      for (size_t iVar = 0; iVar < nVar; ++iVar) {
+        Double dFdU = projGridVel * area * 0.5;
+        flux(iVar) -= dFdU * (U.i.all(iVar) + U.j.all(iVar));
+
+        if (implicit) {
+          jac_i(iVar,iVar) -= dFdU;
+          jac_j(iVar,iVar) -= dFdU;
+        }
+      }
+    }
+
+    /*--- Add the contributions from the base class (static decorator). ---*/
+
+    Base::viscousTerms(iEdge, iPoint, jPoint, V1st, solution_, vector_ij, geometry,
+                       config, area, unitNormal, implicit, flux, jac_i, jac_j);
+
+    /*--- Stop preaccumulation. ---*/
+
+    stopPreacc(flux);
+
+    /*--- Update the vector and system matrix. ---*/
+
+    updateLinearSystem(iEdge, iPoint, jPoint, implicit, updateType,
+                       updateMask, flux, jac_i, jac_j, vector, matrix);
+  }
+};
+
+/*!
+ * \class CAUSMScheme
+ * \brief Original AUSM scheme of Liou and Steffen.
+ */
+template<class Decorator>
+class CAUSMScheme : public CAUSMSLAUBase<CAUSMScheme<Decorator>,Decorator> {
+private:
+  using Base = CAUSMSLAUBase<CAUSMScheme<Decorator>,Decorator>;
+  using Base::nDim;
+  using Base::gamma;
+
+public:
+  /*!
+   * \brief Constructor, forward everything to base.
+   */
+  template<class... Ts>
+  CAUSMScheme(Ts&... args) : Base(args...) {}
+
+  /*!
+   * \brief Mass flux and pressure of AUSM.
+   */
+  template<class PrimVarType>
+  FORCEINLINE void massAndPressureFluxes(const CPair<PrimVarType>& V,
+                                         const VectorDbl<nDim>& unitNormal,
+                                         Int, Int, const CEulerVariable&,
+                                         Double& mdot,
+                                         Double& pressure) const {
+
+    const Double projVel_i = dot(V.i.velocity(), unitNormal);
+    const Double projVel_j = dot(V.j.velocity(), unitNormal);
+
+    const Double energy_i = V.i.enthalpy() - V.i.pressure()/V.i.density();
+    const Double energy_j = V.j.enthalpy() - V.j.pressure()/V.j.density();
+    const Double soundSpeed_i = sqrt(abs(gamma*(gamma-1)*(energy_i-0.5*squaredNorm<nDim>(V.i.velocity()))));
+    const Double soundSpeed_j = sqrt(abs(gamma*(gamma-1)*(energy_j-0.5*squaredNorm<nDim>(V.j.velocity()))));
+
+    const Double mL = projVel_i / soundSpeed_i;
+    const Double mR = projVel_j / soundSpeed_j;
+
+    /*--- Subsonic masks. ---*/
+    const Double subL = (abs(mL) <= 1.0);
+    const Double subR = (abs(mR) <= 1.0);
+
+    const Double mLP = subL*0.25*pow(mL+1.0,2) + (1.0-subL)*0.5*(mL+abs(mL));
+    const Double mRM = -subR*0.25*pow(mR-1.0,2) + (1.0-subR)*0.5*(mR-abs(mR));
+    const Double mF = mLP + mRM;
+
+    /*--- In the supersonic range, (M+|M|)/(2M) is 1 for M > 0 and 0 otherwise. ---*/
+    const Double pLP = subL*0.25*pow(mL+1.0,2)*(2.0-mL) + (1.0-subL)*(mL > 0.0);
+    const Double pRM = subR*0.25*pow(mR-1.0,2)*(2.0+mR) + (1.0-subR)*(mR < 0.0);
+
+    const Double rhoA_i = V.i.density() * soundSpeed_i;
+    const Double rhoA_j = V.j.density() * soundSpeed_j;
+
+    mdot = 0.5*(mF*(rhoA_i+rhoA_j) - abs(mF)*(rhoA_j-rhoA_i));
+    pressure = pLP*V.i.pressure() + pRM*V.j.pressure();
+  }
+};
+
+/*!
+ * \class CAUSMPLUSUPScheme
+ * \brief AUSM+up scheme of Liou (2006), or AUSM+up2 (modified pressure flux)
+ * of Kitamura & Shima (2013), selected at compile time.
+ */
+template<class Decorator, bool UP2 = false>
+class CAUSMPLUSUPScheme : public CAUSMSLAUBase<CAUSMPLUSUPScheme<Decorator,UP2>,Decorator> {
+private:
+  using Base = CAUSMSLAUBase<CAUSMPLUSUPScheme<Decorator,UP2>,Decorator>;
+  using Base::nDim;
+  using Base::gamma;
+  const su2double Minf;
+
+public:
+  /*!
+   * \brief Constructor, store some constants and forward to base.
+   */
+  template<class... Ts>
+  CAUSMPLUSUPScheme(const CConfig& config, Ts&... args) : Base(config, args...),
+    Minf(config.GetMach()) {
+    if (Minf < EPS)
+      SU2_MPI::Error("AUSM+Up requires a reference Mach number (\"MACH_NUMBER\") greater than 0.", CURRENT_FUNCTION);
+  }
+
+  /*!
+   * \brief Mass flux and pressure of AUSM+up(2).
+   */
+  template<class PrimVarType>
+  FORCEINLINE void massAndPressureFluxes(const CPair<PrimVarType>& V,
+                                         const VectorDbl<nDim>& unitNormal,
+                                         Int, Int, const CEulerVariable&,
+                                         Double& mdot,
+                                         Double& pressure) const {
+
+    constexpr passivedouble Kp = 0.25, Ku = 0.75, sigma = 1.0;
+
+    const Double projVel_i = dot(V.i.velocity(), unitNormal);
+    const Double projVel_j = dot(V.j.velocity(), unitNormal);
+
+    /*--- Interface speed of sound (aF). ---*/
+
+    const Double astarL = sqrt(2.0*(gamma-1)/(gamma+1)*V.i.enthalpy());
+    const Double astarR = sqrt(2.0*(gamma-1)/(gamma+1)*V.j.enthalpy());
+
+    const Double ahatL = astarL*astarL/max(astarL, projVel_i);
+    const Double ahatR = astarR*astarR/max(astarR,-projVel_j);
+
+    const Double aF = min(ahatL, ahatR);
+
+    /*--- Left and right pressures and Mach numbers. ---*/
+
+    const Double mL = projVel_i/aF;
+    const Double mR = projVel_j/aF;
+
+    const Double MFsq = 0.5*(mL*mL+mR*mR);
+    const Double Mrefsq = min(1.0, max(MFsq, Minf*Minf));
+
+    const Double fa = 2.0*sqrt(Mrefsq)-Mrefsq;
+
+    const Double alpha = 3.0/16.0*(-4.0+5.0*fa*fa);
+    constexpr passivedouble beta = 1.0/8.0;
+
+    const Double subL = (abs(mL) <= 1.0);
+    const Double subR = (abs(mR) <= 1.0);
+
+    Double p1 = 0.25*pow(mL+1.0,2);
+    Double p2 = pow(mL*mL-1.0,2);
+    const Double mLP = subL*(p1 + beta*p2) + (1.0-subL)*0.5*(mL+abs(mL));
+    const Double betaLP = subL*(p1*(2.0-mL) + alpha*mL*p2) + (1.0-subL)*(mL > 0.0);
+
+    p1 = 0.25*pow(mR-1.0,2);
+    p2 = pow(mR*mR-1.0,2);
+    const Double mRM = subR*(-p1 - beta*p2) + (1.0-subR)*0.5*(mR-abs(mR));
+    const Double betaRM = subR*(p1*(2.0+mR) - alpha*mR*p2) + (1.0-subR)*(mR < 0.0);
+
+    /*--- Mass flux with pressure diffusion term. ---*/
+
+    const Double rhoF = 0.5*(V.i.density()+V.j.density());
+    const Double Mp = -(Kp/fa)*max(1.0-sigma*MFsq, 0.0)*(V.j.pressure()-V.i.pressure())/(rhoF*aF*aF);
+
+    const Double mF = mLP + mRM + Mp;
+    mdot = aF * (max(mF,0.0)*V.i.density() + min(mF,0.0)*V.j.density());
+
+    if (!UP2) {
+      /*--- Pressure with velocity diffusion term. ---*/
+      const Double Pu = -Ku*fa*betaLP*betaRM*2.0*rhoF*aF*(projVel_j-projVel_i);
+      pressure = betaLP*V.i.pressure() + betaRM*V.j.pressure() + Pu;
+    }
+    else {
+      /*--- Modified pressure flux. ---*/
+      const Double sqVel = 0.5*(squaredNorm<nDim>(V.i.velocity()) + squaredNorm<nDim>(V.j.velocity()));
+      pressure = 0.5*(V.j.pressure()+V.i.pressure()) + 0.5*(betaLP-betaRM)*(V.i.pressure()-V.j.pressure()) +
+                 sqrt(sqVel)*(betaLP+betaRM-1.0)*rhoF*aF;
+    }
+  }
+};
+
+/*!
+ * \class CSLAUScheme
+ * \brief SLAU scheme of Shima & Kitamura (2011), or SLAU2 (2013), selected
+ * at compile time. Supports the low-dissipation modes of the Roe scheme.
+ */
+template<class Decorator, bool SLAU2 = false>
+class CSLAUScheme : public CAUSMSLAUBase<CSLAUScheme<Decorator,SLAU2>,Decorator> {
+private:
+  using Base = CAUSMSLAUBase<CSLAUScheme<Decorator,SLAU2>,Decorator>;
+  using Base::nDim;
+  using Base::gamma;
+  const ENUM_ROELOWDISS typeDissip;
+
+public:
+  /*!
+   * \brief Constructor, store some constants and forward to base.
+   */
+  template<class... Ts>
+  CSLAUScheme(const CConfig& config, Ts&... args) : Base(config, args...),
+    typeDissip(static_cast<ENUM_ROELOWDISS>(config.GetKind_RoeLowDiss())) {
+  }
+
+  /*!
+   * \brief Mass flux and pressure of SLAU(2).
+   */
+  template<class PrimVarType>
+  FORCEINLINE void massAndPressureFluxes(const CPair<PrimVarType>& V,
+                                         const VectorDbl<nDim>& unitNormal,
+                                         Int iPoint,
+                                         Int jPoint,
+                                         const CEulerVariable& solution,
+                                         Double& mdot,
+                                         Double& pressure) const {
+
+    const Double projVel_i = dot(V.i.velocity(), unitNormal);
+    const Double projVel_j = dot(V.j.velocity(), unitNormal);
+
+    const Double sqVel_i = squaredNorm<nDim>(V.i.velocity());
+    const Double sqVel_j = squaredNorm<nDim>(V.j.velocity());
+
+    const Double energy_i = V.i.enthalpy() - V.i.pressure()/V.i.density();
+    const Double energy_j = V.j.enthalpy() - V.j.pressure()/V.j.density();
+    const Double soundSpeed_i = sqrt(abs(gamma*(gamma-1)*(energy_i-0.5*sqVel_i)));
+    const Double soundSpeed_j = sqrt(abs(gamma*(gamma-1)*(energy_j-0.5*sqVel_j)));
+
+    /*--- Interface speed of sound (aF), and left/right Mach number. ---*/
+
+    const Double aF = 0.5 * (soundSpeed_i + soundSpeed_j);
+    const Double mL = projVel_i/aF;
+    const Double mR = projVel_j/aF;
+
+    /*--- Smooth function of the local Mach number. ---*/
+
+    const Double machTilde = min(1.0, sqrt(0.5*(sqVel_i+sqVel_j)) / aF);
+    const Double chi = pow(1.0-machTilde, 2);
+    const Double fRho = -max(min(mL,0.0),-1.0) * min(max(mR,0.0),1.0);
+
+    /*--- Mean normal velocity with density weighting. ---*/
+
+    const Double VnMag = (V.i.density()*abs(projVel_i) + V.j.density()*abs(projVel_j)) /
+                         (V.i.density() + V.j.density());
+    const Double VnMagL = (1.0-fRho)*VnMag + fRho*abs(projVel_i);
+    const Double VnMagR = (1.0-fRho)*VnMag + fRho*abs(projVel_j);
+
+    /*--- Mass flux function. ---*/
+
+    mdot = 0.5 * (V.i.density()*(projVel_i+VnMagL) + V.j.density()*(projVel_j-VnMagR) -
+                  (chi/aF)*(V.j.pressure()-V.i.pressure()));
+
+    /*--- Pressure function. ---*/
+
+    const Double subL = (abs(mL) < 1.0);
+    const Double subR = (abs(mR) < 1.0);
+
+    const Double betaL = subL*0.25*(2.0-mL)*pow(mL+1.0,2) + (1.0-subL)*(mL >= 0.0);
+    const Double betaR = subR*0.25*(2.0+mR)*pow(mR-1.0,2) + (1.0-subR)*(mR < 0.0);
+
+    const Double dissipation = roeDissipation(iPoint, jPoint, typeDissip, solution);
+
+    pressure = 0.5*(V.i.pressure()+V.j.pressure()) + 0.5*(betaL-betaR)*(V.i.pressure()-V.j.pressure());
+
+    if (!SLAU2) {
+      pressure += dissipation*(1.0-chi)*(betaL+betaR-1.0)*0.5*(V.i.pressure()+V.j.pressure());
+    }
+    else {
+      pressure += dissipation*sqrt(0.5*(sqVel_i+sqVel_j))*(betaL+betaR-1.0)*aF*0.5*(V.i.density()+V.j.density());
+    }
+  }
+};
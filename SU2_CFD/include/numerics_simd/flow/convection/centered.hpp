@@ -85,6 +85,7 @@ public:
                    const CVariable& solution_,
                    UpdateType updateType,
                    Double updateMask,
+                   bool implicit,
                    CSysVector<su2double>& vector,
                    SparseMatrixType& matrix) const final {
 
@@ -92,7 +93,6 @@ public:
      *    automatically in "gatherVariables". ---*/
     AD::StartPreacc();
 
-    const bool implicit = (config.GetKind_TimeIntScheme() == EULER_IMPLICIT);
     const auto& solution = static_cast<const CEulerVariable&>(solution_);
 
     const auto iPoint = geometry.edges->GetNode(iEdge,0);
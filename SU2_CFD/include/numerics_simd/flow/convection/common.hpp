@@ -261,6 +261,135 @@ FORCEINLINE MatrixDbl<nDim+2> pMatrixInv(Double gamma, Double density, const Ran
   return pMatInv;
 }
 
+/*!
+ * \brief Compute and return the P tensor (compressible flow, general fluid).
+ * \note chi and kappa are the pressure derivatives, see generalGasDerivatives.
+ */
+template<size_t nDim, class RandomAccessIterator>
+FORCEINLINE MatrixDbl<nDim+2> pMatrix(Double density, const RandomAccessIterator& velocity,
+                                      Double projVel, Double speedSound, Double enthalpy,
+                                      Double chi, Double kappa, const VectorDbl<nDim>& normal) {
+  MatrixDbl<nDim+2> pMat;
+  const Double zeta = 0.5*squaredNorm<nDim>(velocity) - chi/kappa;
+
+  if (nDim == 2) {
+    pMat(0,0) = 1.0;
+    pMat(0,1) = 0.0;
+
+    pMat(1,0) = velocity[0];
+    pMat(1,1) = density*normal(1);
+
+    pMat(2,0) = velocity[1];
+    pMat(2,1) = -density*normal(0);
+
+    pMat(3,0) = zeta;
+    pMat(3,1) = density*(velocity[0]*normal(1) - velocity[1]*normal(0));
+  }
+  else {
+    pMat(0,0) = normal(0);
+    pMat(0,1) = normal(1);
+    pMat(0,2) = normal(2);
+
+    pMat(1,0) = velocity[0]*normal(0);
+    pMat(1,1) = velocity[0]*normal(1) - density*normal(2);
+    pMat(1,2) = velocity[0]*normal(2) + density*normal(1);
+
+    pMat(2,0) = velocity[1]*normal(0) + density*normal(2);
+    pMat(2,1) = velocity[1]*normal(1);
+    pMat(2,2) = velocity[1]*normal(2) - density*normal(0);
+
+    pMat(3,0) = velocity[2]*normal(0) - density*normal(1);
+    pMat(3,1) = velocity[2]*normal(1) + density*normal(0);
+    pMat(3,2) = velocity[2]*normal(2);
+
+    pMat(4,0) = zeta*normal(0) + density*(velocity[1]*normal(2) - velocity[2]*normal(1));
+    pMat(4,1) = zeta*normal(1) - density*(velocity[0]*normal(2) - velocity[2]*normal(0));
+    pMat(4,2) = zeta*normal(2) + density*(velocity[0]*normal(1) - velocity[1]*normal(0));
+  }
+
+  /*--- Last two columns. ---*/
+
+  const Double rhoOn2 = 0.5*density;
+  const Double rhoOnTwoC = rhoOn2 / speedSound;
+  pMat(0,nDim) = rhoOnTwoC;
+  pMat(0,nDim+1) = rhoOnTwoC;
+
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    pMat(iDim+1,nDim) = rhoOnTwoC * velocity[iDim] + rhoOn2 * normal(iDim);
+    pMat(iDim+1,nDim+1) = rhoOnTwoC * velocity[iDim] - rhoOn2 * normal(iDim);
+  }
+
+  pMat(nDim+1,nDim) = rhoOnTwoC * enthalpy + rhoOn2 * projVel;
+  pMat(nDim+1,nDim+1) = rhoOnTwoC * enthalpy - rhoOn2 * projVel;
+
+  return pMat;
+}
+
+/*!
+ * \brief Compute and return the inverse P tensor (compressible flow, general fluid).
+ */
+template<size_t nDim, class RandomAccessIterator>
+FORCEINLINE MatrixDbl<nDim+2> pMatrixInv(Double density, const RandomAccessIterator& velocity,
+                                         Double projVel, Double speedSound, Double chi,
+                                         Double kappa, const VectorDbl<nDim>& normal) {
+  MatrixDbl<nDim+2> pMatInv;
+
+  const Double c2 = pow(speedSound,2);
+  const Double dPdrho = chi + 0.5*kappa*squaredNorm<nDim>(velocity);
+  const Double oneOnRho = 1 / density;
+
+  if (nDim == 2) {
+    Double tmp = kappa/c2;
+    pMatInv(0,0) = 1.0 - dPdrho/c2;
+    pMatInv(0,1) = tmp*velocity[0];
+    pMatInv(0,2) = tmp*velocity[1];
+    pMatInv(0,3) = -tmp;
+
+    pMatInv(1,0) = (normal(0)*velocity[1]-normal(1)*velocity[0])*oneOnRho;
+    pMatInv(1,1) = normal(1)*oneOnRho;
+    pMatInv(1,2) = -normal(0)*oneOnRho;
+    pMatInv(1,3) = 0.0;
+  }
+  else {
+    Double tmp = kappa/c2 * normal(0);
+    pMatInv(0,0) = normal(0) - dPdrho/c2*normal(0) - (normal(2)*velocity[1]-normal(1)*velocity[2])*oneOnRho;
+    pMatInv(0,1) = tmp*velocity[0];
+    pMatInv(0,2) = tmp*velocity[1] + normal(2)*oneOnRho;
+    pMatInv(0,3) = tmp*velocity[2] - normal(1)*oneOnRho;
+    pMatInv(0,4) = -tmp;
+
+    tmp = kappa/c2 * normal(1);
+    pMatInv(1,0) = normal(1) - dPdrho/c2*normal(1) + (normal(2)*velocity[0]-normal(0)*velocity[2])*oneOnRho;
+    pMatInv(1,1) = tmp*velocity[0] - normal(2)*oneOnRho;
+    pMatInv(1,2) = tmp*velocity[1];
+    pMatInv(1,3) = tmp*velocity[2] + normal(0)*oneOnRho;
+    pMatInv(1,4) = -tmp;
+
+    tmp = kappa/c2 * normal(2);
+    pMatInv(2,0) = normal(2) - dPdrho/c2*normal(2) - (normal(1)*velocity[0]-normal(0)*velocity[1])*oneOnRho;
+    pMatInv(2,1) = tmp*velocity[0] + normal(1)*oneOnRho;
+    pMatInv(2,2) = tmp*velocity[1] - normal(0)*oneOnRho;
+    pMatInv(2,3) = tmp*velocity[2];
+    pMatInv(2,4) = -tmp;
+  }
+
+  /*--- Last two rows. ---*/
+
+  const Double kappaOnRhoTimesC = kappa / (density*speedSound);
+  const Double dPdrhoOnRhoTimesC = dPdrho / (density*speedSound);
+
+  for (size_t iVar = nDim; iVar < nDim+2; ++iVar) {
+    Double sign = (iVar==nDim)? 1 : -1;
+    pMatInv(iVar,0) = -sign*projVel*oneOnRho + dPdrhoOnRhoTimesC;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      pMatInv(iVar,iDim+1) = sign*normal(iDim)*oneOnRho - kappaOnRhoTimesC * velocity[iDim];
+    }
+    pMatInv(iVar,nDim+1) = kappaOnRhoTimesC;
+  }
+
+  return pMatInv;
+}
+
 /*!
  * \brief Convective projected (onto normal) flux (compressible flow).
  */
@@ -317,6 +446,129 @@ FORCEINLINE MatrixDbl<nDim+2> inviscidProjJac(Double gamma, RandomAccessIterator
   return jac;
 }
 
+/*!
+ * \brief Approximate (Roe-like) Jacobians of an upwind flux, for schemes (e.g. AUSM, HLLC)
+ * that do not use the Roe dissipation, but that approach it closely enough for implicit stability.
+ * \note The Jacobians of the central flux, 0.5*(A_i+A_j), are augmented with 0.5*P|Lambda|P^-1.
+ */
+template<size_t nDim, class PrimVarType, class ConsVarType>
+FORCEINLINE void approxRoeJacobians(Double gamma,
+                                    Double area,
+                                    const VectorDbl<nDim>& normal,
+                                    const VectorDbl<nDim>& unitNormal,
+                                    const CPair<PrimVarType>& V,
+                                    const CPair<ConsVarType>& U,
+                                    MatrixDbl<nDim+2>& jac_i,
+                                    MatrixDbl<nDim+2>& jac_j) {
+  constexpr size_t nVar = nDim+2;
+
+  auto roeAvg = roeAveragedVariables(gamma, V, unitNormal);
+
+  auto pMat = pMatrix(gamma, roeAvg.density, roeAvg.velocity,
+                      roeAvg.projVel, roeAvg.speedSound, unitNormal);
+  auto pMatInv = pMatrixInv(gamma, roeAvg.density, roeAvg.velocity,
+                            roeAvg.projVel, roeAvg.speedSound, unitNormal);
+
+  VectorDbl<nVar> lambda;
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    lambda(iDim) = abs(roeAvg.projVel);
+  }
+  lambda(nDim) = abs(roeAvg.projVel + roeAvg.speedSound);
+  lambda(nDim+1) = abs(roeAvg.projVel - roeAvg.speedSound);
+
+  jac_i = inviscidProjJac(gamma, V.i.velocity(), U.i.energy(), normal, 0.5);
+  jac_j = inviscidProjJac(gamma, V.j.velocity(), U.j.energy(), normal, 0.5);
+
+  for (size_t iVar = 0; iVar < nVar; ++iVar) {
+    for (size_t jVar = 0; jVar < nVar; ++jVar) {
+      Double projModJacTensor = 0.0;
+      for (size_t kVar = 0; kVar < nVar; ++kVar) {
+        projModJacTensor += pMat(iVar,kVar) * lambda(kVar) * pMatInv(kVar,jVar);
+      }
+      jac_i(iVar,jVar) += 0.5 * area * projModJacTensor;
+      jac_j(iVar,jVar) -= 0.5 * area * projModJacTensor;
+    }
+  }
+}
+
+/*!
+ * \brief Jacobian of the convective flux (compressible flow, general fluid).
+ */
+template<size_t nDim, class RandomAccessIterator>
+FORCEINLINE MatrixDbl<nDim+2> inviscidProjJac(RandomAccessIterator velocity, Double enthalpy,
+                                              Double chi, Double kappa,
+                                              const VectorDbl<nDim>& normal, Double scale) {
+  MatrixDbl<nDim+2> jac;
+
+  Double projVel = dot(velocity, normal);
+  Double phi = chi + 0.5*kappa*squaredNorm<nDim>(velocity);
+
+  jac(0,0) = 0.0;
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    jac(0,iDim+1) = scale * normal(iDim);
+  }
+  jac(0,nDim+1) = 0.0;
+
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    jac(iDim+1,0) = scale * (normal(iDim)*phi - velocity[iDim]*projVel);
+    for (size_t jDim = 0; jDim < nDim; ++jDim) {
+      jac(iDim+1,jDim+1) = scale * (normal(jDim)*velocity[iDim] - kappa*normal(iDim)*velocity[jDim]);
+    }
+    jac(iDim+1,iDim+1) += scale * projVel;
+    jac(iDim+1,nDim+1) = scale * kappa * normal(iDim);
+  }
+
+  jac(nDim+1,0) = scale * projVel * (phi-enthalpy);
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    jac(nDim+1,iDim+1) = scale * (normal(iDim)*enthalpy - kappa*velocity[iDim]*projVel);
+  }
+  jac(nDim+1,nDim+1) = scale * (kappa+1) * projVel;
+
+  return jac;
+}
+
+/*!
+ * \brief Approximate (Roe-like) Jacobians of an upwind flux (general fluid), see the ideal gas version.
+ */
+template<size_t nDim, class PrimVarType>
+FORCEINLINE void approxRoeJacobians(const CGeneralRoeVariables<nDim>& roeAvg,
+                                    const CPair<Double>& chi,
+                                    const CPair<Double>& kappa,
+                                    Double area,
+                                    const VectorDbl<nDim>& normal,
+                                    const VectorDbl<nDim>& unitNormal,
+                                    const CPair<PrimVarType>& V,
+                                    MatrixDbl<nDim+2>& jac_i,
+                                    MatrixDbl<nDim+2>& jac_j) {
+  constexpr size_t nVar = nDim+2;
+
+  auto pMat = pMatrix(roeAvg.density, roeAvg.velocity, roeAvg.projVel, roeAvg.speedSound,
+                      roeAvg.enthalpy, roeAvg.chi, roeAvg.kappa, unitNormal);
+  auto pMatInv = pMatrixInv(roeAvg.density, roeAvg.velocity, roeAvg.projVel,
+                            roeAvg.speedSound, roeAvg.chi, roeAvg.kappa, unitNormal);
+
+  VectorDbl<nVar> lambda;
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    lambda(iDim) = abs(roeAvg.projVel);
+  }
+  lambda(nDim) = abs(roeAvg.projVel + roeAvg.speedSound);
+  lambda(nDim+1) = abs(roeAvg.projVel - roeAvg.speedSound);
+
+  jac_i = inviscidProjJac(V.i.velocity(), V.i.enthalpy(), chi.i, kappa.i, normal, 0.5);
+  jac_j = inviscidProjJac(V.j.velocity(), V.j.enthalpy(), chi.j, kappa.j, normal, 0.5);
+
+  for (size_t iVar = 0; iVar < nVar; ++iVar) {
+    for (size_t jVar = 0; jVar < nVar; ++jVar) {
+      Double projModJacTensor = 0.0;
+      for (size_t kVar = 0; kVar < nVar; ++kVar) {
+        projModJacTensor += pMat(iVar,kVar) * lambda(kVar) * pMatInv(kVar,jVar);
+      }
+      jac_i(iVar,jVar) += 0.5 * area * projModJacTensor;
+      jac_j(iVar,jVar) -= 0.5 * area * projModJacTensor;
+    }
+  }
+}
+
 /*!
  * \brief (Low) Dissipation coefficient for Roe schemes.
  */
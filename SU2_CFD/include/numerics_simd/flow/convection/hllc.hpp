@@ -0,0 +1,422 @@
+/*!
+ * \file hllc.hpp
+ * \brief HLLC convective scheme.
+ * \author SU2 Developers
+ * \version 7.1.0 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../../CNumericsSIMD.hpp"
+#include "../../util.hpp"
+#include "../variables.hpp"
+#include "common.hpp"
+#include "../../../variables/CEulerVariable.hpp"
+#include "../../../../../Common/include/geometry/CGeometry.hpp"
+
+/*!
+ * \class CHLLCScheme
+ * \brief HLLC scheme of Toro et al., with the wave speed estimates of Einfeldt (Roe averages).
+ * The viscous contributions are added by the "Decorator" (see CRoeBase). For general fluids
+ * (IdealGas = false) the speeds of sound are computed from the secondary variables, and the
+ * Roe averaged pressure derivatives are corrected as proposed by Vinokur and Montagne.
+ * \note The four cases of the original (scalar) scheme are evaluated without branches,
+ * first the upwind side of the contact surface is selected, and then the star or
+ * full state of that side. The Jacobians are the analytical ones of the scalar scheme
+ * (scaled by ROE_KAPPA), for the derivatives of the star state they are evaluated for
+ * both sides and blended in the same way.
+ */
+template<class Decorator, bool IdealGas = true>
+class CHLLCScheme : public Decorator {
+private:
+  using Base = Decorator;
+  using Base::nDim;
+  static constexpr size_t nVar = CCompressibleConservatives<nDim>::nVar;
+  static constexpr size_t nPrimVarGrad = nDim+4;
+  static constexpr size_t nPrimVar = Max(Base::nPrimVar, nPrimVarGrad);
+
+  const su2double gamma;
+  const su2double roeKappa;
+  const bool finestGrid;
+  const bool dynamicGrid;
+  const bool muscl;
+  const ENUM_LIMITER typeLimiter;
+
+  /*!
+   * \brief Vinokur-Montagne correction of the Roe averaged pressure derivatives,
+   * applied only when the jumps of the state are significant (masked).
+   */
+  template<class PrimVarType>
+  FORCEINLINE static void vinokurMontagne(const CPair<PrimVarType>& V,
+                                          const CPair<Double>& chi,
+                                          const CPair<Double>& kappa,
+                                          CGeneralRoeVariables<nDim>& roeAvg) {
+    CPair<Double> staticEnthalpy, rhoStaticEnergy;
+    staticEnthalpy.i = V.i.enthalpy() - 0.5*squaredNorm<nDim>(V.i.velocity());
+    staticEnthalpy.j = V.j.enthalpy() - 0.5*squaredNorm<nDim>(V.j.velocity());
+    rhoStaticEnergy.i = V.i.density()*staticEnthalpy.i - V.i.pressure();
+    rhoStaticEnergy.j = V.j.density()*staticEnthalpy.j - V.j.pressure();
+
+    const Double deltaRho = V.j.density() - V.i.density();
+    const Double deltaP = V.j.pressure() - V.i.pressure();
+
+    const Double s = roeAvg.chi + 0.5*(staticEnthalpy.i*kappa.i + staticEnthalpy.j*kappa.j);
+    const Double D = s*s*deltaRho*deltaRho + deltaP*deltaP;
+    const Double errP = deltaP - roeAvg.chi*deltaRho - roeAvg.kappa*(rhoStaticEnergy.j-rhoStaticEnergy.i);
+    const Double denom = D - deltaP*errP;
+
+    const Double apply = (abs(denom/V.i.density()) > 1e-3) *
+                         (abs(deltaRho/V.i.density()) > 1e-3) * (s/V.i.density() > 1e-3);
+    const Double safeDenom = apply*denom + (1.0-apply);
+
+    roeAvg.kappa += apply * (D*roeAvg.kappa/safeDenom - roeAvg.kappa);
+    roeAvg.chi += apply * ((D*roeAvg.chi + s*s*deltaRho*errP)/safeDenom - roeAvg.chi);
+  }
+
+  /*!
+   * \brief Derivatives of the pressure w.r.t. the conservative variables, for general fluids
+   * the expression (and sign convention) of the scalar scheme is kept.
+   */
+  template<class PrimVarType>
+  FORCEINLINE VectorDbl<nVar> pressureDerivatives(const PrimVarType& V, const Double& chi,
+                                                   const Double& kappa) const {
+    VectorDbl<nVar> dPdU;
+    const Double dPde = IdealGas? Double(gamma-1) : kappa;
+    const Double sqVel = squaredNorm<nDim>(V.velocity());
+    dPdU(0) = IdealGas? Double(0.5*dPde*sqVel) : Double(chi - 0.5*dPde*sqVel);
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      dPdU(iDim+1) = -dPde*V.velocity(iDim);
+    }
+    dPdU(nDim+1) = dPde;
+    return dPdU;
+  }
+
+  /*!
+   * \brief Analytical Jacobians of the HLLC flux, "left" selects the upwind side (K) of the contact
+   * surface, and "full" whether the flux is given by the state K or by the star state K.
+   */
+  template<class PrimVarType, class ConsVarType>
+  FORCEINLINE void hllcJacobians(const CPair<PrimVarType>& V,
+                                 const CPair<ConsVarType>& U,
+                                 const CPair<Double>& chi,
+                                 const CPair<Double>& kappa,
+                                 const VectorDbl<nDim>& unitNormal,
+                                 const CPair<Double>& projVel,
+                                 Double sL, Double sR, Double sM, Double pStar, Double rhoSum,
+                                 const CCompressibleConservatives<nDim>& UStar,
+                                 Double left, Double full, Double scale,
+                                 MatrixDbl<nVar>& jac_i,
+                                 MatrixDbl<nVar>& jac_j) const {
+
+    const auto blend = [left](const Double& a, const Double& b) -> Double { return left*a + (1.0-left)*b; };
+
+    const Double sK = blend(sL, sR);
+    const Double projVelK = blend(projVel.i, projVel.j);
+    const Double omega = 1.0 / (sK - sM);
+    const Double omegaSM = omega * sM;
+    const Double rhoStar = UStar.density();
+    const Double EpStar = UStar.rhoEnergy() + pStar;
+
+    /*--- Derivatives of the contact speed and of the star pressure w.r.t. the state of each side. ---*/
+
+    CPair<VectorDbl<nVar> > dPI, dSm, dpStar;
+    dPI.i = pressureDerivatives(V.i, chi.i, kappa.i);
+    dPI.j = pressureDerivatives(V.j, chi.j, kappa.j);
+
+    dSm.i(0) = (-projVel.i*projVel.i + sM*sL + dPI.i(0)) / rhoSum;
+    dSm.j(0) = -(-projVel.j*projVel.j + sM*sR + dPI.j(0)) / rhoSum;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      dSm.i(iDim+1) = (unitNormal(iDim)*(2*projVel.i - sL - sM) + dPI.i(iDim+1)) / rhoSum;
+      dSm.j(iDim+1) = -(unitNormal(iDim)*(2*projVel.j - sR - sM) + dPI.j(iDim+1)) / rhoSum;
+    }
+    dSm.i(nDim+1) = dPI.i(nDim+1) / rhoSum;
+    dSm.j(nDim+1) = -dPI.j(nDim+1) / rhoSum;
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      dpStar.i(iVar) = V.i.density() * (sR - projVel.j) * dSm.i(iVar);
+      dpStar.j(iVar) = V.j.density() * (sL - projVel.i) * dSm.j(iVar);
+    }
+
+    /*--- Star flux Jacobians through the contact speed and star pressure. ---*/
+
+    auto starJacobian = [&](const VectorDbl<nVar>& dSmX, const VectorDbl<nVar>& dpStarX) {
+      MatrixDbl<nVar> jac;
+      for (size_t iVar = 0; iVar < nVar; ++iVar) {
+        jac(0,iVar) = rhoStar * (omegaSM+1) * dSmX(iVar);
+        for (size_t iDim = 0; iDim < nDim; ++iDim) {
+          jac(iDim+1,iVar) = (omegaSM+1) * (UStar.momentum(iDim)*dSmX(iVar) + unitNormal(iDim)*dpStarX(iVar));
+        }
+        const Double dEStar = omega * (sM*dpStarX(iVar) + EpStar*dSmX(iVar));
+        jac(nDim+1,iVar) = sM * (dEStar + dpStarX(iVar)) + EpStar*dSmX(iVar);
+      }
+      return jac;
+    };
+    MatrixDbl<nVar> jacStar_i = starJacobian(dSm.i, dpStar.i);
+    MatrixDbl<nVar> jacStar_j = starJacobian(dSm.j, dpStar.j);
+
+    /*--- Direct dependence of the star state K on the state K. ---*/
+
+    VectorDbl<nDim> velK;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      velK(iDim) = blend(V.i.velocity(iDim), V.j.velocity(iDim));
+    }
+    VectorDbl<nVar> dPIK;
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      dPIK(iVar) = blend(dPI.i(iVar), dPI.j(iVar));
+    }
+    const Double enthalpyK = blend(V.i.enthalpy(), V.j.enthalpy());
+
+    MatrixDbl<nVar> jacK;
+    jacK(0,0) = omegaSM * sK;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      jacK(0,iDim+1) = -omegaSM * unitNormal(iDim);
+    }
+    jacK(0,nDim+1) = 0.0;
+
+    for (size_t jDim = 0; jDim < nDim; ++jDim) {
+      jacK(jDim+1,0) = omegaSM * (velK(jDim)*projVelK - dPIK(0)*unitNormal(jDim));
+      for (size_t iDim = 0; iDim < nDim; ++iDim) {
+        jacK(jDim+1,iDim+1) = -omegaSM * (velK(jDim)*unitNormal(iDim) + dPIK(iDim+1)*unitNormal(jDim));
+      }
+      jacK(jDim+1,jDim+1) += omegaSM * (sK - projVelK);
+      jacK(jDim+1,nDim+1) = -omegaSM * dPIK(nDim+1) * unitNormal(jDim);
+    }
+
+    jacK(nDim+1,0) = omegaSM * projVelK * (enthalpyK - dPIK(0));
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      jacK(nDim+1,iDim+1) = -omegaSM * (unitNormal(iDim)*enthalpyK + projVelK*dPIK(iDim+1));
+    }
+    jacK(nDim+1,nDim+1) = omegaSM * (sK - projVelK - projVelK*dPIK(nDim+1));
+
+    /*--- Jacobian of the flux of state K. ---*/
+
+    MatrixDbl<nVar> jacFull;
+    if (IdealGas) {
+      const Double energyK = blend(U.i.energy(), U.j.energy());
+      jacFull = inviscidProjJac(gamma, velK, energyK, unitNormal, 1.0);
+    }
+    else {
+      jacFull = inviscidProjJac(velK, enthalpyK, blend(chi.i, chi.j), blend(kappa.i, kappa.j), unitNormal, 1.0);
+    }
+
+    /*--- Combine. ---*/
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      for (size_t jVar = 0; jVar < nVar; ++jVar) {
+        const Double onlyK = (1.0-full) * jacK(iVar,jVar) + full * jacFull(iVar,jVar);
+        jac_i(iVar,jVar) = scale * ((1.0-full)*jacStar_i(iVar,jVar) + left*onlyK);
+        jac_j(iVar,jVar) = scale * ((1.0-full)*jacStar_j(iVar,jVar) + (1.0-left)*onlyK);
+      }
+    }
+  }
+
+public:
+  /*!
+   * \brief Constructor, store some constants and forward args to base.
+   */
+  template<class... Ts>
+  CHLLCScheme(const CConfig& config, unsigned iMesh, Ts&... args) : Base(config, iMesh, args...),
+    gamma(config.GetGamma()),
+    roeKappa(config.GetRoe_Kappa()),
+    finestGrid(iMesh == MESH_0),
+    dynamicGrid(config.GetDynamic_Grid()),
+    muscl(finestGrid && config.GetMUSCL_Flow()),
+    typeLimiter(static_cast<ENUM_LIMITER>(config.GetKind_SlopeLimit_Flow())) {
+  }
+
+  /*!
+   * \brief Implementation of the HLLC flux.
+   */
+  void ComputeFlux(Int iEdge,
+                   const CConfig& config,
+                   const CGeometry& geometry,
+                   const CVariable& solution_,
+                   UpdateType updateType,
+                   Double updateMask,
+                   bool implicit,
+                   CSysVector<su2double>& vector,
+                   SparseMatrixType& matrix) const final {
+
+    /*--- Start preaccumulation, inputs are registered
+     *    automatically in "gatherVariables". ---*/
+    AD::StartPreacc();
+
+    const auto& solution = static_cast<const CEulerVariable&>(solution_);
+
+    const auto iPoint = geometry.edges->GetNode(iEdge,0);
+    const auto jPoint = geometry.edges->GetNode(iEdge,1);
+
+    /*--- Geometric properties. ---*/
+
+    const auto vector_ij = distanceVector<nDim>(iPoint, jPoint, geometry.nodes->GetCoord());
+
+    const auto normal = gatherVariables<nDim>(iEdge, geometry.edges->GetNormal());
+    const auto area = norm(normal);
+    VectorDbl<nDim> unitNormal;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      unitNormal(iDim) = normal(iDim) / area;
+    }
+
+    /*--- Reconstructed primitives. ---*/
+
+    CPair<CCompressiblePrimitives<nDim,nPrimVar> > V1st;
+    V1st.i.all = gatherVariables<nPrimVar>(iPoint, solution.GetPrimitive());
+    V1st.j.all = gatherVariables<nPrimVar>(jPoint, solution.GetPrimitive());
+
+    auto V = reconstructPrimitives<CCompressiblePrimitives<nDim,nPrimVarGrad> >(
+                  iPoint, jPoint, muscl, typeLimiter, V1st, vector_ij, solution);
+
+    /*--- Compute conservative variables. ---*/
+
+    CPair<CCompressibleConservatives<nDim> > U;
+    U.i = compressibleConservatives(V.i);
+    U.j = compressibleConservatives(V.j);
+
+    /*--- Speeds of sound and Roe averaged variables. ---*/
+
+    Double soundSpeed_i, soundSpeed_j;
+    CPair<Double> chi, kappa;
+    CGeneralRoeVariables<nDim> roeAvg;
+
+    if (IdealGas) {
+      soundSpeed_i = sqrt((gamma-1)*(V.i.enthalpy()-0.5*squaredNorm<nDim>(V.i.velocity())));
+      soundSpeed_j = sqrt((gamma-1)*(V.j.enthalpy()-0.5*squaredNorm<nDim>(V.j.velocity())));
+      static_cast<CRoeVariables<nDim>&>(roeAvg) = roeAveragedVariables(gamma, V, unitNormal);
+    }
+    else {
+      const auto& secondary = solution.GetSecondary();
+      const auto secVar_i = gatherVariables<2>(iPoint, secondary);
+      const auto secVar_j = gatherVariables<2>(jPoint, secondary);
+
+      soundSpeed_i = generalGasDerivatives(V.i, secVar_i(0), secVar_i(1), chi.i, kappa.i);
+      soundSpeed_j = generalGasDerivatives(V.j, secVar_j(0), secVar_j(1), chi.j, kappa.j);
+
+      roeAvg = roeAveragedVariables(V, chi, kappa, unitNormal);
+      vinokurMontagne(V, chi, kappa, roeAvg);
+      roeAvg.speedSound = sqrt(abs(roeSoundSpeed2(roeAvg)));
+    }
+
+    /*--- Wave speed estimates. ---*/
+
+    const Double projVel_i = dot(V.i.velocity(), unitNormal);
+    const Double projVel_j = dot(V.j.velocity(), unitNormal);
+
+    const Double sL = min(roeAvg.projVel - roeAvg.speedSound, projVel_i - soundSpeed_i);
+    const Double sR = max(roeAvg.projVel + roeAvg.speedSound, projVel_j + soundSpeed_j);
+
+    /*--- Speed of the contact surface and pressure on both sides of it. ---*/
+
+    const Double rhoSum = V.j.density()*(sR-projVel_j) - V.i.density()*(sL-projVel_i);
+    const Double sM = (V.i.pressure() - V.j.pressure() - V.i.density()*projVel_i*(sL-projVel_i) +
+                       V.j.density()*projVel_j*(sR-projVel_j)) / rhoSum;
+    const Double pStar = V.j.density()*(projVel_j-sR)*(projVel_j-sM) + V.j.pressure();
+
+    /*--- Select the upwind side (K) of the contact surface, and whether
+     *    the flux is given by the state K or by the star state K. ---*/
+
+    const Double left = (sM > 0.0);
+    const Double full = left*(sL > 0.0) + (1.0-left)*(sR < 0.0);
+
+    const auto blend = [left](const Double& a, const Double& b) -> Double { return left*a + (1.0-left)*b; };
+
+    const Double sK = blend(sL, sR);
+    const Double projVelK = blend(projVel_i, projVel_j);
+    const Double pressureK = blend(V.i.pressure(), V.j.pressure());
+
+    CCompressibleConservatives<nDim> UK;
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      UK.all(iVar) = blend(U.i.all(iVar), U.j.all(iVar));
+    }
+
+    /*--- Star state of side K. ---*/
+
+    const Double omega = sK - projVelK;
+    const Double rhoStarK = omega / (sK - sM);
+
+    CCompressibleConservatives<nDim> UStar;
+    UStar.density() = rhoStarK * UK.density();
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      UStar.momentum(iDim) = rhoStarK * (UK.momentum(iDim) + (pStar-pressureK)/omega * unitNormal(iDim));
+    }
+    UStar.rhoEnergy() = rhoStarK * (UK.rhoEnergy() - (pressureK*projVelK - pStar*sM)/omega);
+
+    /*--- Flux, combination of the flux of state K and of the star state. ---*/
+
+    VectorDbl<nVar> flux;
+    flux(0) = area * (full*UK.density()*projVelK + (1.0-full)*sM*UStar.density());
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      flux(iDim+1) = area * (full*(UK.momentum(iDim)*projVelK + pressureK*unitNormal(iDim)) +
+                             (1.0-full)*(sM*UStar.momentum(iDim) + pStar*unitNormal(iDim)));
+    }
+    flux(nDim+1) = area * (full*(UK.rhoEnergy()+pressureK)*projVelK +
+                           (1.0-full)*sM*(UStar.rhoEnergy()+pStar));
+
+    /*--- Jacobians. ---*/
+
+    MatrixDbl<nVar> jac_i, jac_j;
+    if (implicit) {
+      CPair<Double> projVel;
+      projVel.i = projVel_i;
+      projVel.j = projVel_j;
+      hllcJacobians(V, U, chi, kappa, unitNormal, projVel, sL, sR, sM, pStar, rhoSum,
+                    UStar, left, full, area*roeKappa, jac_i, jac_j);
+    }
+
+    /*--- Correct for grid motion. ---*/
+
+    if (dynamicGrid) {
+      const auto& gridVel = geometry.nodes->GetGridVel();
+      const Double projGridVel = 0.5*(dot(gatherVariables<nDim>(iPoint,gridVel), unitNormal)+
+                                      dot(gatherVariables<nDim>(jPoint,gridVel), unitNormal));
+      for (size_t iVar = 0; iVar < nVar; ++iVar) {
+        Double dFdU = projGridVel * area * 0.5;
+        flux(iVar) -= dFdU * (U.i.all(iVar) + U.j.all(iVar));
+
+        if (implicit) {
+          jac_i(iVar,iVar) -= dFdU;
+          jac_j(iVar,iVar) -= dFdU;
+        }
+      }
+    }
+
+    /*--- Add the contributions from the base class (static decorator). ---*/
+
+    Base::viscousTerms(iEdge, iPoint, jPoint, V1st, solution_, vector_ij, geometry,
+                       config, area, unitNormal, implicit, flux, jac_i, jac_j);
+
+    /*--- Stop preaccumulation. ---*/
+
+    stopPreacc(flux);
+
+    /*--- Update the vector and system matrix. ---*/
+
+    updateLinearSystem(iEdge, iPoint, jPoint, implicit, updateType,
+                       updateMask, flux, jac_i, jac_j, vector, matrix);
+  }
+};
+
+/*!
+ * \brief HLLC scheme for general fluids (real gas).
+ */
+template<class Decorator>
+using CGeneralHLLCScheme = CHLLCScheme<Decorator,false>;
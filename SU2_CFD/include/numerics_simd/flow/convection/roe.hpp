@@ -85,6 +85,7 @@ public:
                    const CVariable& solution_,
                    UpdateType updateType,
                    Double updateMask,
+                   bool implicit,
                    CSysVector<su2double>& vector,
                    SparseMatrixType& matrix) const final {
 
@@ -92,7 +93,6 @@ public:
      *    automatically in "gatherVariables". ---*/
     AD::StartPreacc();
 
-    const bool implicit = (config.GetKind_TimeIntScheme() == EULER_IMPLICIT);
     const auto& solution = static_cast<const CEulerVariable&>(solution_);
 
     const auto iPoint = geometry.edges->GetNode(iEdge,0);
@@ -295,3 +295,219 @@ public:
     }
   }
 };
+
+/*!
+ * \class CGeneralRoeScheme
+ * \brief Roe scheme for general fluids (real gas), the thermodynamic derivatives
+ * dP/drho_e and dP/de_rho (secondary variables) are gathered for all SIMD lanes.
+ * \note With MUSCL reconstruction the derivatives are not extrapolated in a
+ * thermodynamically consistent way (that requires the fluid model), the values
+ * of the points are used instead.
+ */
+template<class Decorator>
+class CGeneralRoeScheme : public Decorator {
+private:
+  using Base = Decorator;
+  using Base::nDim;
+  static constexpr size_t nVar = CCompressibleConservatives<nDim>::nVar;
+  static constexpr size_t nPrimVarGrad = nDim+4;
+  static constexpr size_t nPrimVar = Max(Base::nPrimVar, nPrimVarGrad);
+
+  const su2double kappa;
+  const su2double entropyFix;
+  const bool finestGrid;
+  const bool dynamicGrid;
+  const bool muscl;
+  const ENUM_LIMITER typeLimiter;
+
+public:
+  /*!
+   * \brief Constructor, store some constants and forward args to base.
+   */
+  template<class... Ts>
+  CGeneralRoeScheme(const CConfig& config, unsigned iMesh, Ts&... args) : Base(config, iMesh, args...),
+    kappa(config.GetRoe_Kappa()),
+    entropyFix(config.GetEntropyFix_Coeff()),
+    finestGrid(iMesh == MESH_0),
+    dynamicGrid(config.GetDynamic_Grid()),
+    muscl(finestGrid && config.GetMUSCL_Flow()),
+    typeLimiter(static_cast<ENUM_LIMITER>(config.GetKind_SlopeLimit_Flow())) {
+  }
+
+  /*!
+   * \brief Implementation of the general Roe flux.
+   */
+  void ComputeFlux(Int iEdge,
+                   const CConfig& config,
+                   const CGeometry& geometry,
+                   const CVariable& solution_,
+                   UpdateType updateType,
+                   Double updateMask,
+                   bool implicit,
+                   CSysVector<su2double>& vector,
+                   SparseMatrixType& matrix) const final {
+
+    /*--- Start preaccumulation, inputs are registered
+     *    automatically in "gatherVariables". ---*/
+    AD::StartPreacc();
+
+    const auto& solution = static_cast<const CEulerVariable&>(solution_);
+
+    const auto iPoint = geometry.edges->GetNode(iEdge,0);
+    const auto jPoint = geometry.edges->GetNode(iEdge,1);
+
+    /*--- Geometric properties. ---*/
+
+    const auto vector_ij = distanceVector<nDim>(iPoint, jPoint, geometry.nodes->GetCoord());
+
+    const auto normal = gatherVariables<nDim>(iEdge, geometry.edges->GetNormal());
+    const auto area = norm(normal);
+    VectorDbl<nDim> unitNormal;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      unitNormal(iDim) = normal(iDim) / area;
+    }
+
+    /*--- Reconstructed primitives. ---*/
+
+    CPair<CCompressiblePrimitives<nDim,nPrimVar> > V1st;
+    V1st.i.all = gatherVariables<nPrimVar>(iPoint, solution.GetPrimitive());
+    V1st.j.all = gatherVariables<nPrimVar>(jPoint, solution.GetPrimitive());
+
+    auto V = reconstructPrimitives<CCompressiblePrimitives<nDim,nPrimVarGrad> >(
+                  iPoint, jPoint, muscl, typeLimiter, V1st, vector_ij, solution);
+
+    /*--- Thermodynamic derivatives (dP/drho_e, dP/de_rho). ---*/
+
+    const auto& secondary = solution.GetSecondary();
+    const auto secVar_i = gatherVariables<2>(iPoint, secondary);
+    const auto secVar_j = gatherVariables<2>(jPoint, secondary);
+
+    CPair<Double> chi, kappaGas;
+    generalGasDerivatives(V.i, secVar_i(0), secVar_i(1), chi.i, kappaGas.i);
+    generalGasDerivatives(V.j, secVar_j(0), secVar_j(1), chi.j, kappaGas.j);
+
+    /*--- Compute conservative variables. ---*/
+
+    CPair<CCompressibleConservatives<nDim> > U;
+    U.i = compressibleConservatives(V.i);
+    U.j = compressibleConservatives(V.j);
+
+    /*--- Roe averaged variables, the flux is zero where the speed of sound is not real. ---*/
+
+    auto roeAvg = roeAveragedVariables(V, chi, kappaGas, unitNormal);
+    const Double valid = (roeSoundSpeed2(roeAvg) > 0.0);
+
+    /*--- P tensor. ---*/
+
+    auto pMat = pMatrix(roeAvg.density, roeAvg.velocity, roeAvg.projVel, roeAvg.speedSound,
+                        roeAvg.enthalpy, roeAvg.chi, roeAvg.kappa, unitNormal);
+
+    auto pMatInv = pMatrixInv(roeAvg.density, roeAvg.velocity, roeAvg.projVel,
+                              roeAvg.speedSound, roeAvg.chi, roeAvg.kappa, unitNormal);
+
+    /*--- Grid motion. ---*/
+
+    Double projGridVel = 0.0, projVel = roeAvg.projVel;
+    if (dynamicGrid) {
+      const auto& gridVel = geometry.nodes->GetGridVel();
+      projGridVel = 0.5*(dot(gatherVariables<nDim>(iPoint,gridVel), unitNormal)+
+                         dot(gatherVariables<nDim>(jPoint,gridVel), unitNormal));
+      projVel -= projGridVel;
+    }
+
+    /*--- Convective eigenvalues with Mavriplis' entropy correction. ---*/
+
+    VectorDbl<nVar> lambda;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      lambda(iDim) = projVel;
+    }
+    lambda(nDim) = projVel + roeAvg.speedSound;
+    lambda(nDim+1) = projVel - roeAvg.speedSound;
+
+    Double maxLambda = abs(projVel) + roeAvg.speedSound;
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      lambda(iVar) = max(abs(lambda(iVar)), entropyFix*maxLambda);
+    }
+
+    /*--- Inviscid fluxes and Jacobians. ---*/
+
+    auto flux_i = inviscidProjFlux(V.i, U.i, normal);
+    auto flux_j = inviscidProjFlux(V.j, U.j, normal);
+
+    VectorDbl<nVar> flux;
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      flux(iVar) = kappa * (flux_i(iVar) + flux_j(iVar));
+    }
+
+    MatrixDbl<nVar> jac_i, jac_j;
+    if (implicit) {
+      jac_i = inviscidProjJac(V.i.velocity(), V.i.enthalpy(), chi.i, kappaGas.i, normal, kappa);
+      jac_j = inviscidProjJac(V.j.velocity(), V.j.enthalpy(), chi.j, kappaGas.j, normal, kappa);
+    }
+
+    /*--- Roe dissipation. ---*/
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      for (size_t jVar = 0; jVar < nVar; ++jVar) {
+        /*--- Compute |projModJacTensor| = P x |Lambda| x P^-1. ---*/
+
+        Double projModJacTensor = 0.0;
+        for (size_t kVar = 0; kVar < nVar; ++kVar) {
+          projModJacTensor += pMat(iVar,kVar) * lambda(kVar) * pMatInv(kVar,jVar);
+        }
+
+        Double dDdU = projModJacTensor * (1-kappa) * area;
+
+        /*--- Update flux and Jacobians. ---*/
+
+        flux(iVar) -= dDdU * (U.j.all(jVar) - U.i.all(jVar));
+
+        if(implicit) {
+          jac_i(iVar,jVar) += dDdU;
+          jac_j(iVar,jVar) -= dDdU;
+        }
+      }
+    }
+
+    /*--- Correct for grid motion. ---*/
+
+    if (dynamicGrid) {
+      for (size_t iVar = 0; iVar < nVar; ++iVar) {
+        Double dFdU = projGridVel * area * 0.5;
+        flux(iVar) -= dFdU * (U.i.all(iVar) + U.j.all(iVar));
+
+        if (implicit) {
+          jac_i(iVar,iVar) -= dFdU;
+          jac_j(iVar,iVar) -= dFdU;
+        }
+      }
+    }
+
+    /*--- Discard the convective terms of invalid lanes. ---*/
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      flux(iVar) *= valid;
+      if (implicit) {
+        for (size_t jVar = 0; jVar < nVar; ++jVar) {
+          jac_i(iVar,jVar) *= valid;
+          jac_j(iVar,jVar) *= valid;
+        }
+      }
+    }
+
+    /*--- Add the contributions from the base class (static decorator). ---*/
+
+    Base::viscousTerms(iEdge, iPoint, jPoint, V1st, solution_, vector_ij, geometry,
+                       config, area, unitNormal, implicit, flux, jac_i, jac_j);
+
+    /*--- Stop preaccumulation. ---*/
+
+    stopPreacc(flux);
+
+    /*--- Update the vector and system matrix. ---*/
+
+    updateLinearSystem(iEdge, iPoint, jPoint, implicit, updateType,
+                       updateMask, flux, jac_i, jac_j, vector, matrix);
+  }
+};
@@ -128,3 +128,64 @@ FORCEINLINE CRoeVariables<nDim> roeAveragedVariables(Double gamma,
   roeAvg.projVel = dot(roeAvg.velocity, normal);
   return roeAvg;
 }
+
+/*!
+ * \brief Pressure derivatives of a general fluid, chi = dP/drho_e - kappa*e and
+ * kappa = dP/de_rho / rho, from the primitive variables and from the secondary
+ * variables (dP/drho_e, dP/de_rho) of a point. The speed of sound is returned.
+ */
+template<class PrimVarType>
+FORCEINLINE Double generalGasDerivatives(const PrimVarType& V,
+                                         Double dPdrho_e,
+                                         Double dPde_rho,
+                                         Double& chi,
+                                         Double& kappa) {
+  const Double staticEnthalpy = V.enthalpy() - 0.5*squaredNorm<PrimVarType::nDim>(V.velocity());
+  const Double staticEnergy = staticEnthalpy - V.pressure() / V.density();
+  kappa = dPde_rho / V.density();
+  chi = dPdrho_e - kappa * staticEnergy;
+  return sqrt(chi + kappa * staticEnthalpy);
+}
+
+/*!
+ * \brief Roe-averaged variables, plus pressure derivatives, for a general fluid.
+ */
+template<size_t nDim>
+struct CGeneralRoeVariables : CRoeVariables<nDim> {
+  Double chi;
+  Double kappa;
+};
+
+/*!
+ * \brief Squared speed of sound from Roe-averaged variables of a general fluid.
+ */
+template<size_t nDim>
+FORCEINLINE Double roeSoundSpeed2(const CGeneralRoeVariables<nDim>& roeAvg) {
+  return roeAvg.chi + roeAvg.kappa * (roeAvg.enthalpy - 0.5*squaredNorm(roeAvg.velocity));
+}
+
+/*!
+ * \brief Compute Roe-averaged variables from pair of primitive variables
+ * and pressure derivatives (see generalGasDerivatives) of a general fluid.
+ * \note The squared speed of sound is not guaranteed to be positive, its
+ * absolute value is used, callers should check with "roeSoundSpeed2".
+ */
+template<size_t nDim, class PrimVarType>
+FORCEINLINE CGeneralRoeVariables<nDim> roeAveragedVariables(const CPair<PrimVarType>& V,
+                                                            const CPair<Double>& chi,
+                                                            const CPair<Double>& kappa,
+                                                            const VectorDbl<nDim>& normal) {
+  CGeneralRoeVariables<nDim> roeAvg;
+  Double R = sqrt(V.j.density() / V.i.density());
+  Double D = 1 / (R+1);
+  roeAvg.density = R * V.i.density();
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    roeAvg.velocity(iDim) = (R*V.j.velocity(iDim) + V.i.velocity(iDim)) * D;
+  }
+  roeAvg.enthalpy = (R*V.j.enthalpy() + V.i.enthalpy()) * D;
+  roeAvg.chi = 0.5 * (chi.i + chi.j);
+  roeAvg.kappa = 0.5 * (kappa.i + kappa.j);
+  roeAvg.speedSound = sqrt(abs(roeSoundSpeed2(roeAvg)));
+  roeAvg.projVel = dot(roeAvg.velocity, normal);
+  return roeAvg;
+}
@@ -34,7 +34,9 @@
 #include <iomanip>
 #include <limits>
 #include <vector>
+#include <future>
 
+#include "../../../Common/include/parallelization/mpi_structure.hpp"
 #include "../../../Common/include/toolboxes/printing_toolbox.hpp"
 #include "tools/CWindowingTools.hpp"
 #include "../../../Common/include/option_structure.hpp"
@@ -76,6 +78,9 @@ protected:
   curOuterIter,                   /*!< \brief Current value of the outer iteration index */
   curInnerIter;                   /*!< \brief Current value of the inner iteration index */
 
+  passivedouble lastSampleTime = 0.0,  /*!< \brief Wall time of the previous load balance sample. */
+  lastSampleWait = 0.0;                /*!< \brief MPI wait time of the previous load balance sample. */
+
   string historyFilename;   /*!< \brief The history filename*/
   char char_histfile[200];  /*! \brief Temporary variable to store the history filename */
   ofstream histFile;        /*! \brief Output file stream for the history */
@@ -167,6 +172,30 @@ protected:
    surfaceFilename,                     //!< Surface output filename
    restartFilename;                     //!< Restart output filename
 
+   bool cgnsVolumeSeriesStarted = false,  //!< Whether this run already wrote a step of the CGNS volume time series
+   cgnsSurfaceSeriesStarted = false;      //!< Whether this run already wrote a step of the CGNS surface time series
+
+   /*----------------------------- Asynchronous output ----------------------------*/
+
+   /*!
+    * \brief What is needed to write the volume and surface files, captured when the output is requested.
+    */
+   struct OutputSnapshot {
+     CParallelDataSorter* volumeSorter;   //!< Volume data sorter holding the data
+     CParallelDataSorter* surfaceSorter;  //!< Surface data sorter associated with the volume sorter
+     unsigned long timeIter;              //!< Time iteration of the data
+     su2double timeStep;                  //!< Time step of the data
+     su2double curTime;                   //!< Physical time of the data
+   };
+
+   bool asyncOutput = false;                               //!< Sort and write the files on a background thread
+   CParallelDataSorter* asyncVolumeDataSorter = nullptr;   //!< Volume data sorter of the output thread
+   CParallelDataSorter* asyncSurfaceDataSorter = nullptr;  //!< Surface data sorter of the output thread
+   SU2_MPI::Comm asyncComm;                                //!< Communicator of the output thread
+   std::future<su2double> outputTask;                      //!< Files of the last output, returns the restart bandwidth
+   ostringstream fileWritingLog;                           //!< File writing summary produced by the output thread
+   su2double asyncWaitTime = 0.0;                          //!< Time spent waiting for the output thread
+
   /** \brief Structure to store information for a volume output field.
    *
    *  The stored information is used to create the volume solution file.
@@ -477,8 +506,44 @@ public:
    */
   void WriteToFile(CConfig *config, CGeometry *geomery, unsigned short format, string fileName = "");
 
+  /*!
+   * \brief Wait for the files that are still being written by the output thread.
+   * \note Must be called before the geometry and config used by the output are deleted.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void Finalize(CConfig *config);
+
 protected:
 
+  /*!
+   * \brief Allocates the file writer for a format and writes the sorted data of a snapshot to file.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] snapshot - The data sorters and time information to write.
+   * \param[in] format - The output format.
+   * \param[in] fileName - The file name. If empty, the filenames are automatically determined.
+   * \return Bandwidth of the restart file (MB/s), zero for the other formats.
+   */
+  su2double WriteToFile(CConfig *config, CGeometry *geometry, const OutputSnapshot& snapshot,
+                        unsigned short format, string fileName = "");
+
+  /*!
+   * \brief Sort the data of a snapshot and write all requested volume and surface files.
+   * \note In asynchronous mode this runs on the output thread.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] snapshot - The data sorters and time information to write.
+   * \return Bandwidth of the restart files (MB/s), the config is only updated by the main thread.
+   */
+  su2double WriteVolumeFiles(CConfig *config, CGeometry *geometry, OutputSnapshot snapshot);
+
+  /*!
+   * \brief Wait for the output thread to finish the previous files and print their summary.
+   * \param[in] config - Definition of the particular problem, receives the restart bandwidth and the wait
+   *            time is reported if performance output is on (may be nullptr).
+   */
+  void WaitForOutputThread(CConfig *config);
+
   /*----------------------------- Protected member functions ----------------------------*/
 
   /*!
@@ -0,0 +1,117 @@
+/*!
+ * \file CCGNSFileWriter.hpp
+ * \brief Headers for the CGNS file writer class.
+ * \author SU2 Developers
+ * \version 7.1.0 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+#include "CFileWriter.hpp"
+
+/*!
+ * \class CCGNSFileWriter
+ * \brief Class for writing volume or surface solutions in unstructured CGNS format.
+ * \note All ranks write their part of the sorted data directly into the same file (no gather
+ *       to the master), collectively if the CGNS library is built with parallel HDF5, otherwise
+ *       in turns. Time-accurate solutions can be appended to an existing file as a series of
+ *       FlowSolution nodes, referenced by BaseIterativeData and ZoneIterativeData.
+ * \author SU2 Developers
+ * \version 7.1.0 "Blackbird"
+ */
+class CCGNSFileWriter final : public CFileWriter{
+
+  const bool isSurface;         //!< Whether the sorted data is a surface (cell dimension is nDim-1)
+  const unsigned long timeIter; //!< Current value of the time iteration
+  const su2double time;         //!< Current physical time
+  const bool timeSeries;        //!< Whether the solution is a step of a time series
+  const bool appendToFile;      //!< Append the step to an existing file instead of creating a new one
+
+  /*!
+   * \brief Steps of a time series stored in an existing file.
+   */
+  struct TimeSeries {
+    vector<double> timeValues;      //!< Physical time of the steps that are kept
+    vector<int> iterValues;         //!< Time iteration of the steps that are kept
+    vector<string> solutionNames;   //!< Solution node of the steps that are kept
+    vector<string> staleSolutions;  //!< Solution nodes that are not part of the kept steps
+  };
+
+  /*!
+   * \brief Read the steps before the current iteration from the existing file.
+   * \param[out] series - The steps that are kept and the solution nodes to delete
+   * \return Whether the file exists and its grid matches the sorted data
+   */
+  bool ReadTimeSeries(TimeSeries& series) const;
+
+  /*!
+   * \brief Create the base, zone and element sections (new files only).
+   */
+  void WriteGridStructure(int fn, const vector<unsigned long>& nElemPerRank) const;
+
+  /*!
+   * \brief Write this rank's share of the coordinates and connectivity into the existing structure.
+   */
+  void WriteGridData(int fn, const vector<unsigned long>& nElemPerRank) const;
+
+  /*!
+   * \brief Write this rank's share of the solution fields into the solution node S.
+   */
+  void WriteSolutionData(int fn, int S) const;
+
+  /*!
+   * \brief Delete solution nodes of the zone.
+   */
+  void DeleteSolutions(int fn, const vector<string>& solutionNames) const;
+
+  /*!
+   * \brief Append the current step to the series and write the iterative data (time values and solution pointers).
+   */
+  void WriteIterativeData(int fn, TimeSeries series, const string& solutionName) const;
+
+public:
+
+  /*!
+   * \brief File extension
+   */
+  const static string fileExt;
+
+  /*!
+   * \brief Construct a file writer using field names and the data sorter.
+   * \param[in] valFileName - The name of the file
+   * \param[in] valDataSorter - The parallel sorted data to write
+   * \param[in] valSurface - Whether the sorted data is a surface
+   * \param[in] valTimeIter - The current time iteration
+   * \param[in] valTime - The current physical time
+   * \param[in] valTimeSeries - Write the solution as a step of a time series
+   * \param[in] valAppend - Append the step to an existing file of the same grid, if any
+   */
+  CCGNSFileWriter(string valFileName, CParallelDataSorter* valDataSorter, bool valSurface,
+                  unsigned long valTimeIter = 0, su2double valTime = 0.0,
+                  bool valTimeSeries = false, bool valAppend = false);
+
+  /*!
+   * \brief Write sorted data to file in CGNS file format
+   */
+  void Write_Data() override;
+
+};
@@ -51,6 +51,11 @@ protected:
    */
   int size;
 
+  /*!
+   * \brief The communicator used for writing, the same as the one of the data sorter.
+   */
+  SU2_MPI::Comm comm;
+
   /*!
    * \brief The file extension to be attached to the filename.
    */
@@ -48,6 +48,11 @@ protected:
    */
   int size;
 
+  /*!
+   * \brief The communicator used for sorting the data.
+   */
+  SU2_MPI::Comm comm;
+
   unsigned long nGlobalPointBeforeSort; //!< Global number of points without halos before sorting
   unsigned long nLocalPointsBeforeSort;   //!< Local number of points without halos before sorting on this proc
 
@@ -312,6 +317,24 @@ public:
     return connSend[Index[iPoint] + iField];
   }
 
+  /*!
+   * \brief Copy the unsorted data of another sorter of the same points and fields.
+   * \param[in] other - The sorter to copy from.
+   */
+  void CopyUnsorted_Data(const CParallelDataSorter& other);
+
+  /*!
+   * \brief Set the communicator used for sorting, e.g. to sort on a thread other than the master.
+   * \note Must be called before the connectivity and the data are sorted.
+   * \param[in] newComm - Communicator with the same ranks as the one used to construct the sorter.
+   */
+  void SetComm(SU2_MPI::Comm newComm) { comm = newComm; }
+
+  /*!
+   * \brief Get the communicator used for sorting.
+   */
+  SU2_MPI::Comm GetComm() const { return comm; }
+
   /*!
    * \brief Get the Processor ID a Point belongs to.
    * \param[in] iPoint - global renumbered ID of the point
@@ -0,0 +1,75 @@
+/*!
+ * \file CSU2BinaryMeshFileWriter.hpp
+ * \brief Headers for the SU2 binary mesh file writer class.
+ * \author SU2 Developers
+ * \version 7.1.0 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+#include <cstdint>
+#include "CFileWriter.hpp"
+
+/*!
+ * \class CSU2BinaryMeshFileWriter
+ * \brief Class for writing the native SU2 binary mesh format with MPI I/O (single zone per file).
+ * \note The layout of the file is documented in CSU2BinaryMeshReaderFVM. As for the ASCII mesh writer,
+ *       the markers are taken from the boundary file written by CPhysicalGeometry (SU2_DEF).
+ * \author SU2 Developers
+ * \version 7.1.0 "Blackbird"
+ */
+class CSU2BinaryMeshFileWriter final: public CFileWriter{
+
+private:
+  unsigned short iZone, //!< Index of the current zone
+  nZone;                //!< Number of zones
+
+  /*!
+   * \brief Read the marker names and surface element records from the boundary file (master only).
+   * \param[out] markerTags - Names of the markers.
+   * \param[out] markerElems - Surface element records [vtkType n0 n1 n2 n3] of each marker.
+   */
+  void ReadBoundaryFile(vector<string>& markerTags, vector<vector<uint64_t> >& markerElems) const;
+
+public:
+
+  /*!
+   * \brief File extension
+   */
+  const static string fileExt;
+
+  /*!
+   * \brief Construct a file writer using the data sorter.
+   * \param[in] valFileName - The name of the file
+   * \param[in] valDataSorter - The parallel sorted data to write
+   * \param[in] valiZone - The index of the current zone
+   * \param[in] valnZone - The total number of zones
+   */
+  CSU2BinaryMeshFileWriter(string valFileName, CParallelDataSorter* valDataSorter,
+                           unsigned short valiZone, unsigned short valnZone);
+
+  /*!
+   * \brief Write sorted data to file in SU2 binary mesh file format
+   */
+  void Write_Data() override;
+
+};
@@ -318,6 +318,12 @@ public:
    */
   inline CFluidModel* GetFluidModel(void) const final { return FluidModel[omp_get_thread_num()]; }
 
+  /*!
+   * \brief Report how the look-up table fluid model was used, totals over all ranks.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void PrintStatistics(const CConfig *config) const final;
+
   /*!
    * \brief Compute the time step for solving the Euler equations.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -43,7 +43,7 @@ protected:
   su2double Gamma;           /*!< \brief Fluid's Gamma constant (ratio of specific heats). */
   su2double Gamma_Minus_One; /*!< \brief Fluids's Gamma - 1.0  . */
 
-  CFluidModel  *FluidModel; /*!< \brief fluid model used in the solver */
+  vector<CFluidModel*> FluidModel; /*!< \brief Fluid model used in the solver, one per thread as it stores the thermodynamic state. */
 
   su2double
   Mach_Inf,         /*!< \brief Mach number at infinity. */
@@ -208,6 +208,9 @@ protected:
   vector<unsigned long> startLocResInternalFacesWithHaloElem; /*!< \brief The starting location in the residual of the
                                                                           faces for the time levels of internal faces
                                                                           between an owned and a halo element. */
+  vector<unsigned long> startLocResMatchingFaces; /*!< \brief The starting location in the residual of the faces of
+                                                              every internal matching face, such that any range
+                                                              of faces can be treated independently. */
 
   bool symmetrizingTermsPresent;    /*!< \brief Whether or not symmetrizing terms are present in the
                                                 discretization. */
@@ -269,6 +272,56 @@ private:
 
   CVariable* GetBaseClassPointerToNodes() final {return nullptr;}
 
+  /*!
+   * \brief Number of chunks in which a range of elements or faces is split. A task
+            always consists of at least one chunk, also when the range is empty.
+   * \param[in] nItems    - Number of elements or faces in the range.
+   * \param[in] chunkSize - Number of items per chunk.
+   * \return The number of chunks.
+   */
+  static inline unsigned long NumberOfChunks(const unsigned long nItems,
+                                             const unsigned long chunkSize) {
+    return max<unsigned long>(1, roundUpDiv(nItems, chunkSize));
+  }
+
+  /*!
+   * \brief Carry out the chunks of a range of elements or faces that are claimed by the
+            calling thread. Every chunk is given to the thread that claims it first via
+            the shared counter nextChunk. Hence the function can be called by any number
+            of threads and does not synchronize them, a thread that finds all chunks
+            claimed returns immediately and can carry out other tasks.
+   * \param[in]     indBeg    - Start index of the range.
+   * \param[in]     indEnd    - End index (not included) of the range.
+   * \param[in]     chunkSize - Number of items per chunk.
+   * \param[in,out] nextChunk - Shared counter of the chunks claimed so far.
+   * \param[in]     task      - Function object, which carries out the task for a sub-range [beg,end).
+   * \return The number of chunks carried out by the calling thread.
+   */
+  template<class F>
+  unsigned long ForEachChunkOfRange(const unsigned long indBeg,
+                                    const unsigned long indEnd,
+                                    const unsigned long chunkSize,
+                                    unsigned long       &nextChunk,
+                                    const F             &task) const {
+
+    const unsigned long nItems  = (indEnd > indBeg) ? indEnd-indBeg : 0;
+    const unsigned long nChunks = NumberOfChunks(nItems, chunkSize);
+
+    unsigned long nChunksDone = 0;
+    while( true ) {
+      unsigned long iChunk;
+      SU2_OMP(atomic capture seq_cst)
+      iChunk = nextChunk++;
+      if(iChunk >= nChunks) break;
+
+      const unsigned long beg = indBeg + iChunk*chunkSize;
+      const unsigned long end = min(beg+chunkSize, indEnd);
+      if(beg < end) task(beg, end);
+      ++nChunksDone;
+    }
+    return nChunksDone;
+  }
+
 public:
 
   /*!
@@ -324,7 +377,7 @@ public:
    * \brief Compute the pressure at the infinity.
    * \return Value of the pressure at the infinity.
    */
-  inline CFluidModel* GetFluidModel(void) const final { return FluidModel;}
+  inline CFluidModel* GetFluidModel(void) const final { return FluidModel[omp_get_thread_num()]; }
 
   /*!
    * \brief Compute the density at the infinity.
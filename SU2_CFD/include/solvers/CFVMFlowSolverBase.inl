@@ -803,7 +803,7 @@ void CFVMFlowSolverBase<V, R>::BC_Sym_Plane(CGeometry* geometry, CSolver** solve
   unsigned short iDim, iVar;
   unsigned long iVertex, iPoint;
 
-  bool implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
+  bool implicit = ImplicitResidual(config);
   bool viscous = config->GetViscous();
   bool preprocessed = false;
 
@@ -1068,7 +1068,7 @@ void CFVMFlowSolverBase<V, FlowRegime>::BC_Fluid_Interface(CGeometry* geometry,
   unsigned long iVertex, jVertex, iPoint, Point_Normal = 0;
   unsigned short iDim, iVar, jVar, iMarker, nDonorVertex;
 
-  bool implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
+  bool implicit = ImplicitResidual(config);
   bool viscous = config->GetViscous();
 
   su2double Normal[MAXNDIM] = {0.0};
@@ -1234,7 +1234,7 @@ void CFVMFlowSolverBase<V, R>::BC_Custom(CGeometry* geometry, CSolver** solver_c
     unsigned short iVar;
     unsigned long iVertex, iPoint, total_index;
 
-    bool implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
+    bool implicit = ImplicitResidual(config);
 
     /*--- Get the physical time. ---*/
 
@@ -1295,6 +1295,12 @@ void CFVMFlowSolverBase<V, R>::EdgeFluxResidual(const CGeometry *geometry,
     InstantiateEdgeNumerics(solvers, config);
   }
 
+  /*--- Within a color each point is accessed by one thread, the adjoints (reverse AD)
+   *    can be updated without atomics. Not so with the reducer strategy. ---*/
+  const bool implicit = ImplicitResidual(config);
+
+  if (!ReducerStrategy) AD::StartNoSharedReading();
+
   /*--- Loop over edge colors. ---*/
   for (auto color : EdgeColoring) {
     /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
@@ -1309,16 +1315,18 @@ void CFVMFlowSolverBase<V, R>::EdgeFluxResidual(const CGeometry *geometry,
       }
 
       if (ReducerStrategy) {
-        edgeNumerics->ComputeFlux(iEdge, *config, *geometry, *nodes, UpdateType::REDUCTION, mask, EdgeFluxes, Jacobian);
+        edgeNumerics->ComputeFlux(iEdge, *config, *geometry, *nodes, UpdateType::REDUCTION, mask, implicit, EdgeFluxes, Jacobian);
       } else {
-        edgeNumerics->ComputeFlux(iEdge, *config, *geometry, *nodes, UpdateType::COLORING, mask, LinSysRes, Jacobian);
+        edgeNumerics->ComputeFlux(iEdge, *config, *geometry, *nodes, UpdateType::COLORING, mask, implicit, LinSysRes, Jacobian);
       }
     }
   }
 
+  if (!ReducerStrategy) AD::EndNoSharedReading();
+
   if (ReducerStrategy) {
     SumEdgeFluxes(geometry);
-    if (config->GetKind_TimeIntScheme() == EULER_IMPLICIT) {
+    if (implicit) {
       Jacobian.SetDiagonalAsColumnSum();
     }
   }
@@ -38,13 +38,33 @@
  */
 class CIncEulerSolver : public CFVMFlowSolverBase<CIncEulerVariable, INCOMPRESSIBLE> {
 protected:
-  su2double
-  *Primitive = nullptr,   /*!< \brief Auxiliary nPrimVar vector. */
-  *Primitive_i = nullptr, /*!< \brief Auxiliary nPrimVar vector for storing the primitive at point i. */
-  *Primitive_j = nullptr; /*!< \brief Auxiliary nPrimVar vector for storing the primitive at point j. */
+  vector<CFluidModel*> FluidModel;   /*!< \brief fluid model used in the solver. */
 
-  CFluidModel *FluidModel = nullptr;    /*!< \brief fluid model used in the solver */
-  su2double **Preconditioner = nullptr; /*!< \brief Auxiliary matrix for storing the low speed preconditioner. */
+  unsigned long ErrorCounter = 0;    /*!< \brief Counter for number of un-physical states. */
+
+  su2double Global_Delta_Time = 0.0, /*!< \brief Time-step for TIME_STEPPING time marching strategy. */
+  Global_Delta_UnstTimeND = 0.0,     /*!< \brief Unsteady time step for the dual time strategy. */
+  Max_Vel2 = 0.0;                    /*!< \brief Maximum squared velocity, used to compute the artificial compressibility. */
+
+  /*!
+   * \brief Generic implementation of explicit iterations (RK and EULER) with preconditioning.
+   */
+  template<ENUM_TIME_INT IntegrationType>
+  void Explicit_Iteration(CGeometry *geometry, CSolver **solver_container, CConfig *config, unsigned short iRKStep);
+
+  /*!
+   * \brief Compute the viscous contribution for a particular edge.
+   * \note The convective residual methods include a call to this for each edge,
+   *       this allows convective and viscous loops to be "fused".
+   * \param[in] iEdge - Edge for which the flux and Jacobians are to be computed.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] numerics - Description of the numerical method.
+   * \param[in] config - Definition of the particular problem.
+   */
+  inline virtual void Viscous_Residual(unsigned long iEdge, CGeometry *geometry, CSolver **solver_container,
+                                       CNumerics *numerics, CConfig *config) { }
+  using CSolver::Viscous_Residual; /*--- Silence warning ---*/
 
 public:
   /*!
@@ -77,10 +97,10 @@ public:
    * \brief Compute the pressure at the infinity.
    * \return Value of the pressure at the infinity.
    */
-  inline CFluidModel* GetFluidModel(void) const final { return FluidModel;}
+  inline CFluidModel* GetFluidModel(void) const final { return FluidModel[omp_get_thread_num()]; }
 
   /*!
-   * \brief Compute the time step for solving the Euler equations.
+   * \brief Compute the time step for solving the Euler and Navier-Stokes equations.
    * \param[in] geometry - Geometrical definition of the problem.
    * \param[in] solver_container - Container vector with all the solutions.
    * \param[in] config - Definition of the particular problem.
@@ -91,7 +111,7 @@ public:
                     CSolver **solver_container,
                     CConfig *config,
                     unsigned short iMesh,
-                    unsigned long Iteration) override;
+                    unsigned long Iteration) final;
 
   /*!
    * \brief Compute the spatial integration using a centered scheme.
@@ -370,10 +390,14 @@ public:
 
   /*!
    * \brief Compute the preconditioner for low-Mach flows.
-   * \param[in] iPoint - Index of the grid point
    * \param[in] config - Definition of the particular problem.
+   * \param[in] iPoint - Index of the grid point.
+   * \param[in] delta - Volume over delta t.
+   * \param[in,out] preconditioner - The preconditioner matrix, must be allocated outside.
    */
-  void SetPreconditioner(CConfig *config, unsigned long iPoint) final;
+  void SetPreconditioner(const CConfig *config, unsigned long iPoint,
+                         su2double delta, su2double** preconditioner) const;
+  using CSolver::SetPreconditioner; /*--- Silence warning. ---*/
 
   /*!
    * \brief A virtual member.
@@ -389,4 +413,9 @@ public:
    */
   void PrintVerificationError(const CConfig* config) const final;
 
+  /*!
+   * \brief The incompressible Euler and NS solvers support MPI+OpenMP.
+   */
+  inline bool GetHasHybridParallel() const final { return true; }
+
 };
@@ -41,6 +41,8 @@
 class CNEMOEulerSolver : public CFVMFlowSolverBase<CNEMOEulerVariable, COMPRESSIBLE> {
 protected:
 
+  static constexpr unsigned long PRIMVAR_BATCH_SIZE = 32; /*!< \brief Points per call of the batched temperatures of the gas model. */
+
   su2double
   Prandtl_Lam = 0.0,              /*!< \brief Laminar Prandtl number. */
   Prandtl_Turb = 0.0;             /*!< \brief Turbulent Prandtl number. */
@@ -59,10 +61,28 @@ protected:
   su2double Global_Delta_Time = 0.0, /*!< \brief Time-step for TIME_STEPPING time marching strategy. */
   Global_Delta_UnstTimeND = 0.0;     /*!< \brief Unsteady time step for the dual time strategy. */
 
-  CNEMOGas  *FluidModel;          /*!< \brief fluid model used in the solver */
+  vector<CNEMOGas*> FluidModel;   /*!< \brief Fluid model used in the solver, one per thread as it holds the thermodynamic state. */
 
   CNEMOEulerVariable* node_infty = nullptr;
 
+  vector<unsigned short> SourceJacobianRows; /*!< \brief Equations with chemistry or VT-transfer sources, the non-zero rows of their Jacobian. */
+
+  /*!
+   * \brief Compute the Jacobian of the chemistry and VT-transfer sources of a point w.r.t. its conservative variables.
+   * \note Forward differences, each conservative variable is perturbed and the primitives are recomputed with
+   *       the gas model (so that T, Tve, and the mixture density are consistent), the steps are relative to the
+   *       magnitude of the variables.
+   * \param[in] numerics - Source numerics of the calling thread, set for the point.
+   * \param[in] iPoint - Index of the point.
+   * \param[in] config - Definition of the particular problem.
+   * \param[out] U - Work array for the conservative variables (nVar).
+   * \param[out] V - Work array for the primitive variables (nPrimVar).
+   * \param[out] jacobian - Flat (nVar x nVar) Jacobian of the sources (already scaled by the volume).
+   * \return False if a perturbed state is not physical, the Jacobian is then incomplete.
+   */
+  bool ComputeSourceJacobian(CNumerics* numerics, unsigned long iPoint, const CConfig* config,
+                             su2double* U, su2double* V, su2double* jacobian) const;
+
 public:
 
   /*!
@@ -141,6 +161,20 @@ public:
   void Upwind_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics_container,
                        CConfig *config, unsigned short iMesh) final;
 
+  /*!
+   * \brief Compute the viscous contribution for a particular edge.
+   * \note The convective residual methods include a call to this for each edge,
+   *       this allows convective and viscous loops to be "fused".
+   * \param[in] iEdge - Edge for which the flux is to be computed.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] numerics - Description of the numerical method.
+   * \param[in] config - Definition of the particular problem.
+   */
+  inline virtual void Viscous_Residual(unsigned long iEdge, CGeometry *geometry, CSolver **solver_container,
+                                       CNumerics *numerics, CConfig *config) { }
+  using CSolver::Viscous_Residual; /*--- Silence warning ---*/
+
   /*!
    * \brief Recompute the extrapolated quantities, after MUSCL reconstruction,
    *        in a more thermodynamically consistent way.
@@ -220,7 +254,7 @@ public:
    * \brief Compute the pressure at the infinity.
    * \return Value of the pressure at the infinity.
    */
-  inline CNEMOGas* GetFluidModel(void) const final { return FluidModel;}
+  inline CNEMOGas* GetFluidModel(void) const final { return FluidModel[omp_get_thread_num()];}
 
   /*!
    * \brief Impose the far-field boundary condition using characteristics.
@@ -69,6 +69,7 @@ protected:
   unsigned short MGLevel;        /*!< \brief Multigrid level of this solver object. */
   unsigned short IterLinSolver;  /*!< \brief Linear solver iterations. */
   su2double ResLinSolver;        /*!< \brief Final linear solver residual. */
+  su2double TolLinSolver = 0.0;  /*!< \brief Tolerance of the last linear solve, if looser than the config one (e.g. inexact Newton). */
   unsigned short NonLinRes_Counter;   /*!< \brief Number of elements of the nonlinear residual indicator series. */
   vector<su2double> NonLinRes_Series; /*!< \brief Vector holding the nonlinear residual indicator series. */
   su2double Old_Func,  /*!< \brief Old value of the nonlinear residual indicator. */
@@ -133,6 +134,8 @@ protected:
 
   bool dynamic_grid;       /*!< \brief Flag that determines whether the grid is dynamic (moving or deforming + grid velocities). */
 
+  bool residual_only = false;  /*!< \brief Flag that prevents the residual routines from updating the Jacobian. */
+
   su2double ***VertexTraction;          /*- Temporary, this will be moved to a new postprocessing structure once in place -*/
   su2double ***VertexTractionAdjoint;   /*- Also temporary -*/
 
@@ -284,6 +287,28 @@ public:
    */
   inline void SetResLinSolver(su2double val_reslinsolver) { ResLinSolver = val_reslinsolver; }
 
+  /*!
+   * \brief Set the tolerance of the last linear solve, when it is not the one of the config.
+   * \param[in] val_tollinsolver - Relative tolerance (0 to use the config value).
+   */
+  inline void SetTolLinSolver(su2double val_tollinsolver) { TolLinSolver = val_tollinsolver; }
+
+  /*!
+   * \brief Evaluate only the residual, without updating the Jacobian, regardless of the time integration
+   *        (e.g. for Jacobian-free products). Must be set by one thread.
+   * \param[in] value - True to evaluate only the residual.
+   */
+  inline void SetResidualOnly(bool value) { residual_only = value; }
+
+  /*!
+   * \brief Whether the residual routines update the Jacobian.
+   * \param[in] config - Definition of the particular problem.
+   * \return True for implicit time integration, unless only the residual is evaluated.
+   */
+  inline bool ImplicitResidual(const CConfig *config) const {
+    return !residual_only && (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
+  }
+
   /*!
    * \brief Set the value of the max residual and RMS residual.
    * \param[in] val_iterlinsolver - Number of linear iterations.
@@ -338,6 +363,12 @@ public:
    */
   inline su2double GetResLinSolver(void) const { return ResLinSolver; }
 
+  /*!
+   * \brief Get the tolerance of the last linear solve, if it was not the one of the config.
+   * \return Relative tolerance, 0 if the config value was used.
+   */
+  inline su2double GetTolLinSolver(void) const { return TolLinSolver; }
+
   /*!
    * \brief Get the value of the maximum delta time.
    * \return Value of the maximum delta time.
@@ -739,6 +770,13 @@ public:
                                      CConfig *config,
                                      unsigned short iMesh) { }
 
+  /*!
+   * \brief Print the statistics gathered by the solver during the run.
+   * \note Called once by the driver on all ranks, before the solvers are deleted.
+   * \param[in] config - Definition of the particular problem.
+   */
+  inline virtual void PrintStatistics(const CConfig *config) const { }
+
   /*!
    * \brief A virtual member, overloaded.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -73,7 +73,8 @@ protected:
   MatrixType Cvves;  /*!< \brief Specific heat of vib-el mode w.r.t. species. */
   VectorType Gamma;  /*!< \brief Ratio of specific heats. */
 
-  CNEMOGas *fluidmodel;
+  mutable vector<vector<su2double> > rhosBuffer; /*!< \brief Per-thread species densities used by Cons2PrimVar. */
+  vector<vector<su2double> > batchBuffer;        /*!< \brief Per-thread inputs and outputs of the batched temperatures. */
 
   /*!< \brief Index definition for NEMO pritimive variables. */
   unsigned long RHOS_INDEX, T_INDEX, TVE_INDEX, VEL_INDEX, P_INDEX,
@@ -347,14 +348,38 @@ public:
   /*!
    * \brief Set all the primitive variables for compressible flows.
    */
-  bool SetPrimVar(unsigned long iPoint, CFluidModel *FluidModel) override;
+  inline bool SetPrimVar(unsigned long iPoint, CFluidModel *FluidModel) final {
+    return SetPrimVar(iPoint, FluidModel, nullptr);
+  }
+
+  /*!
+   * \brief Set all the primitive variables of a point.
+   * \param[in] iPoint - Point index.
+   * \param[in] FluidModel - Fluid model of the calling thread.
+   * \param[in] val_temperatures - T and Tve of the point if already computed, nullptr to compute them.
+   * \return True if the state is non-physical.
+   */
+  virtual bool SetPrimVar(unsigned long iPoint, CFluidModel *FluidModel, const su2double *val_temperatures);
+
+  /*!
+   * \brief Set all the primitive variables of a range of points, the temperatures are computed for the
+   *        whole range with one call to the batched API of the gas model.
+   * \param[in] iPointBegin - First point of the range.
+   * \param[in] iPointEnd - One past the last point of the range.
+   * \param[in] FluidModel - Fluid model of the calling thread.
+   * \return Number of non-physical points in the range.
+   */
+  unsigned long SetPrimVar(unsigned long iPointBegin, unsigned long iPointEnd, CFluidModel *FluidModel);
 
    /*!
   * \brief Set all the primitive and secondary variables from the conserved vector.
+  * \note The variables are not modified, different threads may convert different points
+  *       as long as each passes its own fluid model.
   */
   bool Cons2PrimVar(su2double *U, su2double *V, su2double *dPdU,
                     su2double *dTdU, su2double *dTvedU, su2double *val_eves,
-                    su2double *val_Cvves);
+                    su2double *val_Cvves, CNEMOGas *fluidmodel,
+                    const su2double *val_temperatures = nullptr) const;
 
   /*---------------------------------------*/
   /*---   Specific variable routines    ---*/
@@ -47,8 +47,6 @@ private:
   VectorType LaminarViscosity;  /*!< \brief Viscosity of the fluid. */
   VectorType ThermalCond;       /*!< \brief T-R thermal conductivity of the gas mixture. */
   VectorType ThermalCond_ve;    /*!< \brief V-E thermal conductivity of the gas mixture. */
-  vector<su2double> thermalconductivities;
-  vector<su2double> Ds;
 
   su2double inv_TimeScale;      /*!< \brief Inverse of the reference time scale. */
 
@@ -116,9 +114,15 @@ public:
 
 
   /*!
-   * \brief Set all the primitive variables for compressible flows.
+   * \brief Set all the primitive variables and the transport coefficients of a point.
+   * \param[in] iPoint - Point index.
+   * \param[in] FluidModel - Fluid model of the calling thread.
+   * \param[in] val_temperatures - T and Tve of the point if already computed, nullptr to compute them.
+   * \return True if the state is non-physical.
    */
-  bool SetPrimVar(unsigned long iPoint, CFluidModel *FluidModel) final;
+  bool SetPrimVar(unsigned long iPoint, CFluidModel *FluidModel, const su2double *val_temperatures) final;
+
+  using CNEMOEulerVariable::SetPrimVar;
 
   /*!
    * \brief Set the vorticity value.
@@ -60,8 +60,13 @@ int main(int argc, char *argv[]) {
 
   /*--- MPI initialization, and buffer setting ---*/
 
+#ifdef HAVE_MPI
+  /*--- The asynchronous output also needs MPI_THREAD_MULTIPLE in builds without OpenMP. ---*/
 #ifdef HAVE_OMP
   int required = use_thread_mult? MPI_THREAD_MULTIPLE : MPI_THREAD_FUNNELED;
+#else
+  int required = use_thread_mult? MPI_THREAD_MULTIPLE : MPI_THREAD_SINGLE;
+#endif
   int provided;
   SU2_MPI::Init_thread(&argc, &argv, required, &provided);
 #else
@@ -69,6 +74,9 @@ int main(int argc, char *argv[]) {
 #endif
   SU2_Comm MPICommunicator(MPI_COMM_WORLD);
 
+  /*--- Setup the AD tool (records the OpenMP constructs in reverse AD builds). ---*/
+  AD::Initialize();
+
   /*--- Uncomment the following line if runtime NaN catching is desired. ---*/
   // feenableexcept(FE_INVALID | FE_OVERFLOW);
 
@@ -170,6 +178,8 @@ int main(int argc, char *argv[]) {
   libxsmm_finalize();
 #endif
 
+  AD::Finalize();
+
   /*--- Finalize MPI parallelization. ---*/
   SU2_MPI::Finalize();
 
@@ -33,6 +33,7 @@
 #include "../../include/iteration/CIterationFactory.hpp"
 #include "../../include/iteration/CTurboIteration.hpp"
 #include "../../../Common/include/toolboxes/CQuasiNewtonInvLeastSquares.hpp"
+#include "../../../Common/include/toolboxes/CCheckpointScheduler.hpp"
 
 CDiscAdjSinglezoneDriver::CDiscAdjSinglezoneDriver(char* confFile,
                                                    unsigned short val_nZone,
@@ -119,6 +120,31 @@ CDiscAdjSinglezoneDriver::CDiscAdjSinglezoneDriver(char* confFile,
 
  direct_output->PreprocessHistoryOutput(config, false);
 
+  /*--- Checkpointing of the primal states for unsteady problems. ---*/
+
+  if (config->GetUnst_Checkpointing()) {
+    checkpoints = new CCheckpointScheduler(config->GetnUnst_Checkpoints_Memory(), config->GetnUnst_Checkpoints_Disk(),
+                                           config->GetUnst_Checkpoints_FileName());
+    checkpointSolvers.push_back(FLOW_SOL);
+    if (config->GetKind_Turb_Model() != NONE) checkpointSolvers.push_back(TURB_SOL);
+    if (config->GetWeakly_Coupled_Heat()) checkpointSolvers.push_back(HEAT_SOL);
+
+    /*--- The recomputed steps are monitored by their own output, without writing, such that the
+     *    history (e.g. time averaged objectives) of the adjoint iterations is not modified. ---*/
+    if (compressible) recompute_output = COutputFactory::CreateOutput(EULER, config, nDim);
+    else recompute_output = COutputFactory::CreateOutput(INC_EULER, config, nDim);
+    recompute_output->PreprocessHistoryOutput(config, false);
+
+    /*--- Store the state the primal simulation starts from, i.e. the initial condition of the first time step
+     *    (the solution is not restarted by the unsteady adjoint, see CConfig). ---*/
+    if (!config->GetRestart()) {
+      solver[FLOW_SOL]->SetInitialCondition(geometry_container[ZONE_0][INST_0], solver_container[ZONE_0][INST_0],
+                                            config, 0);
+    }
+    PackPrimalState();
+    initialState = checkpointBuffer;
+  }
+
 }
 
 CDiscAdjSinglezoneDriver::~CDiscAdjSinglezoneDriver(void) {
@@ -126,12 +152,46 @@ CDiscAdjSinglezoneDriver::~CDiscAdjSinglezoneDriver(void) {
   delete direct_iteration;
   delete direct_output;
 
+  delete checkpoints;
+  delete recompute_output;
+
+}
+
+void CDiscAdjSinglezoneDriver::PrintStatistics() {
+
+  CDriver::PrintStatistics();
+
+  if (checkpoints && (rank == MASTER_NODE)) {
+    const auto& stats = checkpoints->GetStatistics();
+    const passivedouble MB = 1.0 / (1024*1024);
+    const passivedouble stateSize = checkpointBuffer.size() * sizeof(passivedouble) * MB;
+
+    cout << "\nUnsteady adjoint checkpointing (rank 0):\n"
+         << "  Primal states provided: " << stats.requests << ", snapshots: " << checkpoints->GetnSlots()
+         << " (used " << stats.maxSlotsUsed << ")\n"
+         << "  Recomputed time steps: " << stats.advances << " ("
+         << stats.advances / max(1.0, passivedouble(stats.requests)) << " per state, "
+         << stats.timeAdvance << " s)\n"
+         << "  Snapshots stored/restored, memory: " << stats.storesMemory << "/" << stats.restoresMemory
+         << ", disk: " << stats.storesDisk << "/" << stats.restoresDisk << "\n"
+         << "  Peak snapshot memory: " << stats.bytesMemory*MB << " MB, written to disk: "
+         << stats.bytesDisk*MB << " MB (" << stats.timeDisk << " s)\n"
+         << "  Storing all states would require: " << stats.requests*stateSize << " MB" << endl;
+  }
+
 }
 
 void CDiscAdjSinglezoneDriver::Preprocess(unsigned long TimeIter) {
 
   config_container[ZONE_0]->SetTimeIter(TimeIter);
 
+  /*--- Recompute the primal state for unsteady problems, otherwise it is loaded by the iteration. ---*/
+
+  if (checkpoints) {
+    SetPrimalState(config->GetUnst_AdjointIter() - long(TimeIter) - 1);
+    config->SetTimeIter(TimeIter);
+  }
+
   /*--- NOTE: Inv Design Routines moved to CDiscAdjFluidIteration::Preprocess ---*/
 
   /*--- Preprocess the adjoint iteration ---*/
@@ -295,7 +355,7 @@ void CDiscAdjSinglezoneDriver::SetRecording(unsigned short kind_recording){
     if (rank == MASTER_NODE) AD::PrintStatistics();
 #ifdef CODI_REVERSE_TYPE
     if (size > SINGLE_NODE) {
-      su2double myMem = AD::globalTape.getTapeValues().getUsedMemorySize(), totMem = 0.0;
+      su2double myMem = AD::getGlobalTape().getTapeValues().getUsedMemorySize(), totMem = 0.0;
       SU2_MPI::Allreduce(&myMem, &totMem, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
       if (rank == MASTER_NODE) {
         cout << "MPI\n";
@@ -581,3 +641,126 @@ void CDiscAdjSinglezoneDriver::SecondaryRecording(){
   AD::ClearAdjoints();
 
 }
+
+void CDiscAdjSinglezoneDriver::SetPrimalState(long step) {
+
+  const auto timeIter = config->GetTimeIter();
+  const auto physicalTime = config->GetPhysicalTime();
+  const auto innerIter = config->GetInnerIter();
+
+  long current = -1;
+
+  for (const auto& op : checkpoints->Request(step)) {
+    switch (op.action) {
+      case CCheckpointScheduler::Action::RESTORE_INITIAL:
+        checkpointBuffer = initialState;
+        UnpackPrimalState();
+        current = -1;
+        break;
+
+      case CCheckpointScheduler::Action::RESTORE:
+        checkpoints->Load(op.slot, checkpointBuffer);
+        UnpackPrimalState();
+        current = op.step;
+        break;
+
+      case CCheckpointScheduler::Action::ADVANCE: {
+        const auto start = SU2_MPI::Wtime();
+        if (current < 0) PreprocessPrimalState();
+        while (current < op.step) AdvancePrimal(++current);
+        checkpoints->GetStatistics().timeAdvance += SU2_MPI::Wtime() - start;
+        break;
+      }
+
+      case CCheckpointScheduler::Action::STORE:
+        PackPrimalState();
+        checkpoints->Save(op.slot, checkpointBuffer);
+        break;
+    }
+  }
+
+  /*--- The auxiliary variables are consistent with the state after advancing, but not after a restore. ---*/
+
+  PreprocessPrimalState();
+
+  config->SetTimeIter(timeIter);
+  config->SetPhysicalTime(physicalTime);
+  config->SetInnerIter(innerIter);
+}
+
+void CDiscAdjSinglezoneDriver::AdvancePrimal(long step) {
+
+  config->SetTimeIter(step);
+  config->SetPhysicalTime(step * config->GetDelta_UnstTimeND());
+
+  /*--- Push the converged solution to the previous time levels, then converge the new time step. ---*/
+
+  direct_iteration->Update(recompute_output, integration_container, geometry_container, solver_container,
+                           numerics_container, config_container, surface_movement, grid_movement, FFDBox,
+                           ZONE_0, INST_0);
+
+  direct_iteration->Solve(recompute_output, integration_container, geometry_container, solver_container,
+                          numerics_container, config_container, surface_movement, grid_movement, FFDBox,
+                          ZONE_0, INST_0);
+}
+
+void CDiscAdjSinglezoneDriver::PackPrimalState() {
+
+  checkpointBuffer.clear();
+
+  for (auto iSol : checkpointSolvers) {
+    for (auto iMesh = 0u; iMesh <= config->GetnMGLevels(); ++iMesh) {
+      const auto sol = solver_container[ZONE_0][INST_0][iMesh][iSol];
+      if (sol == nullptr) continue;
+      const auto nodes = sol->GetNodes();
+      for (auto iPoint = 0ul; iPoint < geometry_container[ZONE_0][INST_0][iMesh]->GetnPoint(); ++iPoint) {
+        for (auto iVar = 0u; iVar < sol->GetnVar(); ++iVar) {
+          checkpointBuffer.push_back(SU2_TYPE::GetValue(nodes->GetSolution(iPoint, iVar)));
+          checkpointBuffer.push_back(SU2_TYPE::GetValue(nodes->GetSolution_time_n(iPoint, iVar)));
+          checkpointBuffer.push_back(SU2_TYPE::GetValue(nodes->GetSolution_time_n1(iPoint, iVar)));
+        }
+      }
+    }
+  }
+}
+
+void CDiscAdjSinglezoneDriver::UnpackPrimalState() {
+
+  auto value = checkpointBuffer.cbegin();
+
+  for (auto iSol : checkpointSolvers) {
+    for (auto iMesh = 0u; iMesh <= config->GetnMGLevels(); ++iMesh) {
+      auto sol = solver_container[ZONE_0][INST_0][iMesh][iSol];
+      if (sol == nullptr) continue;
+      auto nodes = sol->GetNodes();
+      for (auto iPoint = 0ul; iPoint < geometry_container[ZONE_0][INST_0][iMesh]->GetnPoint(); ++iPoint) {
+        for (auto iVar = 0u; iVar < sol->GetnVar(); ++iVar) {
+          nodes->SetSolution(iPoint, iVar, *(value++));
+          nodes->Set_Solution_time_n(iPoint, iVar, *(value++));
+          nodes->Set_Solution_time_n1(iPoint, iVar, *(value++));
+        }
+      }
+    }
+  }
+
+  if (value != checkpointBuffer.cend()) {
+    SU2_MPI::Error("Size mismatch in checkpoint data.", CURRENT_FUNCTION);
+  }
+}
+
+void CDiscAdjSinglezoneDriver::PreprocessPrimalState() {
+
+  /*--- Same as when loading a restart in CDiscAdjFluidIteration::LoadUnsteady_Solution. ---*/
+
+  for (auto iMesh = 0u; iMesh <= config->GetnMGLevels(); ++iMesh) {
+    auto solvers = solver_container[ZONE_0][INST_0][iMesh];
+    auto geo = geometry_container[ZONE_0][INST_0][iMesh];
+
+    solvers[FLOW_SOL]->Preprocessing(geo, solvers, config, iMesh, NO_RK_ITER, RUNTIME_FLOW_SYS, false);
+
+    for (auto iSol : {TURB_SOL, HEAT_SOL}) {
+      if (find(checkpointSolvers.begin(), checkpointSolvers.end(), iSol) != checkpointSolvers.end() && solvers[iSol])
+        solvers[iSol]->Postprocessing(geo, solvers, config, iMesh);
+    }
+  }
+}
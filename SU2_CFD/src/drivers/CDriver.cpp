@@ -31,6 +31,7 @@
 #include "../../../Common/include/geometry/CDummyGeometry.hpp"
 #include "../../../Common/include/geometry/CPhysicalGeometry.hpp"
 #include "../../../Common/include/geometry/CMultiGridGeometry.hpp"
+#include "../../../Common/include/toolboxes/CPerformanceTracer.hpp"
 
 #include "../../include/solvers/CSolverFactory.hpp"
 #include "../../include/solvers/CFEM_DG_EulerSolver.hpp"
@@ -125,6 +126,14 @@ CDriver::CDriver(char* confFile, unsigned short val_nZone, SU2_Comm MPICommunica
 
   Input_Preprocessing(config_container, driver_config);
 
+  /*--- Start recording the performance trace, if requested. ---*/
+
+  if (config_container[ZONE_0]->GetPerformance_Trace())
+    CPerformanceTracer::Initialize(config_container[ZONE_0]->GetPerformance_Trace_Buffer());
+
+  if (config_container[ZONE_0]->GetLoad_Balance_Report())
+    CPerformanceTracer::EnableWaitTimer();
+
   /*--- Retrieve dimension from mesh file ---*/
 
   nDim = CConfig::GetnDim(config_container[ZONE_0]->GetMesh_FileName(),
@@ -279,6 +288,7 @@ CDriver::CDriver(char* confFile, unsigned short val_nZone, SU2_Comm MPICommunica
 
   UsedTime = StopTime-StartTime;
   UsedTimePreproc    = UsedTime;
+  CPerformanceTracer::ResetWaitTime();
   UsedTimeCompute    = 0.0;
   UsedTimeOutput     = 0.0;
   IterCount          = 0;
@@ -375,6 +385,17 @@ void CDriver::SetContainers_Null(){
 void CDriver::Postprocessing() {
 
   const bool wrt_perf = config_container[ZONE_0]->GetWrt_Performance();
+  const bool wrt_load_balance = config_container[ZONE_0]->GetLoad_Balance_Report();
+  const string load_balance_file = config_container[ZONE_0]->GetLoad_Balance_FileName() + "_runtime.csv";
+
+  /*--- Finish the files still being written asynchronously, they need the geometry and config. ---*/
+
+  if (output_container != nullptr) {
+    for (iZone = 0; iZone < nZone; iZone++) {
+      if (output_container[iZone] != nullptr)
+        output_container[iZone]->Finalize(config_container[iZone]);
+    }
+  }
 
     /*--- Output some information to the console. ---*/
 
@@ -388,6 +409,8 @@ void CDriver::Postprocessing() {
       cout << "Warning: " << config_container[ZONE_0]->GetNonphysical_Reconstr() << " reconstructed states for upwinding are non-physical." << endl;
   }
 
+  PrintStatistics();
+
   if (rank == MASTER_NODE)
     cout << endl <<"------------------------- Solver Postprocessing -------------------------" << endl;
 
@@ -496,6 +519,10 @@ void CDriver::Postprocessing() {
   config_container[ZONE_0]->SetProfilingCSV();
   config_container[ZONE_0]->GEMMProfilingCSV();
 
+  /*--- Write the performance trace (if one was recorded). ---*/
+
+  CPerformanceTracer::WriteTrace(config_container[ZONE_0]->GetPerformance_Trace_FileName());
+
   /*--- Deallocate config container ---*/
   if (config_container!= nullptr) {
     for (iZone = 0; iZone < nZone; iZone++) {
@@ -538,6 +565,43 @@ void CDriver::Postprocessing() {
   UsedTime = StopTime-StartTime;
   UsedTimeCompute += UsedTime;
 
+  /*--- Compute (excluding MPI waits) and wait time per iteration of each rank. ---*/
+
+  su2double ComputeTimeMin = 0.0, ComputeTimeAvg = 0.0, ComputeTimeMax = 0.0;
+  su2double WaitTimeMin = 0.0, WaitTimeAvg = 0.0, WaitTimeMax = 0.0;
+
+  if (wrt_load_balance) {
+    const su2double nIter = max<unsigned long>(IterCount, 1);
+    const su2double WaitTime = CPerformanceTracer::GetWaitTime();
+    const su2double MyTimes[2] = {(UsedTimeCompute-WaitTime)/nIter, WaitTime/nIter};
+
+    vector<su2double> Times(2*size);
+    SU2_MPI::Allgather(MyTimes, 2, MPI_DOUBLE, Times.data(), 2, MPI_DOUBLE, MPI_COMM_WORLD);
+
+    ComputeTimeMin = ComputeTimeMax = Times[0];
+    WaitTimeMin = WaitTimeMax = Times[1];
+    for (int iRank = 0; iRank < size; iRank++) {
+      ComputeTimeMin = min(ComputeTimeMin, Times[2*iRank]);
+      ComputeTimeMax = max(ComputeTimeMax, Times[2*iRank]);
+      ComputeTimeAvg += Times[2*iRank]/size;
+      WaitTimeMin = min(WaitTimeMin, Times[2*iRank+1]);
+      WaitTimeMax = max(WaitTimeMax, Times[2*iRank+1]);
+      WaitTimeAvg += Times[2*iRank+1]/size;
+    }
+
+    if (rank == MASTER_NODE) {
+      ofstream LoadBalanceFile(load_balance_file);
+      LoadBalanceFile << "\"Rank\",\"Compute_Time_per_Iter(s)\",\"Wait_Time_per_Iter(s)\",\"Wait_Fraction\"\n";
+      LoadBalanceFile.precision(6);
+      for (int iRank = 0; iRank < size; iRank++) {
+        const su2double Total = Times[2*iRank] + Times[2*iRank+1];
+        LoadBalanceFile << iRank << "," << Times[2*iRank] << "," << Times[2*iRank+1] << ","
+                        << ((Total > 0.0)? Times[2*iRank+1]/Total : su2double(0.0)) << "\n";
+      }
+      cout << "Compute and wait times of each rank written to " << load_balance_file << "." << endl;
+    }
+  }
+
   if ((rank == MASTER_NODE) && (wrt_perf)) {
     su2double TotalTime = UsedTimePreproc + UsedTimeCompute + UsedTimeOutput;
     cout.precision(6);
@@ -564,6 +628,15 @@ void CDriver::Postprocessing() {
       cout << setw(25) << "Core-s/iter/Mpoints:" << setw(12)<< (su2double)size*UsedTimeCompute/(su2double)IterCount/Mpoints << " | ";
       cout << setw(20) << "Mpoints/s:" << setw(12)<< Mpoints*(su2double)IterCount/UsedTimeCompute << endl;
     } else cout << endl;
+    if (wrt_load_balance) {
+      cout << setw(25) << "Min. compute s/iter:" << setw(12)<< ComputeTimeMin << " | ";
+      cout << setw(20) << "Min. wait s/iter:" << setw(12)<< WaitTimeMin << endl;
+      cout << setw(25) << "Avg. compute s/iter:" << setw(12)<< ComputeTimeAvg << " | ";
+      cout << setw(20) << "Avg. wait s/iter:" << setw(12)<< WaitTimeAvg << endl;
+      cout << setw(25) << "Max. compute s/iter:" << setw(12)<< ComputeTimeMax << " | ";
+      cout << setw(20) << "Max. wait s/iter:" << setw(12)<< WaitTimeMax << endl;
+      cout << setw(25) << "Load imbalance (max/avg):" << setw(12)<< ComputeTimeMax/max(ComputeTimeAvg, su2double(1e-16)) << " | " << endl;
+    }
     cout << endl;
     cout << "Output phase:" << endl;
     cout << setw(25) << "Output Time (s):"  << setw(12)<< UsedTimeOutput << " | ";
@@ -587,6 +660,19 @@ void CDriver::Postprocessing() {
 
 }
 
+void CDriver::PrintStatistics() {
+
+  for (iZone = 0; iZone < nZone; iZone++) {
+    for (iInst = 0; iInst < nInst[iZone]; iInst++) {
+      for (unsigned short iSol = 0; iSol < MAX_SOLS; iSol++) {
+        const auto solver = solver_container[iZone][iInst][MESH_0][iSol];
+        if (solver != nullptr) solver->PrintStatistics(config_container[iZone]);
+      }
+    }
+  }
+
+}
+
 
 void CDriver::Input_Preprocessing(CConfig **&config, CConfig *&driver_config) {
 
@@ -1050,6 +1136,10 @@ void CDriver::Solver_Preprocessing(CConfig* config, CGeometry** geometry, CSolve
     }
   }
 
+  /*--- Report the balance of the partitions, all the solution variables are exchanged per halo update. ---*/
+
+  if (!fem_solver) geometry[MESH_0]->ComputePartitionStatistics(config, DOFsPerPoint);
+
   bool update_geo = true;
   if (config->GetFSI_Simulation()) update_geo = false;
 
@@ -1371,7 +1461,7 @@ void CDriver::Integration_Preprocessing(CConfig *config, CSolver **solver, CInte
 
   ENUM_MAIN_SOLVER kindMainSolver = static_cast<ENUM_MAIN_SOLVER>(config->GetKind_Solver());
 
-  integration = CIntegrationFactory::CreateIntegrationContainer(kindMainSolver, solver);
+  integration = CIntegrationFactory::CreateIntegrationContainer(kindMainSolver, solver, config);
 
 }
 
@@ -3016,8 +3106,11 @@ void CFluidDriver::Run() {
   if ( unsteady ) {
     for (iZone = 0; iZone < nZone; iZone++) {
       for (jZone = 0; jZone < nZone; jZone++)
-        if(jZone != iZone && interpolator_container[iZone][jZone] != nullptr)
-        interpolator_container[iZone][jZone]->SetTransferCoeff(config_container);
+        if(jZone != iZone && interpolator_container[iZone][jZone] != nullptr) {
+          interpolator_container[iZone][jZone]->SetTransferCoeff(config_container);
+          if (interface_container[iZone][jZone] != nullptr)
+            interface_container[iZone][jZone]->ResetTransferPlans();
+        }
     }
   }
 
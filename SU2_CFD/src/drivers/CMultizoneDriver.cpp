@@ -30,6 +30,7 @@
 #include "../../../Common/include/interface_interpolation/CInterpolator.hpp"
 #include "../../include/output/COutput.hpp"
 #include "../../include/iteration/CIteration.hpp"
+#include "../../../Common/include/toolboxes/CPerformanceTracer.hpp"
 
 CMultizoneDriver::CMultizoneDriver(char* confFile, unsigned short val_nZone, SU2_Comm MPICommunicator) :
                   CDriver(confFile, val_nZone, MPICommunicator, false) {
@@ -219,6 +220,8 @@ void CMultizoneDriver::StartSolver() {
 
 void CMultizoneDriver::Preprocess(unsigned long TimeIter) {
 
+  CTraceScope trace("CMultizoneDriver::Preprocess", "driver");
+
   bool unsteady = driver_config->GetTime_Domain();
 
 
@@ -283,8 +286,11 @@ void CMultizoneDriver::Preprocess(unsigned long TimeIter) {
   if ( unsteady ) {
     for (iZone = 0; iZone < nZone; iZone++) {
       for (unsigned short jZone = 0; jZone < nZone; jZone++){
-        if(jZone != iZone && interpolator_container[iZone][jZone] != nullptr && prefixed_motion[iZone])
+        if(jZone != iZone && interpolator_container[iZone][jZone] != nullptr && prefixed_motion[iZone]) {
           interpolator_container[iZone][jZone]->SetTransferCoeff(config_container);
+          if (interface_container[iZone][jZone] != nullptr)
+            interface_container[iZone][jZone]->ResetTransferPlans();
+        }
       }
     }
   }
@@ -293,6 +299,8 @@ void CMultizoneDriver::Preprocess(unsigned long TimeIter) {
 
 void CMultizoneDriver::Run_GaussSeidel() {
 
+  CTraceScope trace("CMultizoneDriver::Run_GaussSeidel", "driver");
+
   unsigned long iOuter_Iter;
   unsigned short jZone, UpdateMesh;
   bool DeformMesh = false;
@@ -345,6 +353,8 @@ void CMultizoneDriver::Run_GaussSeidel() {
 
 void CMultizoneDriver::Run_Jacobi() {
 
+  CTraceScope trace("CMultizoneDriver::Run_Jacobi", "driver");
+
   unsigned long iOuter_Iter;
   unsigned short jZone, UpdateMesh;
   bool DeformMesh = false;
@@ -444,6 +454,8 @@ bool CMultizoneDriver::OuterConvergence(unsigned long OuterIter) {
 
 void CMultizoneDriver::Update() {
 
+  CTraceScope trace("CMultizoneDriver::Update", "driver");
+
   /*--- For enabling a consistent restart, we need to update the mesh with the interface information that introduces displacements --*/
   /*--- Loop over the number of zones (IZONE) ---*/
   for (iZone = 0; iZone < nZone; iZone++){
@@ -476,6 +488,8 @@ void CMultizoneDriver::Update() {
 
 void CMultizoneDriver::Output(unsigned long TimeIter) {
 
+  CTraceScope trace("CMultizoneDriver::Output", "driver");
+
   /*--- Time the output for performance benchmarking. ---*/
 
   StopTime = SU2_MPI::Wtime();
@@ -29,6 +29,7 @@
 #include "../../include/definition_structure.hpp"
 #include "../../include/output/COutput.hpp"
 #include "../../include/iteration/CIteration.hpp"
+#include "../../../Common/include/toolboxes/CPerformanceTracer.hpp"
 
 CSinglezoneDriver::CSinglezoneDriver(char* confFile,
                        unsigned short val_nZone,
@@ -107,6 +108,8 @@ void CSinglezoneDriver::StartSolver() {
 
 void CSinglezoneDriver::Preprocess(unsigned long TimeIter) {
 
+  CTraceScope trace("CSinglezoneDriver::Preprocess", "driver");
+
   /*--- Set runtime option ---*/
 
   Runtime_Options();
@@ -150,6 +153,8 @@ void CSinglezoneDriver::Preprocess(unsigned long TimeIter) {
 
 void CSinglezoneDriver::Run() {
 
+  CTraceScope trace("CSinglezoneDriver::Run", "driver");
+
   unsigned long OuterIter = 0;
   config_container[ZONE_0]->SetOuterIter(OuterIter);
 
@@ -174,6 +179,8 @@ void CSinglezoneDriver::Postprocess() {
 
 void CSinglezoneDriver::Update() {
 
+  CTraceScope trace("CSinglezoneDriver::Update", "driver");
+
   iteration_container[ZONE_0][INST_0]->Update(output_container[ZONE_0], integration_container, geometry_container,
         solver_container, numerics_container, config_container,
         surface_movement, grid_movement, FFDBox, ZONE_0, INST_0);
@@ -182,6 +189,8 @@ void CSinglezoneDriver::Update() {
 
 void CSinglezoneDriver::Output(unsigned long TimeIter) {
 
+  CTraceScope trace("CSinglezoneDriver::Output", "driver");
+
   /*--- Time the output for performance benchmarking. ---*/
 
   StopTime = SU2_MPI::Wtime();
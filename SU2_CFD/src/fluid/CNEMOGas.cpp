@@ -312,3 +312,18 @@ void CNEMOGas::ComputedTvedU(su2double *V, vector<su2double>& val_eves, su2doubl
 
 }
 
+void CNEMOGas::ComputeBatchTemperatures(unsigned long nPoint, const su2double* val_rhos, const su2double* rhoEmix,
+                                        const su2double* rhoEve, const su2double* rhoEvel, su2double* val_T,
+                                        su2double* val_Tve) {
+
+  vector<su2double> pointRhos(nSpecies);
+
+  for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
+    for (auto iSpecies = 0u; iSpecies < nSpecies; iSpecies++)
+      pointRhos[iSpecies] = val_rhos[iSpecies*nPoint+iPoint];
+
+    const auto& T = ComputeTemperatures(pointRhos, rhoEmix[iPoint], rhoEve[iPoint], rhoEvel[iPoint]);
+    val_T[iPoint]   = T[0];
+    val_Tve[iPoint] = T[1];
+  }
+}
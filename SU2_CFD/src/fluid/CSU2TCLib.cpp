@@ -45,6 +45,7 @@ CSU2TCLib::CSU2TCLib(const CConfig* config, unsigned short val_nDim, bool viscou
   RotationModes.resize(nSpecies,0.0);
   Diss.resize(nSpecies,0.0);
   A.resize(5,0.0);
+  eve_eq.resize(nSpecies,0.0);
   Omega00.resize(nSpecies,nSpecies,4,0.0);
   Omega11.resize(nSpecies,nSpecies,4,0.0);
   RxnConstantTable.resize(6,5) = su2double(0.0);
@@ -611,6 +612,25 @@ CSU2TCLib::CSU2TCLib(const CConfig* config, unsigned short val_nDim, bool viscou
 
   if (ionization) { nHeavy = nSpecies-1; nEl = 1; }
   else            { nHeavy = nSpecies;   nEl = 0; }
+
+  /*--- The equilibrium constants only depend on the reaction, tabulate
+   them once instead of reassigning the table for every point. ---*/
+  RxnConstantTables.resize(nReactions);
+  for (unsigned short iReaction = 0; iReaction < nReactions; iReaction++) {
+    GetChemistryEquilConstants(iReaction);
+    RxnConstantTables[iReaction] = RxnConstantTable;
+  }
+
+  /*--- Temperature-independent part of the Millikan & White relaxation times. ---*/
+  MillikanWhiteA.resize(nSpecies,nSpecies) = su2double(0.0);
+  MillikanWhiteB.resize(nSpecies,nSpecies) = su2double(0.0);
+  for (auto iSpecies = 0u; iSpecies < nSpecies; iSpecies++) {
+    for (auto jSpecies = 0u; jSpecies < nSpecies; jSpecies++) {
+      const su2double mu = MolarMass[iSpecies]*MolarMass[jSpecies] / (MolarMass[iSpecies] + MolarMass[jSpecies]);
+      MillikanWhiteA(iSpecies,jSpecies) = 1.16 * 1E-3 * sqrt(mu) * pow(CharVibTemp[iSpecies], 4.0/3.0);
+      MillikanWhiteB(iSpecies,jSpecies) = 0.015 * pow(mu, 0.25);
+    }
+  }
 }
 
 CSU2TCLib::~CSU2TCLib(){}
@@ -742,42 +762,44 @@ vector<su2double>& CSU2TCLib::ComputeMixtureEnergies(){
 
 }
 
-vector<su2double>& CSU2TCLib::ComputeSpeciesEve(su2double val_T){
+su2double CSU2TCLib::SpeciesEve(unsigned short iSpecies, su2double val_T) const {
 
   su2double Ev, Eel, Ef, num, denom;
-  unsigned short iElectron = nSpecies-1;
 
-  for (iSpecies = 0; iSpecies < nSpecies; iSpecies++){
-
-    /*--- Electron species energy ---*/
-    if ( ionization && (iSpecies == iElectron)) {
-      /*--- Calculate formation energy ---*/
-      Ef = Enthalpy_Formation[iSpecies] - Ru/MolarMass[iSpecies] * Ref_Temperature[iSpecies];
+  /*--- Electron species energy ---*/
+  if ( ionization && (iSpecies == nSpecies-1)) {
+    /*--- Calculate formation energy ---*/
+    Ef = Enthalpy_Formation[iSpecies] - Ru/MolarMass[iSpecies] * Ref_Temperature[iSpecies];
 
-      /*--- Electron t-r mode contributes to mixture vib-el energy ---*/
-      Eel = (3.0/2.0) * Ru/MolarMass[iSpecies] * (val_T - Ref_Temperature[iSpecies]) + Ef;
-      Ev  = 0.0;
-    }
-    /*--- Heavy particle energy ---*/
-    else {
-      /*--- Calculate vibrational energy (harmonic-oscillator model) ---*/
-      if (CharVibTemp[iSpecies] != 0.0)
-        Ev = Ru/MolarMass[iSpecies] * CharVibTemp[iSpecies] / (exp(CharVibTemp[iSpecies]/val_T)-1.0);
-      else
-        Ev = 0.0;
-      /*--- Calculate electronic energy ---*/
-      num = 0.0;
-      denom = ElDegeneracy[iSpecies][0] * exp(-CharElTemp[iSpecies][0]/val_T);
-      for (iEl = 1; iEl < nElStates[iSpecies]; iEl++) {
-        num   += ElDegeneracy[iSpecies][iEl] * CharElTemp[iSpecies][iEl] * exp(-CharElTemp[iSpecies][iEl]/val_T);
-        denom += ElDegeneracy[iSpecies][iEl] * exp(-CharElTemp[iSpecies][iEl]/val_T);
-      }
-      Eel = Ru/MolarMass[iSpecies] * (num/denom);
+    /*--- Electron t-r mode contributes to mixture vib-el energy ---*/
+    Eel = (3.0/2.0) * Ru/MolarMass[iSpecies] * (val_T - Ref_Temperature[iSpecies]) + Ef;
+    Ev  = 0.0;
+  }
+  /*--- Heavy particle energy ---*/
+  else {
+    /*--- Calculate vibrational energy (harmonic-oscillator model) ---*/
+    if (CharVibTemp[iSpecies] != 0.0)
+      Ev = Ru/MolarMass[iSpecies] * CharVibTemp[iSpecies] / (exp(CharVibTemp[iSpecies]/val_T)-1.0);
+    else
+      Ev = 0.0;
+    /*--- Calculate electronic energy ---*/
+    num = 0.0;
+    denom = ElDegeneracy[iSpecies][0] * exp(-CharElTemp[iSpecies][0]/val_T);
+    for (auto iEl = 1u; iEl < nElStates[iSpecies]; iEl++) {
+      num   += ElDegeneracy[iSpecies][iEl] * CharElTemp[iSpecies][iEl] * exp(-CharElTemp[iSpecies][iEl]/val_T);
+      denom += ElDegeneracy[iSpecies][iEl] * exp(-CharElTemp[iSpecies][iEl]/val_T);
     }
-
-    eves[iSpecies] = Ev + Eel;
+    Eel = Ru/MolarMass[iSpecies] * (num/denom);
   }
 
+  return Ev + Eel;
+}
+
+vector<su2double>& CSU2TCLib::ComputeSpeciesEve(su2double val_T){
+
+  for (iSpecies = 0; iSpecies < nSpecies; iSpecies++)
+    eves[iSpecies] = SpeciesEve(iSpecies, val_T);
+
   return eves;
 }
 
@@ -785,7 +807,7 @@ vector<su2double>& CSU2TCLib::ComputeNetProductionRates(){
 
   /*--- Nonequilibrium chemistry ---*/
   unsigned short ii, iReaction;
-  su2double T_min, epsilon, Thf, Thb, Trxnf, Trxnb, Keq, kf, kb, kfb, fwdRxn, bkwRxn, af, bf, ab, bb;
+  su2double T_min, epsilon, Thf, Thb, Trxnf, Trxnb, Keq, kf, kb, kfb, fwdRxn, bkwRxn, af, bf, ab, bb, N;
 
   /*--- Define artificial chemistry parameters ---*/
   // Note: These parameters artificially increase the rate-controlling reaction
@@ -796,8 +818,13 @@ vector<su2double>& CSU2TCLib::ComputeNetProductionRates(){
   /*--- Define preferential dissociation coefficient ---*/
   //alpha = 0.3;
 
-  for( iSpecies = 0; iSpecies < nSpecies; iSpecies++)
+  /*--- Mixture number density, converted from 1/m^3 to 1/cm^3 for the Keq table look-up ---*/
+  N = 0.0;
+  for (auto iSpecies = 0u; iSpecies < nSpecies; iSpecies++) {
     ws[iSpecies] = 0.0;
+    N += rhos[iSpecies]/MolarMass[iSpecies]*AVOGAD_CONSTANT;
+  }
+  N = N*(1E-6);
 
   for (iReaction = 0; iReaction < nReactions; iReaction++) {
 
@@ -814,7 +841,7 @@ vector<su2double>& CSU2TCLib::ComputeNetProductionRates(){
     Thb = 0.5 * (Trxnb+T_min + sqrt((Trxnb-T_min)*(Trxnb-T_min)+epsilon*epsilon));
 
     /*--- Get the Keq & Arrhenius coefficients ---*/
-    ComputeKeqConstants(iReaction);
+    ComputeKeqConstants(iReaction, N);
 
     /*--- Calculate Keq ---*/
     Keq = exp(  A[0]*(Thb/1E4) + A[1] + A[2]*log(1E4/Thb)
@@ -861,22 +888,13 @@ vector<su2double>& CSU2TCLib::ComputeNetProductionRates(){
   return ws;
 }
 
-void CSU2TCLib::ComputeKeqConstants(unsigned short val_Reaction) {
+void CSU2TCLib::ComputeKeqConstants(unsigned short val_Reaction, su2double N) {
 
   unsigned short ii, iIndex, tbl_offset, pwr;
-  su2double N, tmp1, tmp2;
+  su2double tmp1, tmp2;
 
-  /*--- Acquire database constants from CConfig ---*/
-  GetChemistryEquilConstants(val_Reaction);
-
-  /*--- Calculate mixture number density ---*/
-  N = 0.0;
-  for (iSpecies =0 ; iSpecies < nSpecies; iSpecies++) {
-    N += rhos[iSpecies]/MolarMass[iSpecies]*AVOGAD_CONSTANT;
-  }
-
-  /*--- Convert number density from 1/m^3 to 1/cm^3 for table look-up ---*/
-  N = N*(1E-6);
+  /*--- Database constants of this reaction ---*/
+  const auto& RxnConstantTable = RxnConstantTables[val_Reaction];
 
   /*--- Determine table index based on mixture N ---*/
   tbl_offset = 14;
@@ -918,12 +936,9 @@ su2double CSU2TCLib::ComputeEveSourceTerm(){
   // Note: Landau-Teller formulation
   // Note: Millikan & White relaxation time (requires P in Atm.)
   // Note: Park limiting cross section
-  su2double conc, N, mu, A_sr, B_sr, num, denom, Cs, sig_s, tau_sr, tauP, tauMW, taus, omegaVT, omegaCV;
-  vector<su2double> MolarFrac, eve_eq, eve;
+  su2double conc, N, num, denom, Cs, sig_s, tau_sr, tauP, tauMW, taus, omegaVT, omegaCV;
 
-  MolarFrac.resize(nSpecies,0.0);
-  eve_eq.resize(nSpecies,0.0);
-  eve.resize(nSpecies,0.0);
+  auto& MolarFrac = MolarFractions;
 
   omegaVT = 0.0;
   omegaCV = 0.0;
@@ -932,27 +947,28 @@ su2double CSU2TCLib::ComputeEveSourceTerm(){
   /*--- Calculate mole fractions ---*/
   N    = 0.0;
   conc = 0.0;
-  for (iSpecies = 0; iSpecies < nSpecies; iSpecies++) {
+  for (auto iSpecies = 0u; iSpecies < nSpecies; iSpecies++) {
     conc += rhos[iSpecies] / MolarMass[iSpecies];
     N    += rhos[iSpecies] / MolarMass[iSpecies] * AVOGAD_CONSTANT;
   }
-  for (iSpecies = 0; iSpecies < nSpecies; iSpecies++)
+  for (auto iSpecies = 0u; iSpecies < nSpecies; iSpecies++)
     MolarFrac[iSpecies] = (rhos[iSpecies] / MolarMass[iSpecies]) / conc;
 
   eve_eq = ComputeSpeciesEve(T);
-  eve    = ComputeSpeciesEve(Tve);
+  const auto& eve = ComputeSpeciesEve(Tve);
+
+  /*--- Temperature and pressure factors of the relaxation times, common to all species pairs ---*/
+  const su2double T13 = pow(T,-1.0/3.0);
+  const su2double P_atm = 101325.0/Pressure;
 
   /*--- Loop over species to calculate source term --*/
-  for (iSpecies = 0; iSpecies < nSpecies; iSpecies++) {
+  for (auto iSpecies = 0u; iSpecies < nSpecies; iSpecies++) {
 
     /*--- Millikan & White relaxation time ---*/
     num   = 0.0;
     denom = 0.0;
-    for (jSpecies = 0; jSpecies < nSpecies; jSpecies++) {
-      mu     = MolarMass[iSpecies]*MolarMass[jSpecies] / (MolarMass[iSpecies] + MolarMass[jSpecies]);
-      A_sr   = 1.16 * 1E-3 * sqrt(mu) * pow(CharVibTemp[iSpecies], 4.0/3.0);
-      B_sr   = 0.015 * pow(mu, 0.25);
-      tau_sr = 101325.0/Pressure * exp(A_sr*(pow(T,-1.0/3.0) - B_sr) - 18.42);
+    for (auto jSpecies = 0u; jSpecies < nSpecies; jSpecies++) {
+      tau_sr = P_atm * exp(MillikanWhiteA(iSpecies,jSpecies)*(T13 - MillikanWhiteB(iSpecies,jSpecies)) - 18.42);
       num   += MolarFrac[jSpecies];
       denom += MolarFrac[jSpecies] / tau_sr;
     }
@@ -975,7 +991,7 @@ su2double CSU2TCLib::ComputeEveSourceTerm(){
 
   /*--- Vibrational energy change due to chemical reactions ---*/
   if(!frozen){
-    for (iSpecies = 0; iSpecies < nSpecies; iSpecies++)
+    for (auto iSpecies = 0u; iSpecies < nSpecies; iSpecies++)
       omegaCV += ws[iSpecies]*eve[iSpecies];
   }
 
@@ -987,9 +1003,7 @@ su2double CSU2TCLib::ComputeEveSourceTerm(){
 
 vector<su2double>& CSU2TCLib::ComputeSpeciesEnthalpy(su2double val_T, su2double val_Tve, su2double *val_eves){
 
-  vector<su2double> cvtrs;
-
-  cvtrs = GetSpeciesCvTraRot();
+  const auto& cvtrs = GetSpeciesCvTraRot();
 
   for (iSpecies = 0; iSpecies < nSpecies; iSpecies++){
     eves[iSpecies] = val_eves[iSpecies];
@@ -1156,28 +1170,26 @@ void CSU2TCLib::DiffusionCoeffGY(){
   pi   = PI_NUMBER;
   kb   = BOLTZMANN_CONSTANT;
 
+  /*--- The logarithms of the temperatures are common to all species pairs ---*/
+  const su2double lnT = log(T), lnTve = log(Tve);
+
   /*--- Calculate mixture gas constant ---*/
   gam_t = 0.0;
-  for (iSpecies = 0; iSpecies < nSpecies; iSpecies++) {
+  for (auto iSpecies = 0u; iSpecies < nSpecies; iSpecies++) {
     gam_t += rhos[iSpecies] / (Density*MolarMass[iSpecies]);
   }
   /*--- Mixture thermal conductivity via Gupta-Yos approximation ---*/
-  for (iSpecies = 0; iSpecies < nHeavy; iSpecies++) {
-    /*--- Initialize the species diffusion coefficient ---*/
-    DiffusionCoeff[iSpecies] = 0.0;
+  for (auto iSpecies = 0u; iSpecies < nHeavy; iSpecies++) {
     /*--- Calculate molar concentration ---*/
     Mi      = MolarMass[iSpecies];
     gam_i   = rhos[iSpecies] / (Density*Mi);
     denom = 0.0;
-    for (jSpecies = 0; jSpecies < nHeavy; jSpecies++) {
+    for (auto jSpecies = 0u; jSpecies < nHeavy; jSpecies++) {
       if (jSpecies != iSpecies) {
         Mj    = MolarMass[jSpecies];
         gam_j = rhos[iSpecies] / (Density*Mj);
         /*--- Calculate the Omega^(0,0)_ij collision cross section ---*/
-        Omega_ij = 1E-20 * Omega00(iSpecies,jSpecies,3)
-            * pow(T, Omega00(iSpecies,jSpecies,0)*log(T)*log(T)
-            + Omega00(iSpecies,jSpecies,1)*log(T)
-            + Omega00(iSpecies,jSpecies,2));
+        Omega_ij = CollisionCrossSection(Omega00, iSpecies, jSpecies, T, lnT);
         /*--- Calculate "delta1_ij" ---*/
         d1_ij = 8.0/3.0 * sqrt((2.0*Mi*Mj) / (pi*Ru*T*(Mi+Mj))) * Omega_ij;
         /*--- Calculate heavy-particle binary diffusion coefficient ---*/
@@ -1185,52 +1197,30 @@ void CSU2TCLib::DiffusionCoeffGY(){
         denom += gam_j/D_ij;
       }
     }
-    if (ionization) {
-      jSpecies = nSpecies-1;
-      Mj       = MolarMass[jSpecies];
-      gam_j    = rhos[iSpecies] / (Density*Mj);
-      
-      /*--- Calculate the Omega^(0,0)_ij collision cross section ---*/
-      Omega_ij = 1E-20 * Omega00(iSpecies,jSpecies,3)
-          * pow(Tve, Omega00(iSpecies,jSpecies,0)*log(Tve)*log(Tve)
-          + Omega00(iSpecies,jSpecies,1)*log(Tve)
-          + Omega00(iSpecies,jSpecies,2));
-      
-      /*--- Calculate "delta1_ij" ---*/
-      d1_ij = 8.0/3.0 * sqrt((2.0*Mi*Mj) / (pi*Ru*Tve*(Mi+Mj))) * Omega_ij;
-    }
-    
+
     /*--- Assign species diffusion coefficient ---*/
     DiffusionCoeff[iSpecies] = gam_t*gam_t*Mi*(1-Mi*gam_i) / denom;
   }
   if (ionization) {
-    iSpecies = nSpecies-1;
-    
-    /*--- Initialize the species diffusion coefficient ---*/
-    DiffusionCoeff[iSpecies] = 0.0;
-    
+    const unsigned short iSpecies = nSpecies-1;
+
     /*--- Calculate molar concentration ---*/
     Mi      = MolarMass[iSpecies];
     gam_i   = rhos[iSpecies] / (Density*Mi);
     denom = 0.0;
-    for (jSpecies = 0; jSpecies < nHeavy; jSpecies++) {
-      if (iSpecies != jSpecies) {
-        Mj    = MolarMass[jSpecies];
-        gam_j = rhos[iSpecies] / (Density*Mj);
-        
-        /*--- Calculate the Omega^(0,0)_ij collision cross section ---*/
-        Omega_ij = 1E-20 * Omega00(iSpecies,jSpecies,3)
-            * pow(Tve, Omega00(iSpecies,jSpecies,0)*log(Tve)*log(Tve)
-            + Omega00(iSpecies,jSpecies,1)*log(Tve)
-            + Omega00(iSpecies,jSpecies,2));
-        
-        /*--- Calculate "delta1_ij" ---*/
-        d1_ij = 8.0/3.0 * sqrt((2.0*Mi*Mj) / (pi*Ru*Tve*(Mi+Mj))) * Omega_ij;
-        
-        /*--- Calculate heavy-particle binary diffusion coefficient ---*/
-        D_ij = kb*Tve/(Pressure*d1_ij);
-        denom += gam_j/D_ij;
-      }
+    for (auto jSpecies = 0u; jSpecies < nHeavy; jSpecies++) {
+      Mj    = MolarMass[jSpecies];
+      gam_j = rhos[iSpecies] / (Density*Mj);
+
+      /*--- Calculate the Omega^(0,0)_ij collision cross section ---*/
+      Omega_ij = CollisionCrossSection(Omega00, iSpecies, jSpecies, Tve, lnTve);
+
+      /*--- Calculate "delta1_ij" ---*/
+      d1_ij = 8.0/3.0 * sqrt((2.0*Mi*Mj) / (pi*Ru*Tve*(Mi+Mj))) * Omega_ij;
+
+      /*--- Calculate heavy-particle binary diffusion coefficient ---*/
+      D_ij = kb*Tve/(Pressure*d1_ij);
+      denom += gam_j/D_ij;
     }
     DiffusionCoeff[iSpecies] = gam_t*gam_t*MolarMass[iSpecies]*(1-MolarMass[iSpecies]*gam_i) / denom;
   }
@@ -1243,33 +1233,31 @@ void CSU2TCLib::ViscosityGY(){
   pi   = PI_NUMBER;
   Na   = AVOGAD_CONSTANT;
   Mu = 0.0;
+
+  /*--- The logarithms of the temperatures are common to all species pairs ---*/
+  const su2double lnT = log(T), lnTve = log(Tve);
+
   /*--- Mixture viscosity via Gupta-Yos approximation ---*/
-  for (iSpecies = 0; iSpecies < nHeavy; iSpecies++) {
+  for (auto iSpecies = 0u; iSpecies < nHeavy; iSpecies++) {
     denom = 0.0;
     /*--- Calculate molar concentration ---*/
     Mi    = MolarMass[iSpecies];
     gam_i = rhos[iSpecies] / (Density*Mi);
-    for (jSpecies = 0; jSpecies < nHeavy; jSpecies++) {
+    for (auto jSpecies = 0u; jSpecies < nHeavy; jSpecies++) {
       Mj    = MolarMass[jSpecies];
       gam_j = rhos[jSpecies] / (Density*Mj);
       /*--- Calculate "delta" quantities ---*/
-      Omega_ij = 1E-20 * Omega11(iSpecies,jSpecies,3)
-          * pow(T, Omega11(iSpecies,jSpecies,0)*log(T)*log(T)
-          + Omega11(iSpecies,jSpecies,1)*log(T)
-          + Omega11(iSpecies,jSpecies,2));
+      Omega_ij = CollisionCrossSection(Omega11, iSpecies, jSpecies, T, lnT);
       d2_ij = 16.0/5.0 * sqrt((2.0*Mi*Mj) / (pi*Ru*T*(Mi+Mj))) * Omega_ij;
       /*--- Add to denominator of viscosity ---*/
       denom += gam_j*d2_ij;
     }
     if (ionization) {
-      jSpecies = nSpecies-1;
+      const unsigned short jSpecies = nSpecies-1;
       Mj    = MolarMass[jSpecies];
       gam_j = rhos[jSpecies] / (Density*Mj);
       /*--- Calculate "delta" quantities ---*/
-      Omega_ij = 1E-20 * Omega11(iSpecies,jSpecies,3)
-          * pow(Tve, Omega11(iSpecies,jSpecies,0)*log(Tve)*log(Tve)
-          + Omega11(iSpecies,jSpecies,1)*log(Tve)
-          + Omega11(iSpecies,jSpecies,2));
+      Omega_ij = CollisionCrossSection(Omega11, iSpecies, jSpecies, Tve, lnTve);
       d2_ij = 16.0/5.0 * sqrt((2.0*Mi*Mj) / (pi*Ru*Tve*(Mi+Mj))) * Omega_ij;
       denom += gam_j*d2_ij;
     }
@@ -1277,19 +1265,16 @@ void CSU2TCLib::ViscosityGY(){
     Mu += (Mi/Na * gam_i) / denom;
   }
   if (ionization) {
-    iSpecies = nSpecies-1;
+    const unsigned short iSpecies = nSpecies-1;
     denom = 0.0;
     /*--- Calculate molar concentration ---*/
     Mi    = MolarMass[iSpecies];
     gam_i = rhos[iSpecies] / (Density*Mi);
-    for (jSpecies = 0; jSpecies < nSpecies; jSpecies++) {
+    for (auto jSpecies = 0u; jSpecies < nSpecies; jSpecies++) {
       Mj    = MolarMass[jSpecies];
       gam_j = rhos[jSpecies] / (Density*Mj);
       /*--- Calculate "delta" quantities ---*/
-      Omega_ij = 1E-20 * Omega11(iSpecies,jSpecies,3)
-          * pow(Tve, Omega11(iSpecies,jSpecies,0)*log(Tve)*log(Tve)
-          + Omega11(iSpecies,jSpecies,1)*log(Tve)
-          + Omega11(iSpecies,jSpecies,2));
+      Omega_ij = CollisionCrossSection(Omega11, iSpecies, jSpecies, Tve, lnTve);
       d2_ij = 16.0/5.0 * sqrt((2.0*Mi*Mj) / (pi*Ru*Tve*(Mi+Mj))) * Omega_ij;
       /*--- Add to denominator of viscosity ---*/
       denom += gam_j*d2_ij;
@@ -1307,49 +1292,46 @@ void CSU2TCLib::ThermalConductivitiesGY(){
   kb   = BOLTZMANN_CONSTANT;
 
   if (ionization) {
-    cout << "SetThermalConductivity: NEEDS REVISION w/ IONIZATION" << endl;
-    exit(1);
+    SU2_MPI::Error("The Gupta-Yos thermal conductivity needs revision with ionization.", CURRENT_FUNCTION);
   }
 
   /*--- Mixture vibrational-electronic specific heat ---*/
-  Cvves = ComputeSpeciesCvVibEle();
+  const auto& Cvves = ComputeSpeciesCvVibEle();
   rhoCvve = 0.0;
-  for (iSpecies = 0; iSpecies < nSpecies; iSpecies++)
+  for (auto iSpecies = 0u; iSpecies < nSpecies; iSpecies++)
     rhoCvve += rhos[iSpecies]*Cvves[iSpecies];
   Cvve = rhoCvve/Density;
 
   /*--- Calculate mixture gas constant ---*/
   R = 0.0;
-  for (iSpecies = 0; iSpecies < nSpecies; iSpecies++) {
+  for (auto iSpecies = 0u; iSpecies < nSpecies; iSpecies++) {
     R += Ru * rhos[iSpecies]/Density;
   }
+
+  /*--- The logarithm of the temperature is common to all species pairs ---*/
+  const su2double lnT = log(T);
+
   /*--- Mixture thermal conductivity via Gupta-Yos approximation ---*/
   ThermalCond_tr    = 0.0;
   ThermalCond_ve = 0.0;
-  for (iSpecies = 0; iSpecies < nSpecies; iSpecies++) {
+  for (auto iSpecies = 0u; iSpecies < nSpecies; iSpecies++) {
     /*--- Calculate molar concentration ---*/
     Mi      = MolarMass[iSpecies];
     mi      = Mi/Na;
     gam_i   = rhos[iSpecies] / (Density*Mi);
     denom_t = 0.0;
     denom_r = 0.0;
-    for (jSpecies = 0; jSpecies < nSpecies; jSpecies++) {
+    for (auto jSpecies = 0u; jSpecies < nSpecies; jSpecies++) {
       Mj    = MolarMass[jSpecies];
       mj    = Mj/Na;
       gam_j = rhos[iSpecies] / (Density*Mj);
       a_ij = 1.0 + (1.0 - mi/mj)*(0.45 - 2.54*mi/mj) / ((1.0 + mi/mj)*(1.0 + mi/mj));
       /*--- Calculate the Omega^(0,0)_ij collision cross section ---*/
-      Omega_ij = 1E-20 * Omega00(iSpecies,jSpecies,3)
-          * pow(T, Omega00(iSpecies,jSpecies,0)*log(T)*log(T)
-          + Omega00(iSpecies,jSpecies,1)*log(T)
-          + Omega00(iSpecies,jSpecies,2));
+      Omega_ij = CollisionCrossSection(Omega00, iSpecies, jSpecies, T, lnT);
       /*--- Calculate "delta1_ij" ---*/
       d1_ij = 8.0/3.0 * sqrt((2.0*Mi*Mj) / (pi*Ru*T*(Mi+Mj))) * Omega_ij;
       /*--- Calculate the Omega^(1,1)_ij collision cross section ---*/
-      Omega_ij = 1E-20 * Omega11(iSpecies,jSpecies,3)
-          * pow(T, Omega11(iSpecies,jSpecies,0)*log(T)*log(T)
-          + Omega11(iSpecies,jSpecies,1)*log(T)
-          + Omega11(iSpecies,jSpecies,2));
+      Omega_ij = CollisionCrossSection(Omega11, iSpecies, jSpecies, T, lnT);
       /*--- Calculate "delta2_ij" ---*/
       d2_ij = 16.0/5.0 * sqrt((2.0*Mi*Mj) / (pi*Ru*T*(Mi+Mj))) * Omega_ij;
       denom_t += a_ij*gam_j*d2_ij;
@@ -1371,7 +1353,6 @@ void CSU2TCLib::ThermalConductivitiesGY(){
 
 vector<su2double>& CSU2TCLib::ComputeTemperatures(vector<su2double>& val_rhos, su2double rhoE, su2double rhoEve, su2double rhoEvel){
 
-  vector<su2double> val_eves;
   su2double rhoCvtr, rhoE_f, rhoE_ref, rhoEve_t, Tve2, Tve_o, Btol, Tmin, Tmax;
   bool Bconvg;
   unsigned short iIter, maxBIter;
@@ -1411,9 +1392,9 @@ vector<su2double>& CSU2TCLib::ComputeTemperatures(vector<su2double>& val_rhos, s
 
   for (iIter = 0; iIter < maxBIter; iIter++) {
     Tve      = (Tve_o+Tve2)/2.0;
-    val_eves = ComputeSpeciesEve(Tve);
+    const auto& val_eves = ComputeSpeciesEve(Tve);
     rhoEve_t = 0.0;
-    for (iSpecies = 0; iSpecies < nSpecies; iSpecies++) rhoEve_t += rhos[iSpecies] * val_eves[iSpecies];
+    for (auto iSpecies = 0u; iSpecies < nSpecies; iSpecies++) rhoEve_t += rhos[iSpecies] * val_eves[iSpecies];
     if (fabs(rhoEve_t - rhoEve) < Btol) {
       Bconvg = true;
       break;
@@ -1432,6 +1413,96 @@ vector<su2double>& CSU2TCLib::ComputeTemperatures(vector<su2double>& val_rhos, s
 
 }
 
+void CSU2TCLib::ComputeBatchTemperatures(unsigned long nPoint, const su2double* val_rhos, const su2double* rhoE,
+                                         const su2double* rhoEve, const su2double* rhoEvel, su2double* val_T,
+                                         su2double* val_Tve) {
+
+  /*--- Same algorithm and order of the operations as ComputeTemperatures, with the loops over
+   *    species outside of the loops over points, which are independent and can be vectorized. ---*/
+
+  const su2double Tmin = 50.0, Tmax = 8E4, Btol = 1.0E-6;
+  const unsigned short maxBIter = 50;
+
+  const auto& cvtrs = GetSpeciesCvTraRot();
+
+  BatchWork.resize(6*nPoint);
+  BatchConverged.resize(nPoint);
+  su2double* rhoCvtr  = BatchWork.data();
+  su2double* rhoE_ref = rhoCvtr + nPoint;
+  su2double* rhoE_f   = rhoE_ref + nPoint;
+  su2double* Tve_o    = rhoE_f + nPoint;
+  su2double* Tve2     = Tve_o + nPoint;
+  su2double* rhoEve_t = Tve2 + nPoint;
+  int* converged = BatchConverged.data();
+
+  /*----------Translational temperature----------*/
+
+  for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
+    rhoCvtr[iPoint] = 0.0; rhoE_ref[iPoint] = 0.0; rhoE_f[iPoint] = 0.0;
+  }
+
+  for (auto iSpecies = 0u; iSpecies < nHeavy; iSpecies++) {
+    const su2double* rhos_s = &val_rhos[iSpecies*nPoint];
+    const su2double ef = Enthalpy_Formation[iSpecies] - Ru/MolarMass[iSpecies]*Ref_Temperature[iSpecies];
+    SU2_OMP_SIMD_IF_NOT_AD
+    for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
+      rhoCvtr[iPoint]  += rhos_s[iPoint] * cvtrs[iSpecies];
+      rhoE_ref[iPoint] += rhos_s[iPoint] * cvtrs[iSpecies] * Ref_Temperature[iSpecies];
+      rhoE_f[iPoint]   += rhos_s[iPoint] * ef;
+    }
+  }
+
+  SU2_OMP_SIMD_IF_NOT_AD
+  for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
+    const su2double T = (rhoE[iPoint] - rhoEve[iPoint] - rhoE_f[iPoint] + rhoE_ref[iPoint] - rhoEvel[iPoint]) / rhoCvtr[iPoint];
+
+    /*--- Temperature clipping ---*/
+    val_T[iPoint] = (T < Tmin)? Tmin : ((T > Tmax)? Tmax : T);
+
+    Tve_o[iPoint] = Tmin; Tve2[iPoint] = Tmax;
+    converged[iPoint] = false;
+  }
+
+  /*--- Bisection for the vibrational temperature, the converged points keep their temperature,
+   *    their energy is still evaluated to keep the loops over points free of branches. ---*/
+
+  unsigned long nActive = nPoint;
+
+  for (unsigned short iIter = 0; (iIter < maxBIter) && (nActive > 0); iIter++) {
+
+    SU2_OMP_SIMD_IF_NOT_AD
+    for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
+      if (!converged[iPoint]) val_Tve[iPoint] = (Tve_o[iPoint]+Tve2[iPoint])/2.0;
+      rhoEve_t[iPoint] = 0.0;
+    }
+
+    for (auto iSpecies = 0u; iSpecies < nSpecies; iSpecies++) {
+      const su2double* rhos_s = &val_rhos[iSpecies*nPoint];
+      SU2_OMP_SIMD_IF_NOT_AD
+      for (auto iPoint = 0ul; iPoint < nPoint; iPoint++)
+        rhoEve_t[iPoint] += rhos_s[iPoint] * SpeciesEve(iSpecies, val_Tve[iPoint]);
+    }
+
+    nActive = 0;
+    for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
+      if (converged[iPoint]) continue;
+
+      if (fabs(rhoEve_t[iPoint] - rhoEve[iPoint]) < Btol) {
+        converged[iPoint] = true;
+      } else {
+        if (rhoEve_t[iPoint] > rhoEve[iPoint]) Tve2[iPoint] = val_Tve[iPoint];
+        else                                   Tve_o[iPoint] = val_Tve[iPoint];
+        nActive++;
+      }
+    }
+  }
+
+  /*--- If absolutely no convergence, then assign to the TR temperature ---*/
+  for (auto iPoint = 0ul; iPoint < nPoint; iPoint++)
+    if (!converged[iPoint]) val_Tve[iPoint] = val_T[iPoint];
+
+}
+
 void CSU2TCLib::GetChemistryEquilConstants(unsigned short iReaction){
 
   if (gas_model == "O2"){
@@ -0,0 +1,590 @@
+/*!
+ * \file CTabulatedFluidModel.cpp
+ * \brief Source of the look-up table fluid model.
+ * \author SU2 Developers
+ * \version 7.1.0 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <fstream>
+#include <limits>
+
+#include "../../include/fluid/CTabulatedFluidModel.hpp"
+
+namespace {
+
+/*--- Precision of the direct look-ups, that of the nodes unless derivatives are needed. ---*/
+#if defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE)
+using LookupFloat = su2double;
+#else
+using LookupFloat = CTabulatedFluidModel::TableFloat;
+#endif
+
+/*--- Binary file layout: magic, sizes, ranges, build errors, node data. ---*/
+const char LUT_MAGIC[8] = {'S','U','2','_','L','U','T','2'};
+
+bool ReadTable(const string& fileName, CTabulatedFluidModel::CTable& table) {
+
+  ifstream file(fileName, ios::in | ios::binary);
+  if (!file.is_open()) return false;
+
+  char magic[8];
+  uint64_t sizes[3];
+  passivedouble values[6];
+
+  file.read(magic, sizeof(magic));
+  file.read(reinterpret_cast<char*>(sizes), sizeof(sizes));
+  file.read(reinterpret_cast<char*>(values), sizeof(values));
+  if (!file || !equal(magic, magic+8, LUT_MAGIC) || (sizes[2] != CTabulatedFluidModel::BLOCK_SIZE) ||
+      (sizes[0] != table.nRho) || (sizes[1] != table.nEnergy)) return false;
+
+  /*--- The ranges must match what the caller computed (to round-off). ---*/
+  auto same = [](passivedouble a, passivedouble b) { return fabs(a-b) <= 1e-12*max(fabs(a),fabs(b)); };
+  if (!same(values[0], table.rhoMin) || !same(values[1], table.rhoMax) ||
+      !same(values[2], table.eMin) || !same(values[3], table.eMax)) return false;
+
+  table.maxErrorP = values[4];
+  table.maxErrorT = values[5];
+  table.data.resize(table.nRho * table.nEnergy * CTabulatedFluidModel::BLOCK_SIZE);
+  file.read(reinterpret_cast<char*>(table.data.data()), table.data.size()*sizeof(CTabulatedFluidModel::TableFloat));
+
+  return bool(file);
+}
+
+void WriteTable(const string& fileName, const CTabulatedFluidModel::CTable& table) {
+
+  ofstream file(fileName, ios::out | ios::binary | ios::trunc);
+  if (!file.is_open()) {
+    cout << "WARNING: Could not write the fluid model look-up table to " << fileName << "." << endl;
+    return;
+  }
+  const uint64_t sizes[3] = {table.nRho, table.nEnergy, CTabulatedFluidModel::BLOCK_SIZE};
+  const passivedouble values[6] = {table.rhoMin, table.rhoMax, table.eMin, table.eMax,
+                                   table.maxErrorP, table.maxErrorT};
+  file.write(LUT_MAGIC, sizeof(LUT_MAGIC));
+  file.write(reinterpret_cast<const char*>(sizes), sizeof(sizes));
+  file.write(reinterpret_cast<const char*>(values), sizeof(values));
+  file.write(reinterpret_cast<const char*>(table.data.data()), table.data.size()*sizeof(CTabulatedFluidModel::TableFloat));
+}
+
+/*--- Evaluate the model at a node, returns false if the state is not physical. ---*/
+bool EvaluateNode(CFluidModel& model, passivedouble rho, passivedouble e, CTabulatedFluidModel::TableFloat* node) {
+
+  using Tab = CTabulatedFluidModel;
+
+  model.SetTDState_rhoe(rho, e);
+
+  passivedouble val[Tab::BLOCK_SIZE] = {0.0};
+  val[Tab::P_VAR] = SU2_TYPE::GetValue(model.GetPressure());
+  val[Tab::T_VAR] = SU2_TYPE::GetValue(model.GetTemperature());
+  val[Tab::C2_VAR] = SU2_TYPE::GetValue(model.GetSoundSpeed2());
+  val[Tab::S_VAR] = SU2_TYPE::GetValue(model.GetEntropy());
+  val[Tab::DPDRHO_E] = SU2_TYPE::GetValue(model.GetdPdrho_e());
+  val[Tab::DPDE_RHO] = SU2_TYPE::GetValue(model.GetdPde_rho());
+  val[Tab::DTDRHO_E] = SU2_TYPE::GetValue(model.GetdTdrho_e());
+  val[Tab::DTDE_RHO] = SU2_TYPE::GetValue(model.GetdTde_rho());
+  val[Tab::DHDRHO_P] = SU2_TYPE::GetValue(model.Getdhdrho_P());
+  val[Tab::DHDP_RHO] = SU2_TYPE::GetValue(model.GetdhdP_rho());
+  val[Tab::DSDRHO_P] = SU2_TYPE::GetValue(model.Getdsdrho_P());
+  val[Tab::DSDP_RHO] = SU2_TYPE::GetValue(model.GetdsdP_rho());
+  val[Tab::CP_VAR] = SU2_TYPE::GetValue(model.GetCp());
+  val[Tab::CV_VAR] = SU2_TYPE::GetValue(model.GetCv());
+
+  bool valid = (val[Tab::P_VAR] > 0.0) && (val[Tab::T_VAR] > 0.0) && (val[Tab::C2_VAR] > 0.0);
+  for (int iVar = 0; iVar < Tab::VALID_NODE; ++iVar)
+    valid &= std::isfinite(val[iVar]) && (fabs(val[iVar]) < numeric_limits<Tab::TableFloat>::max());
+
+  if (!valid) for (int iVar = 0; iVar < Tab::VALID_NODE; ++iVar) val[iVar] = 0.0;
+  val[Tab::VALID_NODE] = valid;
+
+  for (int iVar = 0; iVar < Tab::BLOCK_SIZE; ++iVar) node[iVar] = val[iVar];
+
+  return valid;
+}
+
+/*--- Input pairs of CTabulatedFluidModel::SolveState. ---*/
+enum : int {PT_PAIR, HS_PAIR, PS_PAIR};
+
+passivedouble RelativeError(su2double approx, su2double exact) {
+  return fabs(SU2_TYPE::GetValue(approx - exact)) / max(fabs(SU2_TYPE::GetValue(exact)), SU2_TYPE::GetValue(EPS));
+}
+
+}
+
+CTabulatedFluidModel::CStatistics& CTabulatedFluidModel::CStatistics::operator+= (const CStatistics& other) {
+  hits += other.hits;
+  misses += other.misses;
+  delegated += other.delegated;
+  samples += other.samples;
+  maxErrorP = max(maxErrorP, other.maxErrorP);
+  maxErrorT = max(maxErrorT, other.maxErrorT);
+  sumErrorP += other.sumErrorP;
+  sumErrorT += other.sumErrorT;
+  return *this;
+}
+
+void CTabulatedFluidModel::CTable::SetColumnEnds() {
+  columnEnds.resize(4*nRho);
+  for (unsigned long iRho = 0; iRho < nRho; ++iRho) {
+    for (const int iVar : {P_VAR, T_VAR}) {
+      auto ends = &columnEnds[(2*iRho + (iVar == T_VAR))*2];
+      ends[0] = node(iRho, 0)[iVar];
+      ends[1] = node(iRho, nEnergy-1)[iVar];
+    }
+  }
+}
+
+CTabulatedFluidModel::CTabulatedFluidModel(shared_ptr<const CTable> table, CFluidModel* exactModel,
+                                           unsigned long errorSampling) :
+  CFluidModel(),
+  Table(move(table)),
+  ExactModel(exactModel),
+  ErrorSampling(errorSampling),
+  HitsToSample(errorSampling) {
+}
+
+bool CTabulatedFluidModel::IsCompatible(const CTable& table, CFluidModel& model) {
+
+  /*--- Re-evaluate the corners and the middle of the table. ---*/
+  const unsigned long iRho[] = {0, table.nRho/2, table.nRho-1};
+  const unsigned long iEnergy[] = {0, table.nEnergy/2, table.nEnergy-1};
+  TableFloat node[BLOCK_SIZE];
+
+  /*--- Same values to the precision of the table. ---*/
+  const passivedouble tol = 8 * numeric_limits<TableFloat>::epsilon();
+
+  for (auto i : iRho) {
+    for (auto j : iEnergy) {
+      const auto ref = table.node(i,j);
+      const bool valid = EvaluateNode(model, table.rhoMin + i/table.invDeltaRho,
+                                      table.eMin + j/table.invDeltaE, node);
+      if (valid != bool(ref[VALID_NODE])) return false;
+
+      for (int iVar = 0; valid && iVar < VALID_NODE; ++iVar)
+        if (fabs(node[iVar]-ref[iVar]) > tol*max<passivedouble>(fabs(ref[iVar]), 1.0)) return false;
+    }
+  }
+  return true;
+}
+
+shared_ptr<const CTabulatedFluidModel::CTable> CTabulatedFluidModel::BuildTable(const FactoryType& factory,
+                                                                                const su2double* rhoRange,
+                                                                                const su2double* TRange,
+                                                                                unsigned long nRho,
+                                                                                unsigned long nEnergy,
+                                                                                const string& fileName) {
+  /*--- The table of the previous call, e.g. multigrid levels share the table of the fine grid. ---*/
+  static weak_ptr<const CTable> previous;
+
+  unique_ptr<CFluidModel> model(factory());
+
+  auto table = make_shared<CTable>();
+  table->nRho = nRho;
+  table->nEnergy = nEnergy;
+  table->rhoMin = SU2_TYPE::GetValue(rhoRange[0]);
+  table->rhoMax = SU2_TYPE::GetValue(rhoRange[1]);
+
+  /*--- Energy range that covers the temperature range for all densities. ---*/
+
+  table->eMin = numeric_limits<passivedouble>::max();
+  table->eMax = numeric_limits<passivedouble>::lowest();
+
+  for (unsigned long iRho = 0; iRho < nRho; ++iRho) {
+    const su2double rho = rhoRange[0] + iRho*(rhoRange[1]-rhoRange[0])/(nRho-1);
+    model->SetTDState_rhoT(rho, TRange[0]);
+    table->eMin = min(table->eMin, SU2_TYPE::GetValue(model->GetStaticEnergy()));
+    model->SetTDState_rhoT(rho, TRange[1]);
+    table->eMax = max(table->eMax, SU2_TYPE::GetValue(model->GetStaticEnergy()));
+  }
+
+  if (!(table->rhoMax > table->rhoMin) || !(table->eMax > table->eMin))
+    SU2_MPI::Error("Invalid range for the fluid model look-up table.", CURRENT_FUNCTION);
+
+  table->invDeltaRho = (nRho-1) / (table->rhoMax - table->rhoMin);
+  table->invDeltaE = (nEnergy-1) / (table->eMax - table->eMin);
+  table->lastRho = nRho-1;
+  table->lastEnergy = nEnergy-1;
+
+  /*--- Reuse the previous table, or load one from file. ---*/
+
+  auto prev = previous.lock();
+  if (prev && (prev->nRho == nRho) && (prev->nEnergy == nEnergy) &&
+      (prev->rhoMin == table->rhoMin) && (prev->rhoMax == table->rhoMax) &&
+      (prev->eMin == table->eMin) && (prev->eMax == table->eMax) && IsCompatible(*prev, *model)) {
+    return prev;
+  }
+
+  bool loaded = false;
+
+  if (!fileName.empty()) {
+    loaded = ReadTable(fileName, *table) && IsCompatible(*table, *model);
+
+    if (SU2_MPI::GetRank() == MASTER_NODE) {
+      if (loaded) cout << "Fluid model look-up table read from " << fileName << "." << endl;
+      else cout << "Fluid model look-up table " << fileName << " not found or not compatible, it will be created." << endl;
+    }
+  }
+
+  if (!loaded) {
+    table->data.assign(nRho * nEnergy * BLOCK_SIZE, 0.0f);
+    table->maxErrorP = table->maxErrorT = 0.0;
+
+    SU2_OMP_PARALLEL
+    {
+      unique_ptr<CFluidModel> threadModel(factory());
+
+      /*--- Evaluate the exact model at the nodes. ---*/
+
+      SU2_OMP_FOR_DYN(8)
+      for (unsigned long iRho = 0; iRho < nRho; ++iRho) {
+        const passivedouble rho = table->rhoMin + iRho / table->invDeltaRho;
+        for (unsigned long iEnergy = 0; iEnergy < nEnergy; ++iEnergy) {
+          const passivedouble e = table->eMin + iEnergy / table->invDeltaE;
+          EvaluateNode(*threadModel, rho, e, table->node(iRho,iEnergy));
+        }
+      }
+
+      /*--- Estimate the interpolation error at the center of the cells, where it is largest. ---*/
+
+      passivedouble maxErrorP = 0.0, maxErrorT = 0.0;
+
+      SU2_OMP_FOR_DYN(8)
+      for (unsigned long iRho = 0; iRho < nRho-1; ++iRho) {
+        const passivedouble rho = table->rhoMin + (iRho+0.5) / table->invDeltaRho;
+        for (unsigned long iEnergy = 0; iEnergy < nEnergy-1; ++iEnergy) {
+          const auto n00 = table->node(iRho,iEnergy), n10 = table->node(iRho+1,iEnergy);
+          const auto n01 = n00+BLOCK_SIZE, n11 = n10+BLOCK_SIZE;
+          if (n00[VALID_NODE] * n01[VALID_NODE] * n10[VALID_NODE] * n11[VALID_NODE] == 0.0) continue;
+
+          const passivedouble e = table->eMin + (iEnergy+0.5) / table->invDeltaE;
+          threadModel->SetTDState_rhoe(rho, e);
+
+          const passivedouble P = 0.25 * (passivedouble(n00[P_VAR]) + n01[P_VAR] + n10[P_VAR] + n11[P_VAR]);
+          const passivedouble T = 0.25 * (passivedouble(n00[T_VAR]) + n01[T_VAR] + n10[T_VAR] + n11[T_VAR]);
+          maxErrorP = max(maxErrorP, RelativeError(P, threadModel->GetPressure()));
+          maxErrorT = max(maxErrorT, RelativeError(T, threadModel->GetTemperature()));
+        }
+      }
+      SU2_OMP_CRITICAL
+      {
+        table->maxErrorP = max(table->maxErrorP, maxErrorP);
+        table->maxErrorT = max(table->maxErrorT, maxErrorT);
+      }
+    }
+  }
+
+  table->SetColumnEnds();
+
+  if (!fileName.empty()) {
+    /*--- Make sure no rank is still reading the file. ---*/
+    SU2_MPI::Barrier(MPI_COMM_WORLD);
+    if (!loaded && (SU2_MPI::GetRank() == MASTER_NODE)) WriteTable(fileName, *table);
+  }
+
+  if (SU2_MPI::GetRank() == MASTER_NODE) {
+    cout << "Fluid model look-up table with " << nRho << "x" << nEnergy << " (rho,e) nodes, "
+         << table->data.size()*sizeof(TableFloat)/(1024.0*1024.0) << " MB.\n"
+         << "Max. relative interpolation error of pressure: " << table->maxErrorP
+         << ", of temperature: " << table->maxErrorT << "." << endl;
+  }
+
+  previous = table;
+  return table;
+}
+
+FORCEINLINE bool CTabulatedFluidModel::FindCell(su2double rho, su2double e, unsigned long& iRho,
+                                                unsigned long& iEnergy, su2double& fRho, su2double& fEnergy) const {
+  const auto& table = *Table;
+
+  const passivedouble x = (SU2_TYPE::GetValue(rho) - table.rhoMin) * table.invDeltaRho;
+  const passivedouble y = (SU2_TYPE::GetValue(e) - table.eMin) * table.invDeltaE;
+
+  /*--- Written such that NaN is also outside. ---*/
+  if (!((x >= 0.0) && (x <= table.lastRho) && (y >= 0.0) && (y <= table.lastEnergy))) return false;
+
+  /*--- Signed conversions, the unsigned ones are not single instructions. ---*/
+  const long i = min(long(x), long(table.nRho)-2), j = min(long(y), long(table.nEnergy)-2);
+  iRho = i;
+  iEnergy = j;
+
+  fRho = (rho - table.rhoMin) * table.invDeltaRho - passivedouble(i);
+  fEnergy = (e - table.eMin) * table.invDeltaE - passivedouble(j);
+
+  return true;
+}
+
+template<class Float>
+FORCEINLINE bool CTabulatedFluidModel::InterpolateCell(unsigned long iRho, unsigned long iEnergy, su2double fRho,
+                                                       su2double fEnergy, su2double rho, su2double e) {
+
+  const auto n00 = Table->node(iRho,iEnergy), n10 = Table->node(iRho+1,iEnergy);
+  const auto n01 = n00+BLOCK_SIZE, n11 = n10+BLOCK_SIZE;
+
+  if (n00[VALID_NODE] * n01[VALID_NODE] * n10[VALID_NODE] * n11[VALID_NODE] == 0.0f) return false;
+
+  /*--- One linear interpolation in each direction, a node is one vector. ---*/
+  const Float fr = fRho, fe = fEnergy;
+
+  Float val[BLOCK_SIZE];
+  SU2_OMP_SIMD_IF_NOT_AD
+  for (int iVar = 0; iVar < BLOCK_SIZE; ++iVar) {
+    const Float v0 = n00[iVar] + fe*(n01[iVar]-n00[iVar]);
+    const Float v1 = n10[iVar] + fe*(n11[iVar]-n10[iVar]);
+    val[iVar] = v0 + fr*(v1-v0);
+  }
+
+  Density = rho;
+  StaticEnergy = e;
+  Pressure = val[P_VAR];
+  Temperature = val[T_VAR];
+  SoundSpeed2 = val[C2_VAR];
+  Entropy = val[S_VAR];
+  dPdrho_e = val[DPDRHO_E];
+  dPde_rho = val[DPDE_RHO];
+  dTdrho_e = val[DTDRHO_E];
+  dTde_rho = val[DTDE_RHO];
+  dhdrho_P = val[DHDRHO_P];
+  dhdP_rho = val[DHDP_RHO];
+  dsdrho_P = val[DSDRHO_P];
+  dsdP_rho = val[DSDP_RHO];
+  Cp = val[CP_VAR];
+  Cv = val[CV_VAR];
+
+  return true;
+}
+
+template<class Float>
+bool CTabulatedFluidModel::Interpolate(su2double rho, su2double e) {
+
+  unsigned long iRho, iEnergy;
+  su2double fRho, fEnergy;
+  if (!FindCell(rho, e, iRho, iEnergy, fRho, fEnergy)) return false;
+
+  return InterpolateCell<Float>(iRho, iEnergy, fRho, fEnergy, rho, e);
+}
+
+bool CTabulatedFluidModel::InterpolateInverse(int iVar, su2double rho, su2double value) {
+
+  const auto& table = *Table;
+
+  const passivedouble x = (SU2_TYPE::GetValue(rho) - table.rhoMin) * table.invDeltaRho;
+  if (!((x >= 0.0) && (x <= table.lastRho))) return false;
+
+  const long iRho = min(long(x), long(table.nRho)-2);
+  const su2double fRho = (rho - table.rhoMin) * table.invDeltaRho - passivedouble(iRho);
+  const passivedouble f = SU2_TYPE::GetValue(fRho);
+
+  /*--- Variable along the line of constant density, bilinear interpolation makes it piecewise linear. ---*/
+  auto column = [&](unsigned long j) {
+    return (1.0-f) * table.node(iRho,j)[iVar] + f * table.node(iRho+1,j)[iVar];
+  };
+
+  /*--- Find the bracketing interval from a linear guess between the (compact) column ends, then walk
+   *    to it. The nodes visited by the walk are the corners of the cell, which are then interpolated. ---*/
+  const passivedouble target = SU2_TYPE::GetValue(value);
+  const long last = table.nEnergy-1;
+  const auto end0 = table.columnEnd(iVar, iRho), end1 = table.columnEnd(iVar, iRho+1);
+  const passivedouble first = (1.0-f) * end0[0] + f * end1[0];
+  const passivedouble range = (1.0-f) * end0[1] + f * end1[1] - first;
+  if (!((target >= first) && (target <= first+range))) return false;
+
+  long lo = min(long((target-first) / range * last), last-1);
+  passivedouble v0 = column(lo), v1 = column(lo+1);
+  while ((lo > 0) && (v0 > target)) { --lo; v1 = v0; v0 = column(lo); }
+  while ((lo < last-1) && (v1 < target)) { ++lo; v0 = v1; v1 = column(lo+1); }
+  if (!(v1 > v0)) return false;
+
+  /*--- Exact inverse of the bilinear interpolation (linear in energy at fixed density). ---*/
+  const auto n00 = table.node(iRho,lo), n10 = table.node(iRho+1,lo);
+  const auto n01 = n00+BLOCK_SIZE, n11 = n10+BLOCK_SIZE;
+  const su2double c0 = (1.0-fRho) * n00[iVar] + fRho * n10[iVar];
+  const su2double c1 = (1.0-fRho) * n01[iVar] + fRho * n11[iVar];
+
+  const su2double fEnergy = (value-c0) / (c1-c0);
+  const su2double e = table.eMin + (passivedouble(lo) + fEnergy) / table.invDeltaE;
+
+  if (!InterpolateCell<LookupFloat>(iRho, lo, fRho, fEnergy, rho, e)) return false;
+
+  /*--- Reproduce the input exactly, not only to the precision of the look-up. ---*/
+  if (iVar == P_VAR) Pressure = value;
+  else Temperature = value;
+  return true;
+}
+
+bool CTabulatedFluidModel::SolveState(int pair, su2double x1, su2double x2) {
+
+  const auto& table = *Table;
+  const int maxIter = 30;
+  const passivedouble tol = 1e-10;
+
+  /*--- Start from the current state if it is in the table, otherwise from the middle of it. ---*/
+  su2double rho = Density, e = StaticEnergy;
+  if (!Interpolate<su2double>(rho, e)) {
+    rho = 0.5 * (table.rhoMin + table.rhoMax);
+    e = 0.5 * (table.eMin + table.eMax);
+    if (!Interpolate<su2double>(rho, e)) return false;
+  }
+
+  for (int iter = 0; iter < maxIter; ++iter) {
+
+    /*--- Residuals and Jacobian w.r.t. (rho,e), the derivatives of entropy follow from
+     *    de = T ds + P/rho^2 drho, and those of enthalpy from h = e + P/rho. ---*/
+    const su2double invRho = 1.0 / Density;
+    const su2double dsdrho_e = -Pressure * invRho * invRho / Temperature;
+    const su2double dsde_rho = 1.0 / Temperature;
+    su2double f1, f2, J11, J12, J21, J22;
+
+    switch (pair) {
+      case PT_PAIR:
+        f1 = Pressure - x1;     J11 = dPdrho_e;  J12 = dPde_rho;
+        f2 = Temperature - x2;  J21 = dTdrho_e;  J22 = dTde_rho;
+        break;
+      case HS_PAIR:
+        f1 = StaticEnergy + Pressure * invRho - x1;
+        J11 = (dPdrho_e - Pressure * invRho) * invRho;
+        J12 = 1.0 + dPde_rho * invRho;
+        f2 = Entropy - x2;  J21 = dsdrho_e;  J22 = dsde_rho;
+        break;
+      default:
+        f1 = Pressure - x1;  J11 = dPdrho_e;  J12 = dPde_rho;
+        f2 = Entropy - x2;   J21 = dsdrho_e;  J22 = dsde_rho;
+        break;
+    }
+
+    const su2double det = J11 * J22 - J12 * J21;
+    if (!(fabs(det) > 0.0)) return false;
+
+    const su2double deltaRho = (f1 * J22 - f2 * J12) / det;
+    const su2double deltaE = (J11 * f2 - J21 * f1) / det;
+    rho -= deltaRho;
+    e -= deltaE;
+
+    if (!Interpolate<su2double>(rho, e)) return false;
+
+    if (fabs(deltaRho) * table.invDeltaRho + fabs(deltaE) * table.invDeltaE < tol) return true;
+  }
+  return false;
+}
+
+void CTabulatedFluidModel::CopyExactState() {
+  Density = ExactModel->GetDensity();
+  StaticEnergy = ExactModel->GetStaticEnergy();
+  Pressure = ExactModel->GetPressure();
+  Temperature = ExactModel->GetTemperature();
+  SoundSpeed2 = ExactModel->GetSoundSpeed2();
+  Entropy = ExactModel->GetEntropy();
+  dPdrho_e = ExactModel->GetdPdrho_e();
+  dPde_rho = ExactModel->GetdPde_rho();
+  dTdrho_e = ExactModel->GetdTdrho_e();
+  dTde_rho = ExactModel->GetdTde_rho();
+  dhdrho_P = ExactModel->Getdhdrho_P();
+  dhdP_rho = ExactModel->GetdhdP_rho();
+  dsdrho_P = ExactModel->Getdsdrho_P();
+  dsdP_rho = ExactModel->GetdsdP_rho();
+  Cp = ExactModel->GetCp();
+  Cv = ExactModel->GetCv();
+}
+
+void CTabulatedFluidModel::CountHit() {
+  ++Stats.hits;
+  if ((ErrorSampling == 0) || (--HitsToSample != 0)) return;
+  HitsToSample = ErrorSampling;
+
+  ExactModel->SetTDState_rhoe(Density, StaticEnergy);
+
+  const auto errorP = RelativeError(Pressure, ExactModel->GetPressure());
+  const auto errorT = RelativeError(Temperature, ExactModel->GetTemperature());
+
+  ++Stats.samples;
+  Stats.maxErrorP = max(Stats.maxErrorP, errorP);
+  Stats.maxErrorT = max(Stats.maxErrorT, errorT);
+  Stats.sumErrorP += errorP;
+  Stats.sumErrorT += errorT;
+}
+
+void CTabulatedFluidModel::SetTDState_rhoe(su2double rho, su2double e) {
+  if (Interpolate<LookupFloat>(rho, e)) {
+    CountHit();
+  } else {
+    ++Stats.misses;
+    ExactModel->SetTDState_rhoe(rho, e);
+    CopyExactState();
+  }
+}
+
+void CTabulatedFluidModel::SetTDState_Prho(su2double P, su2double rho) {
+  if (InterpolateInverse(P_VAR, rho, P)) {
+    CountHit();
+  } else {
+    ++Stats.misses;
+    ExactModel->SetTDState_Prho(P, rho);
+    CopyExactState();
+  }
+}
+
+void CTabulatedFluidModel::SetEnergy_Prho(su2double P, su2double rho) { SetTDState_Prho(P, rho); }
+
+void CTabulatedFluidModel::SetTDState_rhoT(su2double rho, su2double T) {
+  if (InterpolateInverse(T_VAR, rho, T)) {
+    CountHit();
+  } else {
+    ++Stats.misses;
+    ExactModel->SetTDState_rhoT(rho, T);
+    CopyExactState();
+  }
+}
+
+void CTabulatedFluidModel::SetTDState_PT(su2double P, su2double T) {
+  if (SolveState(PT_PAIR, P, T)) {
+    CountHit();
+  } else {
+    ++Stats.misses;
+    ExactModel->SetTDState_PT(P, T);
+    CopyExactState();
+  }
+}
+
+void CTabulatedFluidModel::SetTDState_hs(su2double h, su2double s) {
+  if (SolveState(HS_PAIR, h, s)) {
+    CountHit();
+  } else {
+    ++Stats.misses;
+    ExactModel->SetTDState_hs(h, s);
+    CopyExactState();
+  }
+}
+
+void CTabulatedFluidModel::SetTDState_Ps(su2double P, su2double s) {
+  if (SolveState(PS_PAIR, P, s)) {
+    CountHit();
+  } else {
+    ++Stats.misses;
+    ExactModel->SetTDState_Ps(P, s);
+    CopyExactState();
+  }
+}
+
+void CTabulatedFluidModel::ComputeDerivativeNRBC_Prho(su2double P, su2double rho) {
+  ++Stats.delegated;
+  ExactModel->ComputeDerivativeNRBC_Prho(P, rho);
+  CopyExactState();
+}
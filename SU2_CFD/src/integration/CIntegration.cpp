@@ -27,6 +27,7 @@
 
 #include "../../include/integration/CIntegration.hpp"
 #include "../../../Common/include/parallelization/omp_structure.hpp"
+#include "../../../Common/include/toolboxes/CPerformanceTracer.hpp"
 
 
 CIntegration::CIntegration() {
@@ -43,6 +44,9 @@ void CIntegration::Space_Integration(CGeometry *geometry,
                                      CConfig *config, unsigned short iMesh,
                                      unsigned short iRKStep,
                                      unsigned short RunTime_EqSystem) {
+
+  CTraceScope trace("CIntegration::Space_Integration", "solver");
+
   unsigned short iMarker, KindBC;
 
   unsigned short MainSolver = config->GetContainerPosition(RunTime_EqSystem);
@@ -51,6 +55,8 @@ void CIntegration::Space_Integration(CGeometry *geometry,
 
   /*--- Compute inviscid residuals ---*/
 
+  {
+  CTraceScope traceConv("Convective residual", "solver");
   switch (config->GetKind_ConvNumScheme()) {
     case SPACE_CENTERED:
       solver_container[MainSolver]->Centered_Residual(geometry, solver_container, numerics, config, iMesh, iRKStep);
@@ -62,12 +68,19 @@ void CIntegration::Space_Integration(CGeometry *geometry,
       solver_container[MainSolver]->Convective_Residual(geometry, solver_container, numerics[CONV_TERM], config, iMesh, iRKStep);
       break;
   }
+  }
 
   /*--- Compute viscous residuals ---*/
+  {
+  CTraceScope traceVisc("Viscous residual", "solver");
   solver_container[MainSolver]->Viscous_Residual(geometry, solver_container, numerics, config, iMesh, iRKStep);
+  }
 
   /*--- Compute source term residuals ---*/
+  {
+  CTraceScope traceSource("Source residual", "solver");
   solver_container[MainSolver]->Source_Residual(geometry, solver_container, numerics, config, iMesh);
+  }
 
   /*--- Add viscous and convective residuals, and compute the Dual Time Source term ---*/
 
@@ -189,6 +202,8 @@ void CIntegration::Space_Integration(CGeometry *geometry,
 void CIntegration::Time_Integration(CGeometry *geometry, CSolver **solver_container, CConfig *config,
                                     unsigned short iRKStep, unsigned short RunTime_EqSystem) {
 
+  CTraceScope trace("CIntegration::Time_Integration", "solver");
+
   unsigned short MainSolver = config->GetContainerPosition(RunTime_EqSystem);
 
   switch (config->GetKind_TimeIntScheme()) {
@@ -30,16 +30,21 @@
 #include "../../include/integration/CMultiGridIntegration.hpp"
 #include "../../include/integration/CStructuralIntegration.hpp"
 #include "../../include/integration/CFEM_DG_Integration.hpp"
+#include "../../include/integration/CNewtonIntegration.hpp"
 
 CIntegration** CIntegrationFactory::CreateIntegrationContainer(ENUM_MAIN_SOLVER kindMainSolver,
-                                                               const CSolver* const* solver_container){
+                                                               const CSolver* const* solver_container,
+                                                               const CConfig *config){
 
   CIntegration **integration = new CIntegration* [MAX_SOLS]();
 
   for (unsigned int iSol = 0; iSol < MAX_SOLS; iSol++){
     if (solver_container[iSol] != nullptr){
       const SolverMetaData &solverInfo = CSolverFactory::GetSolverMeta(solver_container[iSol]);
-      integration[iSol] = CreateIntegration(solverInfo.integrationType);
+      if ((iSol == FLOW_SOL) && (solverInfo.integrationType == INTEGRATION_TYPE::MULTIGRID) && config->GetNewtonKrylov())
+        integration[iSol] = new CNewtonIntegration();
+      else
+        integration[iSol] = CreateIntegration(solverInfo.integrationType);
     }
   }
 
@@ -0,0 +1,392 @@
+/*!
+ * \file CNewtonIntegration.cpp
+ * \brief Jacobian-free Newton-Krylov integration of the flow equations.
+ * \author SU2 Developers
+ * \version 7.1.0 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/integration/CNewtonIntegration.hpp"
+#include "../../../Common/include/parallelization/omp_structure.hpp"
+
+void CNewtonIntegration::MultiGrid_Iteration(CGeometry ****geometry_, CSolver *****solver_container,
+                                             CNumerics ******numerics_container, CConfig **config_,
+                                             unsigned short RunTime_EqSystem, unsigned short iZone,
+                                             unsigned short iInst) {
+
+  config = config_[iZone];
+
+  const auto Solver_Position = config->GetContainerPosition(RunTime_EqSystem);
+
+  geometry = geometry_[iZone][iInst][MESH_0];
+  solvers = solver_container[iZone][iInst][MESH_0];
+  solver = solvers[Solver_Position];
+  numerics = numerics_container[iZone][iInst][MESH_0][Solver_Position];
+
+  if (!setupDone) Setup();
+
+  const bool startup = StartupIteration();
+
+  /*--- The standard iterations solve the linear systems to the usual tolerance. ---*/
+
+  if (startup) solver->SetTolLinSolver(0.0);
+
+  SU2_OMP_PARALLEL_(if(solver->GetHasHybridParallel()))
+  {
+    if (startup) StandardIteration();
+    else NewtonIteration();
+
+    /*--- Primitive variables and gradients for the next solver (turbulence) and the output. ---*/
+
+    solver->Preprocessing(geometry, solvers, config, MESH_0, NO_RK_ITER, RunTime_EqSystem, true);
+
+    SU2_OMP_MASTER
+    {
+      solver->Pressure_Forces(geometry, config);
+      solver->Momentum_Forces(geometry, config);
+      solver->Friction_Forces(geometry, config);
+    }
+    SU2_OMP_BARRIER
+  }
+
+}
+
+void CNewtonIntegration::Setup() {
+
+  const auto nPoint = geometry->GetnPoint();
+  const auto nPointDomain = geometry->GetnPointDomain();
+  const auto nVar = solver->GetnVar();
+
+  residual0.Initialize(nPoint, nPointDomain, nVar, 0.0);
+  rhs.Initialize(nPoint, nPointDomain, nVar, 0.0);
+  update.Initialize(nPoint, nPointDomain, nVar, 0.0);
+
+  omp_chunk_size = computeStaticChunkSize(nPointDomain, omp_get_max_threads(), OMP_MAX_SIZE);
+
+  /*--- The preconditioner keeps a reference to the Jacobian, it is rebuilt for each Newton step. ---*/
+
+  preconditioner = unique_ptr<CPreconditioner<Scalar> >(
+    CPreconditioner<Scalar>::Create(config->GetKind_Linear_Solver_Prec(), solver->Jacobian, geometry, config));
+
+  setupDone = true;
+}
+
+bool CNewtonIntegration::StartupIteration() {
+
+  const auto iter = config->GetInnerIter();
+
+  /*--- The startup period is repeated for each time step. ---*/
+
+  if (iter == 0) {
+    newtonActive = false;
+    residualNormOld = 0.0;
+  }
+  if (newtonActive) return false;
+
+  /*--- Mean log of the RMS residuals of the previous iteration. ---*/
+
+  su2double residual = 0.0;
+  for (unsigned short iVar = 0; iVar < solver->GetnVar(); ++iVar)
+    residual += log10(solver->GetRes_RMS(iVar));
+  residual /= solver->GetnVar();
+
+  if (iter == 1) startupResidual = residual;
+
+  const su2double reduction = config->GetNewtonKrylov_StartupResidual();
+
+  newtonActive = (iter >= config->GetNewtonKrylov_StartupIter()) &&
+                 ((reduction <= 0.0) || ((iter > 1) && (startupResidual - residual >= reduction)));
+
+  return !newtonActive;
+}
+
+void CNewtonIntegration::StandardIteration() {
+
+  solver->Preprocessing(geometry, solvers, config, MESH_0, 0, RUNTIME_FLOW_SYS, false);
+
+  solver->Set_OldSolution();
+
+  solver->SetTime_Step(geometry, solvers, config, MESH_0, config->GetTimeIter());
+
+  Space_Integration(geometry, solvers, numerics, config, MESH_0, 0, RUNTIME_FLOW_SYS);
+
+  Time_Integration(geometry, solvers, config, 0, RUNTIME_FLOW_SYS);
+
+  solver->Postprocessing(geometry, solvers, config, MESH_0);
+}
+
+void CNewtonIntegration::EvaluateResidual() {
+
+  /*--- Synchronize the (modified) solution. ---*/
+
+  for (unsigned short iPeriodic = 1; iPeriodic <= config->GetnMarker_Periodic()/2; iPeriodic++) {
+    solver->InitiatePeriodicComms(geometry, config, iPeriodic, PERIODIC_IMPLICIT);
+    solver->CompletePeriodicComms(geometry, config, iPeriodic, PERIODIC_IMPLICIT);
+  }
+  solver->InitiateComms(geometry, config, SOLUTION);
+  solver->CompleteComms(geometry, config, SOLUTION);
+
+  /*--- Only the residual is needed, the Jacobian (preconditioner) must not be modified. ---*/
+
+  SU2_OMP_MASTER
+  solver->SetResidualOnly(true);
+  SU2_OMP_BARRIER
+
+  solver->Preprocessing(geometry, solvers, config, MESH_0, NO_RK_ITER, RUNTIME_FLOW_SYS, false);
+
+  Space_Integration(geometry, solvers, numerics, config, MESH_0, NO_RK_ITER, RUNTIME_FLOW_SYS);
+
+  SU2_OMP_BARRIER
+  SU2_OMP_MASTER
+  solver->SetResidualOnly(false);
+  SU2_OMP_BARRIER
+}
+
+void CNewtonIntegration::MatrixFreeProduct(const CSysVector<Scalar> & u, CSysVector<Scalar> & v) {
+
+  const auto nPointDomain = geometry->GetnPointDomain();
+  const auto nVar = solver->GetnVar();
+  auto nodes = solver->GetNodes();
+
+  const su2double uNorm = u.norm();
+
+  if (uNorm == 0.0) {
+    v = Scalar(0.0);
+    SU2_OMP_BARRIER
+    return;
+  }
+
+  /*--- Perturbation of the same relative size for all directions, with the usual scaling by the norm of the state. ---*/
+
+  const su2double eps = config->GetNewtonKrylov_FDStep() * (1.0 + solutionNorm) / uNorm;
+
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++)
+    for (unsigned short iVar = 0; iVar < nVar; iVar++)
+      nodes->SetSolution(iPoint, iVar, nodes->GetSolution_Old(iPoint,iVar) + eps*u(iPoint,iVar));
+
+  EvaluateResidual();
+
+  const auto& linSysRes = solver->LinSysRes;
+
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+
+    /*--- Rows without time step were replaced by the identity. ---*/
+
+    const su2double dt = nodes->GetDelta_Time(iPoint);
+
+    if (dt == 0.0) {
+      for (unsigned short iVar = 0; iVar < nVar; iVar++) v(iPoint,iVar) = u(iPoint,iVar);
+      continue;
+    }
+
+    const su2double Vol = geometry->nodes->GetVolume(iPoint) + geometry->nodes->GetPeriodicVolume(iPoint);
+    const su2double Delta = Vol / dt;
+
+    for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+      const su2double prod = Delta * u(iPoint,iVar) + (linSysRes(iPoint,iVar) - residual0(iPoint,iVar)) / eps;
+      v(iPoint,iVar) = SU2_TYPE::GetValue(prod);
+    }
+  }
+}
+
+void CNewtonIntegration::NewtonIteration() {
+
+  const auto nPoint = geometry->GetnPoint();
+  const auto nPointDomain = geometry->GetnPointDomain();
+  const auto nVar = solver->GetnVar();
+  auto nodes = solver->GetNodes();
+  auto& jacobian = solver->Jacobian;
+  auto& linSysRes = solver->LinSysRes;
+
+  /*--- Residual and approximate Jacobian at the current solution. ---*/
+
+  solver->Preprocessing(geometry, solvers, config, MESH_0, 0, RUNTIME_FLOW_SYS, false);
+
+  solver->Set_OldSolution();
+
+  solver->SetTime_Step(geometry, solvers, config, MESH_0, config->GetTimeIter());
+
+  Space_Integration(geometry, solvers, numerics, config, MESH_0, 0, RUNTIME_FLOW_SYS);
+
+  /*--- Add the pseudo-time term to the preconditioner, store the residual and set up the
+   *    Newton system. Monitoring residuals and norm of the state are also computed. ---*/
+
+  SU2_OMP_MASTER
+  {
+    for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+      solver->SetRes_RMS(iVar, 0.0);
+      solver->SetRes_Max(iVar, 0.0, 0);
+    }
+    solutionNorm = 0.0;
+  }
+  SU2_OMP_BARRIER
+
+  vector<su2double> resMax(nVar, 0.0), resRMS(nVar, 0.0);
+  vector<const su2double*> coordMax(nVar, nullptr);
+  vector<unsigned long> idxMax(nVar, 0);
+  su2double solNorm = 0.0;
+
+  SU2_OMP(for schedule(static,omp_chunk_size) nowait)
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+
+    const su2double dt = nodes->GetDelta_Time(iPoint);
+
+    if (dt != 0.0) {
+      const su2double Vol = geometry->nodes->GetVolume(iPoint) + geometry->nodes->GetPeriodicVolume(iPoint);
+      jacobian.AddVal2Diag(iPoint, Vol / dt);
+    }
+    else {
+      jacobian.SetVal2Diag(iPoint, 1.0);
+      linSysRes.SetBlock_Zero(iPoint);
+    }
+
+    for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+      const su2double Res = linSysRes(iPoint,iVar);
+      residual0(iPoint,iVar) = Res;
+      rhs(iPoint,iVar) = -SU2_TYPE::GetValue(Res);
+      update(iPoint,iVar) = 0.0;
+
+      solNorm += pow(nodes->GetSolution(iPoint,iVar), 2);
+
+      resRMS[iVar] += Res*Res;
+      if (fabs(Res) > resMax[iVar]) {
+        resMax[iVar] = fabs(Res);
+        idxMax[iVar] = iPoint;
+        coordMax[iVar] = geometry->nodes->GetCoord(iPoint);
+      }
+    }
+  }
+  SU2_OMP_CRITICAL
+  {
+    for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+      solver->AddRes_RMS(iVar, resRMS[iVar]);
+      solver->AddRes_Max(iVar, resMax[iVar], geometry->nodes->GetGlobalIndex(idxMax[iVar]), coordMax[iVar]);
+    }
+    solutionNorm += solNorm;
+  }
+
+  SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+  for (unsigned long iPoint = nPointDomain; iPoint < nPoint; iPoint++) {
+    rhs.SetBlock_Zero(iPoint);
+    update.SetBlock_Zero(iPoint);
+  }
+
+  const su2double resNorm = linSysRes.norm();
+
+  SU2_OMP_MASTER
+  {
+    solver->SetResidual_RMS(geometry, config);
+
+    su2double sumSq = solutionNorm;
+    SU2_MPI::Allreduce(&sumSq, &solutionNorm, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    solutionNorm = sqrt(solutionNorm);
+
+    /*--- Eisenstat-Walker forcing term (choice 2), safeguarded against decreasing too quickly and
+     *    limited by the linear solver tolerance, for the first step the maximum is used. ---*/
+
+    residualNorm = resNorm;
+    const su2double forcingMax = config->GetNewtonKrylov_ForcingMax();
+
+    if (residualNormOld > 0.0) {
+      const su2double ratio = residualNorm / residualNormOld;
+      su2double eta = 0.9 * ratio * ratio;
+      const su2double safeguard = 0.9 * forcing * forcing;
+      if (safeguard > 0.1) eta = max(eta, safeguard);
+      forcing = min(eta, forcingMax);
+    }
+    else {
+      forcing = forcingMax;
+    }
+    forcing = max(forcing, min(config->GetLinear_Solver_Error(), forcingMax));
+    residualNormOld = residualNorm;
+  }
+  SU2_OMP_BARRIER
+
+  /*--- Solve the Newton system with the approximate Jacobian as preconditioner. ---*/
+
+  preconditioner->Build();
+
+  const CNewtonProduct product(this);
+  Scalar linRes = 0.0;
+
+  const auto iter = krylov.FGMRES_LinSolver(rhs, update, product, *preconditioner, Scalar(SU2_TYPE::GetValue(forcing)),
+                                            config->GetNewtonKrylov_Iter(), linRes, false, config);
+
+  /*--- Restore the state, and compute the under-relaxation (limit of the changes of density
+   *    and energy) of the solver with the Newton step. ---*/
+
+  nodes->Set_Solution();
+
+  auto& step = solver->LinSysSol;
+
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++)
+    for (unsigned short iVar = 0; iVar < nVar; iVar++)
+      step(iPoint,iVar) = update(iPoint,iVar);
+
+  solver->ComputeUnderRelaxationFactor(solvers, config);
+
+  /*--- Backtracking line search, the step is accepted if the norm of the residual decreases,
+   *    or when the minimum step length is reached (the CFL adaptation then reacts). ---*/
+
+  const su2double lambdaMin = config->GetNewtonKrylov_LineSearchMin();
+  su2double lambda = 1.0;
+
+  while (true) {
+    SU2_OMP_FOR_STAT(omp_chunk_size)
+    for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+      const su2double factor = lambda * nodes->GetUnderRelaxation(iPoint);
+      for (unsigned short iVar = 0; iVar < nVar; iVar++)
+        nodes->SetSolution(iPoint, iVar, nodes->GetSolution_Old(iPoint,iVar) + factor*step(iPoint,iVar));
+    }
+
+    if (lambda <= lambdaMin) break;
+
+    EvaluateResidual();
+
+    if (linSysRes.norm() < residualNorm) break;
+
+    lambda = max(0.5*lambda, lambdaMin);
+  }
+
+  for (unsigned short iPeriodic = 1; iPeriodic <= config->GetnMarker_Periodic()/2; iPeriodic++) {
+    solver->InitiatePeriodicComms(geometry, config, iPeriodic, PERIODIC_IMPLICIT);
+    solver->CompletePeriodicComms(geometry, config, iPeriodic, PERIODIC_IMPLICIT);
+  }
+  solver->InitiateComms(geometry, config, SOLUTION);
+  solver->CompleteComms(geometry, config, SOLUTION);
+
+  /*--- The residual of FGMRES is relative to the right hand side, the Newton steps are inexact
+   *    by design, therefore the CFL adaptation compares it with the forcing term. ---*/
+
+  SU2_OMP_MASTER
+  {
+    solver->SetIterLinSolver(iter);
+    solver->SetResLinSolver(linRes);
+    solver->SetTolLinSolver(forcing);
+  }
+  SU2_OMP_BARRIER
+
+  solver->Postprocessing(geometry, solvers, config, MESH_0);
+}
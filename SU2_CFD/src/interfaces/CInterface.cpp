@@ -68,9 +68,12 @@ void CInterface::BroadcastData(const CInterpolator& interpolator,
   GetPhysical_Constants(donor_solution, target_solution, donor_geometry, target_geometry,
                         donor_config, target_config);
 
+  const auto nMarkerInt = donor_config->GetMarker_n_ZoneInterface()/2u;
+  if (transferPlans.size() != nMarkerInt) transferPlans.resize(nMarkerInt);
+
   /*--- Loop over interface markers. ---*/
 
-  for (auto iMarkerInt = 0u; iMarkerInt < donor_config->GetMarker_n_ZoneInterface()/2; iMarkerInt++) {
+  for (auto iMarkerInt = 0u; iMarkerInt < nMarkerInt; iMarkerInt++) {
 
     /*--- Check if this interface connects the two zones, if not continue. ---*/
 
@@ -79,118 +82,335 @@ void CInterface::BroadcastData(const CInterpolator& interpolator,
 
     if(!CInterpolator::CheckInterfaceBoundary(markDonor, markTarget)) continue;
 
-    /*--- Count donor vertices on this rank. ---*/
+    /*--- The communication pattern is built on the first transfer after the interpolator is (re)set, then
+     * each rank only receives the data of its donors. If the owners of the donors are not known, the data
+     * of all donor vertices is gathered on all ranks. ---*/
 
-    int nLocalVertexDonor = 0;
-    if (markDonor >= 0) {
-      for (auto iVertex = 0ul; iVertex < donor_geometry->GetnVertex(markDonor); iVertex++) {
-        auto Point_Donor = donor_geometry->vertex[markDonor][iVertex]->GetNode();
-        /*--- Only domain points are donors. ---*/
-        nLocalVertexDonor += donor_geometry->nodes->GetDomain(Point_Donor);
-      }
+    auto& plan = transferPlans[iMarkerInt];
+
+    if (!plan.built) BuildTransferPlan(interpolator, donor_geometry, target_geometry, markDonor, markTarget, plan);
+
+    su2activematrix gatheredVar;
+    vector<unsigned long> gatheredLocation;
+
+    if (plan.sparse) {
+      ExchangeDonorData(donor_solution, donor_geometry, donor_config, markDonor, plan);
+    }
+    else {
+      GatherDonorData(interpolator, donor_solution, donor_geometry, target_geometry, donor_config,
+                      markDonor, markTarget, gatheredVar, gatheredLocation);
     }
 
-    /*--- Gather donor counts and compute total sizes, and displacements (cumulative
-     * sums) to perform an Allgatherv of donor indices and variables. ---*/
+    const auto& donorVar = plan.sparse? plan.recvBuffer : gatheredVar;
+    const auto& donorLocation = plan.sparse? plan.donorLocation : gatheredLocation;
+
+    /*--- This rank does not need to do more work. ---*/
+    if (markTarget < 0) continue;
+
+    /*--- Loop over target vertices. ---*/
+
+    auto iDonor = 0ul;
+
+    for (auto iVertex = 0ul; iVertex < target_geometry->GetnVertex(markTarget); iVertex++) {
+      const auto iPoint = target_geometry->vertex[markTarget][iVertex]->GetNode();
+
+      if (!target_geometry->nodes->GetDomain(iPoint)) continue;
+
+      auto& targetVertex = interpolator.targetVertices[markTarget][iVertex];
+      const auto nDonorPoints = targetVertex.nDonor();
+
+      InitializeTarget_Variable(target_solution, markTarget, iVertex, nDonorPoints);
+
+      /*--- For the number of donor points. ---*/
+      for (auto iDonorPoint = 0ul; iDonorPoint < nDonorPoints; iDonorPoint++) {
+
+        /*--- Get the interpolation coefficient. ---*/
+
+        const auto donorCoeff = targetVertex.coefficient[iDonorPoint];
+
+        /*--- Recover the Target_Variable from the buffer of variables. ---*/
+        RecoverTarget_Variable(donorVar[donorLocation[iDonor++]], donorCoeff);
 
-    vector<int> nAllVertexDonor(size), nAllVarCounts(size), displIdx(size,0), displVar(size);
-    SU2_MPI::Allgather(&nLocalVertexDonor, 1, MPI_INT, nAllVertexDonor.data(), 1, MPI_INT, MPI_COMM_WORLD);
+        /*--- If the value is not directly aggregated in the previous function. ---*/
+        if (!valAggregated)
+          SetTarget_Variable(target_solution, target_geometry, target_config, markTarget, iVertex, iPoint);
+      }
 
-    for (int i = 0; i < size; ++i) {
-      nAllVarCounts[i] = nAllVertexDonor[i] * nVar;
-      if(i) displIdx[i] = displIdx[i-1] + nAllVertexDonor[i-1];
-      displVar[i] = displIdx[i] * nVar;
+      /*--- If we have aggregated the values in the function RecoverTarget_Variable, the set is outside the loop. ---*/
+      if (valAggregated)
+        SetTarget_Variable(target_solution, target_geometry, target_config, markTarget, iVertex, iPoint);
     }
+  }
+}
 
-    /*--- Fill send buffers. ---*/
+void CInterface::BuildTransferPlan(const CInterpolator& interpolator, CGeometry *donor_geometry,
+                                   CGeometry *target_geometry, int markDonor, int markTarget,
+                                   CTransferPlan& plan) const {
 
-    vector<unsigned long> sendDonorIdx(nLocalVertexDonor);
-    su2activematrix sendDonorVar(nLocalVertexDonor, nVar);
+  plan = CTransferPlan();
+  plan.built = true;
 
-    if (markDonor >= 0) {
-      for (auto iVertex = 0ul, iSend = 0ul; iVertex < donor_geometry->GetnVertex(markDonor); iVertex++) {
-        const auto iPoint = donor_geometry->vertex[markDonor][iVertex]->GetNode();
+  /*--- Global indices of the donors needed by this rank, grouped (sorted and unique) by owner. ---*/
 
-        /*--- If this processor owns the node. ---*/
-        if (donor_geometry->nodes->GetDomain(iPoint)) {
+  vector<vector<unsigned long> > request(size);
+  bool validOwners = true;
 
-          GetDonor_Variable(donor_solution, donor_geometry, donor_config, markDonor, iVertex, iPoint);
-          for (auto iVar = 0u; iVar < nVar; iVar++) sendDonorVar(iSend, iVar) = Donor_Variable[iVar];
+  if (markTarget >= 0) {
+    for (auto iVertex = 0ul; iVertex < target_geometry->GetnVertex(markTarget); iVertex++) {
+      const auto iPoint = target_geometry->vertex[markTarget][iVertex]->GetNode();
+      if (!target_geometry->nodes->GetDomain(iPoint)) continue;
 
-          sendDonorIdx[iSend] = donor_geometry->nodes->GetGlobalIndex(iPoint);
-          ++iSend;
-        }
+      const auto& targetVertex = interpolator.targetVertices[markTarget][iVertex];
+      for (auto iDonor = 0ul; iDonor < targetVertex.nDonor(); iDonor++) {
+        const auto owner = targetVertex.processor[iDonor];
+        if (owner < 0 || owner >= size) { validOwners = false; continue; }
+        request[owner].push_back(targetVertex.globalPoint[iDonor]);
       }
     }
+    for (auto& idx : request) {
+      sort(idx.begin(), idx.end());
+      idx.erase(unique(idx.begin(), idx.end()), idx.end());
+    }
+  }
 
-    /*--- Gather data. ---*/
+  /*--- Send the requests to the owners. ---*/
 
-    const auto nGlobalVertexDonor = displIdx.back() + nAllVertexDonor.back();
+  vector<int> nRequest(size), nRequested(size), requestDispl(size+1,0), requestedDispl(size+1,0);
+  for (int iRank = 0; iRank < size; ++iRank) nRequest[iRank] = request[iRank].size();
 
-    vector<unsigned long> donorIdx(nGlobalVertexDonor);
-    su2activematrix donorVar(nGlobalVertexDonor, nVar);
+  SU2_MPI::Alltoall(nRequest.data(), 1, MPI_INT, nRequested.data(), 1, MPI_INT, MPI_COMM_WORLD);
 
-    SU2_MPI::Allgatherv(sendDonorIdx.data(), sendDonorIdx.size(), MPI_UNSIGNED_LONG, donorIdx.data(),
-                        nAllVertexDonor.data(), displIdx.data(), MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+  for (int iRank = 0; iRank < size; ++iRank) {
+    requestDispl[iRank+1] = requestDispl[iRank] + nRequest[iRank];
+    requestedDispl[iRank+1] = requestedDispl[iRank] + nRequested[iRank];
+  }
 
-    SU2_MPI::Allgatherv(sendDonorVar.data(), sendDonorVar.size(), MPI_DOUBLE, donorVar.data(),
-                        nAllVarCounts.data(), displVar.data(), MPI_DOUBLE, MPI_COMM_WORLD);
+  vector<unsigned long> sendRequest(max(requestDispl[size],1)), recvRequest(max(requestedDispl[size],1));
+  for (int iRank = 0; iRank < size; ++iRank)
+    copy(request[iRank].begin(), request[iRank].end(), sendRequest.begin()+requestDispl[iRank]);
 
-    /*--- This rank does not need to do more work. ---*/
-    if (markTarget < 0) continue;
+  SU2_MPI::Alltoallv(sendRequest.data(), nRequest.data(), requestDispl.data(), MPI_UNSIGNED_LONG,
+                     recvRequest.data(), nRequested.data(), requestedDispl.data(), MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+
+  /*--- Map the requested global indices to the owned vertices of the donor marker. ---*/
+
+  vector<pair<unsigned long, unsigned long> > ownedVertex;
+  if (markDonor >= 0) {
+    for (auto iVertex = 0ul; iVertex < donor_geometry->GetnVertex(markDonor); iVertex++) {
+      const auto iPoint = donor_geometry->vertex[markDonor][iVertex]->GetNode();
+      if (donor_geometry->nodes->GetDomain(iPoint))
+        ownedVertex.emplace_back(donor_geometry->nodes->GetGlobalIndex(iPoint), iVertex);
+    }
+    sort(ownedVertex.begin(), ownedVertex.end());
+  }
 
-    /*--- Sort the donor information by index to then use binary searches. ---*/
+  vector<unsigned long> sendVertex(requestedDispl[size]);
+
+  for (auto i = 0; i < requestedDispl[size]; ++i) {
+    const auto it = lower_bound(ownedVertex.begin(), ownedVertex.end(), make_pair(recvRequest[i], 0ul));
+    if (it == ownedVertex.end() || it->first != recvRequest[i]) { validOwners = false; break; }
+    sendVertex[i] = it->second;
+  }
 
-    vector<size_t> order(donorIdx.size());
-    iota(order.begin(), order.end(), 0ul);
-    sort(order.begin(), order.end(), [&donorIdx](size_t i, size_t j) {return donorIdx[i] < donorIdx[j];} );
+  /*--- All ranks must agree on the type of transfer. ---*/
 
-    /*--- inplace permutation. ---*/
-    for (size_t i = 0; i < order.size(); ++i) {
-      auto j = order[i];
-      while (j < i) j = order[j];
-      if (i == j) continue;
-      swap(donorIdx[i], donorIdx[j]);
-      for (auto iVar = 0u; iVar < nVar; ++iVar)
-        swap(donorVar(i,iVar), donorVar(j,iVar));
+  int myValid = validOwners, allValid = 0;
+  SU2_MPI::Allreduce(&myValid, &allValid, 1, MPI_INT, MPI_MIN, MPI_COMM_WORLD);
+  plan.sparse = (allValid != 0);
+  if (!plan.sparse) return;
+
+  /*--- Send side, the donor variables are evaluated once per vertex even if several ranks need them. ---*/
+
+  plan.donorVertex = sendVertex;
+  sort(plan.donorVertex.begin(), plan.donorVertex.end());
+  plan.donorVertex.erase(unique(plan.donorVertex.begin(), plan.donorVertex.end()), plan.donorVertex.end());
+
+  plan.sendItem.resize(sendVertex.size());
+  for (auto i = 0ul; i < sendVertex.size(); ++i) {
+    plan.sendItem[i] = lower_bound(plan.donorVertex.begin(), plan.donorVertex.end(), sendVertex[i]) -
+                       plan.donorVertex.begin();
+  }
+
+  plan.sendDispl.push_back(0);
+  plan.recvDispl.push_back(0);
+  for (int iRank = 0; iRank < size; ++iRank) {
+    if (nRequested[iRank] > 0) {
+      plan.sendRank.push_back(iRank);
+      plan.sendDispl.push_back(requestedDispl[iRank+1]);
+    }
+    if (nRequest[iRank] > 0) {
+      plan.recvRank.push_back(iRank);
+      plan.recvDispl.push_back(requestDispl[iRank+1]);
     }
+  }
 
-    /*--- Loop over target vertices. ---*/
+  /*--- Receive side, location of each donor (in the order they are used) in the receive buffer. ---*/
 
+  if (markTarget >= 0) {
     for (auto iVertex = 0ul; iVertex < target_geometry->GetnVertex(markTarget); iVertex++) {
       const auto iPoint = target_geometry->vertex[markTarget][iVertex]->GetNode();
-
       if (!target_geometry->nodes->GetDomain(iPoint)) continue;
 
-      auto& targetVertex = interpolator.targetVertices[markTarget][iVertex];
-      const auto nDonorPoints = targetVertex.nDonor();
+      const auto& targetVertex = interpolator.targetVertices[markTarget][iVertex];
+      for (auto iDonor = 0ul; iDonor < targetVertex.nDonor(); iDonor++) {
+        const auto& idx = request[targetVertex.processor[iDonor]];
+        const auto pos = lower_bound(idx.begin(), idx.end(), targetVertex.globalPoint[iDonor]) - idx.begin();
+        plan.donorLocation.push_back(requestDispl[targetVertex.processor[iDonor]] + pos);
+      }
+    }
+  }
 
-      InitializeTarget_Variable(target_solution, markTarget, iVertex, nDonorPoints);
+  plan.requests.resize(plan.sendRank.size() + plan.recvRank.size());
+}
 
-      /*--- For the number of donor points. ---*/
-      for (auto iDonorPoint = 0ul; iDonorPoint < nDonorPoints; iDonorPoint++) {
+void CInterface::ExchangeDonorData(CSolver *donor_solution, CGeometry *donor_geometry, const CConfig *donor_config,
+                                   int markDonor, CTransferPlan& plan) {
 
-        /*--- Get the global index of the donor and the interpolation coefficient. ---*/
+  /*--- Evaluate the variables of the donor vertices needed by other ranks. ---*/
 
-        const auto donorGlobalIndex = targetVertex.globalPoint[iDonorPoint];
-        const auto donorCoeff = targetVertex.coefficient[iDonorPoint];
+  su2activematrix donorVar(plan.donorVertex.size(), nVar);
 
-        /*--- Find the index of the global donor point in the donor data. ---*/
+  for (auto i = 0ul; i < plan.donorVertex.size(); ++i) {
+    const auto iVertex = plan.donorVertex[i];
+    const auto iPoint = donor_geometry->vertex[markDonor][iVertex]->GetNode();
 
-        const auto idx = lower_bound(donorIdx.begin(), donorIdx.end(), donorGlobalIndex) - donorIdx.begin();
-        assert(idx < static_cast<long>(donorIdx.size()));
+    GetDonor_Variable(donor_solution, donor_geometry, donor_config, markDonor, iVertex, iPoint);
+    for (auto iVar = 0u; iVar < nVar; iVar++) donorVar(i, iVar) = Donor_Variable[iVar];
+  }
 
-        /*--- Recover the Target_Variable from the buffer of variables. ---*/
-        RecoverTarget_Variable(donorVar[idx], donorCoeff);
+  /*--- Pack the send buffer (the buffers are kept between transfers). ---*/
 
-        /*--- If the value is not directly aggregated in the previous function. ---*/
-        if (!valAggregated)
-          SetTarget_Variable(target_solution, target_geometry, target_config, markTarget, iVertex, iPoint);
+  plan.sendBuffer.resize(plan.sendItem.size(), nVar);
+  plan.recvBuffer.resize(plan.recvDispl.back(), nVar);
+
+  for (auto i = 0ul; i < plan.sendItem.size(); ++i)
+    for (auto iVar = 0u; iVar < nVar; iVar++)
+      plan.sendBuffer(i, iVar) = donorVar(plan.sendItem[i], iVar);
+
+  /*--- Post the receives and the sends, the data of this rank is copied. ---*/
+
+  int nRequest = 0;
+
+  for (auto iRecv = 0ul; iRecv < plan.recvRank.size(); ++iRecv) {
+    const auto source = plan.recvRank[iRecv];
+    if (source == rank) continue;
+    const auto count = (plan.recvDispl[iRecv+1] - plan.recvDispl[iRecv]) * nVar;
+    SU2_MPI::Irecv(plan.recvBuffer[plan.recvDispl[iRecv]], count, MPI_DOUBLE, source, source,
+                   MPI_COMM_WORLD, &plan.requests[nRequest++]);
+  }
+
+  for (auto iSend = 0ul; iSend < plan.sendRank.size(); ++iSend) {
+    const auto dest = plan.sendRank[iSend];
+    const auto count = (plan.sendDispl[iSend+1] - plan.sendDispl[iSend]) * nVar;
+
+    if (dest == rank) {
+      const auto iRecv = find(plan.recvRank.begin(), plan.recvRank.end(), rank) - plan.recvRank.begin();
+      copy(plan.sendBuffer[plan.sendDispl[iSend]], plan.sendBuffer[plan.sendDispl[iSend]] + count,
+           plan.recvBuffer[plan.recvDispl[iRecv]]);
+      continue;
+    }
+    SU2_MPI::Isend(plan.sendBuffer[plan.sendDispl[iSend]], count, MPI_DOUBLE, dest, rank,
+                   MPI_COMM_WORLD, &plan.requests[nRequest++]);
+  }
+
+  SU2_MPI::Waitall(nRequest, plan.requests.data(), MPI_STATUS_IGNORE);
+}
+
+void CInterface::GatherDonorData(const CInterpolator& interpolator, CSolver *donor_solution,
+                                 CGeometry *donor_geometry, CGeometry *target_geometry,
+                                 const CConfig *donor_config, int markDonor, int markTarget,
+                                 su2activematrix& donorVar, vector<unsigned long>& donorLocation) {
+
+  /*--- Count donor vertices on this rank. ---*/
+
+  int nLocalVertexDonor = 0;
+  if (markDonor >= 0) {
+    for (auto iVertex = 0ul; iVertex < donor_geometry->GetnVertex(markDonor); iVertex++) {
+      auto Point_Donor = donor_geometry->vertex[markDonor][iVertex]->GetNode();
+      /*--- Only domain points are donors. ---*/
+      nLocalVertexDonor += donor_geometry->nodes->GetDomain(Point_Donor);
+    }
+  }
+
+  /*--- Gather donor counts and compute total sizes, and displacements (cumulative
+   * sums) to perform an Allgatherv of donor indices and variables. ---*/
+
+  vector<int> nAllVertexDonor(size), nAllVarCounts(size), displIdx(size,0), displVar(size);
+  SU2_MPI::Allgather(&nLocalVertexDonor, 1, MPI_INT, nAllVertexDonor.data(), 1, MPI_INT, MPI_COMM_WORLD);
+
+  for (int i = 0; i < size; ++i) {
+    nAllVarCounts[i] = nAllVertexDonor[i] * nVar;
+    if(i) displIdx[i] = displIdx[i-1] + nAllVertexDonor[i-1];
+    displVar[i] = displIdx[i] * nVar;
+  }
+
+  /*--- Fill send buffers. ---*/
+
+  vector<unsigned long> sendDonorIdx(nLocalVertexDonor);
+  su2activematrix sendDonorVar(nLocalVertexDonor, nVar);
+
+  if (markDonor >= 0) {
+    for (auto iVertex = 0ul, iSend = 0ul; iVertex < donor_geometry->GetnVertex(markDonor); iVertex++) {
+      const auto iPoint = donor_geometry->vertex[markDonor][iVertex]->GetNode();
+
+      /*--- If this processor owns the node. ---*/
+      if (donor_geometry->nodes->GetDomain(iPoint)) {
+
+        GetDonor_Variable(donor_solution, donor_geometry, donor_config, markDonor, iVertex, iPoint);
+        for (auto iVar = 0u; iVar < nVar; iVar++) sendDonorVar(iSend, iVar) = Donor_Variable[iVar];
+
+        sendDonorIdx[iSend] = donor_geometry->nodes->GetGlobalIndex(iPoint);
+        ++iSend;
       }
+    }
+  }
 
-      /*--- If we have aggregated the values in the function RecoverTarget_Variable, the set is outside the loop. ---*/
-      if (valAggregated)
-        SetTarget_Variable(target_solution, target_geometry, target_config, markTarget, iVertex, iPoint);
+  /*--- Gather data. ---*/
+
+  const auto nGlobalVertexDonor = displIdx.back() + nAllVertexDonor.back();
+
+  vector<unsigned long> donorIdx(nGlobalVertexDonor);
+  donorVar.resize(nGlobalVertexDonor, nVar);
+
+  SU2_MPI::Allgatherv(sendDonorIdx.data(), sendDonorIdx.size(), MPI_UNSIGNED_LONG, donorIdx.data(),
+                      nAllVertexDonor.data(), displIdx.data(), MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+
+  SU2_MPI::Allgatherv(sendDonorVar.data(), sendDonorVar.size(), MPI_DOUBLE, donorVar.data(),
+                      nAllVarCounts.data(), displVar.data(), MPI_DOUBLE, MPI_COMM_WORLD);
+
+  /*--- This rank does not need to do more work. ---*/
+  if (markTarget < 0) return;
+
+  /*--- Sort the donor information by index to then use binary searches. ---*/
+
+  vector<size_t> order(donorIdx.size());
+  iota(order.begin(), order.end(), 0ul);
+  sort(order.begin(), order.end(), [&donorIdx](size_t i, size_t j) {return donorIdx[i] < donorIdx[j];} );
+
+  /*--- inplace permutation. ---*/
+  for (size_t i = 0; i < order.size(); ++i) {
+    auto j = order[i];
+    while (j < i) j = order[j];
+    if (i == j) continue;
+    swap(donorIdx[i], donorIdx[j]);
+    for (auto iVar = 0u; iVar < nVar; ++iVar)
+      swap(donorVar(i,iVar), donorVar(j,iVar));
+  }
+
+  /*--- Find the index of the global donor points in the donor data. ---*/
+
+  for (auto iVertex = 0ul; iVertex < target_geometry->GetnVertex(markTarget); iVertex++) {
+    const auto iPoint = target_geometry->vertex[markTarget][iVertex]->GetNode();
+
+    if (!target_geometry->nodes->GetDomain(iPoint)) continue;
+
+    const auto& targetVertex = interpolator.targetVertices[markTarget][iVertex];
+
+    for (auto iDonorPoint = 0ul; iDonorPoint < targetVertex.nDonor(); iDonorPoint++) {
+      const auto donorGlobalIndex = targetVertex.globalPoint[iDonorPoint];
+      const auto idx = lower_bound(donorIdx.begin(), donorIdx.end(), donorGlobalIndex) - donorIdx.begin();
+      assert(idx < static_cast<long>(donorIdx.size()));
+      donorLocation.push_back(idx);
     }
   }
 }
@@ -27,6 +27,7 @@
 
 #include "../../include/iteration/CDiscAdjFluidIteration.hpp"
 #include "../../include/output/COutput.hpp"
+#include "../../../Common/include/toolboxes/CPerformanceTracer.hpp"
 
 void CDiscAdjFluidIteration::Preprocess(COutput* output, CIntegration**** integration, CGeometry**** geometry,
                                         CSolver***** solver, CNumerics****** numerics, CConfig** config,
@@ -54,9 +55,9 @@ void CDiscAdjFluidIteration::Preprocess(COutput* output, CIntegration**** integr
   //    output->SetHeatFlux_InverseDesign(solver[val_iZone][val_iInst][MESH_0][FLOW_SOL],
   //    geometry[val_iZone][val_iInst][MESH_0], config[val_iZone], ExtIter);
 
-  /*--- For the unsteady adjoint, load direct solutions from restart files. ---*/
+  /*--- For the unsteady adjoint, load direct solutions from restart files (unless the driver recomputes them). ---*/
 
-  if (config[val_iZone]->GetTime_Marching()) {
+  if (config[val_iZone]->GetTime_Marching() && !config[val_iZone]->GetUnst_Checkpointing()) {
     Direct_Iter = SU2_TYPE::Int(config[val_iZone]->GetUnst_AdjointIter()) - SU2_TYPE::Int(TimeIter) - 2;
 
     /*--- For dual-time stepping we want to load the already converged solution at timestep n ---*/
@@ -343,6 +344,9 @@ void CDiscAdjFluidIteration::Iterate(COutput* output, CIntegration**** integrati
                                      CSolver***** solver, CNumerics****** numerics, CConfig** config,
                                      CSurfaceMovement** surface_movement, CVolumetricMovement*** volume_grid_movement,
                                      CFreeFormDefBox*** FFDBox, unsigned short iZone, unsigned short iInst) {
+
+  CTraceScope trace("CDiscAdjFluidIteration::Iterate", "iteration");
+
   bool frozen_visc = config[iZone]->GetFrozen_Visc_Disc();
   bool heat = config[iZone]->GetWeakly_Coupled_Heat();
 
@@ -397,6 +401,9 @@ void CDiscAdjFluidIteration::InitializeAdjoint(CSolver***** solver, CGeometry***
 
 void CDiscAdjFluidIteration::RegisterInput(CSolver***** solver, CGeometry**** geometry, CConfig** config,
                                            unsigned short iZone, unsigned short iInst, unsigned short kind_recording) {
+
+  CTraceScope trace("CDiscAdjFluidIteration::SetRecording", "iteration");
+
   bool frozen_visc = config[iZone]->GetFrozen_Visc_Disc();
   bool heat = config[iZone]->GetWeakly_Coupled_Heat();
 
@@ -27,6 +27,7 @@
 
 #include "../../include/iteration/CFluidIteration.hpp"
 #include "../../include/output/COutput.hpp"
+#include "../../../Common/include/toolboxes/CPerformanceTracer.hpp"
 
 void CFluidIteration::Preprocess(COutput* output, CIntegration**** integration, CGeometry**** geometry,
                                  CSolver***** solver, CNumerics****** numerics, CConfig** config,
@@ -56,6 +57,9 @@ void CFluidIteration::Iterate(COutput* output, CIntegration**** integration, CGe
                               CSolver***** solver, CNumerics****** numerics, CConfig** config,
                               CSurfaceMovement** surface_movement, CVolumetricMovement*** grid_movement,
                               CFreeFormDefBox*** FFDBox, unsigned short val_iZone, unsigned short val_iInst) {
+
+  CTraceScope trace("CFluidIteration::Iterate", "iteration");
+
   unsigned long InnerIter, TimeIter;
 
   const bool unsteady = (config[val_iZone]->GetTime_Marching() == DT_STEPPING_1ST) ||
@@ -41,9 +41,12 @@
 #include "../../include/output/filewriter/CSU2FileWriter.hpp"
 #include "../../include/output/filewriter/CSU2BinaryFileWriter.hpp"
 #include "../../include/output/filewriter/CSU2MeshFileWriter.hpp"
+#include "../../include/output/filewriter/CSU2BinaryMeshFileWriter.hpp"
+#include "../../include/output/filewriter/CCGNSFileWriter.hpp"
 
 
 #include "../../../Common/include/geometry/CGeometry.hpp"
+#include "../../../Common/include/toolboxes/CPerformanceTracer.hpp"
 #include "../../include/solvers/CSolver.hpp"
 
 COutput::COutput(CConfig *config, unsigned short nDim, bool fem_output): femOutput(fem_output) {
@@ -57,7 +60,14 @@ COutput::COutput(CConfig *config, unsigned short nDim, bool fem_output): femOutp
 
   convergenceTable = new PrintingToolbox::CTablePrinter(&std::cout);
   multiZoneHeaderTable = new PrintingToolbox::CTablePrinter(&std::cout);
-  fileWritingTable = new PrintingToolbox::CTablePrinter(&std::cout);
+
+  /*--- In asynchronous mode the output thread writes its summary into a log,
+   which is printed by the main thread once the files are written. ---*/
+
+  asyncOutput = config->GetOutput_Async();
+
+  fileWritingTable = new PrintingToolbox::CTablePrinter(asyncOutput? &fileWritingLog : &std::cout);
+
   historyFileTable = new PrintingToolbox::CTablePrinter(&histFile, "");
 
   /*--- Set default filenames ---*/
@@ -171,9 +181,26 @@ COutput::COutput(CConfig *config, unsigned short nDim, bool fem_output): femOutp
 
   headerNeeded = false;
 
+  /*--- The output thread communicates while the solver does, hence it needs its own
+   communicator, and MPI must allow calls from multiple threads. ---*/
+
+  if (asyncOutput) {
+#ifdef HAVE_MPI
+    int provided = 0;
+    SU2_MPI::Query_thread(&provided);
+    if (provided < MPI_THREAD_MULTIPLE)
+      SU2_MPI::Error("OUTPUT_ASYNC= YES requires MPI_THREAD_MULTIPLE, run SU2_CFD with --thread_multiple.",
+                     CURRENT_FUNCTION);
+#endif
+    SU2_MPI::Comm_dup(SU2_MPI::GetComm(), &asyncComm);
+  }
+
 }
 
 COutput::~COutput(void) {
+
+  WaitForOutputThread(nullptr);
+
   delete convergenceTable;
   delete multiZoneHeaderTable;
   delete fileWritingTable;
@@ -184,6 +211,12 @@ COutput::~COutput(void) {
 
   delete surfaceDataSorter;
   surfaceDataSorter = nullptr;
+
+  if (asyncOutput) {
+    delete asyncVolumeDataSorter;
+    delete asyncSurfaceDataSorter;
+    SU2_MPI::Comm_free(&asyncComm);
+  }
 }
 
 
@@ -314,6 +347,23 @@ void COutput::AllocateDataSorters(CConfig *config, CGeometry *geometry){
 
   }
 
+  /*--- The output thread sorts a copy of the data with its own sorters. ---*/
+
+  if (asyncOutput && asyncVolumeDataSorter == nullptr) {
+
+    if (femOutput) {
+      asyncVolumeDataSorter = new CFEMDataSorter(config, geometry, volumeFieldNames);
+      asyncSurfaceDataSorter = new CSurfaceFEMDataSorter(config, geometry,
+                                                         dynamic_cast<CFEMDataSorter*>(asyncVolumeDataSorter));
+    } else {
+      asyncVolumeDataSorter = new CFVMDataSorter(config, geometry, volumeFieldNames);
+      asyncSurfaceDataSorter = new CSurfaceFVMDataSorter(config, geometry,
+                                                         dynamic_cast<CFVMDataSorter*>(asyncVolumeDataSorter));
+    }
+    asyncVolumeDataSorter->SetComm(asyncComm);
+    asyncSurfaceDataSorter->SetComm(asyncComm);
+  }
+
 }
 
 void COutput::Load_Data(CGeometry *geometry, CConfig *config, CSolver** solver_container){
@@ -334,7 +384,30 @@ void COutput::Load_Data(CGeometry *geometry, CConfig *config, CSolver** solver_c
 
 void COutput::WriteToFile(CConfig *config, CGeometry *geometry, unsigned short format, string fileName){
 
+  /*--- The output thread may still be using the file writing table. ---*/
+
+  WaitForOutputThread(config);
+
+  const OutputSnapshot snapshot = {volumeDataSorter, surfaceDataSorter, curTimeIter,
+                                   GetHistoryFieldValue("TIME_STEP"), GetHistoryFieldValue("CUR_TIME")};
+
+  const su2double bandwidth = WriteToFile(config, geometry, snapshot, format, fileName);
+
+  config->SetRestart_Bandwidth_Agg(config->GetRestart_Bandwidth_Agg() + bandwidth);
+
+  WaitForOutputThread(config);
+}
+
+void COutput::Finalize(CConfig *config){
+
+  WaitForOutputThread(config);
+}
+
+su2double COutput::WriteToFile(CConfig *config, CGeometry *geometry, const OutputSnapshot& snapshot,
+                               unsigned short format, string fileName){
+
   CFileWriter *fileWriter = nullptr;
+  su2double restartBandwidth = 0.0;
 
   unsigned short lastindex = fileName.find_last_of(".");
   fileName = fileName.substr(0, lastindex);
@@ -346,42 +419,42 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, unsigned short f
     case SURFACE_CSV:
 
       if (fileName.empty())
-        fileName = config->GetFilename(surfaceFilename, "", curTimeIter);
+        fileName = config->GetFilename(surfaceFilename, "", snapshot.timeIter);
 
-      surfaceDataSorter->SortConnectivity(config, geometry);
-      surfaceDataSorter->SortOutputData();
+      snapshot.surfaceSorter->SortConnectivity(config, geometry);
+      snapshot.surfaceSorter->SortOutputData();
 
       if (rank == MASTER_NODE) {
         (*fileWritingTable) << "CSV file" << fileName + CSU2FileWriter::fileExt;
       }
 
-      fileWriter = new CSU2FileWriter(fileName, surfaceDataSorter);
+      fileWriter = new CSU2FileWriter(fileName, snapshot.surfaceSorter);
 
       break;
 
     case RESTART_ASCII: case CSV:
 
       if (fileName.empty())
-        fileName = config->GetFilename(restartFilename, "", curTimeIter);
+        fileName = config->GetFilename(restartFilename, "", snapshot.timeIter);
 
       if (rank == MASTER_NODE) {
           (*fileWritingTable) << "SU2 ASCII restart" << fileName + CSU2FileWriter::fileExt;
       }
 
-      fileWriter = new CSU2FileWriter(fileName, volumeDataSorter);
+      fileWriter = new CSU2FileWriter(fileName, snapshot.volumeSorter);
 
       break;
 
     case RESTART_BINARY:
 
       if (fileName.empty())
-        fileName = config->GetFilename(restartFilename, "", curTimeIter);
+        fileName = config->GetFilename(restartFilename, "", snapshot.timeIter);
 
       if (rank == MASTER_NODE) {
           (*fileWritingTable) << "SU2 restart" << fileName + CSU2BinaryFileWriter::fileExt;
       }
 
-      fileWriter = new CSU2BinaryFileWriter(fileName, volumeDataSorter);
+      fileWriter = new CSU2BinaryFileWriter(fileName, snapshot.volumeSorter);
 
       break;
 
@@ -392,15 +465,32 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, unsigned short f
 
       /*--- Load and sort the output data and connectivity. ---*/
 
-      volumeDataSorter->SortConnectivity(config, geometry, true);
+      snapshot.volumeSorter->SortConnectivity(config, geometry, true);
 
-      /*--- Set the mesh ASCII format ---*/
-      if (rank == MASTER_NODE) {
-          (*fileWritingTable) << "SU2 mesh" << fileName + CSU2MeshFileWriter::fileExt;
+      if (config->GetMesh_Out_FileFormat() == SU2_BINARY) {
+
+        /*--- Set the mesh binary format, with one file per zone ---*/
+
+        if (config->GetnZone() > 1)
+          fileName += "_" + PrintingToolbox::to_string(config->GetiZone());
+
+        if (rank == MASTER_NODE) {
+            (*fileWritingTable) << "SU2 binary mesh" << fileName + CSU2BinaryMeshFileWriter::fileExt;
+        }
+
+        fileWriter = new CSU2BinaryMeshFileWriter(fileName, snapshot.volumeSorter,
+                                                  config->GetiZone(), config->GetnZone());
       }
+      else {
 
-      fileWriter = new CSU2MeshFileWriter(fileName, volumeDataSorter,
-                                          config->GetiZone(), config->GetnZone());
+        /*--- Set the mesh ASCII format ---*/
+        if (rank == MASTER_NODE) {
+            (*fileWritingTable) << "SU2 mesh" << fileName + CSU2MeshFileWriter::fileExt;
+        }
+
+        fileWriter = new CSU2MeshFileWriter(fileName, snapshot.volumeSorter,
+                                            config->GetiZone(), config->GetnZone());
+      }
 
 
       break;
@@ -408,74 +498,74 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, unsigned short f
     case TECPLOT_BINARY:
 
       if (fileName.empty())
-        fileName = config->GetFilename(volumeFilename, "", curTimeIter);
+        fileName = config->GetFilename(volumeFilename, "", snapshot.timeIter);
 
       /*--- Load and sort the output data and connectivity. ---*/
 
-      volumeDataSorter->SortConnectivity(config, geometry, false);
+      snapshot.volumeSorter->SortConnectivity(config, geometry, false);
 
       /*--- Write tecplot binary ---*/
       if (rank == MASTER_NODE) {
           (*fileWritingTable) << "Tecplot binary" << fileName + CTecplotBinaryFileWriter::fileExt;
       }
 
-      fileWriter = new CTecplotBinaryFileWriter(fileName, volumeDataSorter,
-                                                curTimeIter, GetHistoryFieldValue("TIME_STEP"));
+      fileWriter = new CTecplotBinaryFileWriter(fileName, snapshot.volumeSorter,
+                                                snapshot.timeIter, snapshot.timeStep);
 
       break;
 
     case TECPLOT:
 
       if (fileName.empty())
-        fileName = config->GetFilename(volumeFilename, "", curTimeIter);
+        fileName = config->GetFilename(volumeFilename, "", snapshot.timeIter);
 
       /*--- Load and sort the output data and connectivity. ---*/
 
-      volumeDataSorter->SortConnectivity(config, geometry, true);
+      snapshot.volumeSorter->SortConnectivity(config, geometry, true);
 
       /*--- Write tecplot ascii ---*/
       if (rank == MASTER_NODE) {
           (*fileWritingTable) << "Tecplot ASCII" << fileName + CTecplotFileWriter::fileExt;
       }
 
-      fileWriter = new CTecplotFileWriter(fileName, volumeDataSorter,
-                                          curTimeIter, GetHistoryFieldValue("TIME_STEP"));
+      fileWriter = new CTecplotFileWriter(fileName, snapshot.volumeSorter,
+                                          snapshot.timeIter, snapshot.timeStep);
 
       break;
 
     case PARAVIEW_XML:
 
       if (fileName.empty())
-        fileName = config->GetFilename(volumeFilename, "", curTimeIter);
+        fileName = config->GetFilename(volumeFilename, "", snapshot.timeIter);
 
       /*--- Load and sort the output data and connectivity. ---*/
 
-      volumeDataSorter->SortConnectivity(config, geometry, true);
+      snapshot.volumeSorter->SortConnectivity(config, geometry, true);
 
       /*--- Write paraview binary ---*/
       if (rank == MASTER_NODE) {
         (*fileWritingTable) << "Paraview" << fileName + CParaviewXMLFileWriter::fileExt;
       }
 
-      fileWriter = new CParaviewXMLFileWriter(fileName, volumeDataSorter);
+      fileWriter = new CParaviewXMLFileWriter(fileName, snapshot.volumeSorter);
 
       break;
 
     case PARAVIEW_BINARY:
 
       if (fileName.empty())
-        fileName = config->GetFilename(volumeFilename, "", curTimeIter);
+        fileName = config->GetFilename(volumeFilename, "", snapshot.timeIter);
 
       /*--- Load and sort the output data and connectivity. ---*/
 
-      volumeDataSorter->SortConnectivity(config, geometry, true);
+      snapshot.volumeSorter->SortConnectivity(config, geometry, true);
 
       /*--- Write paraview binary ---*/
       if (rank == MASTER_NODE) {
           (*fileWritingTable) << "Paraview binary" << fileName + CParaviewBinaryFileWriter::fileExt;
       }
 
-      fileWriter = new CParaviewBinaryFileWriter(fileName, volumeDataSorter);
+      fileWriter = new CParaviewBinaryFileWriter(fileName, snapshot.volumeSorter);
 
       break;
 
@@ -483,19 +573,19 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, unsigned short f
       {
 
         if (fileName.empty())
-          fileName = config->GetFilename(volumeFilename, "", curTimeIter);
+          fileName = config->GetFilename(volumeFilename, "", snapshot.timeIter);
 
         /*--- Sort volume connectivity ---*/
 
-        volumeDataSorter->SortConnectivity(config, geometry, true);
+        snapshot.volumeSorter->SortConnectivity(config, geometry, true);
 
         /*--- The file name of the multiblock file is the case name (i.e. the config file name w/o ext.) ---*/
 
-        fileName = config->GetUnsteady_FileName(config->GetCaseName(), curTimeIter, "");
+        fileName = config->GetUnsteady_FileName(config->GetCaseName(), snapshot.timeIter, "");
 
         /*--- Allocate the vtm file writer ---*/
 
-        fileWriter = new CParaviewVTMFileWriter(fileName, fileName, GetHistoryFieldValue("CUR_TIME"),
+        fileWriter = new CParaviewVTMFileWriter(fileName, fileName, snapshot.curTime,
                                                 config->GetiZone(), config->GetnZone());
 
         /*--- We cast the pointer to its true type, to avoid virtual functions ---*/
@@ -516,7 +606,7 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, unsigned short f
         /*--- Open a block for the internal (volume) data and add the dataset ---*/
 
         vtmWriter->StartBlock(fileName);
-        vtmWriter->AddDataset(fileName, fileName, volumeDataSorter);
+        vtmWriter->AddDataset(fileName, fileName, snapshot.volumeSorter);
         vtmWriter->EndBlock();
 
         /*--- Open a block for the boundary ---*/
@@ -549,18 +639,18 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, unsigned short f
           /*--- Only sort if there is at least one processor that has this marker ---*/
 
           int globalMarkerSize = 0, localMarkerSize = marker.size();
-          SU2_MPI::Allreduce(&localMarkerSize, &globalMarkerSize, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+          SU2_MPI::Allreduce(&localMarkerSize, &globalMarkerSize, 1, MPI_INT, MPI_SUM, snapshot.surfaceSorter->GetComm());
 
           if (globalMarkerSize > 0){
 
             /*--- Sort connectivity of the current marker ---*/
 
-            surfaceDataSorter->SortConnectivity(config, geometry, marker);
-            surfaceDataSorter->SortOutputData();
+            snapshot.surfaceSorter->SortConnectivity(config, geometry, marker);
+            snapshot.surfaceSorter->SortOutputData();
 
             /*--- Add the dataset ---*/
 
-            vtmWriter->AddDataset(markerTag, markerTag, surfaceDataSorter);
+            vtmWriter->AddDataset(markerTag, markerTag, snapshot.surfaceSorter);
 
           }
         }
@@ -576,136 +666,183 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, unsigned short f
     case PARAVIEW:
 
       if (fileName.empty())
-        fileName = config->GetFilename(volumeFilename, "", curTimeIter);
+        fileName = config->GetFilename(volumeFilename, "", snapshot.timeIter);
 
       /*--- Load and sort the output data and connectivity. ---*/
 
-      volumeDataSorter->SortConnectivity(config, geometry, true);
+      snapshot.volumeSorter->SortConnectivity(config, geometry, true);
 
       /*--- Write paraview ascii ---*/
       if (rank == MASTER_NODE) {
           (*fileWritingTable) << "Paraview ASCII" << fileName + CParaviewFileWriter::fileExt;
       }
 
-      fileWriter = new CParaviewFileWriter(fileName, volumeDataSorter);
+      fileWriter = new CParaviewFileWriter(fileName, snapshot.volumeSorter);
 
       break;
 
     case SURFACE_PARAVIEW:
 
       if (fileName.empty())
-        fileName = config->GetFilename(surfaceFilename, "", curTimeIter);
+        fileName = config->GetFilename(surfaceFilename, "", snapshot.timeIter);
 
       /*--- Load and sort the output data and connectivity. ---*/
 
-      surfaceDataSorter->SortConnectivity(config, geometry);
-      surfaceDataSorter->SortOutputData();
+      snapshot.surfaceSorter->SortConnectivity(config, geometry);
+      snapshot.surfaceSorter->SortOutputData();
 
       /*--- Write surface paraview ascii ---*/
       if (rank == MASTER_NODE) {
           (*fileWritingTable) << "Paraview ASCII surface" << fileName + CParaviewFileWriter::fileExt;
       }
 
-      fileWriter = new CParaviewFileWriter(fileName, surfaceDataSorter);
+      fileWriter = new CParaviewFileWriter(fileName, snapshot.surfaceSorter);
 
       break;
 
     case SURFACE_PARAVIEW_BINARY:
 
       if (fileName.empty())
-        fileName = config->GetFilename(surfaceFilename, "", curTimeIter);
+        fileName = config->GetFilename(surfaceFilename, "", snapshot.timeIter);
 
       /*--- Load and sort the output data and connectivity. ---*/
 
-      surfaceDataSorter->SortConnectivity(config, geometry);
-      surfaceDataSorter->SortOutputData();
+      snapshot.surfaceSorter->SortConnectivity(config, geometry);
+      snapshot.surfaceSorter->SortOutputData();
 
       /*--- Write surface paraview binary ---*/
       if (rank == MASTER_NODE) {
           (*fileWritingTable) << "Paraview binary surface" << fileName + CParaviewBinaryFileWriter::fileExt;
       }
 
-      fileWriter = new CParaviewBinaryFileWriter(fileName, surfaceDataSorter);
+      fileWriter = new CParaviewBinaryFileWriter(fileName, snapshot.surfaceSorter);
 
       break;
 
     case SURFACE_PARAVIEW_XML:
 
       if (fileName.empty())
-        fileName = config->GetFilename(surfaceFilename, "", curTimeIter);
+        fileName = config->GetFilename(surfaceFilename, "", snapshot.timeIter);
 
       /*--- Load and sort the output data and connectivity. ---*/
 
-      surfaceDataSorter->SortConnectivity(config, geometry);
-      surfaceDataSorter->SortOutputData();
+      snapshot.surfaceSorter->SortConnectivity(config, geometry);
+      snapshot.surfaceSorter->SortOutputData();
 
       /*--- Write paraview binary ---*/
       if (rank == MASTER_NODE) {
           (*fileWritingTable) << "Paraview surface" << fileName + CParaviewXMLFileWriter::fileExt;
       }
 
-      fileWriter = new CParaviewXMLFileWriter(fileName, surfaceDataSorter);
+      fileWriter = new CParaviewXMLFileWriter(fileName, snapshot.surfaceSorter);
 
       break;
 
     case SURFACE_TECPLOT:
 
       if (fileName.empty())
-        fileName = config->GetFilename(surfaceFilename, "", curTimeIter);
+        fileName = config->GetFilename(surfaceFilename, "", snapshot.timeIter);
 
       /*--- Load and sort the output data and connectivity. ---*/
 
-      surfaceDataSorter->SortConnectivity(config, geometry);
-      surfaceDataSorter->SortOutputData();
+      snapshot.surfaceSorter->SortConnectivity(config, geometry);
+      snapshot.surfaceSorter->SortOutputData();
 
       /*--- Write surface tecplot ascii ---*/
       if (rank == MASTER_NODE) {
           (*fileWritingTable) << "Tecplot ASCII surface" << fileName + CTecplotFileWriter::fileExt;
       }
 
-      fileWriter = new CTecplotFileWriter(fileName, surfaceDataSorter,
-                                          curTimeIter, GetHistoryFieldValue("TIME_STEP"));
+      fileWriter = new CTecplotFileWriter(fileName, snapshot.surfaceSorter,
+                                          snapshot.timeIter, snapshot.timeStep);
 
       break;
 
     case SURFACE_TECPLOT_BINARY:
 
       if (fileName.empty())
-        fileName = config->GetFilename(surfaceFilename, "", curTimeIter);
+        fileName = config->GetFilename(surfaceFilename, "", snapshot.timeIter);
 
       /*--- Load and sort the output data and connectivity. ---*/
 
-      surfaceDataSorter->SortConnectivity(config, geometry);
-      surfaceDataSorter->SortOutputData();
+      snapshot.surfaceSorter->SortConnectivity(config, geometry);
+      snapshot.surfaceSorter->SortOutputData();
 
       /*--- Write surface tecplot binary ---*/
       if (rank == MASTER_NODE) {
           (*fileWritingTable) << "Tecplot binary surface" << fileName + CTecplotBinaryFileWriter::fileExt;
       }
 
-      fileWriter = new CTecplotBinaryFileWriter(fileName, surfaceDataSorter,
-                                                curTimeIter, GetHistoryFieldValue("TIME_STEP"));
+      fileWriter = new CTecplotBinaryFileWriter(fileName, snapshot.surfaceSorter,
+                                                snapshot.timeIter, snapshot.timeStep);
 
       break;
 
     case STL:
 
       if (fileName.empty())
-        fileName = config->GetFilename(surfaceFilename, "", curTimeIter);
+        fileName = config->GetFilename(surfaceFilename, "", snapshot.timeIter);
 
       /*--- Load and sort the output data and connectivity. ---*/
 
-      surfaceDataSorter->SortConnectivity(config, geometry);
-      surfaceDataSorter->SortOutputData();
+      snapshot.surfaceSorter->SortConnectivity(config, geometry);
+      snapshot.surfaceSorter->SortOutputData();
 
       /*--- Write ASCII STL ---*/
       if (rank == MASTER_NODE) {
           (*fileWritingTable) << "STL ASCII" << fileName + CSTLFileWriter::fileExt;
       }
 
-      fileWriter = new CSTLFileWriter(fileName, surfaceDataSorter);
+      fileWriter = new CSTLFileWriter(fileName, snapshot.surfaceSorter);
+
+      break;
+
+    case CGNS: case SURFACE_CGNS:
+    {
+      const bool surface = (format == SURFACE_CGNS);
+      CParallelDataSorter* dataSorter = surface? snapshot.surfaceSorter : snapshot.volumeSorter;
+      bool& seriesStarted = surface? cgnsSurfaceSeriesStarted : cgnsVolumeSeriesStarted;
+
+      /*--- Time-accurate solutions on a fixed grid are appended to one file, the first
+       step of a run starts a new file unless the run is a restart. ---*/
+
+      const bool timeSeries = config->GetTime_Domain() && !config->GetDynamic_Grid();
+      const bool append = seriesStarted || config->GetRestart();
+
+      if (fileName.empty()) {
+        fileName = surface? surfaceFilename : volumeFilename;
+        if (timeSeries) {
+          if (config->GetnZone() > 1)
+            fileName += "_" + PrintingToolbox::to_string(config->GetiZone());
+          if (config->GetnTimeInstances() > 1)
+            fileName = config->GetMultiInstance_FileName(fileName, config->GetiInst(), "");
+        }
+        else {
+          fileName = config->GetFilename(fileName, "", snapshot.timeIter);
+        }
+      }
+
+      /*--- Load and sort the output data and connectivity. ---*/
+
+      if (surface) {
+        snapshot.surfaceSorter->SortConnectivity(config, geometry);
+        snapshot.surfaceSorter->SortOutputData();
+      }
+      else {
+        snapshot.volumeSorter->SortConnectivity(config, geometry, true);
+      }
+
+      if (rank == MASTER_NODE) {
+          (*fileWritingTable) << (surface? "CGNS surface" : "CGNS") << fileName + CCGNSFileWriter::fileExt;
+      }
+
+      fileWriter = new CCGNSFileWriter(fileName, dataSorter, surface, snapshot.timeIter,
+                                       snapshot.curTime, timeSeries, append);
+
+      seriesStarted = timeSeries;
 
       break;
+    }
 
     default:
       fileWriter = nullptr;
@@ -720,10 +857,10 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, unsigned short f
 
     su2double BandWidth = fileWriter->Get_Bandwidth();
 
-    /*--- Compute and store the bandwidth ---*/
+    /*--- Return the bandwidth, the output thread must not modify the config. ---*/
 
     if (format == RESTART_BINARY){
-      config->SetRestart_Bandwidth_Agg(config->GetRestart_Bandwidth_Agg()+BandWidth);
+      restartBandwidth = BandWidth;
     }
 
     if (config->GetWrt_Performance() && (rank == MASTER_NODE)){
@@ -735,6 +872,8 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, unsigned short f
     delete fileWriter;
 
   }
+
+  return restartBandwidth;
 }
 
 
@@ -757,31 +896,27 @@ bool COutput::SetResult_Files(CGeometry *geometry, CConfig *config, CSolver** so
 
   if (writeFiles){
 
-    /*--- Partition and sort the data --- */
-
-    volumeDataSorter->SortOutputData();
+    OutputSnapshot snapshot = {volumeDataSorter, surfaceDataSorter, curTimeIter,
+                               GetHistoryFieldValue("TIME_STEP"), GetHistoryFieldValue("CUR_TIME")};
 
-    unsigned short nVolumeFiles = config->GetnVolumeOutputFiles();
-    auto VolumeFiles = config->GetVolumeOutputFiles();
-
-    if (rank == MASTER_NODE && nVolumeFiles != 0){
-      fileWritingTable->SetAlign(PrintingToolbox::CTablePrinter::CENTER);
-      fileWritingTable->PrintHeader();
-      fileWritingTable->SetAlign(PrintingToolbox::CTablePrinter::LEFT);
-    }
+    if (asyncOutput) {
 
-    /*--- Loop through all requested output files and write
-     * the partitioned and sorted data stored in the data sorters. ---*/
+      /*--- Wait until the previous files are written (the output thread owns one set of
+       sorters), hand it a copy of the data, and return to the solver. ---*/
 
-    for (unsigned short iFile = 0; iFile < nVolumeFiles; iFile++){
+      WaitForOutputThread(config);
 
-      WriteToFile(config, geometry, VolumeFiles[iFile]);
+      asyncVolumeDataSorter->CopyUnsorted_Data(*volumeDataSorter);
+      snapshot.volumeSorter = asyncVolumeDataSorter;
+      snapshot.surfaceSorter = asyncSurfaceDataSorter;
 
+      outputTask = std::async(std::launch::async, &COutput::WriteVolumeFiles, this, config, geometry, snapshot);
     }
+    else {
+      const su2double bandwidth = WriteVolumeFiles(config, geometry, snapshot);
+      config->SetRestart_Bandwidth_Agg(config->GetRestart_Bandwidth_Agg() + bandwidth);
 
-    if (rank == MASTER_NODE && nVolumeFiles != 0){
-      fileWritingTable->PrintFooter();
-      headerNeeded = true;
+      if (rank == MASTER_NODE && config->GetnVolumeOutputFiles() != 0) headerNeeded = true;
     }
 
     /*--- Write any additonal files defined in the child class ----*/
@@ -794,6 +929,63 @@ bool COutput::SetResult_Files(CGeometry *geometry, CConfig *config, CSolver** so
   return false;
 }
 
+su2double COutput::WriteVolumeFiles(CConfig *config, CGeometry *geometry, OutputSnapshot snapshot){
+
+  /*--- Partition and sort the data --- */
+
+  snapshot.volumeSorter->SortOutputData();
+
+  unsigned short nVolumeFiles = config->GetnVolumeOutputFiles();
+  auto VolumeFiles = config->GetVolumeOutputFiles();
+
+  if (rank == MASTER_NODE && nVolumeFiles != 0){
+    fileWritingTable->SetAlign(PrintingToolbox::CTablePrinter::CENTER);
+    fileWritingTable->PrintHeader();
+    fileWritingTable->SetAlign(PrintingToolbox::CTablePrinter::LEFT);
+  }
+
+  /*--- Loop through all requested output files and write
+   * the partitioned and sorted data stored in the data sorters. ---*/
+
+  su2double restartBandwidth = 0.0;
+
+  for (unsigned short iFile = 0; iFile < nVolumeFiles; iFile++){
+
+    restartBandwidth += WriteToFile(config, geometry, snapshot, VolumeFiles[iFile]);
+
+  }
+
+  if (rank == MASTER_NODE && nVolumeFiles != 0){
+    fileWritingTable->PrintFooter();
+  }
+
+  return restartBandwidth;
+}
+
+void COutput::WaitForOutputThread(CConfig *config){
+
+  if (outputTask.valid()) {
+    const su2double startTime = SU2_MPI::Wtime();
+    const su2double bandwidth = outputTask.get();
+    asyncWaitTime += SU2_MPI::Wtime() - startTime;
+
+    if (config != nullptr)
+      config->SetRestart_Bandwidth_Agg(config->GetRestart_Bandwidth_Agg() + bandwidth);
+
+    if (rank == MASTER_NODE && config != nullptr && config->GetWrt_Performance()) {
+      fileWritingLog << "Time waited for the output thread so far: " << asyncWaitTime << " s.\n";
+    }
+  }
+
+  /*--- Print the summary of the files written by the output thread. ---*/
+
+  if (rank == MASTER_NODE && !fileWritingLog.str().empty()) {
+    cout << fileWritingLog.str() << flush;
+    fileWritingLog.str("");
+    headerNeeded = true;
+  }
+}
+
 void COutput::PrintConvergenceSummary(){
 
   PrintingToolbox::CTablePrinter  ConvSummary(&cout);
@@ -2022,6 +2214,21 @@ void COutput::SetCommonHistoryFields(CConfig *config){
 
   AddHistoryOutput("NONPHYSICAL_POINTS", "Nonphysical_Points", ScreenOutputFormat::INTEGER, "NONPHYSICAL_POINTS", "The number of non-physical points in the solution");
 
+  if (config->GetLoad_Balance_Report()) {
+    /// BEGIN_GROUP: LOAD_BALANCE, DESCRIPTION: Compute and MPI wait times of the ranks since the previous evaluation.
+    /// DESCRIPTION: Average compute time.
+    AddHistoryOutput("AVG_COMPUTE_TIME", "Avg_Compute(s)", ScreenOutputFormat::SCIENTIFIC, "LOAD_BALANCE", "Compute time (excluding MPI waits) averaged over the ranks");
+    /// DESCRIPTION: Maximum compute time.
+    AddHistoryOutput("MAX_COMPUTE_TIME", "Max_Compute(s)", ScreenOutputFormat::SCIENTIFIC, "LOAD_BALANCE", "Maximum compute time (excluding MPI waits) over the ranks");
+    /// DESCRIPTION: Average MPI wait time.
+    AddHistoryOutput("AVG_WAIT_TIME", "Avg_Wait(s)", ScreenOutputFormat::SCIENTIFIC, "LOAD_BALANCE", "MPI wait time averaged over the ranks");
+    /// DESCRIPTION: Maximum MPI wait time.
+    AddHistoryOutput("MAX_WAIT_TIME", "Max_Wait(s)", ScreenOutputFormat::SCIENTIFIC, "LOAD_BALANCE", "Maximum MPI wait time over the ranks");
+    /// DESCRIPTION: Load imbalance.
+    AddHistoryOutput("LOAD_IMBALANCE", "Imbalance", ScreenOutputFormat::FIXED, "LOAD_BALANCE", "Ratio of the maximum to the average compute time");
+    /// END_GROUP
+  }
+
 }
 
 void COutput::LoadCommonHistoryData(CConfig *config){
@@ -2047,6 +2254,32 @@ void COutput::LoadCommonHistoryData(CConfig *config){
   SetHistoryOutputValue("WALL_TIME", UsedTime);
 
   SetHistoryOutputValue("NONPHYSICAL_POINTS", config->GetNonphysical_Points());
+
+  if (config->GetLoad_Balance_Report()) {
+
+    /*--- Compute and wait times of this rank since the previous sample (collective). ---*/
+
+    const passivedouble sampleTime = SU2_MPI::Wtime();
+    const passivedouble sampleWait = CPerformanceTracer::GetWaitTime();
+    if (lastSampleTime == 0.0) lastSampleTime = SU2_TYPE::GetValue(config->Get_StartTime());
+
+    const passivedouble wait = sampleWait - lastSampleWait;
+    const su2double local[2] = {sampleTime - lastSampleTime - wait, wait};
+    su2double sum[2] = {0.0}, maxVal[2] = {0.0};
+
+    SU2_MPI::Allreduce(local, sum, 2, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    SU2_MPI::Allreduce(local, maxVal, 2, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+
+    lastSampleTime = sampleTime;
+    lastSampleWait = sampleWait;
+
+    const su2double avgCompute = sum[0]/size;
+    SetHistoryOutputValue("AVG_COMPUTE_TIME", avgCompute);
+    SetHistoryOutputValue("MAX_COMPUTE_TIME", maxVal[0]);
+    SetHistoryOutputValue("AVG_WAIT_TIME", sum[1]/size);
+    SetHistoryOutputValue("MAX_WAIT_TIME", maxVal[1]);
+    SetHistoryOutputValue("LOAD_IMBALANCE", (avgCompute > 0.0)? maxVal[0]/avgCompute : 1.0);
+  }
 }
 
 
@@ -0,0 +1,527 @@
+/*!
+ * \file CCGNSFileWriter.cpp
+ * \brief Filewriter class for CGNS format.
+ * \author SU2 Developers
+ * \version 7.1.0 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../../include/output/filewriter/CCGNSFileWriter.hpp"
+
+#ifdef HAVE_CGNS
+#include "cgnslib.h"
+
+/*--- A CGNS library built with parallel HDF5 writes the file collectively, the bundled (ADF) library is serial. ---*/
+#if defined(HAVE_MPI) && CG_BUILD_PARALLEL
+#define CGNS_COLLECTIVE_IO
+#include "pcgnslib.h"
+#endif
+#endif
+
+const string CCGNSFileWriter::fileExt = ".cgns";
+
+#ifdef HAVE_CGNS
+namespace {
+
+/*--- The element types in the order in which the sections are written. ---*/
+
+const GEO_TYPE elemTypes[N_ELEM_TYPES] = {LINE, TRIANGLE, QUADRILATERAL, TETRAHEDRON,
+                                          HEXAHEDRON, PRISM, PYRAMID};
+
+const unsigned short elemNodes[N_ELEM_TYPES] = {N_POINTS_LINE, N_POINTS_TRIANGLE, N_POINTS_QUADRILATERAL,
+                                                N_POINTS_TETRAHEDRON, N_POINTS_HEXAHEDRON, N_POINTS_PRISM,
+                                                N_POINTS_PYRAMID};
+
+const CGNS_ENUMT(ElementType_t) elemTypesCGNS[N_ELEM_TYPES] = {CGNS_ENUMV(BAR_2), CGNS_ENUMV(TRI_3),
+                                                               CGNS_ENUMV(QUAD_4), CGNS_ENUMV(TETRA_4),
+                                                               CGNS_ENUMV(HEXA_8), CGNS_ENUMV(PENTA_6),
+                                                               CGNS_ENUMV(PYRA_5)};
+
+const char* const elemSectionNames[N_ELEM_TYPES] = {"Lines", "Triangles", "Quadrilaterals", "Tetrahedra",
+                                                    "Hexahedra", "Prisms", "Pyramids"};
+
+const char* const coordNames[3] = {"CoordinateX", "CoordinateY", "CoordinateZ"};
+
+/*--- There is only one base and one zone per file. ---*/
+
+const int baseIndex = 1, zoneIndex = 1;
+
+/*!
+ * \brief Abort with the CGNS error message if a call to the library failed.
+ */
+inline void CheckCGNS(int ierr) {
+  if (ierr != CG_OK)
+    SU2_MPI::Error(string("CGNS error: ") + cg_get_error(), CURRENT_FUNCTION);
+}
+
+/*!
+ * \brief Open a file, collectively if the library is parallel.
+ */
+inline int OpenCGNS(const string& fileName, int mode, int* fn) {
+#ifdef CGNS_COLLECTIVE_IO
+  return cgp_open(fileName.c_str(), mode, fn);
+#else
+  return cg_open(fileName.c_str(), mode, fn);
+#endif
+}
+
+/*!
+ * \brief Close a file, collectively if the library is parallel.
+ */
+inline void CloseCGNS(int fn) {
+#ifdef CGNS_COLLECTIVE_IO
+  CheckCGNS(cgp_close(fn));
+#else
+  CheckCGNS(cg_close(fn));
+#endif
+}
+
+/*!
+ * \brief Write the range [start, end] of a coordinate. The parallel library creates the node and
+ *        writes the data collectively (ranks without points write nothing), the serial one writes
+ *        the range into the node, which is created by the first partial write.
+ */
+void WriteCoordinate(int fn, const char* name, cgsize_t start, cgsize_t end, const passivedouble* data) {
+  const bool empty = (end < start);
+  int C = 0;
+#ifdef CGNS_COLLECTIVE_IO
+  CheckCGNS(cgp_coord_write(fn, baseIndex, zoneIndex, CGNS_ENUMV(RealDouble), name, &C));
+  CheckCGNS(cgp_coord_write_data(fn, baseIndex, zoneIndex, C, empty? nullptr : &start,
+                                 empty? nullptr : &end, empty? nullptr : data));
+#else
+  if (!empty)
+    CheckCGNS(cg_coord_partial_write(fn, baseIndex, zoneIndex, CGNS_ENUMV(RealDouble), name,
+                                     &start, &end, data, &C));
+#endif
+}
+
+/*!
+ * \brief Write the range [start, end] of the elements of a section, see WriteCoordinate.
+ */
+void WriteElements(int fn, int S, cgsize_t start, cgsize_t end, const cgsize_t* connectivity) {
+  const bool empty = (end < start);
+#ifdef CGNS_COLLECTIVE_IO
+  CheckCGNS(cgp_elements_write_data(fn, baseIndex, zoneIndex, S, start, end, empty? nullptr : connectivity));
+#else
+  if (!empty)
+    CheckCGNS(cg_elements_partial_write(fn, baseIndex, zoneIndex, S, start, end, connectivity));
+#endif
+}
+
+/*!
+ * \brief Write the range [start, end] of a field of a solution node, see WriteCoordinate.
+ */
+void WriteField(int fn, int S, const char* name, cgsize_t start, cgsize_t end, const passivedouble* data) {
+  const bool empty = (end < start);
+  int F = 0;
+#ifdef CGNS_COLLECTIVE_IO
+  CheckCGNS(cgp_field_write(fn, baseIndex, zoneIndex, S, CGNS_ENUMV(RealDouble), name, &F));
+  CheckCGNS(cgp_field_write_data(fn, baseIndex, zoneIndex, S, F, empty? nullptr : &start,
+                                 empty? nullptr : &end, empty? nullptr : data));
+#else
+  if (!empty)
+    CheckCGNS(cg_field_partial_write(fn, baseIndex, zoneIndex, S, CGNS_ENUMV(RealDouble), name,
+                                     &start, &end, data, &F));
+#endif
+}
+
+/*!
+ * \brief CGNS node names are limited to 32 characters and should not contain quotes.
+ */
+string CGNSName(string name) {
+  name.erase(remove(name.begin(), name.end(), '"'), name.end());
+  if (name.size() > CGNS_STRING_SIZE-1) name.resize(CGNS_STRING_SIZE-1);
+  return name;
+}
+
+/*!
+ * \brief Find the section index of an element type, sections are only created for types that exist.
+ */
+int SectionIndex(const vector<unsigned long>& nElemPerRank, int size, unsigned short iType) {
+  int iSection = 0;
+  for (unsigned short jType = 0; jType <= iType; ++jType) {
+    unsigned long nElem = 0;
+    for (int iRank = 0; iRank < size; ++iRank) nElem += nElemPerRank[iRank*N_ELEM_TYPES + jType];
+    if (nElem > 0) ++iSection;
+  }
+  return iSection;
+}
+
+}
+#endif
+
+CCGNSFileWriter::CCGNSFileWriter(string valFileName, CParallelDataSorter *valDataSorter, bool valSurface,
+                                 unsigned long valTimeIter, su2double valTime,
+                                 bool valTimeSeries, bool valAppend) :
+  CFileWriter(std::move(valFileName), valDataSorter, fileExt),
+  isSurface(valSurface),
+  timeIter(valTimeIter),
+  time(valTime),
+  timeSeries(valTimeSeries),
+  appendToFile(valTimeSeries && valAppend) {}
+
+void CCGNSFileWriter::Write_Data(){
+
+#ifdef HAVE_CGNS
+
+  /*--- Set a timer for the file writing. ---*/
+
+  startTime = SU2_MPI::Wtime();
+
+  /*--- Every rank needs to know how many elements of each type the other ranks
+   own, to determine the element ranges it writes to in each section. ---*/
+
+  unsigned long nElemLocal[N_ELEM_TYPES];
+  for (unsigned short iType = 0; iType < N_ELEM_TYPES; ++iType)
+    nElemLocal[iType] = dataSorter->GetnElem(elemTypes[iType]);
+
+  vector<unsigned long> nElemPerRank(size*N_ELEM_TYPES);
+  SU2_MPI::Allgather(nElemLocal, N_ELEM_TYPES, MPI_UNSIGNED_LONG,
+                     nElemPerRank.data(), N_ELEM_TYPES, MPI_UNSIGNED_LONG, comm);
+
+  /*--- A new solution is appended to the file only if its grid matches the current one,
+   otherwise (or if the file does not exist) the file is created from scratch. The series
+   read from the file is only needed by the ranks that write the file hierarchy. ---*/
+
+  TimeSeries series;
+  int writeGrid = 1;
+
+#ifdef CGNS_COLLECTIVE_IO
+  CheckCGNS(cgp_mpi_comm(comm));
+  if (appendToFile) writeGrid = !ReadTimeSeries(series);
+#else
+  if (appendToFile && rank == MASTER_NODE) writeGrid = !ReadTimeSeries(series);
+  SU2_MPI::Bcast(&writeGrid, 1, MPI_INT, MASTER_NODE, comm);
+#endif
+
+  const string solutionName = timeSeries? CGNSName("FlowSolution_" + to_string(timeIter)) : "FlowSolution";
+
+  const int mode = writeGrid? CG_MODE_WRITE : CG_MODE_MODIFY;
+
+#ifdef CGNS_COLLECTIVE_IO
+
+  /*--- All ranks create the nodes of the file hierarchy and write their (contiguous) range
+   of points, elements and fields collectively, no rank receives data from the others. ---*/
+
+  int fn = 0, S = 0;
+  CheckCGNS(OpenCGNS(fileName, mode, &fn));
+
+  if (writeGrid) {
+    WriteGridStructure(fn, nElemPerRank);
+    WriteGridData(fn, nElemPerRank);
+  }
+  DeleteSolutions(fn, series.staleSolutions);
+
+  CheckCGNS(cg_sol_write(fn, baseIndex, zoneIndex, solutionName.c_str(), CGNS_ENUMV(Vertex), &S));
+  WriteSolutionData(fn, S);
+
+  if (timeSeries) WriteIterativeData(fn, series, solutionName);
+
+  CloseCGNS(fn);
+
+#else
+
+  /*--- The master creates the nodes of the file hierarchy and removes the solutions
+   that no longer belong to the series (e.g. after a restart from an earlier step). ---*/
+
+  int S = 0;
+
+  if (rank == MASTER_NODE) {
+    int fn = 0;
+    CheckCGNS(OpenCGNS(fileName, mode, &fn));
+
+    if (writeGrid) WriteGridStructure(fn, nElemPerRank);
+    DeleteSolutions(fn, series.staleSolutions);
+
+    CheckCGNS(cg_sol_write(fn, baseIndex, zoneIndex, solutionName.c_str(), CGNS_ENUMV(Vertex), &S));
+
+    if (timeSeries) WriteIterativeData(fn, series, solutionName);
+
+    CloseCGNS(fn);
+  }
+  SU2_MPI::Bcast(&S, 1, MPI_INT, MASTER_NODE, comm);
+
+  /*--- Each rank writes its (contiguous) range of points and elements with the partial-write
+   functions of the mid-level library. The serial library cannot open the file on several
+   ranks at once, the ranks therefore take turns, but no rank receives data from the others. ---*/
+
+  for (int iProcessor = 0; iProcessor < size; iProcessor++) {
+    if (rank == iProcessor) {
+      int fn = 0;
+      CheckCGNS(OpenCGNS(fileName, CG_MODE_MODIFY, &fn));
+      if (writeGrid) WriteGridData(fn, nElemPerRank);
+      WriteSolutionData(fn, S);
+      CloseCGNS(fn);
+    }
+    SU2_MPI::Barrier(comm);
+  }
+
+#endif
+
+  /*--- Compute and store the write time. ---*/
+
+  stopTime = SU2_MPI::Wtime();
+
+  usedTime = stopTime-startTime;
+
+  /*--- Determine the file size ---*/
+
+  fileSize = Determine_Filesize(fileName);
+
+  /*--- Compute and store the bandwidth ---*/
+
+  bandwidth = fileSize/(1.0e6)/usedTime;
+
+#else
+
+  SU2_MPI::Error(string(" SU2 built without CGNS support. \n") +
+                 string(" To use CGNS, build SU2 accordingly."),
+                 CURRENT_FUNCTION);
+
+#endif
+}
+
+bool CCGNSFileWriter::ReadTimeSeries(TimeSeries& series) const {
+
+#ifdef HAVE_CGNS
+  if (!ifstream(fileName).good()) return false;
+
+  int fn = 0;
+  if (OpenCGNS(fileName, CG_MODE_READ, &fn) != CG_OK) return false;
+
+  char zoneName[CGNS_STRING_SIZE];
+  cgsize_t zoneSize[3] = {0};
+  const bool sameGrid = (cg_zone_read(fn, baseIndex, zoneIndex, zoneName, zoneSize) == CG_OK) &&
+                        (zoneSize[0] == cgsize_t(dataSorter->GetnPointsGlobal())) &&
+                        (zoneSize[1] == cgsize_t(dataSorter->GetnElemGlobal()));
+  if (!sameGrid) {
+    CloseCGNS(fn);
+    return false;
+  }
+
+  char iterName[CGNS_STRING_SIZE];
+  int nSteps = 0;
+
+  if (cg_biter_read(fn, baseIndex, iterName, &nSteps) == CG_OK && nSteps > 0) {
+    vector<double> timeValues(nSteps);
+    vector<int> iterValues(nSteps);
+    vector<char> pointers(nSteps*(CGNS_STRING_SIZE-1), ' ');
+
+    int nArrays = 0;
+    CheckCGNS(cg_goto(fn, baseIndex, "BaseIterativeData_t", 1, "end"));
+    CheckCGNS(cg_narrays(&nArrays));
+    for (int A = 1; A <= nArrays; ++A) {
+      char arrayName[CGNS_STRING_SIZE];
+      CGNS_ENUMT(DataType_t) dataType;
+      int dataDim = 0;
+      cgsize_t dimVector[3] = {0};
+      CheckCGNS(cg_array_info(A, arrayName, &dataType, &dataDim, dimVector));
+      if (string(arrayName) == "TimeValues")
+        CheckCGNS(cg_array_read_as(A, CGNS_ENUMV(RealDouble), timeValues.data()));
+      if (string(arrayName) == "IterationValues")
+        CheckCGNS(cg_array_read_as(A, CGNS_ENUMV(Integer), iterValues.data()));
+    }
+
+    if (cg_goto(fn, baseIndex, "Zone_t", zoneIndex, "ZoneIterativeData_t", 1, "end") == CG_OK) {
+      CheckCGNS(cg_narrays(&nArrays));
+      for (int A = 1; A <= nArrays; ++A) {
+        char arrayName[CGNS_STRING_SIZE];
+        CGNS_ENUMT(DataType_t) dataType;
+        int dataDim = 0;
+        cgsize_t dimVector[3] = {0};
+        CheckCGNS(cg_array_info(A, arrayName, &dataType, &dataDim, dimVector));
+        if (string(arrayName) == "FlowSolutionPointers")
+          CheckCGNS(cg_array_read(A, pointers.data()));
+      }
+    }
+
+    /*--- Only the steps before the current iteration are kept (e.g. after a restart from an
+     earlier iteration), the solution node of the current iteration is overwritten. ---*/
+
+    for (int iStep = 0; iStep < nSteps; ++iStep) {
+      if (static_cast<unsigned long>(iterValues[iStep]) >= timeIter) break;
+
+      string name(&pointers[iStep*(CGNS_STRING_SIZE-1)], CGNS_STRING_SIZE-1);
+      series.timeValues.push_back(timeValues[iStep]);
+      series.iterValues.push_back(iterValues[iStep]);
+      series.solutionNames.push_back(name.substr(0, name.find_last_not_of(' ')+1));
+    }
+  }
+
+  /*--- The solution nodes of the dropped steps would otherwise stay in the file. ---*/
+
+  int nSol = 0;
+  CheckCGNS(cg_nsols(fn, baseIndex, zoneIndex, &nSol));
+  for (int iSol = 1; iSol <= nSol; ++iSol) {
+    char name[CGNS_STRING_SIZE];
+    CGNS_ENUMT(GridLocation_t) location;
+    CheckCGNS(cg_sol_info(fn, baseIndex, zoneIndex, iSol, name, &location));
+    if (find(series.solutionNames.begin(), series.solutionNames.end(), name) == series.solutionNames.end())
+      series.staleSolutions.push_back(name);
+  }
+
+  CloseCGNS(fn);
+  return true;
+#else
+  return false;
+#endif
+}
+
+void CCGNSFileWriter::WriteGridStructure(int fn, const vector<unsigned long>& nElemPerRank) const {
+
+#ifdef HAVE_CGNS
+  const int physDim = dataSorter->GetnDim();
+  const int cellDim = isSurface? physDim-1 : physDim;
+
+  int B = 0, Z = 0;
+  CheckCGNS(cg_base_write(fn, "Base", cellDim, physDim, &B));
+
+  cgsize_t zoneSize[3] = {cgsize_t(dataSorter->GetnPointsGlobal()), cgsize_t(dataSorter->GetnElemGlobal()), 0};
+  CheckCGNS(cg_zone_write(fn, B, "Zone", zoneSize, CGNS_ENUMV(Unstructured), &Z));
+
+  /*--- Create one (empty) section per element type, the element numbering is contiguous over the types. ---*/
+
+  cgsize_t elemStart = 1;
+  for (unsigned short iType = 0; iType < N_ELEM_TYPES; ++iType) {
+    cgsize_t nElem = 0;
+    for (int iRank = 0; iRank < size; ++iRank) nElem += nElemPerRank[iRank*N_ELEM_TYPES + iType];
+    if (nElem == 0) continue;
+
+    int S = 0;
+#ifdef CGNS_COLLECTIVE_IO
+    CheckCGNS(cgp_section_write(fn, B, Z, elemSectionNames[iType], elemTypesCGNS[iType],
+                                elemStart, elemStart+nElem-1, 0, &S));
+#else
+    CheckCGNS(cg_section_partial_write(fn, B, Z, elemSectionNames[iType], elemTypesCGNS[iType],
+                                       elemStart, elemStart+nElem-1, 0, &S));
+#endif
+    elemStart += nElem;
+  }
+#endif
+}
+
+void CCGNSFileWriter::WriteGridData(int fn, const vector<unsigned long>& nElemPerRank) const {
+
+#ifdef HAVE_CGNS
+  const unsigned short nDim = dataSorter->GetnDim();
+  const unsigned long nPoint = dataSorter->GetnPoints();
+
+  /*--- Coordinates, which are the first nDim fields of the sorter. ---*/
+
+  const cgsize_t pointStart = dataSorter->GetnPointCumulative(rank) + 1;
+  const cgsize_t pointEnd = pointStart + nPoint - 1;
+
+  vector<passivedouble> buffer(nPoint);
+  for (unsigned short iDim = 0; iDim < nDim; ++iDim) {
+    for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint)
+      buffer[iPoint] = dataSorter->GetData(iDim, iPoint);
+
+    WriteCoordinate(fn, coordNames[iDim], pointStart, pointEnd, buffer.data());
+  }
+
+  /*--- Connectivity, the global point indices of the sorter are already 1-based. ---*/
+
+  cgsize_t elemStart = 1;
+  for (unsigned short iType = 0; iType < N_ELEM_TYPES; ++iType) {
+    cgsize_t nElemGlobal = 0, nElemBefore = 0;
+    for (int iRank = 0; iRank < size; ++iRank) {
+      const auto nElem = nElemPerRank[iRank*N_ELEM_TYPES + iType];
+      nElemGlobal += nElem;
+      if (iRank < rank) nElemBefore += nElem;
+    }
+    if (nElemGlobal == 0) continue;
+
+    const unsigned long nElem = nElemPerRank[rank*N_ELEM_TYPES + iType];
+
+    vector<cgsize_t> connectivity(nElem*elemNodes[iType]);
+    for (unsigned long iElem = 0; iElem < nElem; ++iElem)
+      for (unsigned short iNode = 0; iNode < elemNodes[iType]; ++iNode)
+        connectivity[iElem*elemNodes[iType] + iNode] = dataSorter->GetElem_Connectivity(elemTypes[iType], iElem, iNode);
+
+    WriteElements(fn, SectionIndex(nElemPerRank, size, iType), elemStart+nElemBefore,
+                  elemStart+nElemBefore+nElem-1, connectivity.data());
+
+    elemStart += nElemGlobal;
+  }
+#endif
+}
+
+void CCGNSFileWriter::WriteSolutionData(int fn, int S) const {
+
+#ifdef HAVE_CGNS
+  const unsigned short nDim = dataSorter->GetnDim();
+  const unsigned long nPoint = dataSorter->GetnPoints();
+  const vector<string>& fieldNames = dataSorter->GetFieldNames();
+
+  const cgsize_t pointStart = dataSorter->GetnPointCumulative(rank) + 1;
+  const cgsize_t pointEnd = pointStart + nPoint - 1;
+
+  vector<passivedouble> buffer(nPoint);
+  for (size_t iField = nDim; iField < fieldNames.size(); ++iField) {
+    for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint)
+      buffer[iPoint] = dataSorter->GetData(iField, iPoint);
+
+    WriteField(fn, S, CGNSName(fieldNames[iField]).c_str(), pointStart, pointEnd, buffer.data());
+  }
+#endif
+}
+
+void CCGNSFileWriter::DeleteSolutions(int fn, const vector<string>& solutionNames) const {
+
+#ifdef HAVE_CGNS
+  for (const auto& name : solutionNames) {
+    CheckCGNS(cg_goto(fn, baseIndex, "Zone_t", zoneIndex, "end"));
+    CheckCGNS(cg_delete_node(name.c_str()));
+  }
+#endif
+}
+
+void CCGNSFileWriter::WriteIterativeData(int fn, TimeSeries series, const string& solutionName) const {
+
+#ifdef HAVE_CGNS
+
+  /*--- Append the current step and rewrite the iterative data. ---*/
+
+  series.timeValues.push_back(SU2_TYPE::GetValue(time));
+  series.iterValues.push_back(int(timeIter));
+  series.solutionNames.push_back(solutionName);
+  const int nSteps = series.timeValues.size();
+
+  /*--- Character arrays are blank-padded and not null-terminated. ---*/
+
+  vector<char> pointers(nSteps*(CGNS_STRING_SIZE-1), ' ');
+  for (int iStep = 0; iStep < nSteps; ++iStep)
+    copy(series.solutionNames[iStep].begin(), series.solutionNames[iStep].end(), &pointers[iStep*(CGNS_STRING_SIZE-1)]);
+
+  cgsize_t nStepsCGNS = nSteps;
+  CheckCGNS(cg_simulation_type_write(fn, baseIndex, CGNS_ENUMV(TimeAccurate)));
+  CheckCGNS(cg_biter_write(fn, baseIndex, "TimeIterValues", nSteps));
+  CheckCGNS(cg_goto(fn, baseIndex, "BaseIterativeData_t", 1, "end"));
+  CheckCGNS(cg_array_write("TimeValues", CGNS_ENUMV(RealDouble), 1, &nStepsCGNS, series.timeValues.data()));
+  CheckCGNS(cg_array_write("IterationValues", CGNS_ENUMV(Integer), 1, &nStepsCGNS, series.iterValues.data()));
+
+  const cgsize_t dimPointers[2] = {CGNS_STRING_SIZE-1, nStepsCGNS};
+  CheckCGNS(cg_ziter_write(fn, baseIndex, zoneIndex, "ZoneIterativeData"));
+  CheckCGNS(cg_goto(fn, baseIndex, "Zone_t", zoneIndex, "ZoneIterativeData_t", 1, "end"));
+  CheckCGNS(cg_array_write("FlowSolutionPointers", CGNS_ENUMV(Character), 2, dimPointers, pointers.data()));
+#endif
+}
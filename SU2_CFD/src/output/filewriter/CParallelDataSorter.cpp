@@ -45,6 +45,7 @@ CParallelDataSorter::CParallelDataSorter(CConfig *config, const vector<string> &
 
   rank = SU2_MPI::GetRank();
   size = SU2_MPI::GetSize();
+  comm = SU2_MPI::GetComm();
 
   GlobalField_Counter = this->fieldNames.size();
 
@@ -108,6 +109,16 @@ CParallelDataSorter::~CParallelDataSorter(){
   delete [] dataBuffer;
 }
 
+void CParallelDataSorter::CopyUnsorted_Data(const CParallelDataSorter& other) {
+
+  const unsigned long nValues = GlobalField_Counter*nPoint_Send[size];
+
+  if (other.GlobalField_Counter != GlobalField_Counter || other.nPoint_Send[size] != nPoint_Send[size])
+    SU2_MPI::Error("The data sorters do not hold the same points and fields.", CURRENT_FUNCTION);
+
+  copy(other.connSend, other.connSend + nValues, connSend);
+}
+
 void CParallelDataSorter::SortOutputData() {
 
   int VARS_PER_POINT = GlobalField_Counter;
@@ -142,7 +153,7 @@ void CParallelDataSorter::SortOutputData() {
       int source = ii;
       int tag    = ii + 1;
       SU2_MPI::Irecv(&(doubleBuffer[ll]), count, MPI_DOUBLE, source, tag,
-                     MPI_COMM_WORLD, &(recv_req[iMessage]));
+                     comm, &(recv_req[iMessage]));
       iMessage++;
     }
   }
@@ -158,7 +169,7 @@ void CParallelDataSorter::SortOutputData() {
       int dest = ii;
       int tag    = rank + 1;
       SU2_MPI::Isend(&(connSend[ll]), count, MPI_DOUBLE, dest, tag,
-                     MPI_COMM_WORLD, &(send_req[iMessage]));
+                     comm, &(send_req[iMessage]));
       iMessage++;
     }
   }
@@ -174,7 +185,7 @@ void CParallelDataSorter::SortOutputData() {
       int source = ii;
       int tag    = ii + 1;
       SU2_MPI::Irecv(&(idRecv[ll]), count, MPI_UNSIGNED_LONG, source, tag,
-                     MPI_COMM_WORLD, &(recv_req[iMessage+nRecvs]));
+                     comm, &(recv_req[iMessage+nRecvs]));
       iMessage++;
     }
   }
@@ -190,7 +201,7 @@ void CParallelDataSorter::SortOutputData() {
       int dest   = ii;
       int tag    = rank + 1;
       SU2_MPI::Isend(&(idSend[ll]), count, MPI_UNSIGNED_LONG, dest, tag,
-                     MPI_COMM_WORLD, &(send_req[iMessage+nSends]));
+                     comm, &(send_req[iMessage+nSends]));
       iMessage++;
     }
   }
@@ -262,7 +273,7 @@ void CParallelDataSorter::SortOutputData() {
   /*--- Reduce the total number of points we will write in the output files. ---*/
 
   SU2_MPI::Allreduce(&nPoints, &nPointsGlobal, 1,
-                     MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+                     MPI_UNSIGNED_LONG, MPI_SUM, comm);
 
   /*--- Free temporary memory from communications ---*/
 
@@ -298,7 +309,7 @@ void CParallelDataSorter::PrepareSendBuffers(std::vector<unsigned long>& globalI
    many cells it will receive from each other processor. ---*/
 
   SU2_MPI::Alltoall(&(nPoint_Send[1]), 1, MPI_INT,
-                    &(nPoint_Recv[1]), 1, MPI_INT, MPI_COMM_WORLD);
+                    &(nPoint_Recv[1]), 1, MPI_INT, comm);
 
   /*--- Prepare to send coordinates. First check how many
    messages we will be sending and receiving. Here we also put
@@ -414,7 +425,7 @@ void CParallelDataSorter::SetTotalElements(){
   
   /*--- Reduce the total number of cells we will be writing in the output files. ---*/
 
-  SU2_MPI::Allreduce(nElemPerType.data(), nElemPerTypeGlobal.data(), N_ELEM_TYPES, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(nElemPerType.data(), nElemPerTypeGlobal.data(), N_ELEM_TYPES, MPI_UNSIGNED_LONG, MPI_SUM, comm);
   
   nElemGlobal = std::accumulate(nElemPerTypeGlobal.begin(), nElemPerTypeGlobal.end(), 0); 
   nElem  = std::accumulate(nElemPerType.begin(), nElemPerType.end(), 0);
@@ -451,10 +462,10 @@ void CParallelDataSorter::SetTotalElements(){
   /*--- Communicate the local counts to all ranks for building offsets. ---*/
 
   SU2_MPI::Alltoall(&(nElem_Send[1]), 1, MPI_INT,
-                    &(nElem_Cum[1]), 1, MPI_INT, MPI_COMM_WORLD);
+                    &(nElem_Cum[1]), 1, MPI_INT, comm);
 
   SU2_MPI::Alltoall(&(nElemConn_Send[1]), 1, MPI_INT,
-                    &(nElemConn_Cum[1]), 1, MPI_INT, MPI_COMM_WORLD);
+                    &(nElemConn_Cum[1]), 1, MPI_INT, comm);
 
   /*--- Put the counters into cumulative storage format. ---*/
 
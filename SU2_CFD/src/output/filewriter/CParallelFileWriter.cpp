@@ -35,6 +35,7 @@ CFileWriter::CFileWriter(string valFileName, CParallelDataSorter *valDataSorter,
 
   rank = SU2_MPI::GetRank();
   size = SU2_MPI::GetSize();
+  comm = dataSorter->GetComm();
 
   this->fileName += valFileExt;
 
@@ -49,6 +50,7 @@ CFileWriter::CFileWriter(string valFileName, string valFileExt):
 
   rank = SU2_MPI::GetRank();
   size = SU2_MPI::GetSize();
+  comm = SU2_MPI::GetComm();
 
   this->fileName += valFileExt;
 
@@ -216,14 +218,14 @@ bool CFileWriter::OpenMPIFile(){
    to write a fresh output file, so we delete any existing files and create
    a new one. ---*/
 
-  ierr = MPI_File_open(MPI_COMM_WORLD, fileName.c_str(),
+  ierr = MPI_File_open(comm, fileName.c_str(),
                        MPI_MODE_CREATE|MPI_MODE_EXCL|MPI_MODE_WRONLY,
                        MPI_INFO_NULL, &fhw);
   if (ierr != MPI_SUCCESS)  {
     MPI_File_close(&fhw);
     if (rank == 0)
       MPI_File_delete(fileName.c_str(), MPI_INFO_NULL);
-    ierr = MPI_File_open(MPI_COMM_WORLD, fileName.c_str(),
+    ierr = MPI_File_open(comm, fileName.c_str(),
                          MPI_MODE_CREATE|MPI_MODE_EXCL|MPI_MODE_WRONLY,
                          MPI_INFO_NULL, &fhw);
   }
@@ -264,7 +266,7 @@ bool CFileWriter::CloseMPIFile(){
 
   su2double my_fileSize = fileSize;
   SU2_MPI::Allreduce(&my_fileSize, &fileSize, 1,
-                     MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+                     MPI_DOUBLE, MPI_SUM, comm);
 
   /*--- Compute and store the bandwidth ---*/
 
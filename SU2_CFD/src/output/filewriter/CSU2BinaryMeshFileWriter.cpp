@@ -0,0 +1,193 @@
+/*!
+ * \file CSU2BinaryMeshFileWriter.cpp
+ * \brief Filewriter class SU2 native binary mesh format.
+ * \author SU2 Developers
+ * \version 7.1.0 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../../include/output/filewriter/CSU2BinaryMeshFileWriter.hpp"
+#include "../../../../Common/include/toolboxes/printing_toolbox.hpp"
+#include <sstream>
+
+const string CSU2BinaryMeshFileWriter::fileExt = ".su2b";
+
+CSU2BinaryMeshFileWriter::CSU2BinaryMeshFileWriter(string valFileName, CParallelDataSorter *valDataSorter,
+                                                   unsigned short valiZone, unsigned short valnZone) :
+  CFileWriter(std::move(valFileName), valDataSorter, fileExt), iZone(valiZone), nZone(valnZone) {}
+
+void CSU2BinaryMeshFileWriter::ReadBoundaryFile(vector<string>& markerTags,
+                                                vector<vector<uint64_t> >& markerElems) const {
+
+  string str = "boundary";
+  if (nZone > 1) str += "_" + PrintingToolbox::to_string(iZone);
+  str += ".dat";
+
+  ifstream input_file;
+  input_file.open(str);
+
+  if (!input_file.is_open()) {
+    SU2_MPI::Error(string("Cannot find ") + str, CURRENT_FUNCTION);
+  }
+
+  string text_line;
+  while (getline(input_file, text_line)) {
+
+    if (text_line.find("NMARK=",0) == string::npos) continue;
+
+    text_line.erase(0,6);
+    const auto nMarker_ = atoi(text_line.c_str());
+    markerTags.resize(nMarker_);
+    markerElems.resize(nMarker_);
+
+    for (auto iMarker = 0; iMarker < nMarker_; iMarker++) {
+
+      /*--- Name of the marker, without white space. ---*/
+
+      getline(input_file, text_line);
+      text_line.erase(0,11);
+      for (auto c : text_line)
+        if ((c != ' ') && (c != '\r') && (c != '\n')) markerTags[iMarker] += c;
+
+      getline(input_file, text_line);
+      text_line.erase(0,13);
+      const auto nElem_Bound_ = atoi(text_line.c_str());
+
+      /*--- The SEND_TO line is not used. ---*/
+
+      getline(input_file, text_line);
+
+      markerElems[iMarker].resize(nElem_Bound_*SU2_BINARY_BOUND_SIZE, 0);
+
+      for (auto iElem_Bound = 0; iElem_Bound < nElem_Bound_; iElem_Bound++) {
+
+        getline(input_file, text_line);
+        istringstream bound_line(text_line);
+
+        uint64_t* record = &markerElems[iMarker][iElem_Bound*SU2_BINARY_BOUND_SIZE];
+        bound_line >> record[0];
+
+        unsigned short nNodes = 0;
+        switch (record[0]) {
+          case VERTEX:        nNodes = 1;                      break;
+          case LINE:          nNodes = N_POINTS_LINE;          break;
+          case TRIANGLE:      nNodes = N_POINTS_TRIANGLE;      break;
+          case QUADRILATERAL: nNodes = N_POINTS_QUADRILATERAL; break;
+        }
+        for (auto iNode = 0u; iNode < nNodes; iNode++)
+          bound_line >> record[1+iNode];
+      }
+    }
+    break;
+  }
+
+}
+
+void CSU2BinaryMeshFileWriter::Write_Data() {
+
+  const uint64_t nDim = dataSorter->GetnDim();
+  const uint64_t nPointGlobal = dataSorter->GetnPointsGlobal();
+  const uint64_t nElemGlobal = dataSorter->GetnElemGlobal();
+
+  /*--- The master reads the markers, only it writes the header and the markers. ---*/
+
+  vector<string> markerTags;
+  vector<vector<uint64_t> > markerElems;
+
+  if (rank == MASTER_NODE) ReadBoundaryFile(markerTags, markerElems);
+
+  /*--- The header is the index of the file, the sizes of the point
+   and element sections are known from the global counts. ---*/
+
+  const uint64_t pointOffset = SU2_BINARY_MESH_HEADER*sizeof(uint64_t);
+  const uint64_t elementOffset = pointOffset + nPointGlobal*nDim*sizeof(passivedouble);
+  const uint64_t markerOffset = elementOffset + nElemGlobal*SU2_BINARY_ELEM_SIZE*sizeof(uint64_t);
+
+  const uint64_t header[SU2_BINARY_MESH_HEADER] = {uint64_t(SU2_BINARY_MESH_MAGIC), uint64_t(SU2_BINARY_MESH_VERSION),
+                                                   nDim, nPointGlobal, nElemGlobal, markerTags.size(),
+                                                   pointOffset, elementOffset, markerOffset, 0};
+
+  OpenMPIFile();
+
+  WriteMPIBinaryData(header, sizeof(header), MASTER_NODE);
+
+  /*--- Collectively write the coordinates of the sorted points. ---*/
+
+  const unsigned long nPoint = dataSorter->GetnPoints();
+  vector<passivedouble> coords(nPoint*nDim);
+
+  for (auto iPoint = 0ul; iPoint < nPoint; iPoint++)
+    for (auto iDim = 0u; iDim < nDim; iDim++)
+      coords[iPoint*nDim+iDim] = dataSorter->GetData(iDim, iPoint);
+
+  WriteMPIBinaryDataAll(coords.data(), coords.size()*sizeof(passivedouble),
+                        nPointGlobal*nDim*sizeof(passivedouble),
+                        dataSorter->GetnPointCumulative(rank)*nDim*sizeof(passivedouble));
+
+  vector<passivedouble>().swap(coords);
+
+  /*--- Collectively write the element records, zero-based and padded to the size of a hexahedron. ---*/
+
+  vector<uint64_t> elems;
+  elems.reserve(dataSorter->GetnElem()*SU2_BINARY_ELEM_SIZE);
+
+  auto copyToBuffer = [&](GEO_TYPE type, unsigned short nPoints) {
+    for (auto iElem = 0ul; iElem < dataSorter->GetnElem(type); iElem++) {
+      elems.push_back(type);
+      for (auto iNode = 0u; iNode < N_POINTS_HEXAHEDRON; iNode++)
+        elems.push_back(iNode < nPoints? dataSorter->GetElem_Connectivity(type, iElem, iNode)-1 : 0);
+    }
+  };
+
+  copyToBuffer(TRIANGLE,      N_POINTS_TRIANGLE);
+  copyToBuffer(QUADRILATERAL, N_POINTS_QUADRILATERAL);
+  copyToBuffer(TETRAHEDRON,   N_POINTS_TETRAHEDRON);
+  copyToBuffer(HEXAHEDRON,    N_POINTS_HEXAHEDRON);
+  copyToBuffer(PRISM,         N_POINTS_PRISM);
+  copyToBuffer(PYRAMID,       N_POINTS_PYRAMID);
+
+  WriteMPIBinaryDataAll(elems.data(), elems.size()*sizeof(uint64_t),
+                        nElemGlobal*SU2_BINARY_ELEM_SIZE*sizeof(uint64_t),
+                        dataSorter->GetnElemCumulative(rank)*SU2_BINARY_ELEM_SIZE*sizeof(uint64_t));
+
+  vector<uint64_t>().swap(elems);
+
+  /*--- The master packs the markers in one buffer, the write is still a collective call. ---*/
+
+  vector<char> markerBuffer;
+  auto append = [&markerBuffer](const void* data, size_t sizeInBytes) {
+    const auto begin = static_cast<const char*>(data);
+    markerBuffer.insert(markerBuffer.end(), begin, begin+sizeInBytes);
+  };
+
+  for (auto iMarker = 0ul; iMarker < markerTags.size(); iMarker++) {
+    const uint64_t markerInfo[2] = {markerTags[iMarker].size(), markerElems[iMarker].size()/SU2_BINARY_BOUND_SIZE};
+    append(markerInfo, sizeof(markerInfo));
+    append(markerTags[iMarker].data(), markerTags[iMarker].size());
+    append(markerElems[iMarker].data(), markerElems[iMarker].size()*sizeof(uint64_t));
+  }
+
+  WriteMPIBinaryData(markerBuffer.data(), markerBuffer.size(), MASTER_NODE);
+
+  CloseMPIFile();
+
+}
@@ -32,6 +32,7 @@
 #include "../../include/fluid/CIdealGas.hpp"
 #include "../../include/fluid/CVanDerWaalsGas.hpp"
 #include "../../include/fluid/CPengRobinson.hpp"
+#include "../../include/fluid/CTabulatedFluidModel.hpp"
 #include "../../include/numerics_simd/CNumericsSIMD.hpp"
 
 
@@ -668,6 +669,42 @@ CEulerSolver::~CEulerSolver(void) {
 
 }
 
+void CEulerSolver::PrintStatistics(const CConfig *config) const {
+
+  if (FluidModel.empty() || (MGLevel != MESH_0) ||
+      !dynamic_cast<const CTabulatedFluidModel*>(FluidModel[0])) return;
+
+  CTabulatedFluidModel::CStatistics stats;
+  for (const auto model : FluidModel)
+    stats += static_cast<const CTabulatedFluidModel*>(model)->GetStatistics();
+
+  /*--- Totals over all ranks. ---*/
+
+  const unsigned long countsLocal[] = {stats.hits, stats.misses, stats.delegated, stats.samples};
+  unsigned long counts[4] = {0};
+  SU2_MPI::Reduce(countsLocal, counts, 4, MPI_UNSIGNED_LONG, MPI_SUM, MASTER_NODE, MPI_COMM_WORLD);
+
+  const su2double sumErrorLocal[] = {stats.sumErrorP, stats.sumErrorT};
+  const su2double maxErrorLocal[] = {stats.maxErrorP, stats.maxErrorT};
+  su2double sumError[2] = {0.0}, maxError[2] = {0.0};
+  SU2_MPI::Reduce(sumErrorLocal, sumError, 2, MPI_DOUBLE, MPI_SUM, MASTER_NODE, MPI_COMM_WORLD);
+  SU2_MPI::Reduce(maxErrorLocal, maxError, 2, MPI_DOUBLE, MPI_MAX, MASTER_NODE, MPI_COMM_WORLD);
+
+  if (rank != MASTER_NODE) return;
+
+  const auto hits = counts[0], misses = counts[1], delegated = counts[2], samples = counts[3];
+  const auto total = max<unsigned long>(1, hits + misses);
+  cout << "Fluid model look-up table: " << hits << " hits, " << misses
+       << " misses (" << 100.0*misses/total << "%), "
+       << delegated << " evaluations by the exact model for NRBC derivatives." << endl;
+  if (samples > 0) {
+    cout << "Relative error of pressure (max/avg): " << maxError[0] << " / " << sumError[0]/samples
+         << ", of temperature: " << maxError[1] << " / " << sumError[1]/samples
+         << ", over " << samples << " samples." << endl;
+  }
+
+}
+
 void CEulerSolver::InstantiateEdgeNumerics(const CSolver* const* solver_container, const CConfig* config) {
 
   SU2_OMP_BARRIER
@@ -1725,33 +1762,60 @@ void CEulerSolver::SetNondimensionalization(CConfig *config, unsigned short iMes
   assert(FluidModel.empty() && "Potential memory leak!");
   FluidModel.resize(omp_get_max_threads());
 
-  SU2_OMP_PARALLEL
-  {
-    const int thread = omp_get_thread_num();
-
+  auto newFluidModel = [&]() -> CFluidModel* {
     switch (config->GetKind_FluidModel()) {
 
       case STANDARD_AIR:
-        FluidModel[thread] = new CIdealGas(1.4, Gas_ConstantND);
-        break;
+        return new CIdealGas(1.4, Gas_ConstantND);
 
       case IDEAL_GAS:
-        FluidModel[thread] = new CIdealGas(Gamma, Gas_ConstantND);
-        break;
+        return new CIdealGas(Gamma, Gas_ConstantND);
 
       case VW_GAS:
-        FluidModel[thread] = new CVanDerWaalsGas(Gamma, Gas_ConstantND,
-                                                 config->GetPressure_Critical() / config->GetPressure_Ref(),
-                                                 config->GetTemperature_Critical() / config->GetTemperature_Ref());
-        break;
+        return new CVanDerWaalsGas(Gamma, Gas_ConstantND,
+                                   config->GetPressure_Critical() / config->GetPressure_Ref(),
+                                   config->GetTemperature_Critical() / config->GetTemperature_Ref());
 
       case PR_GAS:
-        FluidModel[thread] = new CPengRobinson(Gamma, Gas_ConstantND,
-                                               config->GetPressure_Critical() / config->GetPressure_Ref(),
-                                               config->GetTemperature_Critical() / config->GetTemperature_Ref(),
-                                               config->GetAcentric_Factor());
-        break;
+        return new CPengRobinson(Gamma, Gas_ConstantND,
+                                 config->GetPressure_Critical() / config->GetPressure_Ref(),
+                                 config->GetTemperature_Critical() / config->GetTemperature_Ref(),
+                                 config->GetAcentric_Factor());
     }
+    return nullptr;
+  };
+
+  /*--- The look-up table is built (or read) once and shared by the fluid models of all threads.
+   *    Without user ranges it covers the free-stream conditions with some margin. ---*/
+
+  shared_ptr<const CTabulatedFluidModel::CTable> fluidTable;
+
+  if (config->GetLUT_FluidModel()) {
+    su2double rhoRange[2], TRange[2];
+    for (int i = 0; i < 2; ++i) {
+      rhoRange[i] = config->GetLUT_Density_Range(i) / config->GetDensity_Ref();
+      TRange[i] = config->GetLUT_Temperature_Range(i) / config->GetTemperature_Ref();
+    }
+    if (rhoRange[1] <= 0.0) {
+      rhoRange[0] = 0.05 * Density_FreeStreamND;
+      rhoRange[1] = 5.0 * Density_FreeStreamND;
+    }
+    if (TRange[1] <= 0.0) {
+      TRange[0] = 0.4 * Temperature_FreeStreamND;
+      TRange[1] = 3.0 * Temperature_FreeStreamND;
+    }
+    fluidTable = CTabulatedFluidModel::BuildTable(newFluidModel, rhoRange, TRange, config->GetLUT_nNodes_Density(),
+                                                  config->GetLUT_nNodes_Energy(), config->GetLUT_FileName());
+  }
+
+  SU2_OMP_PARALLEL
+  {
+    const int thread = omp_get_thread_num();
+
+    if (fluidTable)
+      FluidModel[thread] = new CTabulatedFluidModel(fluidTable, newFluidModel(), config->GetLUT_Error_Sampling());
+    else
+      FluidModel[thread] = newFluidModel();
 
     GetFluidModel()->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
     if (viscous) {
@@ -2170,7 +2234,7 @@ void CEulerSolver::CommonPreprocessing(CGeometry *geometry, CSolver **solver_con
 
   bool cont_adjoint     = config->GetContinuous_Adjoint();
   bool disc_adjoint     = config->GetDiscrete_Adjoint();
-  bool implicit         = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
+  bool implicit         = ImplicitResidual(config);
   bool center           = (config->GetKind_ConvNumScheme_Flow() == SPACE_CENTERED);
   bool center_jst       = (config->GetKind_Centered_Flow() == JST) && (iMesh == MESH_0);
   bool center_jst_ke    = (config->GetKind_Centered_Flow() == JST_KE) && (iMesh == MESH_0);
@@ -2311,6 +2375,9 @@ unsigned long CEulerSolver::SetPrimitive_Variables(CSolver **solver_container, C
    *    further reduction if function is called in parallel ---*/
   unsigned long nonPhysicalPoints = 0;
 
+  /*--- Each iteration only reads the data of its point, the adjoints (reverse AD) can be updated without atomics. ---*/
+  AD::StartNoSharedReading();
+
   SU2_OMP_FOR_STAT(omp_chunk_size)
   for (unsigned long iPoint = 0; iPoint < nPoint; iPoint ++) {
 
@@ -2324,6 +2391,8 @@ unsigned long CEulerSolver::SetPrimitive_Variables(CSolver **solver_container, C
     if (!physical) nonPhysicalPoints++;
   }
 
+  AD::EndNoSharedReading();
+
   return nonPhysicalPoints;
 }
 
@@ -2331,7 +2400,7 @@ void CEulerSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_container,
                                 unsigned short iMesh, unsigned long Iteration) {
 
   const bool viscous       = config->GetViscous();
-  const bool implicit      = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
+  const bool implicit      = ImplicitResidual(config);
   const bool time_stepping = (config->GetTime_Marching() == TIME_STEPPING);
   const bool dual_time     = (config->GetTime_Marching() == DT_STEPPING_1ST) ||
                              (config->GetTime_Marching() == DT_STEPPING_2ND);
@@ -2602,7 +2671,7 @@ void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_contain
   }
 
   const auto InnerIter        = config->GetInnerIter();
-  const bool implicit         = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
+  const bool implicit         = ImplicitResidual(config);
   const bool ideal_gas        = (config->GetKind_FluidModel() == STANDARD_AIR) ||
                                 (config->GetKind_FluidModel() == IDEAL_GAS);
 
@@ -2627,6 +2696,9 @@ void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_contain
   su2double Primitive_i[MAXNVAR] = {0.0}, Primitive_j[MAXNVAR] = {0.0};
   su2double Secondary_i[MAXNVAR] = {0.0}, Secondary_j[MAXNVAR] = {0.0};
 
+  /*--- No atomic adjoint updates needed while looping over colors (see EdgeFluxResidual). ---*/
+  if (!ReducerStrategy) AD::StartNoSharedReading();
+
   /*--- Loop over edge colors. ---*/
   for (auto color : EdgeColoring)
   {
@@ -2818,6 +2890,8 @@ void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_contain
   }
   } // end color loop
 
+  if (!ReducerStrategy) AD::EndNoSharedReading();
+
   if (ReducerStrategy) {
     SumEdgeFluxes(geometry);
     if (implicit)
@@ -2905,7 +2979,7 @@ void CEulerSolver::LowMachPrimitiveCorrection(CFluidModel *fluidModel, unsigned
 void CEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_container,
                                    CNumerics **numerics_container, CConfig *config, unsigned short iMesh) {
 
-  const bool implicit         = config->GetKind_TimeIntScheme() == EULER_IMPLICIT;
+  const bool implicit         = ImplicitResidual(config);
   const bool viscous          = config->GetViscous();
   const bool rotating_frame   = config->GetRotating_Frame();
   const bool axisymmetric     = config->GetAxisymmetric();
@@ -5597,7 +5671,7 @@ void CEulerSolver::BC_Far_Field(CGeometry *geometry, CSolver **solver_container,
 
   su2double Gas_Constant     = config->GetGas_ConstantND();
 
-  bool implicit       = config->GetKind_TimeIntScheme() == EULER_IMPLICIT;
+  bool implicit       = ImplicitResidual(config);
   bool viscous        = config->GetViscous();
   bool tkeNeeded = (config->GetKind_Turb_Model() == SST) || (config->GetKind_Turb_Model() == SST_SUST);
 
@@ -5850,7 +5924,7 @@ void CEulerSolver::BC_Riemann(CGeometry *geometry, CSolver **solver_container,
   su2double *gridVel, *Residual;
   su2double *V_boundary, *V_domain, *S_boundary, *S_domain;
 
-  bool implicit             = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
+  bool implicit             = ImplicitResidual(config);
   string Marker_Tag         = config->GetMarker_All_TagBound(val_marker);
   bool viscous              = config->GetViscous();
   bool gravity = (config->GetGravityForce());
@@ -6362,7 +6436,7 @@ void CEulerSolver::BC_TurboRiemann(CGeometry *geometry, CSolver **solver_contain
   su2double *V_boundary, *V_domain, *S_boundary, *S_domain;
   su2double AverageEnthalpy, AverageEntropy;
   unsigned short  iZone  = config->GetiZone();
-  bool implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
+  bool implicit = ImplicitResidual(config);
   string Marker_Tag = config->GetMarker_All_TagBound(val_marker);
   unsigned short nSpanWiseSections = geometry->GetnSpanWiseSections(config->GetMarker_All_TurbomachineryFlag(val_marker));
   bool viscous = config->GetViscous();
@@ -7028,7 +7102,7 @@ void CEulerSolver::BC_Giles(CGeometry *geometry, CSolver **solver_container, CNu
   su2double Pressure_e;
   su2double *V_boundary, *V_domain, *S_boundary, *S_domain;
   unsigned short  iZone     = config->GetiZone();
-  bool implicit             = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
+  bool implicit             = ImplicitResidual(config);
   string Marker_Tag         = config->GetMarker_All_TagBound(val_marker);
   bool viscous              = config->GetViscous();
   unsigned short nSpanWiseSections = geometry->GetnSpanWiseSections(config->GetMarker_All_TurbomachineryFlag(val_marker));
@@ -7769,7 +7843,7 @@ void CEulerSolver::BC_Inlet(CGeometry *geometry, CSolver **solver_container,
   alpha, aa, bb, cc, dd, Area, UnitNormal[3];
   su2double *V_inlet, *V_domain;
 
-  bool implicit             = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
+  bool implicit             = ImplicitResidual(config);
   su2double Two_Gamma_M1       = 2.0/Gamma_Minus_One;
   su2double Gas_Constant       = config->GetGas_ConstantND();
   unsigned short Kind_Inlet = config->GetKind_Inlet();
@@ -8064,7 +8138,7 @@ void CEulerSolver::BC_Outlet(CGeometry *geometry, CSolver **solver_container,
   Area, UnitNormal[3];
   su2double *V_outlet, *V_domain;
 
-  bool implicit           = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
+  bool implicit           = ImplicitResidual(config);
   su2double Gas_Constant     = config->GetGas_ConstantND();
   string Marker_Tag       = config->GetMarker_All_TagBound(val_marker);
   bool gravity = (config->GetGravityForce());
@@ -8236,7 +8310,7 @@ void CEulerSolver::BC_Supersonic_Inlet(CGeometry *geometry, CSolver **solver_con
   su2double Density, Pressure, Temperature, Energy, *Vel, Velocity2;
   su2double Gas_Constant = config->GetGas_ConstantND();
 
-  bool implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
+  bool implicit = ImplicitResidual(config);
   string Marker_Tag = config->GetMarker_All_TagBound(val_marker);
   bool tkeNeeded = (config->GetKind_Turb_Model() == SST) || (config->GetKind_Turb_Model() == SST_SUST);
   su2double *Normal = new su2double[nDim];
@@ -8379,7 +8453,7 @@ void CEulerSolver::BC_Supersonic_Outlet(CGeometry *geometry, CSolver **solver_co
   unsigned long iVertex, iPoint;
   su2double *V_outlet, *V_domain;
 
-  bool implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
+  bool implicit = ImplicitResidual(config);
   string Marker_Tag = config->GetMarker_All_TagBound(val_marker);
 
   su2double *Normal = new su2double[nDim];
@@ -8502,7 +8576,7 @@ void CEulerSolver::BC_Engine_Inflow(CGeometry *geometry, CSolver **solver_contai
   su2double *V_inflow, *V_domain;
 
   su2double DampingFactor = config->GetDamp_Engine_Inflow();
-  bool implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
+  bool implicit = ImplicitResidual(config);
   unsigned short Kind_Engine_Inflow = config->GetKind_Engine_Inflow();
   su2double Gas_Constant = config->GetGas_ConstantND();
   string Marker_Tag = config->GetMarker_All_TagBound(val_marker);
@@ -8720,7 +8794,7 @@ void CEulerSolver::BC_Engine_Exhaust(CGeometry *geometry, CSolver **solver_conta
   su2double *V_exhaust, *V_domain, Target_Exhaust_Pressure, Exhaust_Pressure_old, Exhaust_Pressure_inc;
 
   su2double Gas_Constant = config->GetGas_ConstantND();
-  bool implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
+  bool implicit = ImplicitResidual(config);
   string Marker_Tag = config->GetMarker_All_TagBound(val_marker);
   bool tkeNeeded = (config->GetKind_Turb_Model() == SST) || (config->GetKind_Turb_Model() == SST_SUST);
   su2double DampingFactor = config->GetDamp_Engine_Exhaust();
@@ -8969,7 +9043,7 @@ void CEulerSolver::BC_Interface_Boundary(CGeometry *geometry, CSolver **solver_c
   unsigned long iVertex, iPoint, GlobalIndex_iPoint, GlobalIndex_jPoint;
   unsigned short iDim, iVar;
 
-  bool implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
+  bool implicit = ImplicitResidual(config);
 
   su2double *Normal = new su2double[nDim];
   su2double *PrimVar_i = new su2double[nPrimVar];
@@ -9032,7 +9106,7 @@ void CEulerSolver::BC_NearField_Boundary(CGeometry *geometry, CSolver **solver_c
   unsigned long iVertex, iPoint, GlobalIndex_iPoint, GlobalIndex_jPoint;
   unsigned short iDim, iVar;
 
-  bool implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
+  bool implicit = ImplicitResidual(config);
 
   su2double *Normal = new su2double[nDim];
   su2double *PrimVar_i = new su2double[nPrimVar];
@@ -9136,7 +9210,7 @@ void CEulerSolver::BC_ActDisk(CGeometry *geometry, CSolver **solver_container, C
   Mach_out, Pressure_in, Density_in, SoundSpeed_in, Velocity2_in,
   Mach_in, PressureAdj, TemperatureAdj;
 
-  bool implicit           = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
+  bool implicit           = ImplicitResidual(config);
   su2double Gas_Constant  = config->GetGas_ConstantND();
   bool tkeNeeded          = (config->GetKind_Turb_Model() == SST) || (config->GetKind_Turb_Model() == SST_SUST);
   bool ratio              = (config->GetActDisk_Jump() == RATIO);
@@ -9563,7 +9637,7 @@ void CEulerSolver::BC_ActDisk_VariableLoad(CGeometry *geometry, CSolver **solver
   su2double SoSextr, Vnextr[MAXNDIM], Vnextr_, RiemannExtr, QdMnorm[MAXNDIM], QdMnorm2, appo2, SoS_out;
   su2double Normal[MAXNDIM];
 
-  const bool implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
+  const bool implicit = ImplicitResidual(config);
   const auto Gas_Constant = config->GetGas_ConstantND();
   const bool tkeNeeded = (config->GetKind_Turb_Model() == SST) || (config->GetKind_Turb_Model() == SST_SUST);
 
@@ -9773,7 +9847,7 @@ void CEulerSolver::SetResidual_DualTime(CGeometry *geometry, CSolver **solver_co
   const su2double *Normal = nullptr, *GridVel_i = nullptr, *GridVel_j = nullptr;
   su2double Residual_GCL;
 
-  const bool implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
+  const bool implicit = ImplicitResidual(config);
   const bool first_order = (config->GetTime_Marching() == DT_STEPPING_1ST);
   const bool second_order = (config->GetTime_Marching() == DT_STEPPING_2ND);
 
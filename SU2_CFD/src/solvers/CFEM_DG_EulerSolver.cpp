@@ -38,8 +38,6 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(void) : CSolver() {
 
   /*--- Basic array initialization ---*/
 
-  FluidModel = nullptr;
-
   CD_Inv = nullptr; CL_Inv = nullptr; CSF_Inv = nullptr;  CEff_Inv = nullptr;
   CMx_Inv = nullptr; CMy_Inv = nullptr; CMz_Inv = nullptr;
   CFx_Inv = nullptr; CFy_Inv = nullptr; CFz_Inv = nullptr;
@@ -72,8 +70,6 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CConfig *config, unsigned short val_nDi
 
   /*--- Basic array initialization ---*/
 
-  FluidModel = nullptr;
-
   CD_Inv = nullptr; CL_Inv = nullptr; CSF_Inv = nullptr;  CEff_Inv = nullptr;
   CMx_Inv = nullptr; CMy_Inv = nullptr; CMz_Inv = nullptr;
   CFx_Inv = nullptr; CFy_Inv = nullptr; CFz_Inv = nullptr;
@@ -117,8 +113,6 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CConfig *config, unsigned short val_nDi
 CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CGeometry *geometry, CConfig *config, unsigned short iMesh) : CSolver() {
 
   /*--- Array initialization ---*/
-  FluidModel = nullptr;
-
   CD_Inv = nullptr; CL_Inv = nullptr; CSF_Inv = nullptr; CEff_Inv = nullptr;
   CMx_Inv = nullptr;   CMy_Inv = nullptr;   CMz_Inv = nullptr;
   CFx_Inv = nullptr;   CFy_Inv = nullptr;   CFz_Inv = nullptr;
@@ -423,8 +417,12 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CGeometry *geometry, CConfig *config, u
 
   /*--- First the internal matching faces. ---*/
   unsigned long sizeVecResFaces = 0;
+  startLocResMatchingFaces.resize(nMatchingInternalFacesWithHaloElem[nTimeLevels]+1);
   for(unsigned long i=0; i<nMatchingInternalFacesWithHaloElem[nTimeLevels]; ++i) {
 
+    /* Store the position of the residual of this face. */
+    startLocResMatchingFaces[i] = sizeVecResFaces;
+
     /* Determine the time level of the face. */
     const unsigned long  elem0     = matchingInternalFaces[i].elemID0;
     const unsigned long  elem1     = matchingInternalFaces[i].elemID1;
@@ -491,6 +489,8 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CGeometry *geometry, CConfig *config, u
       startLocResInternalFacesWithHaloElem[timeLevel+1] = sizeVecResFaces;
   }
 
+  startLocResMatchingFaces.back() = sizeVecResFaces;
+
   /* Set the uninitialized values of startLocResInternalFacesLocalElem. */
   for(unsigned short i=1; i<=nTimeLevels; ++i) {
     if(startLocResInternalFacesLocalElem[i] == 0)
@@ -733,7 +733,7 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CGeometry *geometry, CConfig *config, u
 
 CFEM_DG_EulerSolver::~CFEM_DG_EulerSolver(void) {
 
-  delete FluidModel;
+  for(auto& model : FluidModel) delete model;
   delete blasFunctions;
 
   /*--- Array deallocation ---*/
@@ -791,6 +791,8 @@ void CFEM_DG_EulerSolver::SetNondimensionalization(CConfig        *config,
 
   /*--- Local variables ---*/
 
+  CFluidModel* auxFluidModel = nullptr;
+
   su2double Alpha            = config->GetAoA()*PI_NUMBER/180.0;
   su2double Beta             = config->GetAoS()*PI_NUMBER/180.0;
   su2double Mach             = config->GetMach();
@@ -816,69 +818,69 @@ void CFEM_DG_EulerSolver::SetNondimensionalization(CConfig        *config,
       if (config->GetSystemMeasurements() == SI) config->SetGas_Constant(287.058);
       else if (config->GetSystemMeasurements() == US) config->SetGas_Constant(1716.49);
 
-      FluidModel = new CIdealGas(1.4, config->GetGas_Constant(), config->GetCompute_Entropy());
+      auxFluidModel = new CIdealGas(1.4, config->GetGas_Constant(), config->GetCompute_Entropy());
       if (free_stream_temp) {
-        FluidModel->SetTDState_PT(Pressure_FreeStream, Temperature_FreeStream);
-        Density_FreeStream = FluidModel->GetDensity();
+        auxFluidModel->SetTDState_PT(Pressure_FreeStream, Temperature_FreeStream);
+        Density_FreeStream = auxFluidModel->GetDensity();
         config->SetDensity_FreeStream(Density_FreeStream);
       }
       else {
-        FluidModel->SetTDState_Prho(Pressure_FreeStream, Density_FreeStream );
-        Temperature_FreeStream = FluidModel->GetTemperature();
+        auxFluidModel->SetTDState_Prho(Pressure_FreeStream, Density_FreeStream );
+        Temperature_FreeStream = auxFluidModel->GetTemperature();
         config->SetTemperature_FreeStream(Temperature_FreeStream);
       }
       break;
 
     case IDEAL_GAS:
 
-      FluidModel = new CIdealGas(Gamma, config->GetGas_Constant(), config->GetCompute_Entropy());
+      auxFluidModel = new CIdealGas(Gamma, config->GetGas_Constant(), config->GetCompute_Entropy());
       if (free_stream_temp) {
-        FluidModel->SetTDState_PT(Pressure_FreeStream, Temperature_FreeStream);
-        Density_FreeStream = FluidModel->GetDensity();
+        auxFluidModel->SetTDState_PT(Pressure_FreeStream, Temperature_FreeStream);
+        Density_FreeStream = auxFluidModel->GetDensity();
         config->SetDensity_FreeStream(Density_FreeStream);
       }
       else {
-        FluidModel->SetTDState_Prho(Pressure_FreeStream, Density_FreeStream );
-        Temperature_FreeStream = FluidModel->GetTemperature();
+        auxFluidModel->SetTDState_Prho(Pressure_FreeStream, Density_FreeStream );
+        Temperature_FreeStream = auxFluidModel->GetTemperature();
         config->SetTemperature_FreeStream(Temperature_FreeStream);
       }
       break;
 
     case VW_GAS:
 
-      FluidModel = new CVanDerWaalsGas(Gamma, config->GetGas_Constant(),
+      auxFluidModel = new CVanDerWaalsGas(Gamma, config->GetGas_Constant(),
                                        config->GetPressure_Critical(), config->GetTemperature_Critical());
       if (free_stream_temp) {
-        FluidModel->SetTDState_PT(Pressure_FreeStream, Temperature_FreeStream);
-        Density_FreeStream = FluidModel->GetDensity();
+        auxFluidModel->SetTDState_PT(Pressure_FreeStream, Temperature_FreeStream);
+        Density_FreeStream = auxFluidModel->GetDensity();
         config->SetDensity_FreeStream(Density_FreeStream);
       }
       else {
-        FluidModel->SetTDState_Prho(Pressure_FreeStream, Density_FreeStream );
-        Temperature_FreeStream = FluidModel->GetTemperature();
+        auxFluidModel->SetTDState_Prho(Pressure_FreeStream, Density_FreeStream );
+        Temperature_FreeStream = auxFluidModel->GetTemperature();
         config->SetTemperature_FreeStream(Temperature_FreeStream);
       }
       break;
 
     case PR_GAS:
 
-      FluidModel = new CPengRobinson(Gamma, config->GetGas_Constant(), config->GetPressure_Critical(),
+      auxFluidModel = new CPengRobinson(Gamma, config->GetGas_Constant(), config->GetPressure_Critical(),
                                      config->GetTemperature_Critical(), config->GetAcentric_Factor());
       if (free_stream_temp) {
-        FluidModel->SetTDState_PT(Pressure_FreeStream, Temperature_FreeStream);
-        Density_FreeStream = FluidModel->GetDensity();
+        auxFluidModel->SetTDState_PT(Pressure_FreeStream, Temperature_FreeStream);
+        Density_FreeStream = auxFluidModel->GetDensity();
         config->SetDensity_FreeStream(Density_FreeStream);
       }
       else {
-        FluidModel->SetTDState_Prho(Pressure_FreeStream, Density_FreeStream );
-        Temperature_FreeStream = FluidModel->GetTemperature();
+        auxFluidModel->SetTDState_Prho(Pressure_FreeStream, Density_FreeStream );
+        Temperature_FreeStream = auxFluidModel->GetTemperature();
         config->SetTemperature_FreeStream(Temperature_FreeStream);
       }
       break;
 
   }
 
-  Mach2Vel_FreeStream = FluidModel->GetSoundSpeed();
+  Mach2Vel_FreeStream = auxFluidModel->GetSoundSpeed();
 
   /*--- Compute the Free Stream velocity, using the Mach number ---*/
 
@@ -927,17 +929,17 @@ void CFEM_DG_EulerSolver::SetNondimensionalization(CConfig        *config,
             from the dimensional version of Sutherland's law or the constant
             viscosity, depending on the input option.---*/
 
-      FluidModel->SetLaminarViscosityModel(config);
+      auxFluidModel->SetLaminarViscosityModel(config);
 
-      Viscosity_FreeStream = FluidModel->GetLaminarViscosity();
+      Viscosity_FreeStream = auxFluidModel->GetLaminarViscosity();
       config->SetViscosity_FreeStream(Viscosity_FreeStream);
 
       Density_FreeStream = Reynolds*Viscosity_FreeStream/(Velocity_Reynolds*config->GetLength_Reynolds());
       config->SetDensity_FreeStream(Density_FreeStream);
-      FluidModel->SetTDState_rhoT(Density_FreeStream, Temperature_FreeStream);
-      Pressure_FreeStream = FluidModel->GetPressure();
+      auxFluidModel->SetTDState_rhoT(Density_FreeStream, Temperature_FreeStream);
+      Pressure_FreeStream = auxFluidModel->GetPressure();
       config->SetPressure_FreeStream(Pressure_FreeStream);
-      Energy_FreeStream = FluidModel->GetStaticEnergy() + 0.5*ModVel_FreeStream*ModVel_FreeStream;
+      Energy_FreeStream = auxFluidModel->GetStaticEnergy() + 0.5*ModVel_FreeStream*ModVel_FreeStream;
 
     }
 
@@ -945,10 +947,10 @@ void CFEM_DG_EulerSolver::SetNondimensionalization(CConfig        *config,
 
     else {
 
-      FluidModel->SetLaminarViscosityModel(config);
-      Viscosity_FreeStream = FluidModel->GetLaminarViscosity();
+      auxFluidModel->SetLaminarViscosityModel(config);
+      Viscosity_FreeStream = auxFluidModel->GetLaminarViscosity();
       config->SetViscosity_FreeStream(Viscosity_FreeStream);
-      Energy_FreeStream = FluidModel->GetStaticEnergy() + 0.5*ModVel_FreeStream*ModVel_FreeStream;
+      Energy_FreeStream = auxFluidModel->GetStaticEnergy() + 0.5*ModVel_FreeStream*ModVel_FreeStream;
 
     }
 
@@ -962,7 +964,7 @@ void CFEM_DG_EulerSolver::SetNondimensionalization(CConfig        *config,
     /*--- For inviscid flow, energy is calculated from the specified
      FreeStream quantities using the proper gas law. ---*/
 
-    Energy_FreeStream = FluidModel->GetStaticEnergy() + 0.5*ModVel_FreeStream*ModVel_FreeStream;
+    Energy_FreeStream = auxFluidModel->GetStaticEnergy() + 0.5*ModVel_FreeStream*ModVel_FreeStream;
 
   }
 
@@ -1041,37 +1043,9 @@ void CFEM_DG_EulerSolver::SetNondimensionalization(CConfig        *config,
 
   /*--- Initialize the dimensionless Fluid Model that will be used to solve the dimensionless problem ---*/
 
-  /*--- Delete the original (dimensional) FluidModel object before replacing. ---*/
-
-  delete FluidModel;
-
-  switch (config->GetKind_FluidModel()) {
-
-    case STANDARD_AIR:
-      FluidModel = new CIdealGas(1.4, Gas_ConstantND, config->GetCompute_Entropy());
-      FluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
-      break;
-
-    case IDEAL_GAS:
-      FluidModel = new CIdealGas(Gamma, Gas_ConstantND, config->GetCompute_Entropy());
-      FluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
-      break;
-
-    case VW_GAS:
-      FluidModel = new CVanDerWaalsGas(Gamma, Gas_ConstantND, config->GetPressure_Critical() /config->GetPressure_Ref(),
-                                       config->GetTemperature_Critical()/config->GetTemperature_Ref());
-      FluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
-      break;
-
-    case PR_GAS:
-      FluidModel = new CPengRobinson(Gamma, Gas_ConstantND, config->GetPressure_Critical() /config->GetPressure_Ref(),
-                                     config->GetTemperature_Critical()/config->GetTemperature_Ref(), config->GetAcentric_Factor());
-      FluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
-      break;
-
-  }
+  /*--- Delete the original (dimensional) FluidModel object. ---*/
 
-  Energy_FreeStreamND = FluidModel->GetStaticEnergy() + 0.5*ModVel_FreeStreamND*ModVel_FreeStreamND;
+  delete auxFluidModel;
 
   if (viscous) {
 
@@ -1086,12 +1060,46 @@ void CFEM_DG_EulerSolver::SetNondimensionalization(CConfig        *config,
 
     /* constant thermal conductivity model */
     config->SetKt_ConstantND(config->GetKt_Constant()/Conductivity_Ref);
+  }
+
+  /*--- Create one dimensionless fluid model object per OpenMP thread, as the fluid models
+        store the thermodynamic state. GetFluidModel() returns the object of the calling thread. ---*/
+
+  FluidModel.resize(omp_get_max_threads());
+
+  auto newFluidModel = [&]() -> CFluidModel* {
+    switch (config->GetKind_FluidModel()) {
+
+      case STANDARD_AIR:
+        return new CIdealGas(1.4, Gas_ConstantND, config->GetCompute_Entropy());
+
+      case IDEAL_GAS:
+        return new CIdealGas(Gamma, Gas_ConstantND, config->GetCompute_Entropy());
+
+      case VW_GAS:
+        return new CVanDerWaalsGas(Gamma, Gas_ConstantND, config->GetPressure_Critical() /config->GetPressure_Ref(),
+                                   config->GetTemperature_Critical()/config->GetTemperature_Ref());
 
-    FluidModel->SetLaminarViscosityModel(config);
-    FluidModel->SetThermalConductivityModel(config);
+      case PR_GAS:
+        return new CPengRobinson(Gamma, Gas_ConstantND, config->GetPressure_Critical() /config->GetPressure_Ref(),
+                                 config->GetTemperature_Critical()/config->GetTemperature_Ref(), config->GetAcentric_Factor());
+    }
+    return nullptr;
+  };
+
+  SU2_OMP_PARALLEL
+  {
+    FluidModel[omp_get_thread_num()] = newFluidModel();
 
+    GetFluidModel()->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
+    if (viscous) {
+      GetFluidModel()->SetLaminarViscosityModel(config);
+      GetFluidModel()->SetThermalConductivityModel(config);
+    }
   }
 
+  Energy_FreeStreamND = GetFluidModel()->GetStaticEnergy() + 0.5*ModVel_FreeStreamND*ModVel_FreeStreamND;
+
   if (tkeNeeded) { Energy_FreeStreamND += Tke_FreeStreamND; };  config->SetEnergy_FreeStreamND(Energy_FreeStreamND);
 
   Energy_Ref = Energy_FreeStream/Energy_FreeStreamND; config->SetEnergy_Ref(Energy_Ref);
@@ -2196,14 +2204,21 @@ void CFEM_DG_EulerSolver::SetUpTaskList(CConfig *config) {
           /* Check whether there are boundary conditions that involve halo elements. */
           if( BCDependOnHalos[level] ) {
 
-            /* Create the dependency list for this task. */
+            /* Create the dependency list for this task. For all but the first
+               integration point, the previous residual of the owned elements
+               must have been accumulated, because this task overwrites it. */
             prevInd[0] = indexInList[CTaskDefinition::SHOCK_CAPTURING_VISCOSITY_OWNED_ELEMENTS][level];
             prevInd[1] = indexInList[CTaskDefinition::SHOCK_CAPTURING_VISCOSITY_HALO_ELEMENTS][level];
 
+            if(intPoint == 0)
+              prevInd[2] = -1;
+            else
+              prevInd[2] = indexInList[CTaskDefinition::ADER_ACCUMULATE_SPACETIME_RESIDUAL_OWNED_ELEMENTS][level];
+
             /* Create the task for the boundary conditions that involve halo elements. */
             indexInList[CTaskDefinition::BOUNDARY_CONDITIONS_DEPEND_ON_HALO][level] = (int)tasksList.size();
             tasksList.push_back(CTaskDefinition(CTaskDefinition::BOUNDARY_CONDITIONS_DEPEND_ON_HALO,
-                                                level, prevInd[0], prevInd[1]));
+                                                level, prevInd[0], prevInd[1], prevInd[2]));
           }
 
           /* Compute the surface residuals for this time level that involve
@@ -2215,19 +2230,22 @@ void CFEM_DG_EulerSolver::SetUpTaskList(CConfig *config) {
             /* Create the dependencies for the surface residual part that involve
                halo elements. For all but the first integration point, make sure
                that the previous residual is already accumulated, because this
-               task will overwrite that residual. */
+               task will overwrite that residual. These faces also contribute to
+               the residual of the owned elements. */
             prevInd[0] = indexInList[CTaskDefinition::SHOCK_CAPTURING_VISCOSITY_OWNED_ELEMENTS][level];
             prevInd[1] = indexInList[CTaskDefinition::SHOCK_CAPTURING_VISCOSITY_HALO_ELEMENTS][level];
 
             if(intPoint == 0)
-              prevInd[2] = -1;
-            else
+              prevInd[2] = prevInd[3] = -1;
+            else {
               prevInd[2] = indexInList[CTaskDefinition::ADER_ACCUMULATE_SPACETIME_RESIDUAL_HALO_ELEMENTS][level];
+              prevInd[3] = indexInList[CTaskDefinition::ADER_ACCUMULATE_SPACETIME_RESIDUAL_OWNED_ELEMENTS][level];
+            }
 
             /* Create the task for the surface residual. */
             indexInList[CTaskDefinition::SURFACE_RESIDUAL_HALO_ELEMENTS][level] = (int)tasksList.size();
             tasksList.push_back(CTaskDefinition(CTaskDefinition::SURFACE_RESIDUAL_HALO_ELEMENTS,
-                                                level, prevInd[0], prevInd[1], prevInd[2]));
+                                                level, prevInd[0], prevInd[1], prevInd[2], prevInd[3]));
 
             /* Create the task to accumulate the surface residuals of the halo
                elements. Make sure to set the integration point for this task. */
@@ -2310,7 +2328,7 @@ void CFEM_DG_EulerSolver::SetUpTaskList(CConfig *config) {
             /* Create the dependencies for this task. */
             prevInd[0] = indexInList[CTaskDefinition::VOLUME_RESIDUAL][level];
             prevInd[1] = indexInList[CTaskDefinition::BOUNDARY_CONDITIONS_DEPEND_ON_OWNED][level];
-            prevInd[1] = indexInList[CTaskDefinition::BOUNDARY_CONDITIONS_DEPEND_ON_HALO][level];
+            prevInd[2] = indexInList[CTaskDefinition::BOUNDARY_CONDITIONS_DEPEND_ON_HALO][level];
             prevInd[3] = indexInList[CTaskDefinition::SURFACE_RESIDUAL_OWNED_ELEMENTS][level];
             prevInd[4] = indexInList[CTaskDefinition::SURFACE_RESIDUAL_HALO_ELEMENTS][level];
 
@@ -3159,9 +3177,9 @@ void CFEM_DG_EulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_co
           const su2double Mom2         = solDOF[1]*solDOF[1] + solDOF[2]*solDOF[2];
           const su2double StaticEnergy = DensityInv*(solDOF[3] - 0.5*DensityInv*Mom2);
 
-          FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-          const su2double Pressure    = FluidModel->GetPressure();
-          const su2double Temperature = FluidModel->GetTemperature();
+          GetFluidModel()->SetTDState_rhoe(solDOF[0], StaticEnergy);
+          const su2double Pressure    = GetFluidModel()->GetPressure();
+          const su2double Temperature = GetFluidModel()->GetTemperature();
 
           if((Pressure < 0.0) || (solDOF[0] < 0.0) || (Temperature < 0.0)) {
             ++ErrorCounter;
@@ -3185,9 +3203,9 @@ void CFEM_DG_EulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_co
                                        + solDOF[3]*solDOF[3];
           const su2double StaticEnergy = DensityInv*(solDOF[4] - 0.5*DensityInv*Mom2);
 
-          FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-          const su2double Pressure    = FluidModel->GetPressure();
-          const su2double Temperature = FluidModel->GetTemperature();
+          GetFluidModel()->SetTDState_rhoe(solDOF[0], StaticEnergy);
+          const su2double Pressure    = GetFluidModel()->GetPressure();
+          const su2double Temperature = GetFluidModel()->GetTemperature();
 
           if((Pressure < 0.0) || (solDOF[0] < 0.0) || (Temperature < 0.0)) {
             ++ErrorCounter;
@@ -3645,8 +3663,8 @@ void CFEM_DG_EulerSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_con
 
               /*--- Compute the maximum value of the wave speed. This is a rather
                     conservative estimate. ---*/
-              FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-              const su2double SoundSpeed2 = FluidModel->GetSoundSpeed2();
+              GetFluidModel()->SetTDState_rhoe(solDOF[0], StaticEnergy);
+              const su2double SoundSpeed2 = GetFluidModel()->GetSoundSpeed2();
               const su2double SoundSpeed  = sqrt(fabs(SoundSpeed2));
 
               const su2double radx     = fabs(u-gridVel[0]) + SoundSpeed;
@@ -3677,8 +3695,8 @@ void CFEM_DG_EulerSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_con
 
               /*--- Compute the maximum value of the wave speed. This is a rather
                     conservative estimate. ---*/
-              FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-              const su2double SoundSpeed2 = FluidModel->GetSoundSpeed2();
+              GetFluidModel()->SetTDState_rhoe(solDOF[0], StaticEnergy);
+              const su2double SoundSpeed2 = GetFluidModel()->GetSoundSpeed2();
               const su2double SoundSpeed  = sqrt(fabs(SoundSpeed2));
 
               const su2double radx     = fabs(u-gridVel[0]) + SoundSpeed;
@@ -3786,314 +3804,410 @@ void CFEM_DG_EulerSolver::CheckTimeSynchronization(CConfig         *config,
 void CFEM_DG_EulerSolver::ProcessTaskList_DG(CGeometry *geometry,  CSolver **solver_container,
                                              CNumerics **numerics, CConfig *config,
                                              unsigned short iMesh) {
-  /* Easier storage of the number of time levels.. */
+  /* Easier storage of the number of time levels and the number of tasks. */
   const unsigned short nTimeLevels = config->GetnLevels_TimeAccurateLTS();
-
-  /* Define and initialize the bool vector, that indicates whether or
-     not the tasks from the list have been completed. */
-  vector<bool> taskCompleted(tasksList.size(), false);
-
-  /* Allocate the memory for the work array and initialize it to zero to avoid
-     warnings in debug mode  about uninitialized memory when padding is applied. */
+  const unsigned long  nTasks      = tasksList.size();
+
+  /*--- Determine for every task the range of elements or faces to be treated and
+        the size of the chunks in which this range is split. Several chunks per
+        thread are used for load balancing, because the cost per element (or face)
+        varies with the polynomial degree and the element type. The other tasks
+        (communication, time interpolation, boundary conditions and accumulation
+        of the residuals) consist of a single chunk. ---*/
+  const unsigned long nThreads = omp_get_max_threads();
+  vector<unsigned long> rangeBeg(nTasks, 0), rangeEnd(nTasks, 1);
+  vector<unsigned long> chunkSize(nTasks, 1), nChunks(nTasks, 1);
+
+  for(unsigned long i=0; i<nTasks; ++i) {
+    const unsigned short level = tasksList[i].timeLevel;
+    switch( tasksList[i].task ) {
+      case CTaskDefinition::ADER_PREDICTOR_STEP_COMM_ELEMENTS:
+        rangeBeg[i] = nVolElemOwnedPerTimeLevel[level] + nVolElemInternalPerTimeLevel[level];
+        rangeEnd[i] = nVolElemOwnedPerTimeLevel[level+1];
+        break;
+      case CTaskDefinition::ADER_PREDICTOR_STEP_INTERNAL_ELEMENTS:
+        rangeBeg[i] = nVolElemOwnedPerTimeLevel[level];
+        rangeEnd[i] = nVolElemOwnedPerTimeLevel[level] + nVolElemInternalPerTimeLevel[level];
+        break;
+      case CTaskDefinition::SHOCK_CAPTURING_VISCOSITY_OWNED_ELEMENTS:
+      case CTaskDefinition::VOLUME_RESIDUAL:
+      case CTaskDefinition::MULTIPLY_INVERSE_MASS_MATRIX:
+      case CTaskDefinition::ADER_UPDATE_SOLUTION:
+        rangeBeg[i] = nVolElemOwnedPerTimeLevel[level];
+        rangeEnd[i] = nVolElemOwnedPerTimeLevel[level+1];
+        break;
+      case CTaskDefinition::SHOCK_CAPTURING_VISCOSITY_HALO_ELEMENTS:
+        rangeBeg[i] = nVolElemHaloPerTimeLevel[level];
+        rangeEnd[i] = nVolElemHaloPerTimeLevel[level+1];
+        break;
+      case CTaskDefinition::SURFACE_RESIDUAL_OWNED_ELEMENTS:
+        rangeBeg[i] = nMatchingInternalFacesLocalElem[level];
+        rangeEnd[i] = nMatchingInternalFacesLocalElem[level+1];
+        break;
+      case CTaskDefinition::SURFACE_RESIDUAL_HALO_ELEMENTS:
+        rangeBeg[i] = nMatchingInternalFacesWithHaloElem[level];
+        rangeEnd[i] = nMatchingInternalFacesWithHaloElem[level+1];
+        break;
+      default:
+        continue;
+    }
+
+    const unsigned long nItems = (rangeEnd[i] > rangeBeg[i]) ? rangeEnd[i]-rangeBeg[i] : 0;
+    chunkSize[i] = max<unsigned long>(1, roundUpDiv(nItems, 4*nThreads));
+    nChunks[i]   = NumberOfChunks(nItems, chunkSize[i]);
+  }
+
+  /*--- Shared status of the tasks, which is only accessed atomically. A task is
+        completed when all its chunks have been carried out. ---*/
+  vector<unsigned long> nextChunk(nTasks, 0), nChunksDone(nTasks, 0);
+  vector<int> taskCompleted(nTasks, 0);
+
+  /*--- The list of tasks is processed by all threads without synchronizing them.
+        Every thread looks for the first task in the list whose dependencies are
+        completed and which still has chunks that are not claimed, carries out
+        these chunks and starts looking again from the beginning of the list.
+        Hence a thread that has no work left in a range continues with another
+        task, e.g. the boundary conditions or the accumulation of the residuals
+        are carried out while other threads still compute surface residuals.
+        Only the master thread makes MPI calls. ---*/
+  SU2_OMP_PARALLEL
+  {
+  /* Allocate the memory for the work array of this thread and initialize it to zero to
+     avoid warnings in debug mode about uninitialized memory when padding is applied. */
   vector<su2double> workArrayVec(sizeWorkArray, 0.0);
   su2double *workArray = workArrayVec.data();
 
-  /* While loop to carry out all the tasks in tasksList. */
-  unsigned long lowestIndexInList = 0;
-  while(lowestIndexInList < tasksList.size()) {
-
-    /* Find the next task that can be carried out. The outer loop is there
-       to make sure that a communication is completed in case there are no
-       other tasks */
-    for(unsigned short j=0; j<2; ++j) {
-      bool taskCarriedOut = false;
-      for(unsigned long i=lowestIndexInList; i<tasksList.size(); ++i) {
-
-        /* Determine whether or not it can be attempted to carry out
-           this task. */
-        bool taskCanBeCarriedOut = !taskCompleted[i];
-        for(unsigned short ind=0; ind<tasksList[i].nIndMustBeCompleted; ++ind) {
-          if( !taskCompleted[tasksList[i].indMustBeCompleted[ind]] )
-            taskCanBeCarriedOut = false;
-        }
+  /* The numerics of this thread. */
+  CNumerics **threadNumerics = numerics + omp_get_thread_num()*MAX_TERMS;
+  CNumerics *convNumerics    = threadNumerics[CONV_TERM];
 
-        if( taskCanBeCarriedOut ) {
+  const bool masterThread = (omp_get_thread_num() == 0);
 
-          /*--- Determine the actual task to be carried out and do so. The
-                only tasks that may fail are the completion of the non-blocking
-                communication. If that is the case the next task needs to be
-                found. ---*/
-          switch( tasksList[i].task ) {
+  /* Lambda to determine whether a task has been completed (by any thread). */
+  auto isCompleted = [&taskCompleted](const unsigned long i) {
+    int completed;
+    SU2_OMP(atomic read seq_cst)
+    completed = taskCompleted[i];
+    return completed != 0;
+  };
 
-            case CTaskDefinition::ADER_PREDICTOR_STEP_COMM_ELEMENTS: {
+  /*--- Lambda, which carries out the chunks of task i claimed by this thread and
+        returns their number. The only tasks that may fail are the completions of
+        the non-blocking communication, for which SU2_MPI::Testall is used unless
+        waitForComm is true. If that is the case 0 is returned and the task is
+        released again, such that it can be attempted later. ---*/
+  auto carryOutTask = [&](const unsigned long i, const bool waitForComm) -> unsigned long {
 
-              /* Carry out the ADER predictor step for the elements whose
-                 solution must be communicated for this time level. */
-              const unsigned short level   = tasksList[i].timeLevel;
-              const unsigned long  elemBeg = nVolElemOwnedPerTimeLevel[level]
-                                           + nVolElemInternalPerTimeLevel[level];
-              const unsigned long  elemEnd = nVolElemOwnedPerTimeLevel[level+1];
+    const CTaskDefinition &taskDef = tasksList[i];
+    const unsigned short  level    = taskDef.timeLevel;
 
-              ADER_DG_PredictorStep(config, elemBeg, elemEnd, workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+    bool commCompleted = true;
+    unsigned long nChunksCarriedOut = 0;
 
-            case CTaskDefinition::ADER_PREDICTOR_STEP_INTERNAL_ELEMENTS: {
+    switch( taskDef.task ) {
 
-              /* Carry out the ADER predictor step for the elements whose
-                 solution must not be communicated for this time level. */
-              const unsigned short level   = tasksList[i].timeLevel;
-              const unsigned long  elemBeg = nVolElemOwnedPerTimeLevel[level];
-              const unsigned long  elemEnd = nVolElemOwnedPerTimeLevel[level]
-                                           + nVolElemInternalPerTimeLevel[level];
-              ADER_DG_PredictorStep(config, elemBeg, elemEnd, workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      case CTaskDefinition::ADER_PREDICTOR_STEP_COMM_ELEMENTS:
+      case CTaskDefinition::ADER_PREDICTOR_STEP_INTERNAL_ELEMENTS: {
 
-            case CTaskDefinition::INITIATE_MPI_COMMUNICATION: {
-
-              /* Start the MPI communication of the solution in the halo elements. */
-              Initiate_MPI_Communication(config, tasksList[i].timeLevel);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+        /* Carry out the ADER predictor step for the elements whose solution
+           must (or must not) be communicated for this time level. */
+        nChunksCarriedOut = ForEachChunkOfRange(rangeBeg[i], rangeEnd[i], chunkSize[i], nextChunk[i],
+          [&](const unsigned long beg, const unsigned long end) {
+            ADER_DG_PredictorStep(config, beg, end, workArray);
+          });
+        break;
+      }
 
-            case CTaskDefinition::COMPLETE_MPI_COMMUNICATION: {
-
-              /* Attempt to complete the MPI communication of the solution data.
-                 For j==0, SU2_MPI::Testall will be used, which returns false if
-                 not all requests can be completed. In that case the next task on
-                 the list is carried out. If j==1, this means that the next
-                 tasks are waiting for this communication to be completed and
-                 hence MPI_Waitall is used. */
-              if( Complete_MPI_Communication(config, tasksList[i].timeLevel,
-                                             j==1) )
-                taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      case CTaskDefinition::INITIATE_MPI_COMMUNICATION: {
 
-            case CTaskDefinition::INITIATE_REVERSE_MPI_COMMUNICATION: {
+        /* Start the MPI communication of the solution in the halo elements. */
+        nChunksCarriedOut = ForEachChunkOfRange(rangeBeg[i], rangeEnd[i], chunkSize[i], nextChunk[i],
+          [&](const unsigned long, const unsigned long) {
+            Initiate_MPI_Communication(config, level);
+          });
+        break;
+      }
 
-              /* Start the communication of the residuals, for which the
-                 reverse communication must be used. */
-              Initiate_MPI_ReverseCommunication(config, tasksList[i].timeLevel);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      case CTaskDefinition::COMPLETE_MPI_COMMUNICATION: {
 
-            case CTaskDefinition::COMPLETE_REVERSE_MPI_COMMUNICATION: {
-
-              /* Attempt to complete the MPI communication of the residual data.
-                 For j==0, SU2_MPI::Testall will be used, which returns false if
-                 not all requests can be completed. In that case the next task on
-                 the list is carried out. If j==1, this means that the next
-                 tasks are waiting for this communication to be completed and
-                 hence MPI_Waitall is used. */
-              if( Complete_MPI_ReverseCommunication(config, tasksList[i].timeLevel,
-                                                    j==1) )
-                taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+        /* Attempt to complete the MPI communication of the solution data. */
+        nChunksCarriedOut = ForEachChunkOfRange(rangeBeg[i], rangeEnd[i], chunkSize[i], nextChunk[i],
+          [&](const unsigned long, const unsigned long) {
+            commCompleted = Complete_MPI_Communication(config, level, waitForComm);
+          });
+        break;
+      }
 
-            case CTaskDefinition::ADER_TIME_INTERPOLATE_OWNED_ELEMENTS: {
+      case CTaskDefinition::INITIATE_REVERSE_MPI_COMMUNICATION: {
 
-              /* Interpolate the predictor solution of the owned elements
-                 in time to the given time integration point for the
-                 given time level. */
-              const unsigned short level = tasksList[i].timeLevel;
-              unsigned long nAdjElem = 0, *adjElem = nullptr;
-              if(level < (nTimeLevels-1)) {
-                nAdjElem = ownedElemAdjLowTimeLevel[level+1].size();
-                adjElem  = ownedElemAdjLowTimeLevel[level+1].data();
-              }
+        /* Start the communication of the residuals, for which the
+           reverse communication must be used. */
+        nChunksCarriedOut = ForEachChunkOfRange(rangeBeg[i], rangeEnd[i], chunkSize[i], nextChunk[i],
+          [&](const unsigned long, const unsigned long) {
+            Initiate_MPI_ReverseCommunication(config, level);
+          });
+        break;
+      }
 
-              ADER_DG_TimeInterpolatePredictorSol(config, tasksList[i].intPointADER,
-                                                  nVolElemOwnedPerTimeLevel[level],
-                                                  nVolElemOwnedPerTimeLevel[level+1],
-                                                  nAdjElem, adjElem,
-                                                  tasksList[i].secondPartTimeIntADER,
-                                                  VecWorkSolDOFs[level].data());
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      case CTaskDefinition::COMPLETE_REVERSE_MPI_COMMUNICATION: {
+
+        /* Attempt to complete the MPI communication of the residual data. The
+           residuals of the halo elements are added to the residuals of owned
+           elements, which may be updated at the same time by the accumulation
+           of the space time residuals of another time level. */
+        nChunksCarriedOut = ForEachChunkOfRange(rangeBeg[i], rangeEnd[i], chunkSize[i], nextChunk[i],
+          [&](const unsigned long, const unsigned long) {
+            SU2_OMP(critical (FEM_DG_AccumulateOwnedResidual))
+            commCompleted = Complete_MPI_ReverseCommunication(config, level, waitForComm);
+          });
+        break;
+      }
 
-            case CTaskDefinition::ADER_TIME_INTERPOLATE_HALO_ELEMENTS: {
+      case CTaskDefinition::ADER_TIME_INTERPOLATE_OWNED_ELEMENTS: {
 
-              /* Interpolate the predictor solution of the halo elements
-                 in time to the given time integration point for the
-                 given time level. */
-              const unsigned short level = tasksList[i].timeLevel;
-              unsigned long nAdjElem = 0, *adjElem = nullptr;
-              if(level < (nTimeLevels-1)) {
-                nAdjElem = haloElemAdjLowTimeLevel[level+1].size();
-                adjElem  = haloElemAdjLowTimeLevel[level+1].data();
-              }
+        /* Interpolate the predictor solution of the owned elements
+           in time to the given time integration point for the
+           given time level. */
+        unsigned long nAdjElem = 0, *adjElem = nullptr;
+        if(level < (nTimeLevels-1)) {
+          nAdjElem = ownedElemAdjLowTimeLevel[level+1].size();
+          adjElem  = ownedElemAdjLowTimeLevel[level+1].data();
+        }
 
-              ADER_DG_TimeInterpolatePredictorSol(config, tasksList[i].intPointADER,
-                                                  nVolElemHaloPerTimeLevel[level],
-                                                  nVolElemHaloPerTimeLevel[level+1],
-                                                  nAdjElem, adjElem,
-                                                  tasksList[i].secondPartTimeIntADER,
-                                                  VecWorkSolDOFs[level].data());
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+        nChunksCarriedOut = ForEachChunkOfRange(rangeBeg[i], rangeEnd[i], chunkSize[i], nextChunk[i],
+          [&](const unsigned long, const unsigned long) {
+            ADER_DG_TimeInterpolatePredictorSol(config, taskDef.intPointADER,
+                                                nVolElemOwnedPerTimeLevel[level],
+                                                nVolElemOwnedPerTimeLevel[level+1],
+                                                nAdjElem, adjElem,
+                                                taskDef.secondPartTimeIntADER,
+                                                VecWorkSolDOFs[level].data());
+          });
+        break;
+      }
 
-            case CTaskDefinition::SHOCK_CAPTURING_VISCOSITY_OWNED_ELEMENTS: {
+      case CTaskDefinition::ADER_TIME_INTERPOLATE_HALO_ELEMENTS: {
 
-              /*--- Compute the artificial viscosity for shock capturing in DG. ---*/
-              const unsigned short level = tasksList[i].timeLevel;
-              Shock_Capturing_DG(config, nVolElemOwnedPerTimeLevel[level],
-                                 nVolElemOwnedPerTimeLevel[level+1], workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+        /* Interpolate the predictor solution of the halo elements
+           in time to the given time integration point for the
+           given time level. */
+        unsigned long nAdjElem = 0, *adjElem = nullptr;
+        if(level < (nTimeLevels-1)) {
+          nAdjElem = haloElemAdjLowTimeLevel[level+1].size();
+          adjElem  = haloElemAdjLowTimeLevel[level+1].data();
+        }
 
-            case CTaskDefinition::SHOCK_CAPTURING_VISCOSITY_HALO_ELEMENTS: {
+        nChunksCarriedOut = ForEachChunkOfRange(rangeBeg[i], rangeEnd[i], chunkSize[i], nextChunk[i],
+          [&](const unsigned long, const unsigned long) {
+            ADER_DG_TimeInterpolatePredictorSol(config, taskDef.intPointADER,
+                                                nVolElemHaloPerTimeLevel[level],
+                                                nVolElemHaloPerTimeLevel[level+1],
+                                                nAdjElem, adjElem,
+                                                taskDef.secondPartTimeIntADER,
+                                                VecWorkSolDOFs[level].data());
+          });
+        break;
+      }
 
-              /*--- Compute the artificial viscosity for shock capturing in DG. ---*/
-              const unsigned short level = tasksList[i].timeLevel;
-              Shock_Capturing_DG(config, nVolElemHaloPerTimeLevel[level],
-                                 nVolElemHaloPerTimeLevel[level+1], workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      case CTaskDefinition::SHOCK_CAPTURING_VISCOSITY_OWNED_ELEMENTS:
+      case CTaskDefinition::SHOCK_CAPTURING_VISCOSITY_HALO_ELEMENTS: {
 
-            case CTaskDefinition::VOLUME_RESIDUAL: {
+        /*--- Compute the artificial viscosity for shock capturing in DG. ---*/
+        nChunksCarriedOut = ForEachChunkOfRange(rangeBeg[i], rangeEnd[i], chunkSize[i], nextChunk[i],
+          [&](const unsigned long beg, const unsigned long end) {
+            Shock_Capturing_DG(config, beg, end, workArray);
+          });
+        break;
+      }
 
-              /*--- Compute the volume portion of the residual. ---*/
-              const unsigned short level = tasksList[i].timeLevel;
-              Volume_Residual(config, nVolElemOwnedPerTimeLevel[level],
-                              nVolElemOwnedPerTimeLevel[level+1], workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      case CTaskDefinition::VOLUME_RESIDUAL: {
 
-            case CTaskDefinition::SURFACE_RESIDUAL_OWNED_ELEMENTS: {
+        /*--- Compute the volume portion of the residual. ---*/
+        nChunksCarriedOut = ForEachChunkOfRange(rangeBeg[i], rangeEnd[i], chunkSize[i], nextChunk[i],
+          [&](const unsigned long beg, const unsigned long end) {
+            Volume_Residual(config, beg, end, workArray);
+          });
+        break;
+      }
 
-              /* Compute the residual of the faces that only involve owned elements. */
-              const unsigned short level = tasksList[i].timeLevel;
-              unsigned long indResFaces = startLocResInternalFacesLocalElem[level];
-              ResidualFaces(config, nMatchingInternalFacesLocalElem[level],
-                            nMatchingInternalFacesLocalElem[level+1],
-                            indResFaces, numerics[CONV_TERM], workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      case CTaskDefinition::SURFACE_RESIDUAL_OWNED_ELEMENTS:
+      case CTaskDefinition::SURFACE_RESIDUAL_HALO_ELEMENTS: {
+
+        /* Compute the residual of the faces that only involve owned elements
+           or that involve a halo element. Every chunk of faces starts at its
+           own location in the residual. */
+        nChunksCarriedOut = ForEachChunkOfRange(rangeBeg[i], rangeEnd[i], chunkSize[i], nextChunk[i],
+          [&](const unsigned long beg, const unsigned long end) {
+            unsigned long indResFaces = startLocResMatchingFaces[beg];
+            ResidualFaces(config, beg, end, indResFaces, convNumerics, workArray);
+          });
+        break;
+      }
 
-            case CTaskDefinition::SURFACE_RESIDUAL_HALO_ELEMENTS: {
+      case CTaskDefinition::BOUNDARY_CONDITIONS_DEPEND_ON_OWNED:
+      case CTaskDefinition::BOUNDARY_CONDITIONS_DEPEND_ON_HALO: {
 
-              /* Compute the residual of the faces that involve a halo element. */
-              const unsigned short level = tasksList[i].timeLevel;
-              unsigned long indResFaces = startLocResInternalFacesWithHaloElem[level];
-              ResidualFaces(config, nMatchingInternalFacesWithHaloElem[level],
-                            nMatchingInternalFacesWithHaloElem[level+1],
-                            indResFaces, numerics[CONV_TERM], workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+        /*--- Apply the boundary conditions that only depend on data of owned
+              elements or that also depend on data of halo elements. ---*/
+        const bool haloInfoNeeded = taskDef.task == CTaskDefinition::BOUNDARY_CONDITIONS_DEPEND_ON_HALO;
+        nChunksCarriedOut = ForEachChunkOfRange(rangeBeg[i], rangeEnd[i], chunkSize[i], nextChunk[i],
+          [&](const unsigned long, const unsigned long) {
+            Boundary_Conditions(level, config, threadNumerics, haloInfoNeeded, workArray);
+          });
+        break;
+      }
 
-            case CTaskDefinition::BOUNDARY_CONDITIONS_DEPEND_ON_OWNED: {
+      case CTaskDefinition::SUM_UP_RESIDUAL_CONTRIBUTIONS_OWNED_ELEMENTS:
+      case CTaskDefinition::SUM_UP_RESIDUAL_CONTRIBUTIONS_HALO_ELEMENTS: {
 
-              /*--- Apply the boundary conditions that only depend on data
-                    of owned elements. ---*/
-              Boundary_Conditions(tasksList[i].timeLevel, config, numerics, false,
-                                  workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+        /* Create the final residual by summing up all contributions. */
+        const bool ownedElements = taskDef.task == CTaskDefinition::SUM_UP_RESIDUAL_CONTRIBUTIONS_OWNED_ELEMENTS;
+        nChunksCarriedOut = ForEachChunkOfRange(rangeBeg[i], rangeEnd[i], chunkSize[i], nextChunk[i],
+          [&](const unsigned long, const unsigned long) {
+            CreateFinalResidual(level, ownedElements);
+          });
+        break;
+      }
 
-            case CTaskDefinition::BOUNDARY_CONDITIONS_DEPEND_ON_HALO: {
+      case CTaskDefinition::ADER_ACCUMULATE_SPACETIME_RESIDUAL_OWNED_ELEMENTS: {
+
+        /* Accumulate the space time residuals for the owned elements for ADER-DG.
+           This also updates the owned elements of the next time level adjacent to
+           this time level, hence these tasks of different time levels and the
+           reverse communication exclude each other. */
+        nChunksCarriedOut = ForEachChunkOfRange(rangeBeg[i], rangeEnd[i], chunkSize[i], nextChunk[i],
+          [&](const unsigned long, const unsigned long) {
+            SU2_OMP(critical (FEM_DG_AccumulateOwnedResidual))
+            AccumulateSpaceTimeResidualADEROwnedElem(config, level, taskDef.intPointADER);
+          });
+        break;
+      }
 
-              /*--- Apply the boundary conditions that also depend on data
-                    of halo elements. ---*/
-              Boundary_Conditions(tasksList[i].timeLevel, config, numerics, true,
-                                  workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      case CTaskDefinition::ADER_ACCUMULATE_SPACETIME_RESIDUAL_HALO_ELEMENTS: {
 
-            case CTaskDefinition::SUM_UP_RESIDUAL_CONTRIBUTIONS_OWNED_ELEMENTS: {
+        /* Accumulate the space time residuals for the halo elements for ADER-DG,
+           see the owned elements for the exclusion. */
+        nChunksCarriedOut = ForEachChunkOfRange(rangeBeg[i], rangeEnd[i], chunkSize[i], nextChunk[i],
+          [&](const unsigned long, const unsigned long) {
+            SU2_OMP(critical (FEM_DG_AccumulateHaloResidual))
+            AccumulateSpaceTimeResidualADERHaloElem(config, level, taskDef.intPointADER);
+          });
+        break;
+      }
 
-              /* Create the final residual by summing up all contributions. */
-              CreateFinalResidual(tasksList[i].timeLevel, true);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      case CTaskDefinition::MULTIPLY_INVERSE_MASS_MATRIX: {
 
-            case CTaskDefinition::SUM_UP_RESIDUAL_CONTRIBUTIONS_HALO_ELEMENTS: {
+        /*--- Multiply the residual by the (lumped) mass matrix, to obtain the final value. ---*/
+        const bool useADER = config->GetKind_TimeIntScheme() == ADER_DG;
+        nChunksCarriedOut = ForEachChunkOfRange(rangeBeg[i], rangeEnd[i], chunkSize[i], nextChunk[i],
+          [&](const unsigned long beg, const unsigned long end) {
+            MultiplyResidualByInverseMassMatrix(config, useADER, beg, end, workArray);
+          });
+        break;
+      }
 
-              /* Create the final residual by summing up all contributions. */
-              CreateFinalResidual(tasksList[i].timeLevel, false);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      case CTaskDefinition::ADER_UPDATE_SOLUTION: {
 
-            case CTaskDefinition::ADER_ACCUMULATE_SPACETIME_RESIDUAL_OWNED_ELEMENTS: {
+        /*--- Perform the update step for ADER-DG. ---*/
+        nChunksCarriedOut = ForEachChunkOfRange(rangeBeg[i], rangeEnd[i], chunkSize[i], nextChunk[i],
+          [&](const unsigned long beg, const unsigned long end) {
+            ADER_DG_Iteration(beg, end);
+          });
+        break;
+      }
 
-              /* Accumulate the space time residuals for the owned elements
-                 for ADER-DG. */
-              AccumulateSpaceTimeResidualADEROwnedElem(config, tasksList[i].timeLevel,
-                                                       tasksList[i].intPointADER);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      default: {
 
-            case CTaskDefinition::ADER_ACCUMULATE_SPACETIME_RESIDUAL_HALO_ELEMENTS: {
+        cout << "Task not defined. This should not happen." << endl;
+        exit(1);
+      }
+    }
 
-              /* Accumulate the space time residuals for the halo elements
-                 for ADER-DG. */
-              AccumulateSpaceTimeResidualADERHaloElem(config, tasksList[i].timeLevel,
-                                                      tasksList[i].intPointADER);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+    /* Release a communication that could not be completed yet. Only the
+       master thread carries out these tasks, hence no other thread claims it. */
+    if( !commCompleted ) {
+      SU2_OMP(atomic write seq_cst)
+      nextChunk[i] = 0;
+      nChunksCarriedOut = 0;
+    }
 
-            case CTaskDefinition::MULTIPLY_INVERSE_MASS_MATRIX: {
+    return nChunksCarriedOut;
+  };
 
-              /*--- Multiply the residual by the (lumped) mass matrix, to obtain the final value. ---*/
-              const unsigned short level = tasksList[i].timeLevel;
-              const bool useADER = config->GetKind_TimeIntScheme() == ADER_DG;
-              MultiplyResidualByInverseMassMatrix(config, useADER,
-                                                  nVolElemOwnedPerTimeLevel[level],
-                                                  nVolElemOwnedPerTimeLevel[level+1],
-                                                  workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+  /* While loop to carry out all the tasks in tasksList. */
+  unsigned long lowestIndexInList = 0;
+  while(lowestIndexInList < nTasks) {
+
+    /* Find the first task that can be carried out. A completion of a
+       communication that failed is remembered, such that it can be
+       completed with a blocking call when there is nothing else to do. */
+    long pendingComm = -1;
+    unsigned long taskIndex = nTasks, nChunksCarriedOut = 0;
+
+    for(unsigned long i=lowestIndexInList; i<nTasks; ++i) {
+
+      if( isCompleted(i) ) continue;
+
+      const CTaskDefinition::SOLVER_TASK task = tasksList[i].task;
+      const bool commTask = (task == CTaskDefinition::INITIATE_MPI_COMMUNICATION)         ||
+                            (task == CTaskDefinition::COMPLETE_MPI_COMMUNICATION)         ||
+                            (task == CTaskDefinition::INITIATE_REVERSE_MPI_COMMUNICATION) ||
+                            (task == CTaskDefinition::COMPLETE_REVERSE_MPI_COMMUNICATION);
+      if(commTask && !masterThread) continue;
+
+      /* Skip the task if all chunks are claimed by other threads. */
+      unsigned long nClaimed;
+      SU2_OMP(atomic read seq_cst)
+      nClaimed = nextChunk[i];
+      if(nClaimed >= nChunks[i]) continue;
+
+      /* Determine whether or not it can be attempted to carry out this task. */
+      bool taskCanBeCarriedOut = true;
+      for(unsigned short ind=0; ind<tasksList[i].nIndMustBeCompleted; ++ind) {
+        if( !isCompleted(tasksList[i].indMustBeCompleted[ind]) ) {
+          taskCanBeCarriedOut = false;
+          break;
+        }
+      }
+      if( !taskCanBeCarriedOut ) continue;
 
-            case CTaskDefinition::ADER_UPDATE_SOLUTION: {
+      nChunksCarriedOut = carryOutTask(i, false);
+      if( nChunksCarriedOut ) {
+        taskIndex = i;
+        break;
+      }
 
-              /*--- Perform the update step for ADER-DG. ---*/
-              const unsigned short level = tasksList[i].timeLevel;
-              ADER_DG_Iteration(nVolElemOwnedPerTimeLevel[level],
-                                nVolElemOwnedPerTimeLevel[level+1]);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      if((task == CTaskDefinition::COMPLETE_MPI_COMMUNICATION) ||
+         (task == CTaskDefinition::COMPLETE_REVERSE_MPI_COMMUNICATION)) {
+        if(pendingComm < 0) pendingComm = i;
+      }
+    }
 
-            default: {
+    /* The master thread waits for the communication, if no other task
+       could be carried out. */
+    if(!nChunksCarriedOut && (pendingComm >= 0)) {
+      taskIndex = pendingComm;
+      nChunksCarriedOut = carryOutTask(taskIndex, true);
+    }
 
-              cout << "Task not defined. This should not happen." << endl;
-              exit(1);
-            }
-          }
-        }
+    /* Update the status of the task. The thread that carries out
+       the last chunk marks the task as completed. */
+    if( nChunksCarriedOut ) {
+      unsigned long nDone;
+      SU2_OMP(atomic capture seq_cst)
+      nDone = nChunksDone[taskIndex] += nChunksCarriedOut;
 
-        /* Break the inner loop if a task has been carried out. */
-        if( taskCarriedOut ) break;
+      if(nDone == nChunks[taskIndex]) {
+        SU2_OMP(atomic write seq_cst)
+        taskCompleted[taskIndex] = 1;
       }
-
-      /* Break the outer loop if a task has been carried out. */
-      if( taskCarriedOut ) break;
     }
 
     /* Update the value of lowestIndexInList. */
-    for(; lowestIndexInList < tasksList.size(); ++lowestIndexInList)
-      if( !taskCompleted[lowestIndexInList] ) break;
+    for(; lowestIndexInList < nTasks; ++lowestIndexInList)
+      if( !isCompleted(lowestIndexInList) ) break;
   }
+  } // end SU2_OMP_PARALLEL
 }
 
 void CFEM_DG_EulerSolver::ADER_SpaceTimeIntegration(CGeometry *geometry,  CSolver **solver_container,
@@ -4750,8 +4864,8 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_2D(CConfig
       const su2double v            = DensityInv*solDOF[2];
       const su2double StaticEnergy = DensityInv*solDOF[3] - 0.5*(u*u + v*v);
 
-      FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-      const su2double Pressure = FluidModel->GetPressure();
+      GetFluidModel()->SetTDState_rhoe(solDOF[0], StaticEnergy);
+      const su2double Pressure = GetFluidModel()->GetPressure();
 
       /* The Cartesian fluxes in the x-direction. */
       const su2double uRel = u - gridVel[0];
@@ -4999,8 +5113,8 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
       const su2double w            = DensityInv*solDOF[3];
       const su2double StaticEnergy = DensityInv*solDOF[4] - 0.5*(u*u + v*v + w*w);
 
-      FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-      const su2double Pressure = FluidModel->GetPressure();
+      GetFluidModel()->SetTDState_rhoe(solDOF[0], StaticEnergy);
+      const su2double Pressure = GetFluidModel()->GetPressure();
 
       /* The Cartesian fluxes in the x-direction. */
       const su2double uRel = u - gridVel[0];
@@ -5289,8 +5403,8 @@ void CFEM_DG_EulerSolver::ADER_DG_NonAliasedPredictorResidual_2D(CConfig
       const su2double kinEnergy    = 0.5*(u*u + v*v);
       const su2double StaticEnergy = rhoInv*rE - kinEnergy;
 
-      FluidModel->SetTDState_rhoe(rho, StaticEnergy);
-      const su2double Pressure = FluidModel->GetPressure();
+      GetFluidModel()->SetTDState_rhoe(rho, StaticEnergy);
+      const su2double Pressure = GetFluidModel()->GetPressure();
       const su2double Htot     = rhoInv*(rE + Pressure);
 
       /* Set the pointer to the grid velocities in this integration point.
@@ -5504,8 +5618,8 @@ void CFEM_DG_EulerSolver::ADER_DG_NonAliasedPredictorResidual_3D(CConfig
       const su2double kinEnergy    = 0.5*(u*u + v*v + w*w);
       const su2double StaticEnergy = rhoInv*rE - kinEnergy;
 
-      FluidModel->SetTDState_rhoe(rho, StaticEnergy);
-      const su2double Pressure = FluidModel->GetPressure();
+      GetFluidModel()->SetTDState_rhoe(rho, StaticEnergy);
+      const su2double Pressure = GetFluidModel()->GetPressure();
       const su2double Htot     = rhoInv*(rE + Pressure);
 
       /* Set the pointer to the grid velocities in this integration point.
@@ -5887,8 +6001,8 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
             const su2double StaticEnergy = TotalEnergy - 0.5*(u*u + v*v);
 
             /*--- Compute the pressure. ---*/
-            FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-            const su2double Pressure = FluidModel->GetPressure();
+            GetFluidModel()->SetTDState_rhoe(sol[0], StaticEnergy);
+            const su2double Pressure = GetFluidModel()->GetPressure();
 
             /* Compute the relative velocities w.r.t. the grid. */
             const su2double uRel = u - gridVel[0];
@@ -5982,8 +6096,8 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
             const su2double StaticEnergy = TotalEnergy - 0.5*(u*u + v*v + w*w);
 
             /*--- Compute the pressure. ---*/
-            FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-            const su2double Pressure = FluidModel->GetPressure();
+            GetFluidModel()->SetTDState_rhoe(sol[0], StaticEnergy);
+            const su2double Pressure = GetFluidModel()->GetPressure();
 
             /* Compute the relative velocities w.r.t. the grid. */
             const su2double uRel = u - gridVel[0];
@@ -6887,8 +7001,8 @@ void CFEM_DG_EulerSolver::Pressure_Forces(const CGeometry* geometry, const CConf
                   const su2double v            = sol[2]*DensityInv;
                   const su2double StaticEnergy = sol[3]*DensityInv - 0.5*(u*u + v*v);
 
-                  FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-                  const su2double Pressure = FluidModel->GetPressure();
+                  GetFluidModel()->SetTDState_rhoe(sol[0], StaticEnergy);
+                  const su2double Pressure = GetFluidModel()->GetPressure();
 
                   /*-- Compute the vector from the reference point to the integration
                        point and update the inviscid force. Note that the normal points
@@ -6940,8 +7054,8 @@ void CFEM_DG_EulerSolver::Pressure_Forces(const CGeometry* geometry, const CConf
                   const su2double w            = sol[3]*DensityInv;
                   const su2double StaticEnergy = sol[4]*DensityInv - 0.5*(u*u + v*v + w*w);
 
-                  FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-                  const su2double Pressure = FluidModel->GetPressure();
+                  GetFluidModel()->SetTDState_rhoe(sol[0], StaticEnergy);
+                  const su2double Pressure = GetFluidModel()->GetPressure();
 
                   /*-- Compute the vector from the reference point to the integration
                        point and update the inviscid force. Note that the normal points
@@ -7555,9 +7669,9 @@ void CFEM_DG_EulerSolver::BoundaryStates_Inlet(CConfig                  *config,
 
       su2double StaticEnergy = UL[nDim+1]*DensityInv - 0.5*Velocity2;
 
-      FluidModel->SetTDState_rhoe(UL[0], StaticEnergy);
-      su2double SoundSpeed2 = FluidModel->GetSoundSpeed2();
-      su2double Pressure    = FluidModel->GetPressure();
+      GetFluidModel()->SetTDState_rhoe(UL[0], StaticEnergy);
+      su2double SoundSpeed2 = GetFluidModel()->GetSoundSpeed2();
+      su2double Pressure    = GetFluidModel()->GetPressure();
 
       /*--- Compute the Riemann invariant to be extrapolated. ---*/
       const su2double Riemann = 2.0*sqrt(SoundSpeed2)/Gamma_Minus_One + VelocityNormal;
@@ -7663,9 +7777,9 @@ void CFEM_DG_EulerSolver::BoundaryStates_Outlet(CConfig                  *config
 
       su2double StaticEnergy = UL[nDim+1]*DensityInv - 0.5*Velocity2;
 
-      FluidModel->SetTDState_rhoe(UL[0], StaticEnergy);
-      su2double SoundSpeed2 = FluidModel->GetSoundSpeed2();
-      su2double Pressure    = FluidModel->GetPressure();
+      GetFluidModel()->SetTDState_rhoe(UL[0], StaticEnergy);
+      su2double SoundSpeed2 = GetFluidModel()->GetSoundSpeed2();
+      su2double Pressure    = GetFluidModel()->GetPressure();
 
       /*--- Subsonic exit flow: there is one incoming characteristic,
             therefore one variable can be specified (back pressure) and is used
@@ -7727,10 +7841,10 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
       T_Total /= config->GetTemperature_Ref();
 
       /* Compute the total enthalpy and entropy from these values. */
-      FluidModel->SetTDState_PT(P_Total, T_Total);
-      const su2double Enthalpy_e = FluidModel->GetStaticEnergy()
-                                 + FluidModel->GetPressure()/FluidModel->GetDensity();
-      const su2double Entropy_e  = FluidModel->GetEntropy();
+      GetFluidModel()->SetTDState_PT(P_Total, T_Total);
+      const su2double Enthalpy_e = GetFluidModel()->GetStaticEnergy()
+                                 + GetFluidModel()->GetPressure()/GetFluidModel()->GetDensity();
+      const su2double Entropy_e  = GetFluidModel()->GetEntropy();
 
       /* Loop over the faces that are treated simultaneously. */
       for(unsigned short l=0; l<nFaceSimul; ++l) {
@@ -7757,9 +7871,9 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
              and total energy per unit mass for the right state. */
           const su2double StaticEnthalpy_e = Enthalpy_e - 0.5*Velocity2_e;
 
-          FluidModel->SetTDState_hs(StaticEnthalpy_e, Entropy_e);
-          const su2double Density_e = FluidModel->GetDensity();
-          const su2double StaticEnergy_e = FluidModel->GetStaticEnergy();
+          GetFluidModel()->SetTDState_hs(StaticEnthalpy_e, Entropy_e);
+          const su2double Density_e = GetFluidModel()->GetDensity();
+          const su2double StaticEnergy_e = GetFluidModel()->GetStaticEnergy();
           const su2double Energy_e       = StaticEnergy_e + 0.5*Velocity2_e;
 
           /* Set the conservative variables of the right state. */
@@ -7789,10 +7903,10 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
 
       /* Compute the prescribed density, static energy per unit mass
          and speed of sound. */
-      FluidModel->SetTDState_PT(P_static, T_static);
-      const su2double Density_e      = FluidModel->GetDensity();
-      const su2double StaticEnergy_e = FluidModel->GetStaticEnergy();
-      const su2double SoundSpeed     = FluidModel->GetSoundSpeed();
+      GetFluidModel()->SetTDState_PT(P_static, T_static);
+      const su2double Density_e      = GetFluidModel()->GetDensity();
+      const su2double StaticEnergy_e = GetFluidModel()->GetStaticEnergy();
+      const su2double SoundSpeed     = GetFluidModel()->GetSoundSpeed();
 
       /* Determine the magnitude of the Mach number. */
       su2double MachMag = 0.0;
@@ -7840,10 +7954,10 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
 
       /* Compute the prescribed pressure, static energy per unit mass
          and speed of sound. */
-      FluidModel->SetTDState_Prho(P_static, Rho_static);
-      const su2double Density_e      = FluidModel->GetDensity();
-      const su2double StaticEnergy_e = FluidModel->GetStaticEnergy();
-      const su2double SoundSpeed     = FluidModel->GetSoundSpeed();
+      GetFluidModel()->SetTDState_Prho(P_static, Rho_static);
+      const su2double Density_e      = GetFluidModel()->GetDensity();
+      const su2double StaticEnergy_e = GetFluidModel()->GetStaticEnergy();
+      const su2double SoundSpeed     = GetFluidModel()->GetSoundSpeed();
 
       /* Determine the magnitude of the Mach number. */
       su2double MachMag = 0.0;
@@ -7937,7 +8051,7 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
 
           /* Extrapolate the density and set the thermodynamic state. */
           UR[0] = UL[0];
-          FluidModel->SetTDState_Prho(Pressure_e, UR[0]);
+          GetFluidModel()->SetTDState_Prho(Pressure_e, UR[0]);
 
           /* Extrapolate the velocity. As the density is also extrapolated,
              this means that the momentum variables are identical for UL and UR.
@@ -7952,7 +8066,7 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
           }
 
           /* Compute the total energy per unit volume. */
-          UR[nDim+1] = UR[0]*(FluidModel->GetStaticEnergy() + 0.5*Velocity2_e);
+          UR[nDim+1] = UR[0]*(GetFluidModel()->GetStaticEnergy() + 0.5*Velocity2_e);
         }
       }
 
@@ -8003,11 +8117,11 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
           const su2double ny  = normals[1];
           const su2double vnL = vxL*nx + vyL*ny;
 
-          FluidModel->SetTDState_rhoe(UL[0], eL);
+          GetFluidModel()->SetTDState_rhoe(UL[0], eL);
 
-          const su2double aL  = FluidModel->GetSoundSpeed();
+          const su2double aL  = GetFluidModel()->GetSoundSpeed();
           const su2double a2L = aL*aL;
-          const su2double pL  = FluidModel->GetPressure();
+          const su2double pL  = GetFluidModel()->GetPressure();
           const su2double HL  = (UL[3] + pL)*tmp;
 
           const su2double ovaL  = 1.0/aL;
@@ -8082,11 +8196,11 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
           const su2double nz  = normals[2];
           const su2double vnL = vxL*nx + vyL*ny + vzL*nz;
 
-          FluidModel->SetTDState_rhoe(UL[0], eL);
+          GetFluidModel()->SetTDState_rhoe(UL[0], eL);
 
-          const su2double aL  = FluidModel->GetSoundSpeed();
+          const su2double aL  = GetFluidModel()->GetSoundSpeed();
           const su2double a2L = aL*aL;
-          const su2double pL  = FluidModel->GetPressure();
+          const su2double pL  = GetFluidModel()->GetPressure();
           const su2double HL  = (UL[4] + pL)*tmp;
 
           const su2double ovaL  = 1.0/aL;
@@ -9303,11 +9417,12 @@ void CFEM_DG_EulerSolver::ComputeInviscidFluxesFace(CConfig              *config
       su2double Prim_L[8];
       su2double Prim_R[8];
 
-      Jacobian_i = new su2double*[nVar];
-      Jacobian_j = new su2double*[nVar];
+      /* Local (dummy) Jacobians, as this function is called by multiple threads. */
+      su2double **jacobianL = new su2double*[nVar];
+      su2double **jacobianR = new su2double*[nVar];
       for (unsigned short iVar = 0; iVar < nVar; ++iVar) {
-        Jacobian_i[iVar] = new su2double[nVar];
-        Jacobian_j[iVar] = new su2double[nVar];
+        jacobianL[iVar] = new su2double[nVar];
+        jacobianR[iVar] = new su2double[nVar];
       }
 
       /* Loop over the number of faces treated simultaneously. */
@@ -9373,19 +9488,16 @@ void CFEM_DG_EulerSolver::ComputeInviscidFluxesFace(CConfig              *config
           /*--- Now simply call the ComputeResidual() function to calculate
            the flux using the chosen approximate Riemann solver. Note that
            the Jacobian arrays here are just dummies for now (no implicit). ---*/
-          numerics->ComputeResidual(flux, Jacobian_i, Jacobian_j, config);
+          numerics->ComputeResidual(flux, jacobianL, jacobianR, config);
         }
       }
 
       for (unsigned short iVar = 0; iVar < nVar; iVar++) {
-        delete [] Jacobian_i[iVar];
-        delete [] Jacobian_j[iVar];
+        delete [] jacobianL[iVar];
+        delete [] jacobianR[iVar];
       }
-      delete [] Jacobian_i;
-      delete [] Jacobian_j;
-
-      Jacobian_i = nullptr;
-      Jacobian_j = nullptr;
+      delete [] jacobianL;
+      delete [] jacobianR;
     }
   }
 }
@@ -9478,9 +9590,9 @@ void CFEM_DG_EulerSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, C
 
       su2double StaticEnergy = VecSolDOFs[ii+nDim+1]*DensityInv - 0.5*Velocity2;
 
-      FluidModel->SetTDState_rhoe(VecSolDOFs[ii], StaticEnergy);
-      su2double Pressure = FluidModel->GetPressure();
-      su2double Temperature = FluidModel->GetTemperature();
+      GetFluidModel()->SetTDState_rhoe(VecSolDOFs[ii], StaticEnergy);
+      su2double Pressure = GetFluidModel()->GetPressure();
+      su2double Temperature = GetFluidModel()->GetTemperature();
 
       /*--- Use the values at the infinity if the state is not physical. ---*/
       if((Pressure < 0.0) || (VecSolDOFs[ii] < 0.0) || (Temperature < 0.0)) {
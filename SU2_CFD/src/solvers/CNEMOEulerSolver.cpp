@@ -128,6 +128,10 @@ CNEMOEulerSolver::CNEMOEulerSolver(CGeometry *geometry, CConfig *config,
 
   Allocate(*config);
 
+  /*--- MPI + OpenMP initialization. ---*/
+
+  HybridParallelInitialization(*config, *geometry);
+
   /*--- Allocate Jacobians for implicit time-stepping ---*/
   if (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) {
 
@@ -144,6 +148,15 @@ CNEMOEulerSolver::CNEMOEulerSolver(CGeometry *geometry, CConfig *config,
     if (rank == MASTER_NODE)  cout<< "Explicit Scheme. No Jacobian structure (" << description << "). MG level: " << iMesh <<"."<<endl;
   }
 
+  /*--- The chemistry sources act on the species equations and the VT-transfer source on
+   *    the vib.-el. energy equation, this structure is fixed for a given reaction set. ---*/
+  if (config->GetPointImplicitSource() && !config->GetMonoatomic()) {
+    if (!config->GetFrozen())
+      for (unsigned short iSpecies = 0; iSpecies < nSpecies; iSpecies++)
+        SourceJacobianRows.push_back(iSpecies);
+    SourceJacobianRows.push_back(nSpecies+nDim+1);
+  }
+
   /*--- Read farfield conditions from the config file ---*/
   Mach_Inf            = config->GetMach();
   Density_Inf         = config->GetDensity_FreeStreamND();
@@ -195,24 +208,24 @@ CNEMOEulerSolver::CNEMOEulerSolver(CGeometry *geometry, CConfig *config,
     nodes      = new CNEMONSVariable    (Pressure_Inf, MassFrac_Inf, Mvec_Inf,
                                          Temperature_Inf, Temperature_ve_Inf,
                                          nPoint, nDim, nVar, nPrimVar, nPrimVarGrad,
-                                         config, FluidModel);
+                                         config, GetFluidModel());
     node_infty = new CNEMONSVariable    (Pressure_Inf, MassFrac_Inf, Mvec_Inf,
                                         Temperature_Inf, Temperature_ve_Inf,
                                         1, nDim, nVar, nPrimVar, nPrimVarGrad,
-                                        config, FluidModel);
+                                        config, GetFluidModel());
   } else {
     nodes      = new CNEMOEulerVariable(Pressure_Inf, MassFrac_Inf, Mvec_Inf,
                                         Temperature_Inf, Temperature_ve_Inf,
                                         nPoint, nDim, nVar, nPrimVar, nPrimVarGrad,
-                                        config, FluidModel);
+                                        config, GetFluidModel());
     node_infty = new CNEMOEulerVariable(Pressure_Inf, MassFrac_Inf, Mvec_Inf,
                                         Temperature_Inf, Temperature_ve_Inf,
                                         1, nDim, nVar, nPrimVar, nPrimVarGrad,
-                                        config, FluidModel);
+                                        config, GetFluidModel());
   }
   SetBaseClassPointerToNodes();
 
-  node_infty->SetPrimVar(0, FluidModel);
+  node_infty->SetPrimVar(0, GetFluidModel());
 
   /*--- Check that the initial solution is physical, report any non-physical nodes ---*/
 
@@ -220,20 +233,20 @@ CNEMOEulerSolver::CNEMOEulerSolver(CGeometry *geometry, CConfig *config,
 
   for (iPoint = 0; iPoint < nPoint; iPoint++) {
 
-    nonPhys = nodes->SetPrimVar(iPoint, FluidModel);
+    nonPhys = nodes->SetPrimVar(iPoint, GetFluidModel());
 
     /*--- Set mixture state ---*/
-    FluidModel->SetTDStatePTTv(Pressure_Inf, MassFrac_Inf, Temperature_Inf, Temperature_ve_Inf);
+    GetFluidModel()->SetTDStatePTTv(Pressure_Inf, MassFrac_Inf, Temperature_Inf, Temperature_ve_Inf);
 
     /*--- Compute other freestream quantities ---*/
-    Density_Inf    = FluidModel->GetDensity();
-    Soundspeed_Inf = FluidModel->GetSoundSpeed();
+    Density_Inf    = GetFluidModel()->GetDensity();
+    Soundspeed_Inf = GetFluidModel()->GetSoundSpeed();
 
     sqvel = 0.0;
     for (iDim = 0; iDim < nDim; iDim++){
       sqvel += Mvec_Inf[iDim]*Soundspeed_Inf * Mvec_Inf[iDim]*Soundspeed_Inf;
     }
-    const auto& Energies_Inf = FluidModel->ComputeMixtureEnergies();
+    const auto& Energies_Inf = GetFluidModel()->ComputeMixtureEnergies();
 
     /*--- Initialize Solution & Solution_Old vectors ---*/
     for (iSpecies = 0; iSpecies < nSpecies; iSpecies++) {
@@ -280,7 +293,7 @@ CNEMOEulerSolver::CNEMOEulerSolver(CGeometry *geometry, CConfig *config,
 CNEMOEulerSolver::~CNEMOEulerSolver(void) {
 
   delete node_infty;
-  delete FluidModel;
+  for (auto& model : FluidModel) delete model;
 
 }
 
@@ -364,10 +377,10 @@ void CNEMOEulerSolver::CommonPreprocessing(CGeometry *geometry, CSolver **solver
     if (center_jst || center_jst_ke) SetCentered_Dissipation_Sensor(geometry, config);
   }
 
-  /*--- Initialize the Jacobian matrix and residual, not needed for the reducer strategy
-   *    as we set blocks (including diagonal ones) and completely overwrite. ---*/
+  /*--- Initialize the Jacobian matrix and residual. Unlike the Euler/NS solvers this is also
+   *    needed for the reducer strategy, as the edge loops do not set the Jacobian blocks. ---*/
 
-  if(!ReducerStrategy && !Output) {
+  if (!Output) {
     LinSysRes.SetValZero();
     if (implicit) Jacobian.SetValZero();
   }
@@ -407,24 +420,33 @@ void CNEMOEulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_conta
 
 unsigned long CNEMOEulerSolver::SetPrimitive_Variables(CSolver **solver_container, CConfig *config, bool Output) {
 
-  unsigned long iPoint, nonPhysicalPoints = 0;
-  bool nonphysical = true;
+  /*--- Number of non-physical points, local to each thread, reduced at the end. ---*/
+  unsigned long nonPhysicalPoints = 0;
 
-  for (iPoint = 0; iPoint < nPoint; iPoint ++) {
+  /*--- The gas models are the costly part, points are independent and each thread uses its own model. ---*/
+  SU2_OMP_PARALLEL
+  {
+    unsigned long nonPhysicalPointsLocal = 0;
 
-    /*--- Incompressible flow, primitive variables ---*/
+    /*--- The temperatures of a batch of points are computed together, see CNEMOGas::ComputeBatchTemperatures. ---*/
+    const unsigned long nBatch = roundUpDiv(nPoint, PRIMVAR_BATCH_SIZE);
 
-    nonphysical = nodes->SetPrimVar(iPoint,FluidModel);
+    SU2_OMP_FOR_STAT(roundUpDiv(omp_chunk_size, PRIMVAR_BATCH_SIZE))
+    for (unsigned long iBatch = 0; iBatch < nBatch; iBatch++) {
 
-    /* Check for non-realizable states for reporting. */
+      const unsigned long iPointBegin = iBatch*PRIMVAR_BATCH_SIZE;
+      const unsigned long iPointEnd = min(iPointBegin+PRIMVAR_BATCH_SIZE, nPoint);
 
-    if (nonphysical) nonPhysicalPoints++;
+      /* Check for non-realizable states for reporting. */
 
-    /*--- Initialize the convective, source and viscous residual vector ---*/
+      nonPhysicalPointsLocal += nodes->SetPrimVar(iPointBegin, iPointEnd, GetFluidModel());
 
-    if (!Output) LinSysRes.SetBlock_Zero(iPoint);
+    }
 
-  }
+    SU2_OMP_ATOMIC
+    nonPhysicalPoints += nonPhysicalPointsLocal;
+
+  } // end SU2_OMP_PARALLEL
 
   return nonPhysicalPoints;
 }
@@ -745,20 +767,30 @@ void CNEMOEulerSolver::SetMax_Eigenvalue(CGeometry *geometry, CConfig *config) {
 
 void CNEMOEulerSolver::Centered_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics_container,
                                          CConfig *config, unsigned short iMesh, unsigned short iRKStep) {
-  unsigned long iEdge, iPoint, jPoint;
-  unsigned short iVar;
-  bool err;
-
-  CNumerics* numerics = numerics_container[CONV_TERM];
 
   /*--- Set booleans based on config settings ---*/
   //bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
 
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+  SU2_OMP_PARALLEL
+  {
+  /*--- Pick one numerics object per thread. ---*/
+  CNumerics* numerics = numerics_container[CONV_TERM + omp_get_thread_num()*MAX_TERMS];
+
+  /*--- No atomic adjoint updates needed while looping over colors (see EdgeFluxResidual). ---*/
+  if (!ReducerStrategy) AD::StartNoSharedReading();
+
+  /*--- Loop over edge colors. ---*/
+  for (auto color : EdgeColoring)
+  {
+  /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
+  SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
+  for(auto k = 0ul; k < color.size; ++k) {
+
+    auto iEdge = color.indices[k];
 
     /*--- Points in edge, set normal vectors, and number of neighbors ---*/
-    iPoint = geometry->edges->GetNode(iEdge, 0);
-    jPoint = geometry->edges->GetNode(iEdge, 1);
+    auto iPoint = geometry->edges->GetNode(iEdge, 0);
+    auto jPoint = geometry->edges->GetNode(iEdge, 1);
     numerics->SetNormal(geometry->edges->GetNormal(iEdge));
     numerics->SetNeighbor(geometry->nodes->GetnNeighbor(iPoint),
                           geometry->nodes->GetnNeighbor(jPoint));
@@ -782,29 +814,33 @@ void CNEMOEulerSolver::Centered_Residual(CGeometry *geometry, CSolver **solver_c
     auto residual = numerics->ComputeResidual(config);
 
     /*--- Check for NaNs before applying the residual to the linear system ---*/
-    err = false;
-    for (iVar = 0; iVar < nVar; iVar++)
+    bool err = false;
+    for (unsigned short iVar = 0; iVar < nVar; iVar++)
       if (residual[iVar] != residual[iVar])
         err = true;
-    //if (implicit)
-    //  for (iVar = 0; iVar < nVar; iVar++)
-    //    for (jVar = 0; jVar < nVar; jVar++)
-    //      if ((Jacobian_i[iVar][jVar] != Jacobian_i[iVar][jVar]) ||
-    //          (Jacobian_j[iVar][jVar] != Jacobian_j[iVar][jVar])   )
-    //        err = true;
 
-    /*--- Update the residual and Jacobian ---*/
-    if (!err) {
+    /*--- Update the residual (the edge flux is zeroed for the reducer) ---*/
+    if (ReducerStrategy) {
+      if (err) EdgeFluxes.SetBlock_Zero(iEdge);
+      else EdgeFluxes.SetBlock(iEdge, residual);
+    }
+    else if (!err) {
       LinSysRes.AddBlock(iPoint, residual);
       LinSysRes.SubtractBlock(jPoint, residual);
-    //  if (implicit) {
-    //    Jacobian.AddBlock(iPoint,iPoint,Jacobian_i);
-    //    Jacobian.AddBlock(iPoint,jPoint,Jacobian_j);
-    //    Jacobian.SubtractBlock(jPoint,iPoint,Jacobian_i);
-    //    Jacobian.SubtractBlock(jPoint,jPoint,Jacobian_j);
-    //  }
     }
+
+    /*--- Viscous contribution. ---*/
+
+    Viscous_Residual(iEdge, geometry, solver_container,
+                     numerics_container[VISC_TERM + omp_get_thread_num()*MAX_TERMS], config);
   }
+  } // end color loop
+
+  if (!ReducerStrategy) AD::EndNoSharedReading();
+
+  if (ReducerStrategy) SumEdgeFluxes(geometry);
+
+  } // end SU2_OMP_PARALLEL
 }
 
 void CNEMOEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics_container,
@@ -818,13 +854,15 @@ void CNEMOEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_con
                                 (InnerIter <= config->GetLimiterIter());
   const bool van_albada       = (config->GetKind_SlopeLimit_Flow() == VAN_ALBADA_EDGE);
 
+  SU2_OMP_PARALLEL
+  {
   /*--- Non-physical counter. ---*/
   unsigned long counter_local = 0;
   SU2_OMP_MASTER
   ErrorCounter = 0;
 
   /*--- Pick one numerics object per thread. ---*/
-  CNumerics* numerics = numerics_container[CONV_TERM];
+  CNumerics* numerics = numerics_container[CONV_TERM + omp_get_thread_num()*MAX_TERMS];
 
   /*--- Static arrays for MUSCL reconstructed variables ---*/
   su2double Primitive_i[MAXNVAR] = {0.0}, Primitive_j[MAXNVAR] = {0.0};
@@ -836,8 +874,17 @@ void CNEMOEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_con
   su2double      Cvve_i[MAXNVAR] = {0.0},      Cvve_j[MAXNVAR] = {0.0};
   su2double Gamma_i = 0.0, Gamma_j = 0.0;
 
-  /*--- Loop over edges and calculate convective fluxes ---*/
-  for(unsigned long iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+  /*--- No atomic adjoint updates needed while looping over colors (see EdgeFluxResidual). ---*/
+  if (!ReducerStrategy) AD::StartNoSharedReading();
+
+  /*--- Loop over edge colors. ---*/
+  for (auto color : EdgeColoring)
+  {
+  /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
+  SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
+  for(auto k = 0ul; k < color.size; ++k) {
+
+    auto iEdge = color.indices[k];
 
     unsigned short iDim, iVar;
 
@@ -967,8 +1014,12 @@ void CNEMOEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_con
     //          (Jacobian_j[iVar][jVar] != Jacobian_j[iVar][jVar])   )
     //        err = true;
 
-    /*--- Update the residual and Jacobian ---*/
-    if (!err) {
+    /*--- Update the residual (the edge flux is zeroed for the reducer) ---*/
+    if (ReducerStrategy) {
+      if (err) EdgeFluxes.SetBlock_Zero(iEdge);
+      else EdgeFluxes.SetBlock(iEdge, residual);
+    }
+    else if (!err) {
       LinSysRes.AddBlock(iPoint, residual);
       LinSysRes.SubtractBlock(jPoint, residual);
       //if (implicit) {
@@ -978,7 +1029,17 @@ void CNEMOEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_con
       //  Jacobian.SubtractBlock(jPoint, jPoint, Jacobian_j);
       //}
     }
+
+    /*--- Viscous contribution. ---*/
+
+    Viscous_Residual(iEdge, geometry, solver_container,
+                     numerics_container[VISC_TERM + omp_get_thread_num()*MAX_TERMS], config);
   }
+  } // end color loop
+
+  if (!ReducerStrategy) AD::EndNoSharedReading();
+
+  if (ReducerStrategy) SumEdgeFluxes(geometry);
 
   /*--- Warning message about non-physical reconstructions. ---*/
   if ((iMesh == MESH_0) && (config->GetComm_Level() == COMM_FULL)) {
@@ -996,6 +1057,8 @@ void CNEMOEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_con
     }
     SU2_OMP_BARRIER
   }
+
+  } // end SU2_OMP_PARALLEL
 }
 
 su2double CNEMOEulerSolver::ComputeConsistentExtrapolation(CNEMOGas *fluidmodel, unsigned short nSpecies, su2double *V,
@@ -1060,8 +1123,8 @@ void CNEMOEulerSolver::RecomputeConservativeVector(su2double *U, const su2double
   }
 
   /*--- Set the fluidmodel and recompute energies ---*/
-  FluidModel->SetTDStateRhosTTv( rhos, V[T_INDEX], V[TVE_INDEX]);
-  const auto& Energies = FluidModel->ComputeMixtureEnergies();
+  GetFluidModel()->SetTDStateRhosTTv( rhos, V[T_INDEX], V[TVE_INDEX]);
+  const auto& Energies = GetFluidModel()->ComputeMixtureEnergies();
 
   /*--- Set conservative energies ---*/
   U[nSpecies+nDim]   = V[RHO_INDEX]*(Energies[0]+0.5*sqvel);
@@ -1106,31 +1169,66 @@ bool CNEMOEulerSolver::CheckNonPhys(const su2double *V) const {
 
 void CNEMOEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics_container, CConfig *config, unsigned short iMesh) {
 
-  unsigned short iVar, jVar;
-  unsigned long iPoint;
-  unsigned long eAxi_local, eChm_local, eVib_local;
-  unsigned long eAxi_global, eChm_global, eVib_global;
-
   /*--- Assign booleans ---*/
-  bool err        = false;
   bool implicit   = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
   bool frozen     = config->GetFrozen();
   bool monoatomic = config->GetMonoatomic();
   bool viscous    = config->GetViscous();
   bool rans       = (config->GetKind_Turb_Model() != NONE);
 
-  CNumerics* numerics = numerics_container[SOURCE_FIRST_TERM];
+  /*--- Initialize the error counters, each thread adds its own count at the end ---*/
+  unsigned long eAxi_global = 0, eChm_global = 0, eVib_global = 0;
+
+  /*--- Compute the auxiliary variables of the axisymmetric viscous source terms ---*/
+  if (config->GetAxisymmetric() && viscous) {
+
+    for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+
+      su2double yCoord          = geometry->nodes->GetCoord(iPoint, 1);
+      su2double yVelocity       = nodes->GetVelocity(iPoint,1);
+      su2double xVelocity       = nodes->GetVelocity(iPoint,0);
+      su2double Total_Viscosity = nodes->GetLaminarViscosity(iPoint) + nodes->GetEddyViscosity(iPoint);
+
+      if (yCoord > EPS){
+        su2double nu_v_on_y = Total_Viscosity*yVelocity/yCoord;
+        nodes->SetAuxVar(iPoint, 0, nu_v_on_y);
+        nodes->SetAuxVar(iPoint, 1, nu_v_on_y*yVelocity);
+        nodes->SetAuxVar(iPoint, 2, nu_v_on_y*xVelocity);
+      }
+    }
+
+    /*--- Compute the auxiliary variable gradient with GG or WLS. ---*/
+    if (config->GetKind_Gradient_Method() == GREEN_GAUSS) {
+      SetAuxVar_Gradient_GG(geometry, config);
+    }
+    if (config->GetKind_Gradient_Method() == WEIGHTED_LEAST_SQUARES) {
+      SetAuxVar_Gradient_LS(geometry, config);
+    }
+  }
+
+  /*--- The chemistry and relaxation rates are the costly part, each thread
+   *    evaluates them for its points with its own numerics (and gas model). ---*/
+  SU2_OMP_PARALLEL
+  {
+  unsigned short iVar, jVar;
+  unsigned long eAxi_local = 0, eChm_local = 0, eVib_local = 0;
+  bool err = false;
 
-  /*--- Initialize the error counter ---*/
-  eAxi_local = 0;
-  eChm_local = 0;
-  eVib_local = 0;
+  /*--- Pick one numerics object per thread. ---*/
+  CNumerics* numerics = numerics_container[SOURCE_FIRST_TERM + omp_get_thread_num()*MAX_TERMS];
 
-  /*--- Initialize the source residual to zero ---*/
-  for (iVar = 0; iVar < nVar; iVar++) Residual[iVar] = 0.0;
+  /*--- Work arrays of the point-implicit sources. ---*/
+  const bool pointImplicit = implicit && !SourceJacobianRows.empty();
+  vector<su2double> U_work, V_work, SourceJacobian;
+  if (pointImplicit) {
+    U_work.resize(nVar);
+    V_work.resize(nPrimVar);
+    SourceJacobian.resize(nVar*nVar);
+  }
 
   /*--- loop over interior points ---*/
-  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+  SU2_OMP_FOR_DYN(omp_chunk_size)
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
 
     /*--- Set conserved & primitive variables  ---*/
     numerics->SetConservative(nodes->GetSolution(iPoint),   nodes->GetSolution(iPoint));
@@ -1198,39 +1296,25 @@ void CNEMOEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_con
         eVib_local++;
     }
 
-  }
-    /*--- Compute axisymmetric source terms (if needed) ---*/
-    if (config->GetAxisymmetric()) {
+    /*--- Point-implicit treatment of the stiff sources, their Jacobian is added to the
+     *    diagonal of the system so that they do not limit the CFL of the flow solver. ---*/
+    if (pointImplicit) {
 
-      if (viscous) {
-
-        for (iPoint = 0; iPoint < nPoint; iPoint++) {
+      err = !ComputeSourceJacobian(numerics, iPoint, config, U_work.data(), V_work.data(), SourceJacobian.data());
 
-          su2double yCoord          = geometry->nodes->GetCoord(iPoint, 1);
-          su2double yVelocity       = nodes->GetVelocity(iPoint,1);
-          su2double xVelocity       = nodes->GetVelocity(iPoint,0);
-          su2double Total_Viscosity = nodes->GetLaminarViscosity(iPoint) + nodes->GetEddyViscosity(iPoint);
+      for (iVar = 0; iVar < nVar*nVar; iVar++)
+        if (SourceJacobian[iVar] != SourceJacobian[iVar]) err = true;
 
-          if (yCoord > EPS){
-            su2double nu_v_on_y = Total_Viscosity*yVelocity/yCoord;
-            nodes->SetAuxVar(iPoint, 0, nu_v_on_y);
-            nodes->SetAuxVar(iPoint, 1, nu_v_on_y*yVelocity);
-            nodes->SetAuxVar(iPoint, 2, nu_v_on_y*xVelocity);
-          }
-        }
+      if (!err) Jacobian.AddBlock(iPoint, iPoint, SourceJacobian.data(), su2double(-1.0));
+    }
 
-        /*--- Compute the auxiliary variable gradient with GG or WLS. ---*/
-        if (config->GetKind_Gradient_Method() == GREEN_GAUSS) {
-          SetAuxVar_Gradient_GG(geometry, config);
-        }
-        if (config->GetKind_Gradient_Method() == WEIGHTED_LEAST_SQUARES) {
-          SetAuxVar_Gradient_LS(geometry, config);
-        }
-      }
+  }
+    /*--- Compute axisymmetric source terms (if needed) ---*/
+    if (config->GetAxisymmetric()) {
 
       /*--- loop over points ---*/
       SU2_OMP_FOR_DYN(omp_chunk_size)
-      for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+      for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
 
         /*--- If necessary, set variables needed for viscous computation ---*/
         if (viscous) {
@@ -1263,31 +1347,47 @@ void CNEMOEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_con
           }
         }
 
+        /*--- Set conserved & primitive variables, and the geometry of the point ---*/
+        numerics->SetConservative(nodes->GetSolution(iPoint),  nodes->GetSolution(iPoint));
+        numerics->SetPrimitive   (nodes->GetPrimitive(iPoint), nodes->GetPrimitive(iPoint));
+        numerics->SetVolume(geometry->nodes->GetVolume(iPoint));
+        numerics->SetCoord(geometry->nodes->GetCoord(iPoint), geometry->nodes->GetCoord(iPoint));
+
         auto residual = numerics->ComputeAxisymmetric(config);
 
+        /*--- The Jacobian is the one of the numerics of this thread, if it provides one. ---*/
+        const bool addJacobian = implicit && (residual.jacobian_i != nullptr);
+
         /*--- Check for errors before applying source to the linear system ---*/
         err = false;
         for (iVar = 0; iVar < nVar; iVar++)
           if (residual[iVar] != residual[iVar]) err = true;
-        if (implicit)
+        if (addJacobian)
           for (iVar = 0; iVar < nVar; iVar++)
             for (jVar = 0; jVar < nVar; jVar++)
-              if (Jacobian_i[iVar][jVar] != Jacobian_i[iVar][jVar]) err = true;
+              if (residual.jacobian_i[iVar][jVar] != residual.jacobian_i[iVar][jVar]) err = true;
 
         /*--- Apply the update to the linear system ---*/
         if (!err) {
           LinSysRes.AddBlock(iPoint, residual);
-          if (implicit)
-            Jacobian.AddBlock(iPoint, iPoint, Jacobian_i);
+          if (addJacobian)
+            Jacobian.AddBlock2Diag(iPoint, residual.jacobian_i);
         }else
           eAxi_local++;
       }
     }
 
+  /*--- Add the error counts of all threads ---*/
+  SU2_OMP_ATOMIC
+  eAxi_global += eAxi_local;
+  SU2_OMP_ATOMIC
+  eChm_global += eChm_local;
+  SU2_OMP_ATOMIC
+  eVib_global += eVib_local;
+
+  } // end SU2_OMP_PARALLEL
+
   /*--- Checking for NaN ---*/
-  eAxi_global = eAxi_local;
-  eChm_global = eChm_local;
-  eVib_global = eVib_local;
 
   //THIS IS NO FUN
   if ((eAxi_global != 0) ||
@@ -1300,6 +1400,71 @@ void CNEMOEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_con
   }
 }
 
+bool CNEMOEulerSolver::ComputeSourceJacobian(CNumerics* numerics, unsigned long iPoint, const CConfig* config,
+                                             su2double* U, su2double* V, su2double* jacobian) const {
+
+  const bool frozen = config->GetFrozen();
+  /*--- The temperatures come from an iterative solve with a finite tolerance, the relative
+   *    step must be well above it, not the usual sqrt(machine epsilon). ---*/
+  const passivedouble delta = 1e-5;
+
+  const su2double* U_i = nodes->GetSolution(iPoint);
+  su2double* V_i = nodes->GetPrimitive(iPoint);
+  auto fluidmodel = GetFluidModel();
+
+  /*--- Secondary variables of the perturbed states, only needed by the conversion. ---*/
+  su2double dPdU[MAXNVAR], dTdU[MAXNVAR], dTvedU[MAXNVAR], eves[MAXNVAR], Cvves[MAXNVAR];
+
+  /*--- Sources at the state V, only the rows of the Jacobian structure are stored. ---*/
+  auto evalSources = [&](su2double* V_eval, su2double* S) {
+    numerics->SetPrimitive(V_eval, V_eval);
+    if (!frozen) {
+      auto residual = numerics->ComputeChemistry(config);
+      for (unsigned short iSpecies = 0; iSpecies < nSpecies; iSpecies++)
+        S[iSpecies] = residual[iSpecies];
+    }
+    auto residual = numerics->ComputeVibRelaxation(config);
+    S[nSpecies+nDim+1] = residual[nSpecies+nDim+1];
+  };
+
+  su2double S0[MAXNVAR] = {0.0}, S[MAXNVAR] = {0.0};
+
+  evalSources(V_i, S0);
+
+  /*--- Reference magnitudes for the steps, the species densities and momentum can be 0,
+   *    their steps are relative to the mixture density and momentum magnitude. ---*/
+  su2double rho = 0.0;
+  for (unsigned short iSpecies = 0; iSpecies < nSpecies; iSpecies++) rho += U_i[iSpecies];
+  const su2double momentum = sqrt(rho*U_i[nSpecies+nDim]);
+
+  for (unsigned short iVar = 0; iVar < nVar; iVar++) U[iVar] = U_i[iVar];
+
+  unsigned short jVar = 0;
+  for (; jVar < nVar; jVar++) {
+
+    const su2double ref = (jVar < nSpecies)? rho : (jVar < nSpecies+nDim)? momentum : fabs(U_i[jVar]);
+    const su2double h = delta * max(fabs(U_i[jVar]), ref);
+
+    /*--- Perturb through the gas model, all the primitives see the change. ---*/
+    U[jVar] = U_i[jVar] + h;
+    const bool nonPhys = nodes->Cons2PrimVar(U, V, dPdU, dTdU, dTvedU, eves, Cvves, fluidmodel);
+    U[jVar] = U_i[jVar];
+
+    if (nonPhys) break;
+
+    evalSources(V, S);
+
+    for (unsigned short iVar = 0; iVar < nVar; iVar++) jacobian[iVar*nVar+jVar] = 0.0;
+    for (auto iVar : SourceJacobianRows)
+      jacobian[iVar*nVar+jVar] = (S[iVar]-S0[iVar]) / h;
+  }
+
+  /*--- Restore the numerics to the unperturbed state. ---*/
+  numerics->SetPrimitive(V_i, V_i);
+
+  return (jVar == nVar);
+}
+
 void CNEMOEulerSolver::ExplicitEuler_Iteration(CGeometry *geometry, CSolver **solver_container, CConfig *config) {
 
   su2double *local_Residual, *local_Res_TruncError, Vol, Delta, Res;
@@ -1494,20 +1659,27 @@ void CNEMOEulerSolver::SetNondimensionalization(CConfig *config, unsigned short
   bool tkeNeeded          = ((turbulent) && (config->GetKind_Turb_Model() == SST));
   bool reynolds_init      = (config->GetKind_InitOption() == REYNOLDS);
 
-  /*--- Instatiate the fluid model ---*/
-  switch (config->GetKind_FluidModel()) {
-  case MUTATIONPP:
-   #if defined(HAVE_MPP) && !defined(CODI_REVERSE_TYPE) && !defined(CODI_FORWARD_TYPE)
-     FluidModel = new CMutationTCLib(config, nDim);
-   #else
-     SU2_MPI::Error(string("Either 1) Mutation++ has not been configured/compiled (add '-Denable-mpp=true' to your meson string) or 2) CODI must be deactivated since it is not compatible with Mutation++."),
-     CURRENT_FUNCTION);
-   #endif
-   break;
-  case SU2_NONEQ:
-   FluidModel = new CSU2TCLib(config, nDim, viscous);
-   break;
-  }
+  /*--- Instatiate the fluid model, one per thread as the models hold the thermodynamic state ---*/
+  auto newFluidModel = [&]() {
+    CNEMOGas* model = nullptr;
+    switch (config->GetKind_FluidModel()) {
+    case MUTATIONPP:
+     #if defined(HAVE_MPP) && !defined(CODI_REVERSE_TYPE) && !defined(CODI_FORWARD_TYPE)
+       model = new CMutationTCLib(config, nDim);
+     #else
+       SU2_MPI::Error(string("Either 1) Mutation++ has not been configured/compiled (add '-Denable-mpp=true' to your meson string) or 2) CODI must be deactivated since it is not compatible with Mutation++."),
+       CURRENT_FUNCTION);
+     #endif
+     break;
+    case SU2_NONEQ:
+     model = new CSU2TCLib(config, nDim, viscous);
+     break;
+    }
+    return model;
+  };
+
+  FluidModel.resize(omp_get_max_threads());
+  for (auto& model : FluidModel) model = newFluidModel();
 
   /*--- Compute the Free Stream Pressure, Temperatrue, and Density ---*/
   Pressure_FreeStream        = config->GetPressure_FreeStream();
@@ -1519,17 +1691,17 @@ void CNEMOEulerSolver::SetNondimensionalization(CConfig *config, unsigned short
   /*---                                     ---*/
 
   /*--- Set mixture state based on pressure, mass fractions and temperatures ---*/
-  FluidModel->SetTDStatePTTv(Pressure_FreeStream, MassFrac_Inf,
+  GetFluidModel()->SetTDStatePTTv(Pressure_FreeStream, MassFrac_Inf,
                              Temperature_FreeStream, Temperature_ve_FreeStream);
 
   /*--- Compute Gas Constant ---*/
-  GasConstant_Inf = FluidModel->ComputeGasConstant();
+  GasConstant_Inf = GetFluidModel()->ComputeGasConstant();
   config->SetGas_Constant(GasConstant_Inf);
 
   /*--- Compute the freestream density, soundspeed ---*/
-  Density_FreeStream = FluidModel->GetDensity();
-  soundspeed         = FluidModel->ComputeSoundSpeed();
-  Gamma              = FluidModel->ComputeGamma();
+  Density_FreeStream = GetFluidModel()->GetDensity();
+  soundspeed         = GetFluidModel()->ComputeSoundSpeed();
+  Gamma              = GetFluidModel()->ComputeGamma();
 
   /*--- Compute the Free Stream velocity, using the Mach number ---*/
   if (nDim == 2) {
@@ -1551,7 +1723,7 @@ void CNEMOEulerSolver::SetNondimensionalization(CConfig *config, unsigned short
   ModVel_FreeStream = sqrt(ModVel_FreeStream); config->SetModVel_FreeStream(ModVel_FreeStream);
 
   /*--- Calculate energies ---*/
-  const auto& energies = FluidModel->ComputeMixtureEnergies();
+  const auto& energies = GetFluidModel()->ComputeMixtureEnergies();
 
   /*--- Viscous initialization ---*/
   if (viscous) {
@@ -1573,7 +1745,7 @@ void CNEMOEulerSolver::SetNondimensionalization(CConfig *config, unsigned short
     if (!reynolds_init) {
 
       /*--- Thermodynamics quantities based initialization ---*/
-      Viscosity_FreeStream = FluidModel->GetViscosity();
+      Viscosity_FreeStream = GetFluidModel()->GetViscosity();
       Energy_FreeStream    = energies[0] + 0.5*sqvel;
 
     } else {
@@ -1896,7 +2068,7 @@ void CNEMOEulerSolver::BC_Sym_Plane(CGeometry *geometry, CSolver **solver_contai
   }
 
   /*--- Get species molar mass ---*/
-  auto& Ms = FluidModel->GetSpeciesMolarMass();
+  auto& Ms = GetFluidModel()->GetSpeciesMolarMass();
 
   /*--- Loop over all the vertices on this boundary (val_marker) ---*/
   for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
@@ -2525,11 +2697,11 @@ void CNEMOEulerSolver::BC_Outlet(CGeometry *geometry, CSolver **solution_contain
         V_outlet[A_INDEX]     = SoundSpeed;
 
         /*--- Set mixture state and compute quantities ---*/
-        FluidModel->SetTDStateRhosTTv(rhos, Temperature, Tve);
-        V_outlet[RHOCVTR_INDEX] = FluidModel->ComputerhoCvtr();
-        V_outlet[RHOCVVE_INDEX] = FluidModel->ComputerhoCvve();
+        GetFluidModel()->SetTDStateRhosTTv(rhos, Temperature, Tve);
+        V_outlet[RHOCVTR_INDEX] = GetFluidModel()->ComputerhoCvtr();
+        V_outlet[RHOCVVE_INDEX] = GetFluidModel()->ComputerhoCvve();
 
-        const auto& energies = FluidModel->ComputeMixtureEnergies();
+        const auto& energies = GetFluidModel()->ComputeMixtureEnergies();
 
         /*--- Conservative variables, using the derived quantities ---*/
         for (iSpecies = 0; iSpecies < nSpecies; iSpecies ++){
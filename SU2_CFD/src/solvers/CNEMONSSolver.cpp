@@ -192,123 +192,116 @@ void CNEMONSSolver::SetPrimitive_Gradient_LS(CGeometry *geometry, const CConfig
 
 unsigned long CNEMONSSolver::SetPrimitive_Variables(CSolver **solver_container,CConfig *config, bool Output) {
 
-  unsigned long iPoint, nonPhysicalPoints = 0;
+  /*--- Number of non-physical points, local to each thread, reduced at the end. ---*/
+  unsigned long nonPhysicalPoints = 0;
+
   const unsigned short turb_model = config->GetKind_Turb_Model();
   //const bool tkeNeeded = (turb_model == SST) || (turb_model == SST_SUST);
 
-  bool nonphysical = true;
+  /*--- The gas models are the costly part, points are independent and each thread uses its own model. ---*/
+  SU2_OMP_PARALLEL
+  {
+    unsigned long nonPhysicalPointsLocal = 0;
 
-  for (iPoint = 0; iPoint < nPoint; iPoint ++) {
+    /*--- The temperatures of a batch of points are computed together, see CNEMOGas::ComputeBatchTemperatures. ---*/
+    const unsigned long nBatch = roundUpDiv(nPoint, PRIMVAR_BATCH_SIZE);
 
-    /*--- Retrieve the value of the kinetic energy (if needed). ---*/
+    SU2_OMP_FOR_STAT(roundUpDiv(omp_chunk_size, PRIMVAR_BATCH_SIZE))
+    for (unsigned long iBatch = 0; iBatch < nBatch; iBatch++) {
 
-    su2double eddy_visc = 0.0;
-    //su2double turb_ke = 0.0;
+      const unsigned long iPointBegin = iBatch*PRIMVAR_BATCH_SIZE;
+      const unsigned long iPointEnd = min(iPointBegin+PRIMVAR_BATCH_SIZE, nPoint);
 
-    if (turb_model != NONE && solver_container[TURB_SOL] != nullptr) {
-      eddy_visc = solver_container[TURB_SOL]->GetNodes()->GetmuT(iPoint);
-      //if (tkeNeeded) turb_ke = solver_container[TURB_SOL]->GetNodes()->GetSolution(iPoint,0);
+      /*--- Retrieve the value of the kinetic energy (if needed). ---*/
 
-       nodes->SetEddyViscosity(iPoint, eddy_visc);
-    }
+      if (turb_model != NONE && solver_container[TURB_SOL] != nullptr) {
+        for (auto iPoint = iPointBegin; iPoint < iPointEnd; iPoint++) {
+          su2double eddy_visc = solver_container[TURB_SOL]->GetNodes()->GetmuT(iPoint);
+          //if (tkeNeeded) turb_ke = solver_container[TURB_SOL]->GetNodes()->GetSolution(iPoint,0);
 
-    /*--- Incompressible flow, primitive variables ---*/
+          nodes->SetEddyViscosity(iPoint, eddy_visc);
+        }
+      }
 
-    nonphysical = nodes->SetPrimVar(iPoint,FluidModel);
+      /* Check for non-realizable states for reporting. */
 
-    /* Check for non-realizable states for reporting. */
+      nonPhysicalPointsLocal += nodes->SetPrimVar(iPointBegin, iPointEnd, GetFluidModel());
 
-    if (nonphysical) nonPhysicalPoints++;
+    }
 
-  }
+    SU2_OMP_ATOMIC
+    nonPhysicalPoints += nonPhysicalPointsLocal;
+
+  } // end SU2_OMP_PARALLEL
 
   return nonPhysicalPoints;
 }
 
-void CNEMONSSolver::Viscous_Residual(CGeometry *geometry,
-                                     CSolver **solution_container,
-                                     CNumerics **numerics_container,
-                                     CConfig *config, unsigned short iMesh,
-                                     unsigned short iRKStep) {
-
-  bool err;
-  unsigned short iVar;
-  unsigned long iPoint, jPoint, iEdge;
-
-  CNumerics* numerics = numerics_container[VISC_TERM];
-
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
-
-    /*--- Points, coordinates and normal vector in edge ---*/
-    iPoint = geometry->edges->GetNode(iEdge, 0);
-    jPoint = geometry->edges->GetNode(iEdge, 1);
-    numerics->SetCoord(geometry->nodes->GetCoord(iPoint),
-                       geometry->nodes->GetCoord(jPoint) );
-    numerics->SetNormal(geometry->edges->GetNormal(iEdge));
-
-    /*--- Primitive variables, and gradient ---*/
-    numerics->SetConservative   (nodes->GetSolution(iPoint),
-                                 nodes->GetSolution(jPoint) );
-    numerics->SetConsVarGradient(nodes->GetGradient(iPoint),
-                                 nodes->GetGradient(jPoint) );
-    numerics->SetPrimitive      (nodes->GetPrimitive(iPoint),
-                                 nodes->GetPrimitive(jPoint) );
-    numerics->SetPrimVarGradient(nodes->GetGradient_Primitive(iPoint),
-                                 nodes->GetGradient_Primitive(jPoint) );
-
-    /*--- Pass supplementary information to CNumerics ---*/
-    numerics->SetdPdU  (nodes->GetdPdU(iPoint),   nodes->GetdPdU(jPoint));
-    numerics->SetdTdU  (nodes->GetdTdU(iPoint),   nodes->GetdTdU(jPoint));
-    numerics->SetdTvedU(nodes->GetdTvedU(iPoint), nodes->GetdTvedU(jPoint));
-    numerics->SetEve   (nodes->GetEve(iPoint),    nodes->GetEve(jPoint));
-    numerics->SetCvve  (nodes->GetCvve(iPoint),   nodes->GetCvve(jPoint));
-
-    /*--- Species diffusion coefficients ---*/
-    numerics->SetDiffusionCoeff(nodes->GetDiffusionCoeff(iPoint),
-                                nodes->GetDiffusionCoeff(jPoint) );
-
-    /*--- Laminar viscosity ---*/
-    numerics->SetLaminarViscosity(nodes->GetLaminarViscosity(iPoint),
-                                  nodes->GetLaminarViscosity(jPoint) );
-
-    /*--- Eddy viscosity ---*/
-    numerics->SetEddyViscosity(nodes->GetEddyViscosity(iPoint),
-                               nodes->GetEddyViscosity(jPoint) );
-
-    /*--- Thermal conductivity ---*/
-    numerics->SetThermalConductivity(nodes->GetThermalConductivity(iPoint),
-                                     nodes->GetThermalConductivity(jPoint));
-
-    /*--- Vib-el. thermal conductivity ---*/
-    numerics->SetThermalConductivity_ve(nodes->GetThermalConductivity_ve(iPoint),
-                                        nodes->GetThermalConductivity_ve(jPoint) );
-
-    /*--- Compute and update residual ---*/
-    auto residual = numerics->ComputeResidual(config);
-
-    /*--- Check for NaNs before applying the residual to the linear system ---*/
-    err = false;
-    for (iVar = 0; iVar < nVar; iVar++)
-      if (residual[iVar] != residual[iVar]) err = true;
-    //if (implicit)
-    //  for (iVar = 0; iVar < nVar; iVar++)
-    //    for (jVar = 0; jVar < nVar; jVar++)
-    //      if ((Jacobian_i[iVar][jVar] != Jacobian_i[iVar][jVar]) ||
-    //          (Jacobian_j[iVar][jVar] != Jacobian_j[iVar][jVar])   )
-    //        err = true;
-
-    /*--- Update the residual and Jacobian ---*/
-    if (!err) {
-      LinSysRes.SubtractBlock(iPoint, residual);
-      LinSysRes.AddBlock(jPoint, residual);
-      //if (implicit) {
-      //  Jacobian.SubtractBlock(iPoint, iPoint, Jacobian_i);
-      //  Jacobian.SubtractBlock(iPoint, jPoint, Jacobian_j);
-      //  Jacobian.AddBlock(jPoint, iPoint, Jacobian_i);
-      //  Jacobian.AddBlock(jPoint, jPoint, Jacobian_j);
-      //}
-    }
-  } //iEdge
+void CNEMONSSolver::Viscous_Residual(unsigned long iEdge, CGeometry *geometry, CSolver **solver_container,
+                                     CNumerics *numerics, CConfig *config) {
+
+  /*--- Points, coordinates and normal vector in edge ---*/
+  const auto iPoint = geometry->edges->GetNode(iEdge, 0);
+  const auto jPoint = geometry->edges->GetNode(iEdge, 1);
+  numerics->SetCoord(geometry->nodes->GetCoord(iPoint),
+                     geometry->nodes->GetCoord(jPoint) );
+  numerics->SetNormal(geometry->edges->GetNormal(iEdge));
+
+  /*--- Primitive variables, and gradient ---*/
+  numerics->SetConservative   (nodes->GetSolution(iPoint),
+                               nodes->GetSolution(jPoint) );
+  numerics->SetConsVarGradient(nodes->GetGradient(iPoint),
+                               nodes->GetGradient(jPoint) );
+  numerics->SetPrimitive      (nodes->GetPrimitive(iPoint),
+                               nodes->GetPrimitive(jPoint) );
+  numerics->SetPrimVarGradient(nodes->GetGradient_Primitive(iPoint),
+                               nodes->GetGradient_Primitive(jPoint) );
+
+  /*--- Pass supplementary information to CNumerics ---*/
+  numerics->SetdPdU  (nodes->GetdPdU(iPoint),   nodes->GetdPdU(jPoint));
+  numerics->SetdTdU  (nodes->GetdTdU(iPoint),   nodes->GetdTdU(jPoint));
+  numerics->SetdTvedU(nodes->GetdTvedU(iPoint), nodes->GetdTvedU(jPoint));
+  numerics->SetEve   (nodes->GetEve(iPoint),    nodes->GetEve(jPoint));
+  numerics->SetCvve  (nodes->GetCvve(iPoint),   nodes->GetCvve(jPoint));
+
+  /*--- Species diffusion coefficients ---*/
+  numerics->SetDiffusionCoeff(nodes->GetDiffusionCoeff(iPoint),
+                              nodes->GetDiffusionCoeff(jPoint) );
+
+  /*--- Laminar viscosity ---*/
+  numerics->SetLaminarViscosity(nodes->GetLaminarViscosity(iPoint),
+                                nodes->GetLaminarViscosity(jPoint) );
+
+  /*--- Eddy viscosity ---*/
+  numerics->SetEddyViscosity(nodes->GetEddyViscosity(iPoint),
+                             nodes->GetEddyViscosity(jPoint) );
+
+  /*--- Thermal conductivity ---*/
+  numerics->SetThermalConductivity(nodes->GetThermalConductivity(iPoint),
+                                   nodes->GetThermalConductivity(jPoint));
+
+  /*--- Vib-el. thermal conductivity ---*/
+  numerics->SetThermalConductivity_ve(nodes->GetThermalConductivity_ve(iPoint),
+                                      nodes->GetThermalConductivity_ve(jPoint) );
+
+  /*--- Compute and update residual ---*/
+  auto residual = numerics->ComputeResidual(config);
+
+  /*--- Check for NaNs before applying the residual to the linear system ---*/
+  bool err = false;
+  for (unsigned short iVar = 0; iVar < nVar; iVar++)
+    if (residual[iVar] != residual[iVar]) err = true;
+
+  if (err) return;
+
+  /*--- Update the residual (the NEMO viscous Jacobians are not used yet) ---*/
+  if (ReducerStrategy) {
+    EdgeFluxes.SubtractBlock(iEdge, residual);
+  }
+  else {
+    LinSysRes.SubtractBlock(iPoint, residual);
+    LinSysRes.AddBlock(jPoint, residual);
+  }
 }
 
 void CNEMONSSolver::BC_HeatFluxNonCatalytic_Wall(CGeometry *geometry,
@@ -378,7 +371,7 @@ void CNEMONSSolver::BC_HeatFluxNonCatalytic_Wall(CGeometry *geometry,
       // TODO: Need to determine proper way to incorporate eddy viscosity
       // This is only scaling Kve by same factor as ktr
       su2double Mass = 0.0;
-      auto&     Ms   = FluidModel->GetSpeciesMolarMass();
+      auto&     Ms   = GetFluidModel()->GetSpeciesMolarMass();
       su2double tmp1, scl, Cptr;
       su2double Ru=1000.0*UNIVERSAL_GAS_CONSTANT;
       su2double eddy_viscosity = nodes->GetEddyViscosity(iPoint);
@@ -753,7 +746,7 @@ void CNEMONSSolver::BC_IsothermalNonCatalytic_Wall(CGeometry *geometry,
       // This is only scaling Kve by same factor as ktr
       V = nodes->GetPrimitive(iPoint);
       su2double Mass = 0.0;
-      auto&     Ms   = FluidModel->GetSpeciesMolarMass();
+      auto&     Ms   = GetFluidModel()->GetSpeciesMolarMass();
       su2double tmp1, scl, Cptr;
       su2double Ru=1000.0*UNIVERSAL_GAS_CONSTANT;
       su2double eddy_viscosity=nodes->GetEddyViscosity(iPoint);
@@ -828,7 +821,7 @@ void CNEMONSSolver::BC_IsothermalCatalytic_Wall(CGeometry *geometry,
   /*--- Get universal information ---*/
   RuSI     = UNIVERSAL_GAS_CONSTANT;
   Ru       = 1000.0*RuSI;
-  auto& Ms = FluidModel->GetSpeciesMolarMass();
+  auto& Ms = GetFluidModel()->GetSpeciesMolarMass();
 
   /*--- Get the locations of the primitive variables ---*/
   RHOS_INDEX  = nodes->GetRhosIndex();
@@ -880,7 +873,7 @@ void CNEMONSSolver::BC_IsothermalCatalytic_Wall(CGeometry *geometry,
       Vj   = nodes->GetPrimitive(jPoint);
       Di   = nodes->GetDiffusionCoeff(iPoint);
       eves = nodes->GetEve(iPoint);
-      hs   = FluidModel->ComputeSpeciesEnthalpy(Vi[T_INDEX], Vi[TVE_INDEX], eves);
+      hs   = GetFluidModel()->ComputeSpeciesEnthalpy(Vi[T_INDEX], Vi[TVE_INDEX], eves);
       for (iSpecies = 0; iSpecies < nSpecies; iSpecies++)
         Yj[iSpecies] = Vj[RHOS_INDEX+iSpecies]/Vj[RHO_INDEX];
       rho    = Vi[RHO_INDEX];
@@ -929,7 +922,7 @@ void CNEMONSSolver::BC_IsothermalCatalytic_Wall(CGeometry *geometry,
         }
 
         /*--- Calculate supplementary quantities ---*/
-        Cvtrs = FluidModel->GetSpeciesCvTraRot();
+        Cvtrs = GetFluidModel()->GetSpeciesCvTraRot();
         Cvve = nodes->GetCvve(iPoint);
 
         /*--- Take the primitive var. Jacobian & store in Jac. jj ---*/
@@ -1087,7 +1080,7 @@ void CNEMONSSolver::BC_Smoluchowski_Maxwell(CGeometry *geometry,
       Gamma     = nodes->GetGamma(iPoint);
 
       /*--- Incorporate turbulence effects ---*/
-      auto&      Ms = FluidModel->GetSpeciesMolarMass();
+      auto&      Ms = GetFluidModel()->GetSpeciesMolarMass();
       su2double  Ru = 1000.0*UNIVERSAL_GAS_CONSTANT;
       su2double  tmp1, scl, Cptr;
       su2double *Vi = nodes->GetPrimitive(iPoint);
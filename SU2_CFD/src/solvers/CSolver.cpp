@@ -45,6 +45,7 @@
 #include "../../../Common/include/toolboxes/printing_toolbox.hpp"
 #include "../../../Common/include/toolboxes/C1DInterpolation.hpp"
 #include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
+#include "../../../Common/include/toolboxes/CPerformanceTracer.hpp"
 #include "../../include/CMarkerProfileReaderFVM.hpp"
 
 
@@ -1671,6 +1672,8 @@ void CSolver::InitiateComms(CGeometry *geometry,
                             const CConfig *config,
                             unsigned short commType) {
 
+  CTraceScope trace("CSolver::InitiateComms", "mpi");
+
   /*--- Local variables ---*/
 
   unsigned short iVar, iDim;
@@ -1841,6 +1844,8 @@ void CSolver::CompleteComms(CGeometry *geometry,
                             const CConfig *config,
                             unsigned short commType) {
 
+  CTraceScope trace("CSolver::CompleteComms", "mpi");
+
   /*--- Local variables ---*/
 
   unsigned short iDim, iVar;
@@ -1872,7 +1877,10 @@ void CSolver::CompleteComms(CGeometry *geometry,
        the order they arrive. ---*/
 
       SU2_OMP_MASTER
-      SU2_MPI::Waitany(geometry->nP2PRecv, geometry->req_P2PRecv, &ind, &status);
+      {
+        CTraceWaitScope traceWait("MPI_Waitany");
+        SU2_MPI::Waitany(geometry->nP2PRecv, geometry->req_P2PRecv, &ind, &status);
+      }
       SU2_OMP_BARRIER
 
       /*--- Once we have recv'd a message, get the source rank. ---*/
@@ -2013,7 +2021,10 @@ void CSolver::CompleteComms(CGeometry *geometry,
 
 #ifdef HAVE_MPI
     SU2_OMP_MASTER
-    SU2_MPI::Waitall(geometry->nP2PSend, geometry->req_P2PSend, MPI_STATUS_IGNORE);
+    {
+      CTraceWaitScope traceWait("MPI_Waitall");
+      SU2_MPI::Waitall(geometry->nP2PSend, geometry->req_P2PSend, MPI_STATUS_IGNORE);
+    }
 #endif
     SU2_OMP_BARRIER
   }
@@ -2073,8 +2084,9 @@ void CSolver::AdaptCFLNumber(CGeometry **geometry,
     /* Max linear residual between flow and turbulence. */
     const su2double linRes = max(solverFlow->GetResLinSolver(), linResTurb);
 
-    /* Tolerance limited to an acceptable value. */
-    const su2double linTol = max(acceptableLinTol, config->GetLinear_Solver_Error());
+    /* Tolerance limited to an acceptable value, inexact Newton steps have a looser one. */
+    const su2double linTol = max(acceptableLinTol, max(config->GetLinear_Solver_Error(),
+                                                       solverFlow->GetTolLinSolver()));
 
     /* Check that we are meeting our nonlinear residual reduction target
      over time so that we do not get stuck in limit cycles, this is done
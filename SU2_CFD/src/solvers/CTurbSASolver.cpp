@@ -304,6 +304,9 @@ void CTurbSASolver::Postprocessing(CGeometry *geometry, CSolver **solver_contain
 
   /*--- Compute eddy viscosity ---*/
 
+  /*--- Each iteration only reads the data of its point, the adjoints (reverse AD) can be updated without atomics. ---*/
+  AD::StartNoSharedReading();
+
   SU2_OMP_FOR_STAT(omp_chunk_size)
   for (unsigned long iPoint = 0; iPoint < nPoint; iPoint ++) {
 
@@ -332,6 +335,8 @@ void CTurbSASolver::Postprocessing(CGeometry *geometry, CSolver **solver_contain
 
   }
 
+  AD::EndNoSharedReading();
+
 }
 
 
@@ -46,6 +46,7 @@ CIncNSVariable::CIncNSVariable(su2double pressure, const su2double *velocity, su
 
 bool CIncNSVariable::SetVorticity_StrainMag() {
 
+  SU2_OMP_FOR_STAT(256)
   for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint) {
 
     /*--- Vorticity ---*/
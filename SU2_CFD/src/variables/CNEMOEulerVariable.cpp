@@ -77,6 +77,10 @@ CNEMOEulerVariable::CNEMOEulerVariable(su2double val_pressure,
   /*--- Allocate & initialize residual vectors ---*/
   Res_TruncError.resize(nPoint,nVar) = su2double(0.0);
 
+  /*--- Species densities passed to the gas model, one buffer per thread ---*/
+  rhosBuffer.assign(omp_get_max_threads(), vector<su2double>(nSpecies, 0.0));
+  batchBuffer.resize(omp_get_max_threads());
+
   /*--- Size Grad_AuxVar for axiysmmetric ---*/
   if (config->GetAxisymmetric()){
     nAuxVar = 3;
@@ -189,16 +193,66 @@ void CNEMOEulerVariable::SetVelocity2(unsigned long iPoint) {
   }
 }
 
-bool CNEMOEulerVariable::SetPrimVar(unsigned long iPoint, CFluidModel *FluidModel) {
+unsigned long CNEMOEulerVariable::SetPrimVar(unsigned long iPointBegin, unsigned long iPointEnd,
+                                             CFluidModel *FluidModel) {
+
+  auto fluidmodel = static_cast<CNEMOGas*>(FluidModel);
+  const auto nBatch = iPointEnd - iPointBegin;
+
+  /*--- Species-major inputs of the batch, the species densities are clipped as in Cons2PrimVar. ---*/
+  auto& buffer = batchBuffer[omp_get_thread_num()];
+  buffer.resize((nSpecies+5)*nBatch);
+  su2double* rhos    = buffer.data();
+  su2double* rhoE    = rhos + nSpecies*nBatch;
+  su2double* rhoEve  = rhoE + nBatch;
+  su2double* rhoEvel = rhoEve + nBatch;
+  su2double* T       = rhoEvel + nBatch;
+  su2double* Tve     = T + nBatch;
+
+  for (auto i = 0ul; i < nBatch; i++) {
+    const su2double* U = Solution[iPointBegin+i];
+
+    su2double rho = 0.0;
+    for (auto iSpecies = 0u; iSpecies < nSpecies; iSpecies++) {
+      const su2double rho_s = (U[iSpecies] < 0.0)? 1E-20 : U[iSpecies];
+      rhos[iSpecies*nBatch+i] = rho_s;
+      rho += rho_s;
+    }
+    su2double sqvel = 0.0;
+    for (auto iDim = 0u; iDim < nDim; iDim++) {
+      const su2double vel = U[nSpecies+iDim]/rho;
+      sqvel += vel*vel;
+    }
+    rhoE[i]    = U[nSpecies+nDim];
+    rhoEve[i]  = U[nSpecies+nDim+1];
+    rhoEvel[i] = 0.5*rho*sqvel;
+  }
+
+  fluidmodel->ComputeBatchTemperatures(nBatch, rhos, rhoE, rhoEve, rhoEvel, T, Tve);
+
+  /*--- The rest of the primitives is set point by point. ---*/
+  unsigned long nonPhysicalPoints = 0;
+
+  for (auto i = 0ul; i < nBatch; i++) {
+    const su2double temperatures[] = {T[i], Tve[i]};
+    nonPhysicalPoints += SetPrimVar(iPointBegin+i, FluidModel, temperatures);
+  }
+
+  return nonPhysicalPoints;
+}
+
+bool CNEMOEulerVariable::SetPrimVar(unsigned long iPoint, CFluidModel *FluidModel, const su2double *val_temperatures) {
 
   bool nonPhys;
   unsigned short iVar;
 
-  fluidmodel = static_cast<CNEMOGas*>(FluidModel);
+  /*--- The fluid model holds the thermodynamic state, it must be private to the calling thread. ---*/
+  auto fluidmodel = static_cast<CNEMOGas*>(FluidModel);
 
   /*--- Convert conserved to primitive variables ---*/
   nonPhys = Cons2PrimVar(Solution[iPoint], Primitive[iPoint],
-                         dPdU[iPoint], dTdU[iPoint], dTvedU[iPoint], eves[iPoint], Cvves[iPoint]);
+                         dPdU[iPoint], dTdU[iPoint], dTvedU[iPoint], eves[iPoint], Cvves[iPoint], fluidmodel,
+                         val_temperatures);
 
   /*--- Reset solution to previous one, if nonphys ---*/
   if (nonPhys) {
@@ -217,13 +271,12 @@ bool CNEMOEulerVariable::SetPrimVar(unsigned long iPoint, CFluidModel *FluidMode
 bool CNEMOEulerVariable::Cons2PrimVar(su2double *U, su2double *V,
                                       su2double *val_dPdU, su2double *val_dTdU,
                                       su2double *val_dTvedU, su2double *val_eves,
-                                      su2double *val_Cvves) {
+                                      su2double *val_Cvves, CNEMOGas *fluidmodel,
+                                      const su2double *val_temperatures) const {
 
   unsigned short iDim, iSpecies;
   su2double Tmin, Tmax, Tvemin, Tvemax;
-  vector<su2double> rhos;
-
-  rhos.resize(nSpecies,0.0);
+  auto& rhos = rhosBuffer[omp_get_thread_num()];
 
   /*--- Conserved & primitive vector layout ---*/
   // U:  [rho1, ..., rhoNs, rhou, rhov, rhow, rhoe, rhoeve]^T
@@ -267,12 +320,13 @@ bool CNEMOEulerVariable::Cons2PrimVar(su2double *U, su2double *V,
     sqvel            += V[VEL_INDEX+iDim]*V[VEL_INDEX+iDim];
   }
 
-  /*--- Assign temperatures ---*/
-  const auto& T = fluidmodel->ComputeTemperatures(rhos, rhoE, rhoEve, 0.5*rho*sqvel);
+  /*--- Assign temperatures, unless they were computed for a batch of points ---*/
+  if (val_temperatures == nullptr)
+    val_temperatures = fluidmodel->ComputeTemperatures(rhos, rhoE, rhoEve, 0.5*rho*sqvel).data();
 
   /*--- Temperatures ---*/
-  V[T_INDEX]   = T[0];
-  V[TVE_INDEX] = T[1];
+  V[T_INDEX]   = val_temperatures[0];
+  V[TVE_INDEX] = val_temperatures[1];
   
   // Determine if the temperature lies within the acceptable range
   //TODO: fIX THIS
@@ -282,18 +336,19 @@ bool CNEMOEulerVariable::Cons2PrimVar(su2double *U, su2double *V,
     nonPhys = true;
   }
   
-  /*--- Vibrational-Electronic Temperature ---*/
-  vector<su2double> eves_min = fluidmodel->ComputeSpeciesEve(Tvemin);
-  vector<su2double> eves_max = fluidmodel->ComputeSpeciesEve(Tvemax);
-
   // Check for non-physical solutions
   if (!monoatomic){
+
+    /*--- Vibrational-Electronic Temperature (the returned references are consumed before the next call) ---*/
     su2double rhoEve_min = 0.0;
-    su2double rhoEve_max = 0.0;
-    for (iSpecies = 0; iSpecies < nSpecies; iSpecies++) {
+    const auto& eves_min = fluidmodel->ComputeSpeciesEve(Tvemin);
+    for (iSpecies = 0; iSpecies < nSpecies; iSpecies++)
       rhoEve_min += U[iSpecies] * eves_min[iSpecies];
+
+    su2double rhoEve_max = 0.0;
+    const auto& eves_max = fluidmodel->ComputeSpeciesEve(Tvemax);
+    for (iSpecies = 0; iSpecies < nSpecies; iSpecies++)
       rhoEve_max += U[iSpecies] * eves_max[iSpecies];
-    }
 
     if (rhoEve < rhoEve_min) {
       
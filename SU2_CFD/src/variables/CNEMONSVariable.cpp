@@ -102,15 +102,16 @@ bool CNEMONSVariable::SetVorticity(void) {
   return false;
 }
 
-bool CNEMONSVariable::SetPrimVar(unsigned long iPoint, CFluidModel *FluidModel) {
+bool CNEMONSVariable::SetPrimVar(unsigned long iPoint, CFluidModel *FluidModel, const su2double *val_temperatures) {
 
   bool nonPhys;
   unsigned short iVar, iSpecies;
 
-  fluidmodel = static_cast<CNEMOGas*>(FluidModel);
+  /*--- The fluid model holds the thermodynamic state, it must be private to the calling thread. ---*/
+  auto fluidmodel = static_cast<CNEMOGas*>(FluidModel);
 
   /*--- Convert conserved to primitive variables ---*/
-  nonPhys = Cons2PrimVar(Solution[iPoint], Primitive[iPoint], dPdU[iPoint], dTdU[iPoint], dTvedU[iPoint], eves[iPoint], Cvves[iPoint]);
+  nonPhys = Cons2PrimVar(Solution[iPoint], Primitive[iPoint], dPdU[iPoint], dTdU[iPoint], dTvedU[iPoint], eves[iPoint], Cvves[iPoint], fluidmodel, val_temperatures);
 
   /*--- Reset solution to previous one, if nonphys ---*/
   if (nonPhys) {
@@ -123,13 +124,13 @@ bool CNEMONSVariable::SetPrimVar(unsigned long iPoint, CFluidModel *FluidModel)
 
   SetVelocity2(iPoint);
 
-  Ds = fluidmodel->GetDiffusionCoeff();
+  const auto& Ds = fluidmodel->GetDiffusionCoeff();
   for (iSpecies = 0; iSpecies < nSpecies; iSpecies++)
     DiffusionCoeff(iPoint, iSpecies) = Ds[iSpecies];
   
   LaminarViscosity(iPoint) = fluidmodel->GetViscosity();
 
-  thermalconductivities    = fluidmodel->GetThermalConductivities();
+  const auto& thermalconductivities = fluidmodel->GetThermalConductivities();
   ThermalCond(iPoint)      = thermalconductivities[0];
   ThermalCond_ve(iPoint)   = thermalconductivities[1];
 
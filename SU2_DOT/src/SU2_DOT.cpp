@@ -46,6 +46,8 @@ int main(int argc, char *argv[]) {
 #endif
   SU2_MPI::Comm MPICommunicator(MPI_COMM_WORLD);
 
+  AD::Initialize();
+
   const int rank = SU2_MPI::GetRank();
   const int size = SU2_MPI::GetSize();
 
@@ -402,6 +404,8 @@ int main(int argc, char *argv[]) {
   if (rank == MASTER_NODE)
     cout << "\n------------------------- Exit Success (SU2_DOT) ------------------------\n" << endl;
 
+  AD::Finalize();
+
   /*--- Finalize MPI parallelization ---*/
   SU2_MPI::Finalize();
 
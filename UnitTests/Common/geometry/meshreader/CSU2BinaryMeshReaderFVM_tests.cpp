@@ -0,0 +1,182 @@
+/*!
+ * \file CSU2BinaryMeshReaderFVM_tests.cpp
+ * \brief Round trip of the native SU2 binary mesh format (writer and reader).
+ * \author SU2 Developers
+ * \version 7.1.0 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <cstdio>
+#include <fstream>
+#include "../../../../Common/include/geometry/CPhysicalGeometry.hpp"
+#include "../../../../Common/include/geometry/meshreader/CSU2ASCIIMeshReaderFVM.hpp"
+#include "../../../../Common/include/geometry/meshreader/CSU2BinaryMeshReaderFVM.hpp"
+#include "../../../../SU2_CFD/include/output/filewriter/CFVMDataSorter.hpp"
+#include "../../../../SU2_CFD/include/output/filewriter/CSU2BinaryMeshFileWriter.hpp"
+
+namespace {
+
+/*--- 4x3 points, 3x2 quadrilaterals, the upper marker also has a vertex element. ---*/
+const unsigned long nPointX = 4, nPointY = 3;
+
+void WriteASCIIMesh(const string& fileName) {
+  ofstream file(fileName);
+  file.precision(17);
+  file << "NDIME= 2\n";
+  file << "NELEM= " << (nPointX-1)*(nPointY-1) << "\n";
+  unsigned long iElem = 0;
+  for (auto j = 0ul; j < nPointY-1; ++j)
+    for (auto i = 0ul; i < nPointX-1; ++i, ++iElem)
+      file << QUADRILATERAL << "\t" << i+j*nPointX << "\t" << i+1+j*nPointX << "\t"
+           << i+1+(j+1)*nPointX << "\t" << i+(j+1)*nPointX << "\t" << iElem << "\n";
+  file << "NPOIN= " << nPointX*nPointY << "\n";
+  for (auto j = 0ul; j < nPointY; ++j)
+    for (auto i = 0ul; i < nPointX; ++i)
+      file << 0.3*i << "\t" << 0.1*j*j << "\t" << i+j*nPointX << "\n";
+  file << "NMARK= 2\n";
+  file << "MARKER_TAG= lower\nMARKER_ELEMS= " << nPointX-1 << "\n";
+  for (auto i = 0ul; i < nPointX-1; ++i) file << LINE << "\t" << i << "\t" << i+1 << "\n";
+  file << "MARKER_TAG= upper\nMARKER_ELEMS= " << nPointX << "\n";
+  const auto offset = (nPointY-1)*nPointX;
+  for (auto i = 0ul; i < nPointX-1; ++i) file << LINE << "\t" << offset+i+1 << "\t" << offset+i << "\n";
+  file << VERTEX << "\t" << offset << "\n";
+}
+
+/*--- The boundary file written by SU2_DEF, read by the mesh writers. ---*/
+void WriteBoundaryFile(const string& fileName) {
+  ofstream file(fileName);
+  file << "NMARK= 2\n";
+  file << "MARKER_TAG= lower\nMARKER_ELEMS= " << nPointX-1 << "\nSEND_TO= 0\n";
+  for (auto i = 0ul; i < nPointX-1; ++i) file << LINE << "\t" << i << "\t" << i+1 << "\t" << i << "\n";
+  file << "MARKER_TAG= upper\nMARKER_ELEMS= " << nPointX << "\nSEND_TO= 0\n";
+  const auto offset = (nPointY-1)*nPointX;
+  for (auto i = 0ul; i < nPointX-1; ++i) file << LINE << "\t" << offset+i+1 << "\t" << offset+i << "\t" << i << "\n";
+  file << VERTEX << "\t" << offset << "\t" << 0 << "\t" << nPointX-1 << "\n";
+}
+
+std::unique_ptr<CConfig> MakeConfig(const string& meshFormat, const string& meshFile) {
+  stringstream ss("SOLVER= EULER\n"
+                  "MARKER_EULER= (lower, upper)\n"
+                  "MESH_FORMAT= " + meshFormat + "\n"
+                  "MESH_FILENAME= " + meshFile + "\n");
+  return std::unique_ptr<CConfig>(new CConfig(ss, SU2_CFD, false));
+}
+
+/*--- Number of nodes of the element types in the grids of this test. ---*/
+unsigned short nNodes(unsigned long vtkType) {
+  switch (vtkType) {
+    case LINE: return N_POINTS_LINE;
+    case QUADRILATERAL: return N_POINTS_QUADRILATERAL;
+    default: return 0;
+  }
+}
+
+/*--- Compare [globalID vtkType n0 ... n7] lists, the padding of the ASCII reader is not defined. ---*/
+void CheckConnectivity(const vector<unsigned long>& ref, const vector<unsigned long>& conn, bool checkID) {
+  REQUIRE(conn.size() == ref.size());
+  for (auto k = 0ul; k < ref.size(); k += SU2_CONN_SIZE) {
+    if (checkID) CHECK(conn[k] == ref[k]);
+    CHECK(conn[k+1] == ref[k+1]);
+    for (auto iNode = 0u; iNode < nNodes(ref[k+1]); ++iNode)
+      CHECK(conn[k+SU2_CONN_SKIP+iNode] == ref[k+SU2_CONN_SKIP+iNode]);
+  }
+}
+
+}
+
+TEST_CASE("SU2 binary mesh round trip", "[MeshReader]") {
+
+  const string asciiFile = "binary_roundtrip.su2", binaryName = "binary_roundtrip";
+  const string binaryFile = binaryName + CSU2BinaryMeshFileWriter::fileExt;
+
+  auto origBuf = cout.rdbuf();
+  cout.rdbuf(nullptr);
+
+  if (SU2_MPI::GetRank() == MASTER_NODE) {
+    WriteASCIIMesh(asciiFile);
+    WriteBoundaryFile("boundary.dat");
+  }
+  SU2_MPI::Barrier(MPI_COMM_WORLD);
+
+  /*--- Write the binary mesh from the ASCII grid, as SU2_DEF does. ---*/
+  auto config = MakeConfig("SU2", asciiFile);
+  {
+    std::unique_ptr<CGeometry> geometry;
+    {
+      auto aux_geometry = std::unique_ptr<CGeometry>(new CPhysicalGeometry(config.get(), 0, 1));
+      geometry = std::unique_ptr<CGeometry>(new CPhysicalGeometry(aux_geometry.get(), config.get()));
+    }
+    geometry->SetSendReceive(config.get());
+    geometry->SetBoundaries(config.get());
+    geometry->SetPoint_Connectivity();
+    geometry->SetVertex(config.get());
+    geometry->SetGlobal_to_Local_Point();
+
+    const vector<string> fieldNames = {"x", "y"};
+    CFVMDataSorter sorter(config.get(), geometry.get(), fieldNames);
+    for (auto iPoint = 0ul; iPoint < geometry->GetnPointDomain(); ++iPoint)
+      for (auto iDim = 0u; iDim < 2; ++iDim)
+        sorter.SetUnsorted_Data(iPoint, iDim, geometry->nodes->GetCoord(iPoint, iDim));
+    sorter.SortOutputData();
+    sorter.SortConnectivity(config.get(), geometry.get(), true);
+
+    CSU2BinaryMeshFileWriter writer(binaryName, &sorter, 0, 1);
+    writer.Write_Data();
+  }
+
+  /*--- Read both grids, they must give the same partitions. ---*/
+  auto binaryConfig = MakeConfig("SU2_BINARY", binaryFile);
+  CSU2ASCIIMeshReaderFVM ascii(config.get(), 0, 1);
+  CSU2BinaryMeshReaderFVM binary(binaryConfig.get(), 0, 1);
+
+  cout.rdbuf(origBuf);
+
+  REQUIRE(binary.GetDimension() == ascii.GetDimension());
+  REQUIRE(binary.GetNumberOfGlobalPoints() == ascii.GetNumberOfGlobalPoints());
+  REQUIRE(binary.GetNumberOfGlobalElements() == ascii.GetNumberOfGlobalElements());
+  REQUIRE(binary.GetNumberOfLocalPoints() == ascii.GetNumberOfLocalPoints());
+
+  for (auto iDim = 0u; iDim < ascii.GetDimension(); ++iDim) {
+    const auto& ref = ascii.GetLocalPointCoordinates()[iDim];
+    const auto& coord = binary.GetLocalPointCoordinates()[iDim];
+    for (auto iPoint = 0ul; iPoint < ascii.GetNumberOfLocalPoints(); ++iPoint)
+      CHECK(coord[iPoint] == ref[iPoint]);
+  }
+
+  CheckConnectivity(ascii.GetLocalVolumeElementConnectivity(), binary.GetLocalVolumeElementConnectivity(), true);
+
+  /*--- The markers are only stored by the master, the vertex element is skipped by both readers. ---*/
+  REQUIRE(binary.GetNumberOfMarkers() == ascii.GetNumberOfMarkers());
+  if (SU2_MPI::GetRank() == MASTER_NODE) {
+    for (auto iMarker = 0ul; iMarker < ascii.GetNumberOfMarkers(); ++iMarker) {
+      CHECK(binary.GetMarkerNames()[iMarker] == ascii.GetMarkerNames()[iMarker]);
+      CheckConnectivity(ascii.GetSurfaceElementConnectivityForMarker(iMarker),
+                        binary.GetSurfaceElementConnectivityForMarker(iMarker), false);
+    }
+    CHECK(binary.GetNumberOfSurfaceElementsForMarker(1) == nPointX-1);
+
+    remove(asciiFile.c_str());
+    remove(binaryFile.c_str());
+    remove("boundary.dat");
+  }
+}
@@ -0,0 +1,149 @@
+/*!
+ * \file CVolumetricMovement_tests.cpp
+ * \brief Unit tests for the linear elasticity mesh deformation.
+ * \author SU2 Developers
+ * \version 7.1.0 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include "../../UnitQuadTestCase.hpp"
+#include "../../../Common/include/grid_movement/CVolumetricMovement.hpp"
+
+/*!
+ * \brief Square grid whose boundaries are all moved by the volumetric (linear elasticity) deformation.
+ */
+struct DeformingSquare : UnitQuadTestCase {
+  std::unique_ptr<CVolumetricMovement> movement;
+
+  explicit DeformingSquare(unsigned long nNonlinearIter, unsigned long nPointsPerSide = 9) :
+    UnitQuadTestCase(
+      "SOLVER= EULER\n"
+      "MARKER_EULER= (x_minus, x_plus, y_minus, y_plus)\n"
+      "TIME_DOMAIN= YES\n"
+      "TIME_MARCHING= DUAL_TIME_STEPPING-2ND_ORDER\n"
+      "TIME_STEP= 1e-3\n"
+      "SURFACE_MOVEMENT= (EXTERNAL, EXTERNAL, EXTERNAL, EXTERNAL)\n"
+      "MARKER_MOVING= (x_minus, x_plus, y_minus, y_plus)\n"
+      "DEFORM_NONLINEAR_ITER= " + to_string(nNonlinearIter) + "\n"
+      "DEFORM_STIFFNESS_TYPE= INVERSE_VOLUME\n"
+      "DEFORM_LINEAR_SOLVER= FGMRES\n"
+      "DEFORM_LINEAR_SOLVER_PREC= ILU\n"
+      "DEFORM_LINEAR_SOLVER_ERROR= 1e-14\n"
+      "MESH_FORMAT= RECTANGLE\n"
+      "MESH_BOX_SIZE= " + to_string(nPointsPerSide) + "," + to_string(nPointsPerSide) + ",0\n"
+      "MESH_BOX_LENGTH= 1,1,0\n"
+      "MESH_BOX_OFFSET= 0,0,0\n") {
+
+    InitConfig();
+    InitGeometry();
+
+    movement = std::unique_ptr<CVolumetricMovement>(new CVolumetricMovement(geometry.get(), config.get()));
+  }
+
+  /*!
+   * \brief Set the displacement of the boundary points as a function of their coordinates.
+   */
+  template<class F>
+  void setBoundaryDisplacement(const F& displacement) {
+    for (auto iMarker = 0u; iMarker < config->GetnMarker_All(); ++iMarker) {
+      for (auto iVertex = 0ul; iVertex < geometry->nVertex[iMarker]; ++iVertex) {
+        const auto iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        su2double delta[3] = {0.0};
+        displacement(geometry->nodes->GetCoord(iPoint), delta);
+        geometry->vertex[iMarker][iVertex]->SetVarCoord(delta);
+      }
+    }
+  }
+
+  void deform() {
+    cout.rdbuf(nullptr);
+    movement->SetVolume_Deformation(geometry.get(), config.get(), false);
+    cout.rdbuf(orig_buf);
+  }
+};
+
+TEST_CASE("Incremental deformation of a rigid translation", "[GridMovement]") {
+  DeformingSquare square(3);
+
+  const su2double shift[] = {0.1, -0.05};
+  square.setBoundaryDisplacement([&](const su2double*, su2double* delta) {
+    delta[0] = shift[0];
+    delta[1] = shift[1];
+  });
+
+  const auto nPoint = square.geometry->GetnPoint();
+  vector<su2double> coord0(2*nPoint);
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint)
+    for (auto iDim = 0u; iDim < 2; ++iDim)
+      coord0[2*iPoint+iDim] = square.geometry->nodes->GetCoord(iPoint, iDim);
+
+  square.deform();
+
+  /*--- A rigid translation does not strain the grid, the interior follows the boundaries exactly. ---*/
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+    for (auto iDim = 0u; iDim < 2; ++iDim) {
+      const auto ref = SU2_TYPE::GetValue(coord0[2*iPoint+iDim] + shift[iDim]);
+      CHECK(SU2_TYPE::GetValue(square.geometry->nodes->GetCoord(iPoint, iDim)) == Approx(ref).margin(1e-10));
+    }
+  }
+}
+
+TEST_CASE("Incremental deformation serial vs threaded", "[GridMovement]") {
+  /*--- Several increments to lag the preconditioner, the upper side is bent and the others sheared. ---*/
+  const unsigned long nNonlinearIter = 4, nPointsPerSide = 17;
+
+  auto displacement = [](const su2double* coord, su2double* delta) {
+    delta[0] = 0.05 * coord[1];
+    delta[1] = 0.2 * sin(PI_NUMBER * coord[0]) * coord[1];
+  };
+
+  const auto nThreads = omp_get_max_threads();
+
+  omp_set_num_threads(1);
+  DeformingSquare serial(nNonlinearIter, nPointsPerSide);
+  serial.setBoundaryDisplacement(displacement);
+  serial.deform();
+
+  omp_set_num_threads(nThreads);
+  DeformingSquare threaded(nNonlinearIter, nPointsPerSide);
+  threaded.setBoundaryDisplacement(displacement);
+  threaded.deform();
+
+  /*--- Both converged, to the tolerance of the linear solver. ---*/
+  CHECK(serial.movement->Get_nIterMesh() < serial.config->GetDeform_Linear_Solver_Iter());
+  CHECK(threaded.movement->Get_nIterMesh() < threaded.config->GetDeform_Linear_Solver_Iter());
+
+  su2double maxDisp = 0.0;
+  DeformingSquare reference(1, nPointsPerSide);
+
+  for (auto iPoint = 0ul; iPoint < serial.geometry->GetnPoint(); ++iPoint) {
+    for (auto iDim = 0u; iDim < 2; ++iDim) {
+      const auto ref = SU2_TYPE::GetValue(serial.geometry->nodes->GetCoord(iPoint, iDim));
+      CHECK(SU2_TYPE::GetValue(threaded.geometry->nodes->GetCoord(iPoint, iDim)) == Approx(ref).margin(1e-10));
+      maxDisp = max(maxDisp, su2double(fabs(ref - reference.geometry->nodes->GetCoord(iPoint, iDim))));
+    }
+  }
+
+  /*--- The deformation is not trivial. ---*/
+  CHECK(maxDisp > 0.05);
+}
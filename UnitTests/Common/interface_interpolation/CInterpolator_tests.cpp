@@ -0,0 +1,146 @@
+/*!
+ * \file CInterpolator_tests.cpp
+ * \brief Unit tests for the distributed donor search of the interface interpolators.
+ * \author SU2 Developers
+ * \version 7.1.0 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <map>
+#include "../../../Common/include/geometry/CPhysicalGeometry.hpp"
+#include "../../../Common/include/interface_interpolation/CNearestNeighbor.hpp"
+#include "../../../Common/include/interface_interpolation/CIsoparametric.hpp"
+#include "../../../Common/include/interface_interpolation/CRadialBasisFunction.hpp"
+
+/*!
+ * \brief Two box zones whose lower (planar) sides form the interface, the grids do not match and the
+ *        donor side extends beyond the target side, so that some donors are not near any target.
+ */
+struct DonorSearchInterface {
+  std::unique_ptr<CConfig> config[2];
+  std::unique_ptr<CGeometry> geometry[2];
+
+  explicit DonorSearchInterface(bool distributed) {
+    auto origBuf = cout.rdbuf();
+    cout.rdbuf(nullptr);
+
+    const string boxSize[] = {"13,11,2", "7,8,2"};
+    const string boxLength[] = {"1.6,1.4,0.2", "1,1,0.2"};
+    const string boxOffset[] = {"-0.3,-0.2,0.1", "0.03,-0.02,0.1"};
+
+    for (int iZone = 0; iZone < 2; ++iZone) {
+      stringstream ss(
+        "SOLVER= EULER\n"
+        "MARKER_EULER= (x_minus, x_plus, y_minus, y_plus, z_minus, z_plus)\n"
+        "MARKER_ZONE_INTERFACE= (z_minus, z_minus)\n"
+        "NUM_NEAREST_NEIGHBORS= 3\n"
+        "KIND_RADIAL_BASIS_FUNCTION= WENDLAND_C2\n"
+        "RADIAL_BASIS_FUNCTION_PARAMETER= 0.4\n"
+        "DISTRIBUTED_DONOR_SEARCH= " + string(distributed? "YES" : "NO") + "\n"
+        "MESH_FORMAT= BOX\n"
+        "MESH_BOX_SIZE= " + boxSize[iZone] + "\n"
+        "MESH_BOX_LENGTH= " + boxLength[iZone] + "\n"
+        "MESH_BOX_OFFSET= " + boxOffset[iZone] + "\n");
+      config[iZone] = std::unique_ptr<CConfig>(new CConfig(ss, SU2_CFD, false));
+
+      auto cfg = config[iZone].get();
+      {
+        auto aux_geometry = std::unique_ptr<CGeometry>(new CPhysicalGeometry(cfg, 0, 1));
+        geometry[iZone] = std::unique_ptr<CGeometry>(new CPhysicalGeometry(aux_geometry.get(), cfg));
+      }
+      auto geo = geometry[iZone].get();
+      geo->SetSendReceive(cfg);
+      geo->SetBoundaries(cfg);
+      geo->SetPoint_Connectivity();
+      geo->SetElement_Connectivity();
+      geo->SetBoundVolume();
+      geo->SetEdges();
+      geo->SetVertex(cfg);
+      geo->SetControlVolume(cfg, ALLOCATE);
+      geo->SetBoundControlVolume(cfg, ALLOCATE);
+      geo->SetGlobal_to_Local_Point();
+    }
+
+    cout.rdbuf(origBuf);
+  }
+
+  /*!
+   * \brief Interpolation coefficients from zone 0 to zone 1, per target vertex, indexed by the global donor point.
+   */
+  template<class Interpolator>
+  vector<map<long, passivedouble> > coefficients() {
+    CGeometry* meshes[2] = {geometry[0].get(), geometry[1].get()};
+    CGeometry** instances[2] = {&meshes[0], &meshes[1]};
+    CGeometry*** zones[2] = {&instances[0], &instances[1]};
+    const CConfig* configs[2] = {config[0].get(), config[1].get()};
+
+    auto origBuf = cout.rdbuf();
+    cout.rdbuf(nullptr);
+    Interpolator interpolator(zones, configs, 0, 1);
+    cout.rdbuf(origBuf);
+
+    const auto markTarget = config[1]->FindInterfaceMarker(0);
+    const auto& targets = interpolator.targetVertices[markTarget];
+
+    vector<map<long, passivedouble> > coeffs(targets.size());
+    for (auto iVertex = 0ul; iVertex < targets.size(); ++iVertex)
+      for (auto iDonor = 0ul; iDonor < targets[iVertex].nDonor(); ++iDonor)
+        coeffs[iVertex][targets[iVertex].globalPoint[iDonor]] += SU2_TYPE::GetValue(targets[iVertex].coefficient[iDonor]);
+    return coeffs;
+  }
+};
+
+/*!
+ * \brief The distributed search must find the same donors, with the same coefficients, as the global one.
+ */
+template<class Interpolator>
+void CompareDonorSearch() {
+  const auto global = DonorSearchInterface(false).coefficients<Interpolator>();
+  const auto distributed = DonorSearchInterface(true).coefficients<Interpolator>();
+
+  REQUIRE(!global.empty());
+  REQUIRE(distributed.size() == global.size());
+
+  for (auto iVertex = 0ul; iVertex < global.size(); ++iVertex) {
+    REQUIRE(!global[iVertex].empty());
+    REQUIRE(distributed[iVertex].size() == global[iVertex].size());
+
+    for (const auto& donor : global[iVertex]) {
+      const auto it = distributed[iVertex].find(donor.first);
+      REQUIRE(it != distributed[iVertex].end());
+      CHECK(it->second == Approx(donor.second).margin(1e-10));
+    }
+  }
+}
+
+TEST_CASE("Distributed vs global donor search, nearest neighbor", "[Interpolation]") {
+  CompareDonorSearch<CNearestNeighbor>();
+}
+
+TEST_CASE("Distributed vs global donor search, isoparametric", "[Interpolation]") {
+  CompareDonorSearch<CIsoparametric>();
+}
+
+TEST_CASE("Distributed vs global donor search, radial basis function", "[Interpolation]") {
+  CompareDonorSearch<CRadialBasisFunction>();
+}
@@ -0,0 +1,183 @@
+/*!
+ * \file CRadialBasisFunction_tests.cpp
+ * \brief Unit tests for the radial basis function interpolation.
+ * \author SU2 Developers
+ * \version 7.1.0 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <map>
+#include "../../../Common/include/geometry/CPhysicalGeometry.hpp"
+#include "../../../Common/include/interface_interpolation/CRadialBasisFunction.hpp"
+#include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
+
+/*!
+ * \brief Two box zones whose lower (planar) sides form the interface, the grids do not match.
+ * \note The interface plane does not contain the origin, the plane detection of the polynomial term requires it.
+ */
+struct RBFInterface {
+  std::unique_ptr<CConfig> config[2];
+  std::unique_ptr<CGeometry> geometry[2];
+
+  RBFInterface(bool usePolynomial, bool sparse, const string& pruneTol = "0.0") {
+    auto origBuf = cout.rdbuf();
+    cout.rdbuf(nullptr);
+
+    const string boxSize[] = {"9,9,2", "7,8,2"};
+    const string boxOffset[] = {"0,0,0.1", "0.03,-0.02,0.1"};
+
+    for (int iZone = 0; iZone < 2; ++iZone) {
+      stringstream ss(
+        "SOLVER= EULER\n"
+        "MARKER_EULER= (x_minus, x_plus, y_minus, y_plus, z_minus, z_plus)\n"
+        "MARKER_ZONE_INTERFACE= (z_minus, z_minus)\n"
+        "KIND_INTERPOLATION= RADIAL_BASIS_FUNCTION\n"
+        "KIND_RADIAL_BASIS_FUNCTION= WENDLAND_C2\n"
+        "RADIAL_BASIS_FUNCTION_PARAMETER= 0.4\n"
+        "RADIAL_BASIS_FUNCTION_PRUNE_TOLERANCE= " + pruneTol + "\n"
+        "RADIAL_BASIS_FUNCTION_POLYNOMIAL_TERM= " + string(usePolynomial? "YES" : "NO") + "\n"
+        "RADIAL_BASIS_FUNCTION_SPARSE= " + string(sparse? "YES" : "NO") + "\n"
+        "MESH_FORMAT= BOX\n"
+        "MESH_BOX_SIZE= " + boxSize[iZone] + "\n"
+        "MESH_BOX_LENGTH= 1,1,0.2\n"
+        "MESH_BOX_OFFSET= " + boxOffset[iZone] + "\n");
+      config[iZone] = std::unique_ptr<CConfig>(new CConfig(ss, SU2_CFD, false));
+
+      auto cfg = config[iZone].get();
+      {
+        auto aux_geometry = std::unique_ptr<CGeometry>(new CPhysicalGeometry(cfg, 0, 1));
+        geometry[iZone] = std::unique_ptr<CGeometry>(new CPhysicalGeometry(aux_geometry.get(), cfg));
+      }
+      geometry[iZone]->SetSendReceive(cfg);
+      geometry[iZone]->SetBoundaries(cfg);
+      geometry[iZone]->SetPoint_Connectivity();
+      geometry[iZone]->SetVertex(cfg);
+      geometry[iZone]->SetGlobal_to_Local_Point();
+    }
+
+    cout.rdbuf(origBuf);
+  }
+
+  /*!
+   * \brief Interpolation coefficients from zone 0 to zone 1, per target vertex, indexed by the global donor point.
+   */
+  vector<map<unsigned long, passivedouble> > coefficients() {
+    CGeometry* meshes[2] = {geometry[0].get(), geometry[1].get()};
+    CGeometry** instances[2] = {&meshes[0], &meshes[1]};
+    CGeometry*** zones[2] = {&instances[0], &instances[1]};
+    const CConfig* configs[2] = {config[0].get(), config[1].get()};
+
+    CRadialBasisFunction interpolator(zones, configs, 0, 1);
+
+    const auto markTarget = config[1]->FindInterfaceMarker(0);
+    const auto& targets = interpolator.targetVertices[markTarget];
+
+    vector<map<unsigned long, passivedouble> > coeffs(targets.size());
+    for (auto iVertex = 0ul; iVertex < targets.size(); ++iVertex)
+      for (auto iDonor = 0ul; iDonor < targets[iVertex].nDonor(); ++iDonor)
+        coeffs[iVertex][targets[iVertex].globalPoint[iDonor]] = SU2_TYPE::GetValue(targets[iVertex].coefficient[iDonor]);
+    return coeffs;
+  }
+};
+
+TEST_CASE("Sparse RBF interpolation vs dense", "[Interpolation]") {
+
+  /*--- With pruning, the sparse method skips the (polynomial) coefficients that would be pruned. ---*/
+  for (const auto& options : vector<pair<bool,string> >{{false, "0.0"}, {true, "0.0"}, {true, "1e-3"}}) {
+
+    const bool usePolynomial = options.first;
+    INFO("Polynomial term: " << usePolynomial << ", pruning tolerance: " << options.second);
+
+    const auto dense = RBFInterface(usePolynomial, false, options.second).coefficients();
+    const auto sparse = RBFInterface(usePolynomial, true, options.second).coefficients();
+
+    REQUIRE(sparse.size() == dense.size());
+    REQUIRE(!dense.empty());
+
+    for (auto iVertex = 0ul; iVertex < dense.size(); ++iVertex) {
+      /*--- The sparse method drops the coefficients that are exactly zero. ---*/
+      CHECK(sparse[iVertex].size() <= dense[iVertex].size());
+
+      passivedouble sum = 0.0;
+      for (const auto& donor : dense[iVertex]) {
+        const auto it = sparse[iVertex].find(donor.first);
+        const auto coeff = (it != sparse[iVertex].end())? it->second : 0.0;
+        CHECK(coeff == Approx(donor.second).margin(1e-7));
+        sum += coeff;
+      }
+      CHECK(sum == Approx(1.0));
+    }
+  }
+}
+
+TEST_CASE("RBF generator matrix of planar donors", "[Interpolation]") {
+  /*--- Donors on an inclined plane that does not contain the origin, one polynomial term is removed. ---*/
+  const int nSide = 6, nDonor = nSide*nSide, nDim = 3;
+  const su2double radius = 2.0;
+
+  auto plane = [](su2double x, su2double y, su2double* coord) {
+    coord[0] = x; coord[1] = y; coord[2] = 0.1 + 0.3*x - 0.2*y;
+  };
+  auto linear = [](const su2double* coord) { return 1.0 + 2.0*coord[0] - coord[1] + 0.5*coord[2]; };
+
+  su2activematrix coords(nDonor, nDim);
+  for (int i = 0; i < nSide; ++i)
+    for (int j = 0; j < nSide; ++j)
+      plane(i/(nSide-1.0), j/(nSide-1.0) + 0.05*i, coords[i*nSide+j]);
+
+  int nPolynomial = -1;
+  vector<int> keepPolynomialRow;
+  su2passivematrix C_inv_trunc;
+  CRadialBasisFunction::ComputeGeneratorMatrix(WENDLAND_C2, true, radius, coords, nPolynomial,
+                                               keepPolynomialRow, C_inv_trunc);
+
+  REQUIRE(nPolynomial == nDim-1);
+  REQUIRE(count(keepPolynomialRow.begin(), keepPolynomialRow.end(), 0) == 1);
+  REQUIRE(C_inv_trunc.rows() == 1ul+nPolynomial+nDonor);
+  REQUIRE(C_inv_trunc.cols() == static_cast<unsigned long>(nDonor));
+
+  /*--- Interpolate a linear function to points of the plane, which is exact with the polynomial term. ---*/
+  for (const auto& target : vector<pair<su2double,su2double> >{{0.33, 0.41}, {0.9, 0.12}, {0.05, 0.77}}) {
+    su2double coordTarget[nDim];
+    plane(target.first, target.second, coordTarget);
+
+    vector<passivedouble> func(C_inv_trunc.rows());
+    func[0] = 1.0;
+    for (int iDim = 0, idx = 1; iDim < nDim; ++iDim)
+      if (keepPolynomialRow[iDim]) func[idx++] = SU2_TYPE::GetValue(coordTarget[iDim]);
+    for (int iDonor = 0; iDonor < nDonor; ++iDonor) {
+      const auto dist = GeometryToolbox::Distance(nDim, coordTarget, coords[iDonor]);
+      func[1+nPolynomial+iDonor] = SU2_TYPE::GetValue(CRadialBasisFunction::Get_RadialBasisValue(WENDLAND_C2, radius, dist));
+    }
+
+    passivedouble sum = 0.0, value = 0.0;
+    for (int iDonor = 0; iDonor < nDonor; ++iDonor) {
+      passivedouble coeff = 0.0;
+      for (auto k = 0ul; k < func.size(); ++k) coeff += func[k] * C_inv_trunc(k, iDonor);
+      sum += coeff;
+      value += coeff * SU2_TYPE::GetValue(linear(coords[iDonor]));
+    }
+    CHECK(sum == Approx(1.0));
+    CHECK(value == Approx(SU2_TYPE::GetValue(linear(coordTarget))));
+  }
+}
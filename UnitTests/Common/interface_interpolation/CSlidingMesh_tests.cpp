@@ -0,0 +1,238 @@
+/*!
+ * \file CSlidingMesh_tests.cpp
+ * \brief Unit tests for the sliding mesh interpolation.
+ * \author SU2 Developers
+ * \version 7.1.0 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <map>
+#include <array>
+#include <cstdio>
+#include <fstream>
+#include "../../../Common/include/geometry/CPhysicalGeometry.hpp"
+#include "../../../Common/include/interface_interpolation/CSlidingMesh.hpp"
+
+/*!
+ * \brief Write a box of prisms (one layer in z), such that its z_minus and z_plus sides are triangulated.
+ * \note The supermesh of 3D interfaces is built from the triangles formed by the linked boundary nodes.
+ */
+void WritePrismMesh(const string& fileName, int nx, int ny, passivedouble x0, passivedouble y0,
+                    passivedouble lx, passivedouble ly) {
+  auto node = [&](int i, int j, int k) { return k*(nx+1)*(ny+1) + j*(nx+1) + i; };
+
+  ofstream mesh(fileName);
+  mesh << "NDIME= 3\nNELEM= " << 2*nx*ny << "\n";
+  int iElem = 0;
+  for (int j = 0; j < ny; ++j) {
+    for (int i = 0; i < nx; ++i) {
+      const int quad[] = {node(i,j,0), node(i+1,j,0), node(i+1,j+1,0), node(i,j+1,0)};
+      const int nLayer = (nx+1)*(ny+1);
+      for (const auto& tri : {array<int,3>{{quad[0], quad[1], quad[2]}}, array<int,3>{{quad[0], quad[2], quad[3]}}})
+        mesh << "13 " << tri[0] << " " << tri[1] << " " << tri[2] << " "
+             << tri[0]+nLayer << " " << tri[1]+nLayer << " " << tri[2]+nLayer << " " << iElem++ << "\n";
+    }
+  }
+  mesh << "NPOIN= " << 2*(nx+1)*(ny+1) << "\n";
+  for (int k = 0; k < 2; ++k)
+    for (int j = 0; j <= ny; ++j)
+      for (int i = 0; i <= nx; ++i)
+        mesh << x0 + lx*i/nx << " " << y0 + ly*j/ny << " " << 0.2*k << " " << node(i,j,k) << "\n";
+
+  mesh << "NMARK= 3\n";
+  for (int k = 0; k < 2; ++k) {
+    mesh << "MARKER_TAG= " << (k? "z_plus" : "z_minus") << "\nMARKER_ELEMS= " << 2*nx*ny << "\n";
+    for (int j = 0; j < ny; ++j) {
+      for (int i = 0; i < nx; ++i) {
+        mesh << "5 " << node(i,j,k) << " " << node(i+1,j,k) << " " << node(i+1,j+1,k) << "\n";
+        mesh << "5 " << node(i,j,k) << " " << node(i+1,j+1,k) << " " << node(i,j+1,k) << "\n";
+      }
+    }
+  }
+  mesh << "MARKER_TAG= sides\nMARKER_ELEMS= " << 2*(nx+ny) << "\n";
+  for (int i = 0; i < nx; ++i) {
+    mesh << "9 " << node(i,0,0) << " " << node(i+1,0,0) << " " << node(i+1,0,1) << " " << node(i,0,1) << "\n";
+    mesh << "9 " << node(i,ny,0) << " " << node(i+1,ny,0) << " " << node(i+1,ny,1) << " " << node(i,ny,1) << "\n";
+  }
+  for (int j = 0; j < ny; ++j) {
+    mesh << "9 " << node(0,j,0) << " " << node(0,j+1,0) << " " << node(0,j+1,1) << " " << node(0,j,1) << "\n";
+    mesh << "9 " << node(nx,j,0) << " " << node(nx,j+1,0) << " " << node(nx,j+1,1) << " " << node(nx,j,1) << "\n";
+  }
+}
+
+/*!
+ * \brief Two zones touching on their lower side (y_minus in 2D, z_minus in 3D), the grids do not match.
+ *        The donor side (zone 0) is larger than the target side such that it still covers it after sliding.
+ */
+struct SlidingInterface {
+  std::unique_ptr<CConfig> config[2];
+  std::unique_ptr<CGeometry> geometry[2];
+
+  /*--- Zone/instance/mesh container, the interpolators keep a pointer to it. ---*/
+  CGeometry* meshes[2];
+  CGeometry** instances[2] = {&meshes[0], &meshes[1]};
+  CGeometry*** zones[2] = {&instances[0], &instances[1]};
+
+  const string meshFile[2] = {"sliding_test_zone0.su2", "sliding_test_zone1.su2"};
+
+  explicit SlidingInterface(unsigned short nDim) {
+    auto origBuf = cout.rdbuf();
+    cout.rdbuf(nullptr);
+
+    const bool is3D = (nDim == 3);
+    if (is3D) {
+      WritePrismMesh(meshFile[0], 10, 11, -0.2, -0.2, 1.4, 1.4);
+      WritePrismMesh(meshFile[1], 6, 7, 0.0, 0.0, 1.0, 1.0);
+    }
+
+    const string boxSize[] = {"23,2,0", "9,2,0"};
+    const string boxLength[] = {"1.4,0.2,0", "1,0.2,0"};
+    const string boxOffset[] = {"-0.2,0,0", "0,0,0"};
+
+    for (int iZone = 0; iZone < 2; ++iZone) {
+      stringstream ss(
+        "SOLVER= EULER\n" +
+        (is3D? "MARKER_EULER= (sides, z_minus, z_plus)\n"
+               "MARKER_ZONE_INTERFACE= (z_minus, z_minus)\n"
+               "MESH_FORMAT= SU2\n"
+               "MESH_FILENAME= " + meshFile[iZone] + "\n"
+             : "MARKER_EULER= (x_minus, x_plus, y_minus, y_plus)\n"
+               "MARKER_ZONE_INTERFACE= (y_minus, y_minus)\n"
+               "MESH_FORMAT= RECTANGLE\n"
+               "MESH_BOX_SIZE= " + boxSize[iZone] + "\n"
+               "MESH_BOX_LENGTH= " + boxLength[iZone] + "\n"
+               "MESH_BOX_OFFSET= " + boxOffset[iZone] + "\n"));
+      config[iZone] = std::unique_ptr<CConfig>(new CConfig(ss, SU2_CFD, false));
+
+      auto cfg = config[iZone].get();
+      {
+        auto aux_geometry = std::unique_ptr<CGeometry>(new CPhysicalGeometry(cfg, 0, 1));
+        geometry[iZone] = std::unique_ptr<CGeometry>(new CPhysicalGeometry(aux_geometry.get(), cfg));
+      }
+      auto geo = geometry[iZone].get();
+      geo->SetSendReceive(cfg);
+      geo->SetBoundaries(cfg);
+      geo->SetPoint_Connectivity();
+      geo->SetElement_Connectivity();
+      geo->SetBoundVolume();
+      geo->Check_IntElem_Orientation(cfg);
+      geo->Check_BoundElem_Orientation(cfg);
+      geo->SetEdges();
+      geo->SetVertex(cfg);
+      geo->SetControlVolume(cfg, ALLOCATE);
+      geo->SetBoundControlVolume(cfg, ALLOCATE);
+      geo->SetGlobal_to_Local_Point();
+      meshes[iZone] = geo;
+    }
+
+    if (is3D) {
+      for (const auto& name : meshFile) std::remove(name.c_str());
+    }
+
+    cout.rdbuf(origBuf);
+  }
+
+  /*!
+   * \brief Slide the donor zone along the interface.
+   */
+  void MoveDonor(const su2double* shift) {
+    auto geo = geometry[0].get();
+    for (auto iPoint = 0ul; iPoint < geo->GetnPoint(); ++iPoint)
+      for (auto iDim = 0u; iDim < geo->GetnDim(); ++iDim)
+        geo->nodes->SetCoord(iPoint, iDim, geo->nodes->GetCoord(iPoint, iDim) + shift[iDim]);
+  }
+
+  /*!
+   * \brief Interpolation coefficients from zone 0 to zone 1, per target vertex, indexed by the global donor point.
+   */
+  vector<map<long, passivedouble> > Coefficients(const CSlidingMesh& interpolator) const {
+    const auto markTarget = config[1]->FindInterfaceMarker(0);
+    const auto& targets = interpolator.targetVertices[markTarget];
+
+    vector<map<long, passivedouble> > coeffs(targets.size());
+    for (auto iVertex = 0ul; iVertex < targets.size(); ++iVertex)
+      for (auto iDonor = 0ul; iDonor < targets[iVertex].nDonor(); ++iDonor)
+        coeffs[iVertex][targets[iVertex].globalPoint[iDonor]] += SU2_TYPE::GetValue(targets[iVertex].coefficient[iDonor]);
+    return coeffs;
+  }
+
+  std::unique_ptr<CSlidingMesh> NewInterpolator() {
+    const CConfig* configs[2] = {config[0].get(), config[1].get()};
+    return std::unique_ptr<CSlidingMesh>(new CSlidingMesh(zones, configs, 0, 1));
+  }
+
+  void Update(CSlidingMesh& interpolator) {
+    const CConfig* configs[2] = {config[0].get(), config[1].get()};
+    interpolator.SetTransferCoeff(configs);
+  }
+};
+
+TEST_CASE("Sliding mesh search from the previous donors", "[Interpolation]") {
+
+  /*--- The first call starts each supermesh from the closest donor, found with a search tree (the same vertex
+   *    as the former brute force search). After sliding, the interpolator updated in place walks from the
+   *    previous donors and re-gathers only the coordinates, it must match a new interpolator. ---*/
+
+  for (unsigned short nDim : {2, 3}) {
+    INFO("nDim: " << nDim);
+
+    SlidingInterface interface(nDim);
+
+    auto updated = interface.NewInterpolator();
+
+    const su2double shifts[][3] = {{0.037, -0.052, 0.0}, {0.061, 0.043, 0.0}};
+
+    for (const auto shift : shifts) {
+      const su2double planeShift[3] = {shift[0], (nDim == 3)? shift[1] : 0.0, 0.0};
+      interface.MoveDonor(planeShift);
+
+      interface.Update(*updated);
+      const auto fresh = interface.NewInterpolator();
+
+      const auto expected = interface.Coefficients(*fresh);
+      const auto actual = interface.Coefficients(*updated);
+
+      REQUIRE(!expected.empty());
+      REQUIRE(actual.size() == expected.size());
+
+      unsigned long nCovered = 0;
+      for (auto iVertex = 0ul; iVertex < expected.size(); ++iVertex) {
+        REQUIRE(actual[iVertex].size() == expected[iVertex].size());
+
+        passivedouble sum = 0.0;
+        for (const auto& donor : expected[iVertex]) {
+          const auto it = actual[iVertex].find(donor.first);
+          REQUIRE(it != actual[iVertex].end());
+          CHECK(it->second == Approx(donor.second).margin(1e-12));
+          sum += donor.second;
+        }
+        /*--- The donor side covers the target side. ---*/
+        if (!expected[iVertex].empty()) {
+          CHECK(sum == Approx(1.0));
+          ++nCovered;
+        }
+      }
+      CHECK(nCovered == expected.size());
+    }
+  }
+}
@@ -0,0 +1,248 @@
+/*!
+ * \file CSysMatrix_tests.cpp
+ * \brief Unit tests for the sparse matrix and its preconditioners.
+ * \author SU2 Developers
+ * \version 7.1.0 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "catch.hpp"
+#include "../../UnitQuadTestCase.hpp"
+#include "../../../Common/include/linear_algebra/CSysMatrix.hpp"
+#include "../../../Common/include/linear_algebra/CSysSolve.hpp"
+#include "../../../Common/include/linear_algebra/CPreconditioner.hpp"
+
+/*!
+ * \brief Block diffusion problem on a unit cube, solved with FGMRES
+ * and the preconditioner given in the options.
+ */
+struct BlockDiffusionProblem : UnitQuadTestCase {
+  static constexpr unsigned long nVar = 2;
+
+  CSysMatrix<su2mixedfloat> matrix;
+  CSysSolve<su2mixedfloat> solver;
+
+  explicit BlockDiffusionProblem(const string& precond, const string& extraOptions = "",
+                                 const string& linSolver = "FGMRES") :
+    UnitQuadTestCase(
+      "SOLVER= NAVIER_STOKES\n"
+      "MESH_FORMAT= BOX\n"
+      "INIT_OPTION= TD_CONDITIONS\n"
+      "MARKER_HEATFLUX= (y_minus, 0.0, y_plus, 0.0)\n"
+      "MARKER_FAR= (x_minus, x_plus, z_plus, z_minus)\n"
+      "MESH_BOX_SIZE= 17,17,17\n"
+      "MESH_BOX_LENGTH= 1,1,1\n"
+      "MESH_BOX_OFFSET= 0,0,0\n"
+      "LINEAR_SOLVER= " + linSolver + "\n"
+      "LINEAR_SOLVER_ERROR= 1e-10\n"
+      "LINEAR_SOLVER_ITER= 200\n"
+      "LINEAR_SOLVER_PREC= " + precond + "\n" + extraOptions) {
+
+    InitConfig();
+    InitGeometry();
+
+    matrix.Initialize(geometry->GetnPoint(), geometry->GetnPointDomain(), nVar, nVar, true, geometry.get(), config.get());
+    assemble(1e-3);
+  }
+
+  /*!
+   * \brief Anisotropic diffusion with coupled variables, plus a "time step" term on the diagonal.
+   */
+  void assemble(su2double diagonal) {
+    const auto nPoint = geometry->GetnPoint();
+
+    /*--- Each thread zeroes its part of the matrix. ---*/
+    SU2_OMP_PARALLEL
+    matrix.SetValZero();
+
+    const su2double coupling[nVar][nVar] = {{1.0, 0.2}, {-0.1, 1.0}};
+    su2double block_i[nVar][nVar], block_j[nVar][nVar];
+    su2double* bi[nVar] = {block_i[0], block_i[1]};
+    su2double* bj[nVar] = {block_j[0], block_j[1]};
+
+    for (auto iEdge = 0ul; iEdge < geometry->GetnEdge(); ++iEdge) {
+      const auto iPoint = geometry->edges->GetNode(iEdge,0);
+      const auto jPoint = geometry->edges->GetNode(iEdge,1);
+      const auto coord_i = geometry->nodes->GetCoord(iPoint);
+      const auto coord_j = geometry->nodes->GetCoord(jPoint);
+      const su2double weight = (fabs(coord_i[0]-coord_j[0]) > 1e-9)? 10.0 : 1.0;
+
+      for (auto iVar = 0ul; iVar < nVar; ++iVar) {
+        for (auto jVar = 0ul; jVar < nVar; ++jVar) {
+          block_i[iVar][jVar] = weight * coupling[iVar][jVar];
+          block_j[iVar][jVar] = -weight * coupling[iVar][jVar];
+        }
+      }
+      matrix.UpdateBlocks(iEdge, iPoint, jPoint, bi, bj);
+    }
+    for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint)
+      matrix.AddVal2Diag(iPoint, diagonal);
+  }
+
+  /*!
+   * \brief Solve for a known solution, return the number of iterations.
+   */
+  unsigned long solve() {
+    const auto nPoint = geometry->GetnPoint();
+    const auto nPointDomain = geometry->GetnPointDomain();
+
+    CSysVector<su2mixedfloat> ref(nPoint, nPointDomain, nVar, 0.0), rhs(ref);
+    for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint)
+      for (auto iVar = 0ul; iVar < nVar; ++iVar)
+        ref(iPoint,iVar) = sin(3.0*iPoint) + iVar;
+
+    matrix.MatrixVectorProduct(ref, rhs, geometry.get(), config.get());
+
+    CSysVector<su2double> b(nPoint, nPointDomain, nVar, 0.0), x(b);
+    for (auto i = 0ul; i < b.GetLocSize(); ++i) b[i] = rhs[i];
+
+    const auto iters = solver.Solve(matrix, b, x, geometry.get(), config.get());
+
+    su2double err = 0.0;
+    for (auto i = 0ul; i < nPointDomain*nVar; ++i)
+      err = max(err, su2double(fabs(x[i]-ref[i])));
+    CHECK(err < 1e-4);
+
+    return iters;
+  }
+};
+
+TEST_CASE("AMG preconditioner", "[LinearAlgebra]") {
+  BlockDiffusionProblem jacobi("JACOBI"), amg("AMG");
+
+  const auto itersJacobi = jacobi.solve();
+  const auto itersAMG = amg.solve();
+
+  /*--- 17^3 points with 2 variables need more than one coarse level to reach the coarse size. ---*/
+  CHECK(amg.matrix.GetnAMGLevels() > 2);
+
+  /*--- Solving again re-uses the hierarchy. ---*/
+  CHECK(amg.solve() == itersAMG);
+
+  CHECK(itersAMG < itersJacobi/2);
+}
+
+TEST_CASE("AMG preconditioner is a snapshot of the matrix", "[LinearAlgebra]") {
+  BlockDiffusionProblem problem("AMG");
+  auto& geometry = *problem.geometry;
+  auto& config = *problem.config;
+  const auto nVar = BlockDiffusionProblem::nVar;
+
+  CSysVector<su2mixedfloat> vec(geometry.GetnPoint(), geometry.GetnPointDomain(), nVar, 0.0), before(vec), after(vec);
+  for (auto i = 0ul; i < vec.GetLocSize(); ++i) vec[i] = cos(2.0*i);
+
+  std::unique_ptr<CPreconditioner<su2mixedfloat> > precond(
+    CPreconditioner<su2mixedfloat>::Create(AMG, problem.matrix, &geometry, &config));
+
+  /*--- Lagged preconditioner, the matrix is assembled again without building it. ---*/
+  precond->Build();
+  (*precond)(vec, before);
+  problem.assemble(1e-1);
+  (*precond)(vec, after);
+
+  for (auto i = 0ul; i < vec.GetLocSize(); ++i)
+    CHECK(after[i] == before[i]);
+
+  /*--- Without the "time step" term the operators are singular (constant null space of each variable),
+   *    the coarsest level is regularized and the preconditioner remains usable. ---*/
+  problem.assemble(0.0);
+  precond->Build();
+  CHECK(problem.matrix.GetnAMGRegularizedPivots() > 0);
+  CHECK(problem.matrix.GetnAMGRegularizedPivots() <= nVar);
+
+  (*precond)(vec, after);
+  for (auto i = 0ul; i < vec.GetLocSize(); ++i)
+    REQUIRE(std::isfinite(SU2_TYPE::GetValue(after[i])));
+}
+
+TEST_CASE("Level-scheduled ILU and LU_SGS", "[LinearAlgebra]") {
+  for (const string precond : {"ILU", "LU_SGS"}) {
+    BlockDiffusionProblem sequential(precond, "LINEAR_SOLVER_PREC_THREADS= 1\n");
+    BlockDiffusionProblem levels(precond, "LINEAR_SOLVER_PREC_SCHEDULE= LEVEL_SCHEDULING\n");
+
+    /*--- The sweeps are the same as in sequential execution, regardless of the number of threads. ---*/
+    CHECK(levels.solve() == sequential.solve());
+  }
+}
+
+TEST_CASE("Pipelined Krylov solvers", "[LinearAlgebra]") {
+  /*--- Level scheduling makes the preconditioner independent of the number of threads. ---*/
+  const string schedule = "LINEAR_SOLVER_PREC_SCHEDULE= LEVEL_SCHEDULING\n";
+  BlockDiffusionProblem fgmres("ILU"), pgmres("ILU", "", "PIPELINED_GMRES");
+  BlockDiffusionProblem bcgstab("ILU", schedule, "BCGSTAB"), pbcgstab("ILU", schedule, "PIPELINED_BCGSTAB");
+
+  /*--- With a fixed preconditioner GMRES builds the same subspace as FGMRES. ---*/
+  CHECK(pgmres.solve() == fgmres.solve());
+
+  /*--- The recurrences of p-BiCGStab are mathematically equivalent but accumulate round-off
+   *    differently, the solution accuracy is checked by solve. ---*/
+  const long itersBCGSTAB = bcgstab.solve();
+  CHECK(std::abs(long(pbcgstab.solve()) - itersBCGSTAB) <= 2);
+}
+
+#ifdef USE_RUNTIME_MIXED_PRECISION
+TEST_CASE("Mixed precision linear solver", "[LinearAlgebra]") {
+  BlockDiffusionProblem full("ILU"), mixed("ILU", "LINEAR_SOLVER_MIXED_PRECISION= YES\n");
+
+  /*--- The refinement reaches the full precision tolerance (checked by solve) with a few more iterations. ---*/
+  const auto itersFull = full.solve();
+  CHECK(mixed.solve() <= 2*itersFull);
+}
+
+TEST_CASE("Mixed precision linear solver refresh and fallback", "[LinearAlgebra]") {
+  /*--- Whether the float solves stall depends on the round-off, i.e. on the number of threads. ---*/
+  const auto nThreads = omp_get_max_threads();
+  omp_set_num_threads(1);
+
+  const string options = "LINEAR_SOLVER_MIXED_PRECISION= YES\n";
+
+  SECTION("The float copy of the matrix is refreshed when the matrix is assembled again") {
+    BlockDiffusionProblem mixed("ILU", options), fresh("ILU", options);
+    mixed.solve();
+
+    const auto version = mixed.matrix.GetValuesVersion();
+    mixed.assemble(1e-2);
+    CHECK(mixed.matrix.GetValuesVersion() > version);
+
+    fresh.assemble(1e-2);
+    CHECK(mixed.solve() == fresh.solve());
+  }
+
+  SECTION("After a stall the full precision solve gets the remaining iterations") {
+    BlockDiffusionProblem full("ILU"), mixed("ILU", options);
+
+    /*--- Too ill-conditioned for the float inner solves to converge, the full precision solve
+     *    continues from the refined solution (accuracy checked by solve). ---*/
+    full.assemble(1e-5);
+    mixed.assemble(1e-5);
+
+    const auto itersFull = full.solve();
+    CHECK(mixed.solve() <= mixed.config->GetLinear_Solver_Iter());
+
+    /*--- From then on only full precision is used. ---*/
+    CHECK(mixed.solve() == itersFull);
+  }
+
+  omp_set_num_threads(nThreads);
+}
+#endif
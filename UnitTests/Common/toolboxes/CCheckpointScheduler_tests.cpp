@@ -0,0 +1,100 @@
+/*!
+ * \file CCheckpointScheduler_tests.cpp
+ * \brief Unit tests for the binomial checkpointing schedule.
+ * \author SU2 Developers
+ * \version 7.1.0 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <vector>
+#include "../../../Common/include/toolboxes/CCheckpointScheduler.hpp"
+
+using Action = CCheckpointScheduler::Action;
+
+/*--- Reverse nStates of a process whose state after step k is k, the state is a small buffer. ---*/
+unsigned long Reverse(CCheckpointScheduler& scheduler, long nStates) {
+  std::vector<passivedouble> state(3, -1.0);
+  unsigned long nAdvance = 0;
+
+  for (long step = nStates-1; step >= 0; --step) {
+    for (const auto& op : scheduler.Request(step)) {
+      switch (op.action) {
+        case Action::RESTORE_INITIAL: state.assign(3, -1.0); break;
+        case Action::RESTORE: scheduler.Load(op.slot, state); break;
+        case Action::STORE: scheduler.Save(op.slot, state); break;
+        case Action::ADVANCE:
+          while (state[0] < op.step) { for (auto& x : state) x += 1.0; ++nAdvance; }
+          break;
+      }
+      CHECK(state[0] == op.step);
+    }
+    REQUIRE(state[0] == step);
+    REQUIRE(state[2] == step);
+  }
+  return nAdvance;
+}
+
+TEST_CASE("Binomial split and cost", "[Toolboxes]") {
+
+  /*--- Brute force minimum cost, T(l,s) = min_m m + T(l-m,s-1) + T(m,s). ---*/
+  const unsigned long L = 40, S = 4;
+  std::vector<std::vector<unsigned long> > T(L+1, std::vector<unsigned long>(S+1, 0));
+  for (auto l = 2ul; l <= L; ++l) {
+    T[l][0] = l*(l-1)/2;
+    for (auto s = 1ul; s <= S; ++s) {
+      T[l][s] = T[l][0];
+      for (auto m = 1ul; m < l; ++m) T[l][s] = std::min(T[l][s], m + T[l-m][s-1] + T[m][s]);
+    }
+  }
+
+  for (auto s = 0ul; s <= S; ++s) {
+    for (auto l = 2ul; l <= L; ++l) {
+      REQUIRE(CCheckpointScheduler::MinimumAdvances(l, s) == T[l][s]);
+      if (s == 0) continue;
+      const auto m = CCheckpointScheduler::OptimalSplit(l, s);
+      REQUIRE(m >= 1);
+      REQUIRE(m < l);
+      REQUIRE(m + T[l-m][s-1] + T[m][s] == T[l][s]);
+    }
+  }
+}
+
+TEST_CASE("Checkpointed reversal", "[Toolboxes]") {
+
+  for (auto nMemory : {0ul, 1ul, 3ul}) {
+    for (auto nDisk : {0ul, 2ul}) {
+      for (long nStates : {1, 7, 30}) {
+        CCheckpointScheduler scheduler(nMemory, nDisk, "checkpoint_unit_test");
+
+        const auto nAdvance = Reverse(scheduler, nStates);
+        const auto& stats = scheduler.GetStatistics();
+
+        CHECK(nAdvance == stats.advances);
+        CHECK(nAdvance == CCheckpointScheduler::MinimumAdvances(nStates+1, nMemory+nDisk));
+        CHECK(stats.maxSlotsUsed <= nMemory+nDisk);
+        if (nDisk == 0) CHECK(stats.storesDisk == 0);
+        if (nMemory == 0) CHECK(stats.storesMemory == 0);
+      }
+    }
+  }
+}
@@ -0,0 +1,175 @@
+/*!
+ * \file CDiscAdjSinglezoneDriver_tests.cpp
+ * \brief Unit tests for the checkpointing of the primal states of unsteady discrete adjoints.
+ * \author SU2 Developers
+ * \version 7.1.0 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include "../../../SU2_CFD/include/drivers/CSinglezoneDriver.hpp"
+#include "../../../SU2_CFD/include/drivers/CDiscAdjSinglezoneDriver.hpp"
+
+namespace {
+
+const std::string configName = "ckpt_test.cfg";
+const unsigned long nTimeSteps = 5;
+
+/*--- Channel with an inclined free-stream, the initial condition is not a solution of the (unsteady) problem. ---*/
+const std::string baseOptions =
+  "SOLVER= EULER\n"
+  "MACH_NUMBER= 0.3\n"
+  "AOA= 10.0\n"
+  "MARKER_FAR= (x_minus, x_plus)\n"
+  "MARKER_EULER= (y_minus, y_plus)\n"
+  "MARKER_MONITORING= (y_minus)\n"
+  "MARKER_PLOTTING= (y_minus)\n"
+  "OBJECTIVE_FUNCTION= DRAG\n"
+  "MESH_FORMAT= RECTANGLE\n"
+  "MESH_BOX_SIZE= 9,9,0\n"
+  "MESH_BOX_LENGTH= 1,1,0\n"
+  "MESH_BOX_OFFSET= 0,0,0\n"
+  "CONV_NUM_METHOD_FLOW= ROE\n"
+  "MUSCL_FLOW= NO\n"
+  "TIME_DISCRE_FLOW= EULER_IMPLICIT\n"
+  "CFL_NUMBER= 10\n"
+  "TIME_DOMAIN= YES\n"
+  "TIME_MARCHING= DUAL_TIME_STEPPING-2ND_ORDER\n"
+  "TIME_STEP= 1e-3\n"
+  "TIME_ITER= 5\n"
+  "INNER_ITER= 30\n"
+  "CONV_RESIDUAL_MINVAL= -10\n"
+  "OUTPUT_FILES= (RESTART)\n"
+  "RESTART_FILENAME= ckpt_test_flow.dat\n"
+  "SOLUTION_FILENAME= ckpt_test_flow.dat\n"
+  "RESTART_ADJ_FILENAME= ckpt_test_adj.dat\n"
+  "SOLUTION_ADJ_FILENAME= ckpt_test_adj.dat\n"
+  "CONV_FILENAME= ckpt_test_history\n";
+
+/*!
+ * \brief Gives access to the containers of a driver.
+ */
+template<class Driver>
+struct TestDriver : Driver {
+  explicit TestDriver(char* confFile) : Driver(confFile, 1, MPI_COMM_WORLD) {}
+
+  CSolver** Solvers() { return this->solver_container[ZONE_0][INST_0][MESH_0]; }
+
+  unsigned long nPoint() const { return this->geometry_container[ZONE_0][INST_0][MESH_0]->GetnPoint(); }
+};
+
+template<class Driver>
+void RunDriver(const std::string& options, std::vector<passivedouble>* primal = nullptr,
+               std::vector<passivedouble>* gradient = nullptr) {
+
+  std::ofstream(configName) << options;
+
+  std::vector<char> fileName(configName.begin(), configName.end());
+  fileName.push_back('\0');
+
+  TestDriver<Driver> driver(fileName.data());
+  driver.StartSolver();
+
+  const auto nPoint = driver.nPoint();
+  const auto solvers = driver.Solvers();
+
+  if (primal) {
+    const auto nodes = solvers[FLOW_SOL]->GetNodes();
+    for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint)
+      for (auto iVar = 0u; iVar < solvers[FLOW_SOL]->GetnVar(); ++iVar)
+        primal->push_back(SU2_TYPE::GetValue(nodes->GetSolution(iPoint, iVar)));
+  }
+  if (gradient) {
+    const auto nodes = solvers[ADJFLOW_SOL]->GetNodes();
+    for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+      for (auto iVar = 0u; iVar < solvers[ADJFLOW_SOL]->GetnVar(); ++iVar)
+        gradient->push_back(SU2_TYPE::GetValue(nodes->GetSolution(iPoint, iVar)));
+      for (auto iDim = 0u; iDim < 2; ++iDim)
+        gradient->push_back(SU2_TYPE::GetValue(nodes->GetSensitivity(iPoint, iDim)));
+    }
+  }
+
+  driver.Postprocessing();
+}
+
+std::string TimeStepFile(const std::string& base, unsigned long iter) {
+  std::stringstream name;
+  name << base << "_" << std::setw(5) << std::setfill('0') << iter << ".dat";
+  return name.str();
+}
+
+}
+
+TEST_CASE("Recomputed primal states of the unsteady adjoint", "[AD][Checkpointing]") {
+
+  auto orig_buf = cout.rdbuf();
+  cout.rdbuf(nullptr);
+
+  /*--- The primal writes the state of every time step, the reference adjoint reads them. ---*/
+
+  RunDriver<CSinglezoneDriver>(baseOptions);
+
+  const std::string adjointOptions = baseOptions +
+    "MATH_PROBLEM= DISCRETE_ADJOINT\n"
+    "UNST_ADJOINT_ITER= 5\n"
+    "OUTPUT_WRT_FREQ= 1000\n";
+
+  std::vector<passivedouble> primalStored, gradientStored;
+  RunDriver<CDiscAdjSinglezoneDriver>(adjointOptions, &primalStored, &gradientStored);
+
+  /*--- Fewer snapshots than time steps, some states are recomputed more than once. ---*/
+
+  std::vector<passivedouble> primalRecomputed, gradientRecomputed;
+  RunDriver<CDiscAdjSinglezoneDriver>(adjointOptions +
+                                      "UNST_ADJOINT_CHECKPOINTING= YES\n"
+                                      "UNST_CHECKPOINTS_MEMORY= 2\n"
+                                      "UNST_CHECKPOINTS_DISK= 0\n",
+                                      &primalRecomputed, &gradientRecomputed);
+
+  cout.rdbuf(orig_buf);
+
+  for (auto iter = 0ul; iter < nTimeSteps; ++iter) {
+    std::remove(TimeStepFile("ckpt_test_flow", iter).c_str());
+    std::remove(TimeStepFile("ckpt_test_adj_cd", iter).c_str());
+  }
+  std::remove("ckpt_test_history.csv");
+  std::remove(configName.c_str());
+
+  /*--- The last adjoint step uses the state of the first time step. ---*/
+
+  REQUIRE(primalRecomputed.size() == primalStored.size());
+  for (auto i = 0ul; i < primalStored.size(); ++i) {
+    CHECK(primalRecomputed[i] == Approx(primalStored[i]).epsilon(1e-8));
+  }
+
+  REQUIRE(gradientRecomputed.size() == gradientStored.size());
+  passivedouble maxGrad = 0.0;
+  for (auto g : gradientStored) maxGrad = std::max(maxGrad, std::fabs(g));
+  REQUIRE(maxGrad > 0.0);
+  for (auto i = 0ul; i < gradientStored.size(); ++i) {
+    CHECK(gradientRecomputed[i] == Approx(gradientStored[i]).epsilon(1e-6).margin(1e-8*maxGrad));
+  }
+}
@@ -0,0 +1,82 @@
+/*!
+ * \file CTabulatedFluidModel_tests.cpp
+ * \brief Unit tests for the look-up table fluid model.
+ * \author SU2 Developers
+ * \version 7.1.0 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include "../../../SU2_CFD/include/fluid/CTabulatedFluidModel.hpp"
+#include "../../../SU2_CFD/include/fluid/CPengRobinson.hpp"
+
+TEST_CASE("Tabulated Peng-Robinson model", "[Fluid models]") {
+
+  /*--- Non-dimensional dense gas, the table is coarse to keep the test fast. ---*/
+  auto factory = []() -> CFluidModel* { return new CPengRobinson(1.05, 1.0, 0.5, 1.0, 0.5); };
+  const su2double rhoRange[] = {0.05, 0.6}, TRange[] = {1.1, 2.5};
+
+  auto table = CTabulatedFluidModel::BuildTable(factory, rhoRange, TRange, 128, 128, "");
+
+  /*--- The table is reused for the same arguments. ---*/
+  CHECK(table == CTabulatedFluidModel::BuildTable(factory, rhoRange, TRange, 128, 128, ""));
+
+  CTabulatedFluidModel model(table, factory(), 1);
+  CPengRobinson exact(1.05, 1.0, 0.5, 1.0, 0.5);
+
+  const su2double rho = 0.31, T = 1.7;
+  exact.SetTDState_rhoT(rho, T);
+  const su2double e = exact.GetStaticEnergy(), P = exact.GetPressure(), s = exact.GetEntropy();
+  const su2double h = e + P / rho;
+  const su2double tol = 1e-4;
+
+  model.SetTDState_rhoe(rho, e);
+  CHECK(model.GetPressure() == Approx(P).epsilon(tol));
+  CHECK(model.GetTemperature() == Approx(T).epsilon(tol));
+  CHECK(model.GetSoundSpeed2() == Approx(exact.GetSoundSpeed2()).epsilon(tol));
+
+  model.SetTDState_Prho(P, rho);
+  CHECK(model.GetStaticEnergy() == Approx(e).epsilon(tol));
+
+  model.SetTDState_rhoT(rho, T);
+  CHECK(model.GetPressure() == Approx(P).epsilon(tol));
+
+  model.SetTDState_PT(P, T);
+  CHECK(model.GetDensity() == Approx(rho).epsilon(tol));
+
+  model.SetTDState_hs(h, s);
+  CHECK(model.GetDensity() == Approx(rho).epsilon(tol));
+
+  model.SetTDState_Ps(P, s);
+  CHECK(model.GetDensity() == Approx(rho).epsilon(tol));
+
+  /*--- Outside of the table the exact model is used. ---*/
+  exact.SetTDState_rhoT(1.5, T);
+  model.SetTDState_rhoe(1.5, exact.GetStaticEnergy());
+  CHECK(model.GetPressure() == Approx(exact.GetPressure()));
+
+  const auto& stats = model.GetStatistics();
+  CHECK(stats.hits == 6);
+  CHECK(stats.misses == 1);
+  CHECK(stats.samples == 6);
+  CHECK(stats.maxErrorP < tol);
+}
@@ -0,0 +1,157 @@
+/*!
+ * \file CNewtonIntegration_tests.cpp
+ * \brief Unit tests for the Jacobian-free Newton-Krylov integration.
+ * \author SU2 Developers
+ * \version 7.1.0 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include "../../UnitQuadTestCase.hpp"
+#include "../../../SU2_CFD/include/integration/CNewtonIntegration.hpp"
+#include "../../../SU2_CFD/include/numerics/flow/convection/roe.hpp"
+
+/*!
+ * \brief Channel flow whose density and energy are perturbed, advanced by Newton steps.
+ */
+struct PerturbedChannel : UnitQuadTestCase {
+  std::vector<CNumerics*> numerics;
+  CNewtonIntegration newton;
+
+  PerturbedChannel() :
+    UnitQuadTestCase(
+      "SOLVER= EULER\n"
+      "MACH_NUMBER= 0.5\n"
+      "MARKER_FAR= (x_minus, x_plus)\n"
+      "MARKER_EULER= (y_minus, y_plus)\n"
+      "MESH_FORMAT= RECTANGLE\n"
+      "MESH_BOX_SIZE= 9,9,0\n"
+      "MESH_BOX_LENGTH= 1,1,0\n"
+      "MESH_BOX_OFFSET= 0,0,0\n"
+      "CONV_NUM_METHOD_FLOW= ROE\n"
+      "MUSCL_FLOW= NO\n"
+      "TIME_DISCRE_FLOW= EULER_IMPLICIT\n"
+      "CFL_NUMBER= 50\n"
+      "LINEAR_SOLVER_PREC= ILU\n"
+      "LINEAR_SOLVER_ERROR= 1e-6\n"
+      "NEWTON_KRYLOV= YES\n"
+      "NEWTON_KRYLOV_STARTUP_ITER= 0\n"
+      "NEWTON_KRYLOV_ITER= 50\n"
+      "NEWTON_KRYLOV_FORCING_MAX= 0.1\n") {
+
+    InitConfig();
+    /*--- Numerical methods of the flow system, as set by the fluid iteration. ---*/
+    config->SetGlobalParam(EULER, RUNTIME_FLOW_SYS);
+    InitGeometry();
+    /*--- Needed by the symmetry (Euler wall) boundary condition. ---*/
+    geometry->ComputeSurf_Straightness(config.get(), false);
+    InitSolver();
+
+    /*--- One convective and one boundary numerics per thread, as set up by the driver. ---*/
+    const auto nDim = geometry->GetnDim();
+    const auto nVar = solver[FLOW_SOL]->GetnVar();
+    numerics.resize(MAX_TERMS*omp_get_max_threads(), nullptr);
+    for (auto iThread = 0; iThread < omp_get_max_threads(); ++iThread) {
+      numerics[CONV_TERM + iThread*MAX_TERMS] = new CUpwRoe_Flow(nDim, nVar, config.get(), false);
+      numerics[CONV_BOUND_TERM + iThread*MAX_TERMS] = new CUpwRoe_Flow(nDim, nVar, config.get(), false);
+    }
+
+    auto nodes = solver[FLOW_SOL]->GetNodes();
+    for (auto iPoint = 0ul; iPoint < geometry->GetnPoint(); ++iPoint) {
+      const auto coord = geometry->nodes->GetCoord(iPoint);
+      const su2double bump = 1.0 + 0.05 * sin(PI_NUMBER * coord[0]) * sin(PI_NUMBER * coord[1]);
+      nodes->SetSolution(iPoint, 0, nodes->GetSolution(iPoint, 0) * bump);
+      nodes->SetSolution(iPoint, nVar-1, nodes->GetSolution(iPoint, nVar-1) * bump);
+    }
+  }
+
+  ~PerturbedChannel() {
+    for (auto num : numerics) delete num;
+  }
+
+  /*!
+   * \brief Perform one iteration and return the norm of the residual at the start of the step.
+   */
+  su2double iterate(unsigned long iter) {
+    config->SetInnerIter(iter);
+
+    CGeometry* geometryMG[] = {geometry.get()};
+    CGeometry** geometryInst[] = {geometryMG};
+    CGeometry*** geometryZone[] = {geometryInst};
+
+    CSolver** solverMG[] = {solver};
+    CSolver*** solverInst[] = {solverMG};
+    CSolver**** solverZone[] = {solverInst};
+
+    CNumerics** numericsSol[MAX_SOLS] = {nullptr};
+    numericsSol[FLOW_SOL] = numerics.data();
+    CNumerics*** numericsMG[] = {numericsSol};
+    CNumerics**** numericsInst[] = {numericsMG};
+    CNumerics***** numericsZone[] = {numericsInst};
+
+    CConfig* configZone[] = {config.get()};
+
+    newton.MultiGrid_Iteration(geometryZone, solverZone, numericsZone, configZone, RUNTIME_FLOW_SYS, ZONE_0, INST_0);
+
+    /*--- The RMS residuals are those of the start of the Newton step. ---*/
+    const auto flow = solver[FLOW_SOL];
+    su2double sumSq = 0.0;
+    for (auto iVar = 0u; iVar < flow->GetnVar(); ++iVar) sumSq += pow(flow->GetRes_RMS(iVar), 2);
+    return sqrt(sumSq * geometry->GetGlobal_nPointDomain());
+  }
+};
+
+TEST_CASE("Newton-Krylov forcing terms and linear residual", "[Newton]") {
+  PerturbedChannel channel;
+  const auto flow = channel.solver[FLOW_SOL];
+  const su2double forcingMax = channel.config->GetNewtonKrylov_ForcingMax();
+  const su2double linSolError = channel.config->GetLinear_Solver_Error();
+
+  su2double normOld = 0.0, forcingOld = 0.0;
+
+  for (auto iter = 0ul; iter < 4; ++iter) {
+    INFO("Iteration " << iter);
+
+    const su2double norm = channel.iterate(iter);
+    const su2double forcing = channel.newton.GetForcingTerm();
+
+    /*--- Eisenstat-Walker choice 2 with safeguard, the first step uses the maximum. ---*/
+    su2double expected = forcingMax;
+    if (iter > 0) {
+      expected = 0.9 * pow(norm / normOld, 2);
+      if (0.9 * forcingOld * forcingOld > 0.1) expected = max(expected, 0.9 * forcingOld * forcingOld);
+      expected = max(min(expected, forcingMax), linSolError);
+    }
+    CHECK(SU2_TYPE::GetValue(forcing) == Approx(SU2_TYPE::GetValue(expected)).epsilon(1e-6));
+
+    /*--- The relative residual of FGMRES is reported as is, the CFL adaptation compares it with the forcing term. ---*/
+    CHECK(flow->GetIterLinSolver() > 0);
+    CHECK(flow->GetResLinSolver() > 0.0);
+    CHECK(flow->GetResLinSolver() <= forcing);
+    CHECK(flow->GetTolLinSolver() == forcing);
+
+    if (iter > 0) CHECK(norm < normOld);
+
+    normOld = norm;
+    forcingOld = forcing;
+  }
+}
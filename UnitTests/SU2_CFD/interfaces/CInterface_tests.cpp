@@ -0,0 +1,199 @@
+/*!
+ * \file CInterface_tests.cpp
+ * \brief Unit tests for the transfer of donor data between zones.
+ * \author SU2 Developers
+ * \version 7.1.0 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <map>
+#include <array>
+#include "../../../Common/include/geometry/CPhysicalGeometry.hpp"
+#include "../../../Common/include/interface_interpolation/CIsoparametric.hpp"
+#include "../../../SU2_CFD/include/interfaces/CInterface.hpp"
+
+namespace {
+
+/*!
+ * \brief Transfers a linear function of the donor coordinates, which the isoparametric interpolation
+ *        reproduces exactly, and records the target values by global point.
+ */
+class CLinearFieldInterface : public CInterface {
+public:
+  su2double offset = 0.0;
+  map<unsigned long, array<passivedouble,2> > targetValues;
+
+  CLinearFieldInterface() : CInterface(2, 0) {}
+
+  static passivedouble Field(const su2double* coord, passivedouble offset, unsigned short iVar) {
+    return SU2_TYPE::GetValue(iVar? 2.0*coord[0] - 0.5*coord[1] + offset : offset - coord[0] + 3.0*coord[1]);
+  }
+
+  const CTransferPlan& Plan() const { return transferPlans.at(0); }
+
+protected:
+  void GetDonor_Variable(CSolver*, CGeometry *donor_geometry, const CConfig*, unsigned long,
+                         unsigned long, unsigned long Point_Donor) override {
+    const auto coord = donor_geometry->nodes->GetCoord(Point_Donor);
+    for (auto iVar = 0u; iVar < nVar; ++iVar) Donor_Variable[iVar] = Field(coord, SU2_TYPE::GetValue(offset), iVar);
+  }
+
+  void SetTarget_Variable(CSolver*, CGeometry *target_geometry, const CConfig*, unsigned long,
+                          unsigned long, unsigned long Point_Target) override {
+    auto& values = targetValues[target_geometry->nodes->GetGlobalIndex(Point_Target)];
+    for (auto iVar = 0u; iVar < nVar; ++iVar) values[iVar] = SU2_TYPE::GetValue(Target_Variable[iVar]);
+  }
+};
+
+/*!
+ * \brief Two box zones whose lower (planar) sides form the interface, the donor side covers the target side.
+ */
+struct TransferInterface {
+  std::unique_ptr<CConfig> config[2];
+  std::unique_ptr<CGeometry> geometry[2];
+
+  CGeometry* meshes[2];
+  CGeometry** instances[2] = {&meshes[0], &meshes[1]};
+  CGeometry*** zones[2] = {&instances[0], &instances[1]};
+
+  std::unique_ptr<CInterpolator> interpolator;
+
+  TransferInterface() {
+    auto origBuf = cout.rdbuf();
+    cout.rdbuf(nullptr);
+
+    const string boxSize[] = {"9,8,2", "6,7,2"};
+    const string boxLength[] = {"1.4,1.3,0.2", "1,1,0.2"};
+    const string boxOffset[] = {"-0.2,-0.15,0.1", "0.03,-0.02,0.1"};
+
+    for (int iZone = 0; iZone < 2; ++iZone) {
+      stringstream ss(
+        "SOLVER= EULER\n"
+        "MARKER_EULER= (x_minus, x_plus, y_minus, y_plus, z_minus, z_plus)\n"
+        "MARKER_ZONE_INTERFACE= (z_minus, z_minus)\n"
+        "MESH_FORMAT= BOX\n"
+        "MESH_BOX_SIZE= " + boxSize[iZone] + "\n"
+        "MESH_BOX_LENGTH= " + boxLength[iZone] + "\n"
+        "MESH_BOX_OFFSET= " + boxOffset[iZone] + "\n");
+      config[iZone] = std::unique_ptr<CConfig>(new CConfig(ss, SU2_CFD, false));
+
+      auto cfg = config[iZone].get();
+      {
+        auto aux_geometry = std::unique_ptr<CGeometry>(new CPhysicalGeometry(cfg, 0, 1));
+        geometry[iZone] = std::unique_ptr<CGeometry>(new CPhysicalGeometry(aux_geometry.get(), cfg));
+      }
+      auto geo = geometry[iZone].get();
+      geo->SetSendReceive(cfg);
+      geo->SetBoundaries(cfg);
+      geo->SetPoint_Connectivity();
+      geo->SetElement_Connectivity();
+      geo->SetBoundVolume();
+      geo->SetEdges();
+      geo->SetVertex(cfg);
+      geo->SetControlVolume(cfg, ALLOCATE);
+      geo->SetBoundControlVolume(cfg, ALLOCATE);
+      geo->SetGlobal_to_Local_Point();
+      meshes[iZone] = geo;
+    }
+
+    const CConfig* configs[2] = {config[0].get(), config[1].get()};
+    interpolator = std::unique_ptr<CInterpolator>(new CIsoparametric(zones, configs, 0, 1));
+
+    cout.rdbuf(origBuf);
+  }
+
+  void Transfer(CLinearFieldInterface& interface) {
+    interface.targetValues.clear();
+    interface.BroadcastData(*interpolator, nullptr, nullptr, geometry[0].get(), geometry[1].get(),
+                            config[0].get(), config[1].get());
+  }
+
+  /*!
+   * \brief All owned target vertices must receive the (exactly interpolated) field.
+   */
+  void Check(const CLinearFieldInterface& interface) const {
+    const auto geo = geometry[1].get();
+    const auto markTarget = config[1]->FindInterfaceMarker(0);
+    REQUIRE(markTarget >= 0);
+
+    unsigned long nOwned = 0;
+    for (auto iVertex = 0ul; iVertex < geo->GetnVertex(markTarget); ++iVertex) {
+      const auto iPoint = geo->vertex[markTarget][iVertex]->GetNode();
+      if (!geo->nodes->GetDomain(iPoint)) continue;
+      ++nOwned;
+
+      const auto it = interface.targetValues.find(geo->nodes->GetGlobalIndex(iPoint));
+      REQUIRE(it != interface.targetValues.end());
+
+      const auto coord = geo->nodes->GetCoord(iPoint);
+      for (auto iVar = 0u; iVar < 2; ++iVar) {
+        const auto expected = CLinearFieldInterface::Field(coord, SU2_TYPE::GetValue(interface.offset), iVar);
+        CHECK(it->second[iVar] == Approx(expected).margin(1e-10));
+      }
+    }
+    CHECK(interface.targetValues.size() == nOwned);
+  }
+};
+
+}
+
+TEST_CASE("Point-to-point transfer of donor data", "[Interface]") {
+
+  TransferInterface setup;
+  CLinearFieldInterface interface;
+
+  /*--- The first transfer builds the plan, the second reuses it and its buffers. ---*/
+
+  setup.Transfer(interface);
+  REQUIRE(interface.Plan().built);
+  CHECK(interface.Plan().sparse);
+  setup.Check(interface);
+
+  interface.offset = 0.75;
+  setup.Transfer(interface);
+  CHECK(interface.Plan().sparse);
+  setup.Check(interface);
+}
+
+TEST_CASE("Fallback transfer of donor data when the owners are not known", "[Interface]") {
+
+  TransferInterface setup;
+  CLinearFieldInterface interface;
+
+  setup.Transfer(interface);
+  REQUIRE(interface.Plan().sparse);
+
+  /*--- Invalidate the owners of the donors, the plan must be rebuilt after the reset and all
+   *    ranks must switch to gathering the data of all donor vertices, with the same result. ---*/
+
+  const auto markTarget = setup.config[1]->FindInterfaceMarker(0);
+  for (auto& targetVertex : setup.interpolator->targetVertices[markTarget])
+    for (auto& owner : targetVertex.processor) owner = -1;
+
+  interface.ResetTransferPlans();
+  interface.offset = -0.4;
+  setup.Transfer(interface);
+  REQUIRE(interface.Plan().built);
+  CHECK_FALSE(interface.Plan().sparse);
+  setup.Check(interface);
+}
@@ -0,0 +1,224 @@
+/*!
+ * \file CNumericsSIMD_tests.cpp
+ * \brief Unit tests comparing the vectorized upwind schemes with the scalar ones.
+ * \author SU2 Developers
+ * \version 7.1.0 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include "../../UnitQuadTestCase.hpp"
+#include "../../../SU2_CFD/include/numerics/flow/convection/roe.hpp"
+#include "../../../SU2_CFD/include/numerics/flow/convection/hllc.hpp"
+#include "../../../SU2_CFD/include/numerics/flow/convection/ausm_slau.hpp"
+
+namespace {
+
+/*!
+ * \brief Scalar version of the upwind scheme selected in the config, as created by the driver.
+ */
+CNumerics* NewScalarNumerics(const CConfig* config, unsigned short nDim, unsigned short nVar) {
+  const bool ideal_gas = (config->GetKind_FluidModel() == STANDARD_AIR) ||
+                         (config->GetKind_FluidModel() == IDEAL_GAS);
+
+  switch (config->GetKind_Upwind_Flow()) {
+    case ROE:
+      if (ideal_gas) return new CUpwRoe_Flow(nDim, nVar, config, false);
+      return new CUpwGeneralRoe_Flow(nDim, nVar, config);
+    case HLLC:
+      if (ideal_gas) return new CUpwHLLC_Flow(nDim, nVar, config);
+      return new CUpwGeneralHLLC_Flow(nDim, nVar, config);
+    case AUSM: return new CUpwAUSM_Flow(nDim, nVar, config);
+    case AUSMPLUSUP: return new CUpwAUSMPLUSUP_Flow(nDim, nVar, config);
+    case AUSMPLUSUP2: return new CUpwAUSMPLUSUP2_Flow(nDim, nVar, config);
+    case SLAU: return new CUpwSLAU_Flow(nDim, nVar, config, false);
+    case SLAU2: return new CUpwSLAU2_Flow(nDim, nVar, config, false);
+  }
+  return nullptr;
+}
+
+/*!
+ * \brief Euler flow in a box with a non-uniform state, the residual is computed with the vectorized
+ *        edge loop or with the scalar numerics depending on USE_VECTORIZATION.
+ */
+struct UpwindBox : UnitQuadTestCase {
+  std::vector<CNumerics*> numerics;
+
+  UpwindBox(const string& scheme, const string& extraOptions, passivedouble mach) :
+    UnitQuadTestCase(
+      "SOLVER= EULER\n"
+      "MACH_NUMBER= " + to_string(mach) + "\n"
+      "AOA= 10.0\n"
+      "MARKER_EULER= (x_minus, x_plus, y_minus, y_plus, z_minus, z_plus)\n"
+      "MESH_FORMAT= BOX\n"
+      "MESH_BOX_SIZE= 4,4,4\n"
+      "MESH_BOX_LENGTH= 1,1,1\n"
+      "MESH_BOX_OFFSET= 0,0,0\n"
+      "CONV_NUM_METHOD_FLOW= " + scheme + "\n"
+      "MUSCL_FLOW= NO\n"
+      "TIME_DISCRE_FLOW= EULER_IMPLICIT\n" + extraOptions) {
+
+    InitConfig();
+    InitGeometry();
+    InitSolver();
+
+    const auto nDim = geometry->GetnDim();
+    numerics.resize(MAX_TERMS*omp_get_max_threads(), nullptr);
+    for (auto iThread = 0; iThread < omp_get_max_threads(); ++iThread)
+      numerics[CONV_TERM + iThread*MAX_TERMS] = NewScalarNumerics(config.get(), nDim, flow()->GetnVar());
+
+    /*--- Perturb density, velocity, and internal energy so that all fluxes and Jacobians differ. ---*/
+    auto nodes = flow()->GetNodes();
+    for (auto iPoint = 0ul; iPoint < geometry->GetnPoint(); ++iPoint) {
+      const auto coord = geometry->nodes->GetCoord(iPoint);
+      const su2double rho0 = nodes->GetSolution(iPoint, 0);
+
+      su2double vel[3] = {0.0}, kinetic0 = 0.0, kinetic = 0.0;
+      for (auto iDim = 0u; iDim < nDim; ++iDim) {
+        vel[iDim] = nodes->GetSolution(iPoint, iDim+1) / rho0;
+        kinetic0 += 0.5*rho0*pow(vel[iDim], 2);
+      }
+      const su2double rhoe = (nodes->GetSolution(iPoint, nDim+1) - kinetic0) * (1 + 0.3*coord[0] - 0.2*coord[2]);
+      const su2double rho = rho0 * (1 + 0.2*coord[0]*coord[1]);
+      vel[0] *= 1 + 0.5*coord[1];
+      vel[1] -= 0.4*vel[0]*coord[2];
+      vel[2] += 0.3*vel[0]*coord[0];
+
+      nodes->SetSolution(iPoint, 0, rho);
+      for (auto iDim = 0u; iDim < nDim; ++iDim) {
+        nodes->SetSolution(iPoint, iDim+1, rho*vel[iDim]);
+        kinetic += 0.5*rho*pow(vel[iDim], 2);
+      }
+      nodes->SetSolution(iPoint, nDim+1, rhoe + kinetic);
+    }
+  }
+
+  ~UpwindBox() {
+    for (auto num : numerics) delete num;
+  }
+
+  CEulerSolver* flow() { return static_cast<CEulerSolver*>(solver[FLOW_SOL]); }
+
+  /*!
+   * \brief Update the primitives and compute the convective residual and Jacobian.
+   */
+  void residual() {
+    flow()->Preprocessing(geometry.get(), solver, config.get(), MESH_0, 0, RUNTIME_FLOW_SYS, false);
+    flow()->LinSysRes.SetValZero();
+    flow()->Jacobian.SetValZero();
+    flow()->Upwind_Residual(geometry.get(), solver, numerics.data(), config.get(), MESH_0);
+  }
+};
+
+/*!
+ * \brief Compare the residuals and the Jacobian blocks of the vectorized and scalar versions of a scheme.
+ */
+void CompareScalarAndSIMD(const string& scheme, const string& options = "", passivedouble mach = 0.5) {
+  UpwindBox simd(scheme, options + "USE_VECTORIZATION= YES\n", mach);
+  UpwindBox scalar(scheme, options + "USE_VECTORIZATION= NO\n", mach);
+
+  simd.residual();
+  scalar.residual();
+
+  const auto nVar = scalar.flow()->GetnVar();
+  const auto nPoint = scalar.geometry->GetnPoint();
+
+  su2double norm = 0.0;
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint)
+    for (auto iVar = 0u; iVar < nVar; ++iVar)
+      norm = max(norm, su2double(fabs(scalar.flow()->LinSysRes(iPoint, iVar))));
+  REQUIRE(norm > 0.0);
+
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+    for (auto iVar = 0u; iVar < nVar; ++iVar) {
+      const auto ref = SU2_TYPE::GetValue(scalar.flow()->LinSysRes(iPoint, iVar));
+      CHECK(SU2_TYPE::GetValue(simd.flow()->LinSysRes(iPoint, iVar)) ==
+            Approx(ref).epsilon(1e-10).margin(SU2_TYPE::GetValue(1e-12*norm)));
+    }
+  }
+
+  const auto& edges = scalar.geometry->edges;
+  for (auto iEdge = 0ul; iEdge < scalar.geometry->GetnEdge(); ++iEdge) {
+    const auto iPoint = edges->GetNode(iEdge, 0);
+    const auto jPoint = edges->GetNode(iEdge, 1);
+
+    for (const auto& block : {make_pair(iPoint, iPoint), make_pair(iPoint, jPoint),
+                              make_pair(jPoint, iPoint), make_pair(jPoint, jPoint)}) {
+      const auto refBlock = scalar.flow()->Jacobian.GetBlock(block.first, block.second);
+      const auto simdBlock = simd.flow()->Jacobian.GetBlock(block.first, block.second);
+
+      passivedouble scale = 0.0;
+      for (auto k = 0u; k < nVar*nVar; ++k) scale = max(scale, fabs(SU2_TYPE::GetValue(refBlock[k])));
+
+      INFO("Block (" << block.first << "," << block.second << ")");
+      for (auto k = 0u; k < nVar*nVar; ++k)
+        CHECK(SU2_TYPE::GetValue(simdBlock[k]) ==
+              Approx(SU2_TYPE::GetValue(refBlock[k])).epsilon(1e-8).margin(1e-10*scale));
+    }
+  }
+}
+
+}
+
+TEST_CASE("Vectorized HLLC vs scalar", "[Upwind][SIMD]") {
+  /*--- Supersonic, some edges are fully upwind (the flux is that of one side). ---*/
+  for (const auto mach : {0.5, 1.8}) {
+    INFO("Mach: " << mach);
+    CompareScalarAndSIMD("HLLC", "", mach);
+  }
+}
+
+TEST_CASE("Vectorized AUSM family vs scalar", "[Upwind][SIMD]") {
+  for (const auto scheme : {"AUSM", "AUSMPLUSUP", "AUSMPLUSUP2"}) {
+    INFO("Scheme: " << scheme);
+    CompareScalarAndSIMD(scheme);
+  }
+}
+
+TEST_CASE("Vectorized SLAU family vs scalar", "[Upwind][SIMD]") {
+  for (const auto scheme : {"SLAU", "SLAU2"}) {
+    INFO("Scheme: " << scheme);
+    CompareScalarAndSIMD(scheme);
+  }
+}
+
+TEST_CASE("Vectorized real gas Roe and HLLC vs scalar", "[Upwind][SIMD]") {
+  /*--- Siloxane MDM close to the critical point, as in the turbomachinery test cases. ---*/
+  const string gasOptions =
+    "GAMMA_VALUE= 1.034\n"
+    "GAS_CONSTANT= 28.03\n"
+    "CRITICAL_TEMPERATURE= 586.5\n"
+    "CRITICAL_PRESSURE= 1332000.0\n"
+    "ACENTRIC_FACTOR= 0.592\n"
+    "FREESTREAM_PRESSURE= 200000.0\n"
+    "FREESTREAM_TEMPERATURE= 510.33\n"
+    "REF_DIMENSIONALIZATION= FREESTREAM_PRESS_EQ_ONE\n";
+
+  for (const auto fluid : {"PR_GAS", "VW_GAS"}) {
+    for (const auto scheme : {"ROE", "HLLC"}) {
+      for (const auto mach : {0.5, 1.8}) {
+        INFO("Fluid: " << fluid << ", scheme: " << scheme << ", Mach: " << mach);
+        CompareScalarAndSIMD(scheme, gasOptions + "FLUID_MODEL= " + fluid + "\n", mach);
+      }
+    }
+  }
+}
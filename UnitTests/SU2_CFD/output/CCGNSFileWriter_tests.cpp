@@ -0,0 +1,210 @@
+/*!
+ * \file CCGNSFileWriter_tests.cpp
+ * \brief Unit tests for the CGNS solution writer.
+ * \author SU2 Developers
+ * \version 7.1.0 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifdef HAVE_CGNS
+
+#include "catch.hpp"
+#include <cstdio>
+#include <sstream>
+#include "cgnslib.h"
+#include "../../../Common/include/geometry/CPhysicalGeometry.hpp"
+#include "../../../SU2_CFD/include/output/filewriter/CFVMDataSorter.hpp"
+#include "../../../SU2_CFD/include/output/filewriter/CCGNSFileWriter.hpp"
+
+namespace {
+
+/*!
+ * \brief Sorted solution of a small 2D grid, the fields depend on the time step.
+ */
+struct SortedSolution {
+  std::unique_ptr<CConfig> config;
+  std::unique_ptr<CGeometry> geometry;
+  std::unique_ptr<CFVMDataSorter> sorter;
+
+  SortedSolution() {
+    stringstream ss("SOLVER= EULER\n"
+                    "MARKER_EULER= (x_minus, x_plus, y_minus, y_plus)\n"
+                    "MESH_FORMAT= RECTANGLE\n"
+                    "MESH_BOX_SIZE= 5,4,0\n"
+                    "MESH_BOX_LENGTH= 1,1,0\n"
+                    "MESH_BOX_OFFSET= 0,0,0\n");
+    config = std::unique_ptr<CConfig>(new CConfig(ss, SU2_CFD, false));
+    {
+      auto aux_geometry = std::unique_ptr<CGeometry>(new CPhysicalGeometry(config.get(), 0, 1));
+      geometry = std::unique_ptr<CGeometry>(new CPhysicalGeometry(aux_geometry.get(), config.get()));
+    }
+    geometry->SetSendReceive(config.get());
+    geometry->SetBoundaries(config.get());
+
+    sorter = std::unique_ptr<CFVMDataSorter>(
+      new CFVMDataSorter(config.get(), geometry.get(), {"x", "y", "Density", "Pressure"}));
+    sorter->SortConnectivity(config.get(), geometry.get(), true);
+  }
+
+  static passivedouble Density(const passivedouble* coord, unsigned long step) { return coord[0] + step; }
+  static passivedouble Pressure(const passivedouble* coord, unsigned long step) { return coord[1] * (step+1); }
+
+  void Load(unsigned long step) {
+    for (auto iPoint = 0ul; iPoint < geometry->GetnPointDomain(); ++iPoint) {
+      const passivedouble coord[] = {SU2_TYPE::GetValue(geometry->nodes->GetCoord(iPoint, 0)),
+                                     SU2_TYPE::GetValue(geometry->nodes->GetCoord(iPoint, 1))};
+      sorter->SetUnsorted_Data(iPoint, 0, coord[0]);
+      sorter->SetUnsorted_Data(iPoint, 1, coord[1]);
+      sorter->SetUnsorted_Data(iPoint, 2, Density(coord, step));
+      sorter->SetUnsorted_Data(iPoint, 3, Pressure(coord, step));
+    }
+    sorter->SortOutputData();
+  }
+
+  void Write(const string& fileName, unsigned long step, bool append) {
+    Load(step);
+    CCGNSFileWriter(fileName, sorter.get(), false, step, 0.1*step, true, append).Write_Data();
+  }
+};
+
+vector<string> ReadStrings(const vector<char>& chars, size_t n) {
+  vector<string> strings;
+  for (size_t i = 0; i < n; ++i) {
+    string name(&chars[i*(CGNS_STRING_SIZE-1)], CGNS_STRING_SIZE-1);
+    strings.push_back(name.substr(0, name.find_last_not_of(' ')+1));
+  }
+  return strings;
+}
+
+}
+
+TEST_CASE("CGNS time series round trip", "[Output]") {
+
+  auto orig_buf = cout.rdbuf();
+  cout.rdbuf(nullptr);
+
+  SortedSolution solution;
+
+  /*--- Three steps, then a restart from the second step, the third step must go away. ---*/
+
+  const string baseName = "cgns_writer_test";
+  const string fileName = baseName + CCGNSFileWriter::fileExt;
+
+  solution.Write(baseName, 0, false);
+  solution.Write(baseName, 1, true);
+  solution.Write(baseName, 2, true);
+  solution.Write(baseName, 1, true);
+
+  cout.rdbuf(orig_buf);
+
+  int fn = 0;
+  REQUIRE(cg_open(fileName.c_str(), CG_MODE_READ, &fn) == CG_OK);
+
+  /*--- Grid. ---*/
+
+  char name[CGNS_STRING_SIZE];
+  cgsize_t zoneSize[3] = {0};
+  REQUIRE(cg_zone_read(fn, 1, 1, name, zoneSize) == CG_OK);
+  REQUIRE(zoneSize[0] == cgsize_t(solution.sorter->GetnPointsGlobal()));
+  REQUIRE(zoneSize[1] == cgsize_t(solution.sorter->GetnElemGlobal()));
+
+  const auto nPoint = solution.sorter->GetnPoints();
+  cgsize_t rmin = 1, rmax = nPoint;
+  vector<passivedouble> coordX(nPoint), coordY(nPoint);
+  REQUIRE(cg_coord_read(fn, 1, 1, "CoordinateX", CGNS_ENUMV(RealDouble), &rmin, &rmax, coordX.data()) == CG_OK);
+  REQUIRE(cg_coord_read(fn, 1, 1, "CoordinateY", CGNS_ENUMV(RealDouble), &rmin, &rmax, coordY.data()) == CG_OK);
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+    CHECK(coordX[iPoint] == solution.sorter->GetData(0, iPoint));
+    CHECK(coordY[iPoint] == solution.sorter->GetData(1, iPoint));
+  }
+
+  int nSection = 0;
+  REQUIRE(cg_nsections(fn, 1, 1, &nSection) == CG_OK);
+  REQUIRE(nSection == 1);
+  CGNS_ENUMT(ElementType_t) type;
+  cgsize_t start = 0, end = 0;
+  int nBoundary = 0, parent = 0;
+  REQUIRE(cg_section_read(fn, 1, 1, 1, name, &type, &start, &end, &nBoundary, &parent) == CG_OK);
+  CHECK(type == CGNS_ENUMV(QUAD_4));
+  REQUIRE(end-start+1 == cgsize_t(solution.sorter->GetnElem(QUADRILATERAL)));
+
+  vector<cgsize_t> connectivity(4*(end-start+1));
+  REQUIRE(cg_elements_read(fn, 1, 1, 1, connectivity.data(), nullptr) == CG_OK);
+  for (auto iElem = 0ul; iElem < solution.sorter->GetnElem(QUADRILATERAL); ++iElem)
+    for (auto iNode = 0ul; iNode < 4; ++iNode)
+      CHECK(connectivity[4*iElem+iNode] == cgsize_t(solution.sorter->GetElem_Connectivity(QUADRILATERAL, iElem, iNode)));
+
+  /*--- Solutions, the stale third step is no longer in the file. ---*/
+
+  int nSol = 0;
+  REQUIRE(cg_nsols(fn, 1, 1, &nSol) == CG_OK);
+  REQUIRE(nSol == 2);
+
+  for (int iSol = 1; iSol <= nSol; ++iSol) {
+    CGNS_ENUMT(GridLocation_t) location;
+    REQUIRE(cg_sol_info(fn, 1, 1, iSol, name, &location) == CG_OK);
+    CHECK(location == CGNS_ENUMV(Vertex));
+
+    const string solName(name);
+    REQUIRE((solName == "FlowSolution_0" || solName == "FlowSolution_1"));
+    const unsigned long step = (solName == "FlowSolution_1");
+
+    vector<passivedouble> density(nPoint), pressure(nPoint);
+    REQUIRE(cg_field_read(fn, 1, 1, iSol, "Density", CGNS_ENUMV(RealDouble), &rmin, &rmax, density.data()) == CG_OK);
+    REQUIRE(cg_field_read(fn, 1, 1, iSol, "Pressure", CGNS_ENUMV(RealDouble), &rmin, &rmax, pressure.data()) == CG_OK);
+
+    for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+      const passivedouble coord[] = {coordX[iPoint], coordY[iPoint]};
+      CHECK(density[iPoint] == Approx(SortedSolution::Density(coord, step)));
+      CHECK(pressure[iPoint] == Approx(SortedSolution::Pressure(coord, step)));
+    }
+  }
+
+  /*--- Iterative data. ---*/
+
+  int nSteps = 0;
+  REQUIRE(cg_biter_read(fn, 1, name, &nSteps) == CG_OK);
+  REQUIRE(nSteps == 2);
+
+  vector<double> timeValues(nSteps);
+  vector<int> iterValues(nSteps);
+  REQUIRE(cg_goto(fn, 1, "BaseIterativeData_t", 1, "end") == CG_OK);
+  REQUIRE(cg_array_read_as(1, CGNS_ENUMV(RealDouble), timeValues.data()) == CG_OK);
+  REQUIRE(cg_array_read_as(2, CGNS_ENUMV(Integer), iterValues.data()) == CG_OK);
+  CHECK(timeValues[0] == Approx(0.0));
+  CHECK(timeValues[1] == Approx(0.1));
+  CHECK(iterValues[0] == 0);
+  CHECK(iterValues[1] == 1);
+
+  vector<char> pointers(nSteps*(CGNS_STRING_SIZE-1));
+  REQUIRE(cg_goto(fn, 1, "Zone_t", 1, "ZoneIterativeData_t", 1, "end") == CG_OK);
+  REQUIRE(cg_array_read(1, pointers.data()) == CG_OK);
+  const auto solutionNames = ReadStrings(pointers, nSteps);
+  CHECK(solutionNames[0] == "FlowSolution_0");
+  CHECK(solutionNames[1] == "FlowSolution_1");
+
+  cg_close(fn);
+  std::remove(fileName.c_str());
+}
+
+#endif
@@ -0,0 +1,196 @@
+/*!
+ * \file CFEM_DG_EulerSolver_tests.cpp
+ * \brief Unit tests for the processing of the task list of the FEM-DG solver with threads.
+ * \author SU2 Developers
+ * \version 7.1.0 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include "../../../SU2_CFD/include/drivers/CSinglezoneDriver.hpp"
+#include "../../../Common/include/fem/fem_geometry_structure.hpp"
+
+namespace {
+
+const std::string configName = "fem_dg_test.cfg";
+const std::string meshName = "fem_dg_test.su2";
+
+/*!
+ * \brief Channel of quadrilaterals with a linear geometry and a quadratic solution (type 30009). The cells
+ *        are stretched in x, such that time accurate local time stepping uses several time levels.
+ */
+void WriteChannelMesh(int nx, int ny) {
+  auto node = [&](int i, int j) { return j*(nx+1) + i; };
+
+  std::vector<passivedouble> x(nx+1, 0.0);
+  passivedouble dx = 0.02;
+  for (int i = 1; i <= nx; ++i, dx *= 1.5) x[i] = x[i-1] + dx;
+
+  std::ofstream mesh(meshName);
+  mesh << "NDIME= 2\nNELEM= " << nx*ny << "\n";
+  for (int j = 0; j < ny; ++j)
+    for (int i = 0; i < nx; ++i)
+      mesh << "30009 " << node(i,j) << " " << node(i+1,j) << " " << node(i+1,j+1) << " "
+           << node(i,j+1) << " " << j*nx+i << "\n";
+
+  mesh << "NPOIN= " << (nx+1)*(ny+1) << "\n";
+  for (int j = 0; j <= ny; ++j)
+    for (int i = 0; i <= nx; ++i)
+      mesh << x[i] << " " << 0.1*j << " " << node(i,j) << "\n";
+
+  mesh << "NMARK= 4\n";
+  mesh << "MARKER_TAG= y_minus\nMARKER_ELEMS= " << nx << "\n";
+  for (int i = 0; i < nx; ++i) mesh << "3 " << node(i,0) << " " << node(i+1,0) << "\n";
+  mesh << "MARKER_TAG= y_plus\nMARKER_ELEMS= " << nx << "\n";
+  for (int i = 0; i < nx; ++i) mesh << "3 " << node(i+1,ny) << " " << node(i,ny) << "\n";
+  mesh << "MARKER_TAG= x_minus\nMARKER_ELEMS= " << ny << "\n";
+  for (int j = 0; j < ny; ++j) mesh << "3 " << node(0,j+1) << " " << node(0,j) << "\n";
+  mesh << "MARKER_TAG= x_plus\nMARKER_ELEMS= " << ny << "\n";
+  for (int j = 0; j < ny; ++j) mesh << "3 " << node(nx,j) << " " << node(nx,j+1) << "\n";
+}
+
+/*--- Inclined free-stream, the walls make the solution non-uniform from the first iteration. ---*/
+const std::string baseOptions =
+  "SOLVER= FEM_EULER\n"
+  "MACH_NUMBER= 0.5\n"
+  "AOA= 10.0\n"
+  "FREESTREAM_PRESSURE= 101325.0\n"
+  "FREESTREAM_TEMPERATURE= 288.15\n"
+  "REF_DIMENSIONALIZATION= FREESTREAM_PRESS_EQ_ONE\n"
+  "MARKER_FAR= (x_minus, x_plus)\n"
+  "MARKER_EULER= (y_minus, y_plus)\n"
+  "MARKER_MONITORING= (y_minus)\n"
+  "NUM_METHOD_FEM_FLOW= DG\n"
+  "RIEMANN_SOLVER_FEM= ROE\n"
+  "QUADRATURE_FACTOR_STRAIGHT_FEM= 2.0\n"
+  "USE_LUMPED_MASSMATRIX_DGFEM= YES\n"
+  "MESH_FORMAT= SU2\n"
+  "MESH_FILENAME= " + meshName + "\n"
+  "OUTPUT_FILES= (RESTART)\n"
+  "OUTPUT_WRT_FREQ= 100000\n"
+  "RESTART_FILENAME= fem_dg_test_flow.dat\n"
+  "CONV_FILENAME= fem_dg_test_history\n";
+
+/*!
+ * \brief Gives access to the containers of the driver.
+ */
+struct TestDriver : CSinglezoneDriver {
+  explicit TestDriver(char* confFile) : CSinglezoneDriver(confFile, 1, MPI_COMM_WORLD) {}
+
+  CSolver* Flow() { return solver_container[ZONE_0][INST_0][MESH_0][FLOW_SOL]; }
+
+  CMeshFEM_DG* Mesh() { return static_cast<CMeshFEM_DG*>(geometry_container[ZONE_0][INST_0][MESH_0]); }
+};
+
+/*!
+ * \brief Run the solver with the given number of threads, return the solution of the owned DOFs
+ *        followed by the RMS residuals of the last iteration.
+ */
+std::vector<passivedouble> RunSolver(const std::string& options, int nThreads) {
+
+  std::ofstream(configName) << options;
+
+  std::vector<char> fileName(configName.begin(), configName.end());
+  fileName.push_back('\0');
+
+  const int maxThreads = omp_get_max_threads();
+  omp_set_num_threads(nThreads);
+
+  std::vector<passivedouble> result;
+  {
+    TestDriver driver(fileName.data());
+    driver.StartSolver();
+
+    const auto flow = driver.Flow();
+    const auto mesh = driver.Mesh();
+    const auto volElem = mesh->GetVolElem();
+    const auto nElemOwned = mesh->GetNVolElemOwned();
+    const auto nDOFsOwned = volElem[nElemOwned-1].offsetDOFsSolLocal + volElem[nElemOwned-1].nDOFsSol;
+
+    const su2double* sol = flow->GetVecSolDOFs();
+    for (auto i = 0ul; i < nDOFsOwned*flow->GetnVar(); ++i)
+      result.push_back(SU2_TYPE::GetValue(sol[i]));
+    for (auto iVar = 0u; iVar < flow->GetnVar(); ++iVar)
+      result.push_back(SU2_TYPE::GetValue(flow->GetRes_RMS(iVar)));
+
+    driver.Postprocessing();
+  }
+
+  omp_set_num_threads(maxThreads);
+  return result;
+}
+
+void CompareThreads(const std::string& options) {
+
+  auto orig_buf = cout.rdbuf();
+  cout.rdbuf(nullptr);
+
+  WriteChannelMesh(12, 4);
+
+  const auto serial = RunSolver(options, 1);
+  const auto threaded = RunSolver(options, 4);
+
+  cout.rdbuf(orig_buf);
+
+  std::remove(meshName.c_str());
+  std::remove(configName.c_str());
+  std::remove("fem_dg_test_flow.dat");
+  std::remove("fem_dg_test_history.csv");
+
+  /*--- The tasks are carried out in a different order, only the accumulation of the
+   *    contributions of different time levels may round differently. ---*/
+  REQUIRE(threaded.size() == serial.size());
+  for (auto i = 0ul; i < serial.size(); ++i) {
+    REQUIRE(std::isfinite(serial[i]));
+    CHECK(threaded[i] == Approx(serial[i]).epsilon(1e-12).margin(1e-14));
+  }
+}
+
+}
+
+TEST_CASE("FEM-DG residual with threads, Runge-Kutta", "[FEM_DG]") {
+
+  CompareThreads(baseOptions +
+    "CFL_NUMBER= 0.1\n"
+    "ITER= 5\n"
+    "TIME_DISCRE_FEM_FLOW= RUNGE-KUTTA_EXPLICIT\n"
+    "RK_ALPHA_COEFF= (0.666667, 0.666667, 1.0)\n");
+}
+
+TEST_CASE("FEM-DG residual with threads, ADER with local time stepping", "[FEM_DG]") {
+
+  CompareThreads(baseOptions +
+    "TIME_DOMAIN= YES\n"
+    "TIME_MARCHING= TIME_STEPPING\n"
+    "TIME_STEP= 1e-5\n"
+    "MAX_TIME= 1.0\n"
+    "UNST_CFL_NUMBER= 0.1\n"
+    "TIME_ITER= 4\n"
+    "TIME_DISCRE_FEM_FLOW= ADER_DG\n"
+    "TIME_DOFS_ADER_DG= 2\n"
+    "QUADRATURE_FACTOR_TIME_ADER_DG= 2.0\n"
+    "ADER_PREDICTOR= ADER_ALIASED_PREDICTOR\n"
+    "LEVELS_TIME_ACCURATE_LTS= 3\n");
+}
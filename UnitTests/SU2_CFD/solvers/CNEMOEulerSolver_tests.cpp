@@ -0,0 +1,263 @@
+/*!
+ * \file CNEMOEulerSolver_tests.cpp
+ * \brief Unit tests for the NEMO Euler solver.
+ * \author SU2 Developers
+ * \version 7.1.0 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "catch.hpp"
+#include "../../UnitQuadTestCase.hpp"
+#include "../../../SU2_CFD/include/solvers/CNEMOEulerSolver.hpp"
+#include "../../../SU2_CFD/include/numerics/NEMO/NEMO_sources.hpp"
+#include "../../../SU2_CFD/include/numerics/NEMO/convection/ausm.hpp"
+
+/*!
+ * \brief Thermal bath of dissociating N2 (strong chemistry and VT sources) on a small rectangle.
+ */
+struct NEMOThermalBath : UnitQuadTestCase {
+  std::vector<CNumerics*> numerics;
+
+  explicit NEMOThermalBath(const string& extraOptions = "", unsigned long nPointsPerSide = 5) :
+    UnitQuadTestCase(
+      "SOLVER= NEMO_EULER\n"
+      "GAS_MODEL= N2\n"
+      "GAS_COMPOSITION= (0.666667, 0.333333)\n"
+      "FLUID_MODEL= SU2_NONEQ\n"
+      "MACH_NUMBER= 0.0\n"
+      "FREESTREAM_PRESSURE= 101325.0\n"
+      "FREESTREAM_TEMPERATURE= 30000\n"
+      "FREESTREAM_TEMPERATURE_VE= 1000\n"
+      "MARKER_SYM= (x_minus, x_plus, y_minus, y_plus)\n"
+      "MESH_FORMAT= RECTANGLE\n"
+      "MESH_BOX_SIZE= " + to_string(nPointsPerSide) + "," + to_string(nPointsPerSide) + ",0\n"
+      "MESH_BOX_LENGTH= 1,1,0\n"
+      "MESH_BOX_OFFSET= 0,0,0\n"
+      "CONV_NUM_METHOD_FLOW= AUSM\n"
+      "TIME_DISCRE_FLOW= EULER_IMPLICIT\n" + extraOptions) {
+
+    InitConfig();
+    InitGeometry();
+    InitSolver();
+
+    /*--- One convective and one source numerics per thread, as set up by the driver. ---*/
+    const auto flow = solver[FLOW_SOL];
+    const auto nDim = geometry->GetnDim();
+    numerics.resize(MAX_TERMS*omp_get_max_threads(), nullptr);
+    for (auto iThread = 0; iThread < omp_get_max_threads(); ++iThread) {
+      numerics[CONV_TERM + iThread*MAX_TERMS] =
+        new CUpwAUSM_NEMO(nDim, flow->GetnVar(), flow->GetnPrimVar(), flow->GetnPrimVarGrad(), config.get());
+      numerics[SOURCE_FIRST_TERM + iThread*MAX_TERMS] =
+        new CSource_NEMO(nDim, flow->GetnVar(), flow->GetnPrimVar(), flow->GetnPrimVarGrad(), config.get());
+    }
+  }
+
+  ~NEMOThermalBath() {
+    for (auto num : numerics) delete num;
+  }
+
+  CNEMOEulerSolver* flow() { return static_cast<CNEMOEulerSolver*>(solver[FLOW_SOL]); }
+
+  /*!
+   * \brief Update the primitives and compute the residual and Jacobian of the sources.
+   */
+  void sourceResidual() {
+    flow()->SetPrimitive_Variables(solver, config.get(), false);
+    flow()->LinSysRes.SetValZero();
+    flow()->Jacobian.SetValZero();
+    flow()->Source_Residual(geometry.get(), solver, numerics.data(), config.get(), MESH_0);
+  }
+
+  /*!
+   * \brief Update the primitives and compute the convective and source residuals.
+   */
+  void residual() {
+    flow()->SetPrimitive_Variables(solver, config.get(), false);
+    flow()->LinSysRes.SetValZero();
+    flow()->Jacobian.SetValZero();
+    flow()->Upwind_Residual(geometry.get(), solver, numerics.data(), config.get(), MESH_0);
+    flow()->Source_Residual(geometry.get(), solver, numerics.data(), config.get(), MESH_0);
+  }
+};
+
+TEST_CASE("NEMO point-implicit source Jacobian", "[NEMO]") {
+  NEMOThermalBath bath("POINT_IMPLICIT_SOURCE= YES\n");
+
+  const auto nVar = bath.flow()->GetnVar();
+  auto nodes = bath.flow()->GetNodes();
+  const unsigned long iPoint = 12;
+
+  bath.sourceResidual();
+
+  vector<su2double> R0(nVar), block(nVar*nVar);
+  for (auto iVar = 0u; iVar < nVar; ++iVar) R0[iVar] = bath.flow()->LinSysRes(iPoint, iVar);
+  for (auto iVar = 0u; iVar < nVar; ++iVar)
+    for (auto jVar = 0u; jVar < nVar; ++jVar)
+      block[iVar*nVar+jVar] = bath.flow()->Jacobian.GetBlock(iPoint, iPoint, iVar, jVar);
+
+  /*--- Central differences of the assembled residual w.r.t. each conservative variable. ---*/
+  for (auto jVar = 0u; jVar < nVar; ++jVar) {
+    const su2double U0 = nodes->GetSolution(iPoint, jVar);
+    const su2double h = 1e-5 * max(fabs(U0), su2double(nodes->GetDensity(iPoint)));
+
+    vector<su2double> Rp(nVar), Rm(nVar);
+
+    nodes->SetSolution(iPoint, jVar, U0+h);
+    bath.sourceResidual();
+    for (auto iVar = 0u; iVar < nVar; ++iVar) Rp[iVar] = bath.flow()->LinSysRes(iPoint, iVar);
+
+    nodes->SetSolution(iPoint, jVar, U0-h);
+    bath.sourceResidual();
+    for (auto iVar = 0u; iVar < nVar; ++iVar) Rm[iVar] = bath.flow()->LinSysRes(iPoint, iVar);
+
+    nodes->SetSolution(iPoint, jVar, U0);
+
+    for (auto iVar = 0u; iVar < nVar; ++iVar) {
+      su2double scale = 0.0;
+      for (auto kVar = 0u; kVar < nVar; ++kVar) scale = max(scale, su2double(fabs(block[iVar*nVar+kVar])));
+
+      const su2double fd = (Rp[iVar]-Rm[iVar]) / (2*h);
+      CHECK(SU2_TYPE::GetValue(block[iVar*nVar+jVar]) ==
+            Approx(SU2_TYPE::GetValue(fd)).margin(SU2_TYPE::GetValue(1e-4*scale)).epsilon(1e-3));
+    }
+  }
+
+  /*--- The sources are not zero, the comparison is not trivial. ---*/
+  su2double norm = 0.0;
+  for (auto val : R0) norm += val*val;
+  CHECK(norm > 0.0);
+}
+
+TEST_CASE("NEMO residual serial vs threaded", "[NEMO]") {
+  /*--- Large enough for all threads to get work. ---*/
+  NEMOThermalBath bath("MUSCL_FLOW= NO\n", 33);
+
+  const auto nVar = bath.flow()->GetnVar();
+  const auto nSpecies = bath.config->GetnSpecies();
+  const auto nPoint = bath.geometry->GetnPoint();
+  auto nodes = bath.flow()->GetNodes();
+
+  /*--- Non-uniform velocity and composition so that all edge fluxes are active. ---*/
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+    const auto coord = bath.geometry->nodes->GetCoord(iPoint);
+    const su2double vel[] = {200*coord[0], -150*coord[1]};
+
+    su2double rho = 0.0;
+    for (auto iSpecies = 0u; iSpecies < nSpecies; ++iSpecies) {
+      const su2double rhos = nodes->GetSolution(iPoint, iSpecies) * (1 + 0.1*(iSpecies+1)*coord[0]*coord[1]);
+      nodes->SetSolution(iPoint, iSpecies, rhos);
+      rho += rhos;
+    }
+    su2double rhoE = nodes->GetSolution(iPoint, nSpecies+2);
+    for (auto iDim = 0u; iDim < 2; ++iDim) {
+      nodes->SetSolution(iPoint, nSpecies+iDim, rho*vel[iDim]);
+      rhoE += 0.5*rho*pow(vel[iDim], 2);
+    }
+    nodes->SetSolution(iPoint, nSpecies+2, rhoE);
+  }
+
+  const auto nThreads = omp_get_max_threads();
+
+  omp_set_num_threads(1);
+  bath.residual();
+  const auto serial = bath.flow()->LinSysRes;
+
+  omp_set_num_threads(nThreads);
+  bath.residual();
+  const auto& threaded = bath.flow()->LinSysRes;
+
+  su2double norm = 0.0;
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+    for (auto iVar = 0u; iVar < nVar; ++iVar) {
+      const auto ref = SU2_TYPE::GetValue(serial(iPoint, iVar));
+      CHECK(SU2_TYPE::GetValue(threaded(iPoint, iVar)) == Approx(ref).epsilon(1e-12));
+      norm += pow(serial(iPoint, iVar), 2);
+    }
+  }
+  CHECK(norm > 0.0);
+}
+
+TEST_CASE("NEMO batched vs per point temperatures", "[NEMO]") {
+  NEMOThermalBath bath("", 7);
+
+  const auto nSpecies = bath.config->GetnSpecies();
+  const auto nPoint = bath.geometry->GetnPoint();
+  const auto nPrimVar = bath.flow()->GetnPrimVar();
+  auto nodes = static_cast<CNEMOEulerVariable*>(bath.flow()->GetNodes());
+  auto gas = static_cast<CNEMOGas*>(bath.flow()->GetFluidModel());
+
+  /*--- States away from the free-stream and from equilibrium, including vib.-el. energies outside of the
+   *    range of the bisection (the first and last points) for which Tve falls back to T. ---*/
+  vector<su2double> rhos(nSpecies*nPoint), rhoE(nPoint), rhoEve(nPoint), rhoEvel(nPoint, 0.0);
+
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+    const auto coord = bath.geometry->nodes->GetCoord(iPoint);
+    const su2double factorEve = 0.2 + 4*coord[0];
+    const su2double factorE = 0.5 + coord[1];
+
+    for (auto iSpecies = 0u; iSpecies < nSpecies; ++iSpecies) {
+      const su2double rho_s = nodes->GetSolution(iPoint, iSpecies) * (1 + 0.3*(iSpecies+1)*coord[0]*coord[1]);
+      nodes->SetSolution(iPoint, iSpecies, rho_s);
+      rhos[iSpecies*nPoint+iPoint] = rho_s;
+    }
+    const su2double rhoEve0 = nodes->GetSolution(iPoint, nSpecies+3);
+    rhoEve[iPoint] = (iPoint == 0)? -rhoEve0 : ((iPoint == nPoint-1)? 1e6*rhoEve0 : factorEve*rhoEve0);
+    rhoE[iPoint] = rhoEve[iPoint] + factorE*(nodes->GetSolution(iPoint, nSpecies+2) - rhoEve0);
+
+    nodes->SetSolution(iPoint, nSpecies+2, rhoE[iPoint]);
+    nodes->SetSolution(iPoint, nSpecies+3, rhoEve[iPoint]);
+  }
+  nodes->Set_OldSolution();
+
+  SECTION("Gas model") {
+    vector<su2double> T(nPoint), Tve(nPoint);
+    gas->ComputeBatchTemperatures(nPoint, rhos.data(), rhoE.data(), rhoEve.data(), rhoEvel.data(), T.data(), Tve.data());
+
+    unsigned long nFallback = 0;
+    vector<su2double> pointRhos(nSpecies);
+    for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+      for (auto iSpecies = 0u; iSpecies < nSpecies; ++iSpecies) pointRhos[iSpecies] = rhos[iSpecies*nPoint+iPoint];
+      const auto& ref = gas->ComputeTemperatures(pointRhos, rhoE[iPoint], rhoEve[iPoint], rhoEvel[iPoint]);
+
+      CHECK(SU2_TYPE::GetValue(T[iPoint]) == Approx(SU2_TYPE::GetValue(ref[0])).epsilon(1e-12));
+      CHECK(SU2_TYPE::GetValue(Tve[iPoint]) == Approx(SU2_TYPE::GetValue(ref[1])).epsilon(1e-12));
+      nFallback += (Tve[iPoint] == T[iPoint]);
+    }
+    CHECK(nFallback >= 2);
+    CHECK(nFallback < nPoint/2);
+  }
+
+  SECTION("Primitive variables") {
+    const auto nonPhysBatch = nodes->SetPrimVar(0ul, nPoint, gas);
+    const auto batch = nodes->GetPrimitive();
+
+    unsigned long nonPhys = 0;
+    for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) nonPhys += nodes->SetPrimVar(iPoint, gas);
+
+    CHECK(nonPhysBatch == nonPhys);
+    for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint)
+      for (auto iVar = 0u; iVar < nPrimVar; ++iVar)
+        CHECK(SU2_TYPE::GetValue(nodes->GetPrimitive(iPoint, iVar)) ==
+              Approx(SU2_TYPE::GetValue(batch(iPoint, iVar))).epsilon(1e-12));
+  }
+}
@@ -55,6 +55,12 @@ struct UnitQuadTestCase {
   streambuf* orig_buf{nullptr};
   UnitQuadTestCase() : orig_buf(cout.rdbuf()) {}
 
+  /*!
+   * \brief Construct with other base options, e.g. another mesh or solver.
+   * \param[in] options - String containing the base option(s)
+   */
+  explicit UnitQuadTestCase(std::string options) : config_options(std::move(options)), orig_buf(cout.rdbuf()) {}
+
   /*!
    * \brief Add a line to the base config string stream
    * \param[in] optionLine - String containing the option(s)